@@ -0,0 +1,162 @@
+//# SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+//# SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "rv/tracking/CTRVModel.hpp"
+#include "rv/tracking/MultiModelKalmanEstimator.hpp"
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+namespace benchmark {
+
+/**
+ * @brief Microbenchmarks for the estimator building blocks
+ *
+ * The end-to-end tracking benchmarks only show a regression in the filters
+ * once it is large enough to move whole frame times; these isolate the UKF
+ * predict/correct steps, the IMM mixing stage and estimator initialization so
+ * per-component regressions show up directly. The target builds with
+ * -fno-access-control, which is what lets the mixing benchmark call the
+ * estimator's private stages.
+ */
+
+static TrackedObject makeBenchmarkObject() {
+    TrackedObject object;
+    object.x = 1.0;
+    object.y = 2.0;
+    object.vx = 2.0;
+    object.vy = 1.5;
+    object.yaw = 0.5;
+    object.length = 2.0;
+    object.width = 1.0;
+    object.height = 2.0;
+    return object;
+}
+
+static cv::Ptr<cv::detail::tracking::UnscentedKalmanFilterMod> makeCtrvFilter(const TrackedObject& object) {
+    const int stateSize = TrackedObject::StateSize;
+    const int measurementSize = TrackedObject::MeasurementSize;
+
+    auto model = cv::makePtr<CTRVModel>();
+    cv::detail::tracking::UnscentedKalmanFilterParams params(stateSize, measurementSize, 1, 0, 0, model);
+    params.stateInit = object.stateVector().clone();
+    params.errorCovInit = cv::Mat::eye(stateSize, stateSize, CV_64F);
+    params.measurementNoiseCov = cv::Mat::eye(measurementSize, measurementSize, CV_64F) * 1e-2;
+    params.processNoiseCov = cv::Mat::eye(stateSize, stateSize, CV_64F) * 1e-3;
+    params.alpha = 1.0;
+    params.beta = 2.0;
+    params.k = 3.0 - stateSize;
+    return cv::detail::tracking::createUnscentedKalmanFilterMod(params);
+}
+
+/**
+ * @brief UKF prediction step for the CTRV model (the model the IMM runs
+ * through the unscented filter)
+ */
+static void BM_UkfPredict(::benchmark::State& state) {
+    auto object = makeBenchmarkObject();
+    auto filter = makeCtrvFilter(object);
+
+    const double deltaT = 0.1;
+    cv::Mat deltaTVector = cv::Mat(1, 1, CV_64F, cv::Scalar(deltaT));
+
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(filter->predict(deltaTVector));
+    }
+}
+BENCHMARK(BM_UkfPredict);
+
+/**
+ * @brief UKF correction step for the CTRV model
+ *
+ * Each correction needs a fresh prediction; the predict runs outside the
+ * timed region so only correct() is measured.
+ */
+static void BM_UkfCorrect(::benchmark::State& state) {
+    auto object = makeBenchmarkObject();
+    auto filter = makeCtrvFilter(object);
+
+    const double deltaT = 0.1;
+    cv::Mat deltaTVector = cv::Mat(1, 1, CV_64F, cv::Scalar(deltaT));
+    cv::Mat measurement = object.measurementVector().clone();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        filter->predict(deltaTVector);
+        state.ResumeTiming();
+        ::benchmark::DoNotOptimize(filter->correct(measurement));
+    }
+}
+BENCHMARK(BM_UkfCorrect);
+
+/**
+ * @brief IMM mixing stage: conditional probability plus model interaction
+ *
+ * This is the per-track overhead the multi-model setup adds on top of the
+ * individual filters, run once per prediction.
+ */
+static void BM_ImmMixing(::benchmark::State& state) {
+    auto object = makeBenchmarkObject();
+    auto timestamp = std::chrono::system_clock::now();
+
+    MultiModelKalmanEstimator estimator;
+    estimator.initialize(object, timestamp, 1e-4, 1e-2, 1.0,
+                         {MotionModel::CV, MotionModel::CA, MotionModel::CP, MotionModel::CTRV});
+    estimator.track(object, timestamp + std::chrono::milliseconds(100));
+
+    const std::size_t numberOfModels = estimator.modelCount();
+    std::vector<cv::Mat> states;
+    std::vector<cv::Mat> covariances;
+    for (std::size_t j = 0; j < numberOfModels; ++j) {
+        states.push_back(estimator.currentStates()[j].stateVector());
+        covariances.push_back(estimator.getKalmanFilterErrorCovariance(j));
+    }
+    cv::Mat transitionProbability = estimator.getTransitionProbability();
+    cv::Mat modelProbability = estimator.getModelProbability();
+    cv::Mat conditionalProbability;
+    std::vector<cv::Mat> covarianceEstimates(numberOfModels);
+    std::vector<cv::Mat> stateEstimates(numberOfModels);
+
+    for (auto _ : state) {
+        MultiModelKalmanEstimator::combiningProbability(transitionProbability, modelProbability,
+                                                        conditionalProbability);
+        MultiModelKalmanEstimator::interaction(states, covariances, conditionalProbability, covarianceEstimates,
+                                               stateEstimates);
+        ::benchmark::DoNotOptimize(stateEstimates.data());
+    }
+}
+BENCHMARK(BM_ImmMixing);
+
+/**
+ * @brief Estimator initialization per motion model
+ *
+ * Initialization happens on every new track, so detection churn makes this a
+ * hot path. Re-initializing with an unchanged model set exercises the pooled
+ * re-arm path, the one that actually runs per new track; the argument selects
+ * the model so each model's cost is visible individually.
+ */
+static void BM_EstimatorInitialize(::benchmark::State& state) {
+    static const std::vector<std::pair<MotionModel, std::string>> models = {
+        {MotionModel::CV, "CV"}, {MotionModel::CA, "CA"}, {MotionModel::CP, "CP"}, {MotionModel::CTRV, "CTRV"}};
+    const auto& model = models[static_cast<std::size_t>(state.range(0))];
+
+    auto object = makeBenchmarkObject();
+    auto timestamp = std::chrono::system_clock::now();
+    MultiModelKalmanEstimator estimator;
+
+    for (auto _ : state) {
+        estimator.initialize(object, timestamp, 1e-4, 1e-2, 1.0, {model.first});
+        ::benchmark::DoNotOptimize(estimator.currentState().x);
+    }
+    state.SetLabel(model.second);
+}
+BENCHMARK(BM_EstimatorInitialize)->DenseRange(0, 3);
+
+} // namespace benchmark
+} // namespace tracking
+} // namespace rv
@@ -7,11 +7,13 @@
 #include <chrono>
 #include <memory>
 #include <cmath>
+#include <string>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+#include "rv/tracking/FrameStats.hpp"
 #include "rv/tracking/MultipleObjectTracker.hpp"
 #include "rv/tracking/TrackedObject.hpp"
 #include "rv/tracking/ObjectMatching.hpp"
@@ -76,8 +78,7 @@ public:
         person.predictedMeasurementMean.at<double>(6, 0) = person.yaw;
         
         // Higher uncertainty for people (more erratic movement than vehicles)
-        person.predictedMeasurementCov = cv::Mat::eye(7, 7, CV_64F) * 0.2;
-        cv::invert(person.predictedMeasurementCov, person.predictedMeasurementCovInv);
+        person.setPredictedMeasurementCov(cv::Mat::eye(7, 7, CV_64F) * 0.2);
         person.errorCovariance = cv::Mat::eye(7, 7, CV_64F) * 0.1;
         
         return person;
@@ -175,6 +176,236 @@ static void BM_Tracking50MovingPeople(::benchmark::State& state) {
 }
 BENCHMARK(BM_Tracking50MovingPeople)->Unit(::benchmark::kMillisecond);
 
+/**
+ * @brief Merge one measurement window into an aggregate across tracker resets
+ */
+static void accumulateFrameStats(FrameStats& total, const FrameStats& window) {
+    for (std::size_t i = 0; i < total.stages.size(); ++i) {
+        auto& into = total.stages[i];
+        const auto& from = window.stages[i];
+        if (from.count == 0) {
+            continue;
+        }
+        if (into.count == 0 || from.minMicroseconds < into.minMicroseconds) {
+            into.minMicroseconds = from.minMicroseconds;
+        }
+        if (from.maxMicroseconds > into.maxMicroseconds) {
+            into.maxMicroseconds = from.maxMicroseconds;
+        }
+        into.count += from.count;
+        into.totalMicroseconds += from.totalMicroseconds;
+        for (std::size_t bucket = 0; bucket < StageStats::kHistogramBuckets; ++bucket) {
+            into.histogram[bucket] += from.histogram[bucket];
+        }
+    }
+}
+
+/**
+ * @brief Report the per-stage breakdown as benchmark counters (average microseconds)
+ */
+static void reportStageBreakdown(::benchmark::State& state, const FrameStats& stats) {
+    for (std::size_t i = 0; i < stats.stages.size(); ++i) {
+        auto name = std::string(trackingStageName(static_cast<TrackingStage>(i))) + "_avg_us";
+        state.counters[name] = stats.stages[i].averageMicroseconds();
+    }
+}
+
+/**
+ * @brief Scaling benchmark over the track-count axis, single camera
+ */
+static void BM_TrackingScaling(::benchmark::State& state) {
+    PeopleTrackingBenchmarkFixture fixture;
+    auto tracker = fixture.createPeopleTracker();
+
+    const size_t numPeople = static_cast<size_t>(state.range(0));
+    auto timestamp = fixture.getTimestamp();
+
+    const double frameTime = 0.033;
+    int frameCount = 0;
+    FrameStats aggregateStats;
+
+    for (auto _ : state) {
+        auto currentPeople = fixture.generateMovingPeopleScenario(numPeople, frameCount * frameTime);
+        tracker->track(std::move(currentPeople), timestamp, 0.7);
+
+        frameCount++;
+        timestamp = fixture.getTimestamp(frameCount);
+
+        if (frameCount >= 100) {
+            frameCount = 0;
+            accumulateFrameStats(aggregateStats, tracker->getFrameStats());
+            tracker = fixture.createPeopleTracker();
+        }
+    }
+
+    accumulateFrameStats(aggregateStats, tracker->getFrameStats());
+    state.SetItemsProcessed(state.iterations() * numPeople);
+    reportStageBreakdown(state, aggregateStats);
+}
+BENCHMARK(BM_TrackingScaling)
+    ->Arg(50)->Arg(200)->Arg(1000)->Arg(5000)
+    ->Unit(::benchmark::kMillisecond);
+
+/**
+ * @brief Scaling benchmark over the camera-count axis via the objectsPerCamera overload
+ *
+ * The per-frame population is split round-robin across the cameras, so each
+ * camera sees a disjoint subset and the batched multi-camera association path
+ * does the cross-camera merging.
+ */
+static void BM_TrackingMultiCamera(::benchmark::State& state) {
+    PeopleTrackingBenchmarkFixture fixture;
+    auto tracker = fixture.createPeopleTracker();
+
+    const size_t numPeople = static_cast<size_t>(state.range(0));
+    const size_t numCameras = static_cast<size_t>(state.range(1));
+    auto timestamp = fixture.getTimestamp();
+
+    const double frameTime = 0.033;
+    int frameCount = 0;
+    FrameStats aggregateStats;
+
+    for (auto _ : state) {
+        auto currentPeople = fixture.generateMovingPeopleScenario(numPeople, frameCount * frameTime);
+
+        std::vector<std::vector<TrackedObject>> objectsPerCamera(numCameras);
+        for (auto& cameraObjects : objectsPerCamera) {
+            cameraObjects.reserve(numPeople / numCameras + 1);
+        }
+        for (size_t i = 0; i < currentPeople.size(); ++i) {
+            objectsPerCamera[i % numCameras].push_back(std::move(currentPeople[i]));
+        }
+
+        tracker->track(std::move(objectsPerCamera), timestamp, 0.7);
+
+        frameCount++;
+        timestamp = fixture.getTimestamp(frameCount);
+
+        if (frameCount >= 100) {
+            frameCount = 0;
+            accumulateFrameStats(aggregateStats, tracker->getFrameStats());
+            tracker = fixture.createPeopleTracker();
+        }
+    }
+
+    accumulateFrameStats(aggregateStats, tracker->getFrameStats());
+    state.SetItemsProcessed(state.iterations() * numPeople);
+    reportStageBreakdown(state, aggregateStats);
+}
+BENCHMARK(BM_TrackingMultiCamera)
+    ->ArgsProduct({{50, 200, 1000, 5000}, {1, 8, 40}})
+    ->Unit(::benchmark::kMillisecond);
+
+/**
+ * @brief Association cost across the four supported distance types
+ */
+static void BM_TrackingDistanceTypes(::benchmark::State& state) {
+    static const DistanceType distanceTypes[] = {
+        DistanceType::MultiClassEuclidean,
+        DistanceType::Euclidean,
+        DistanceType::Mahalanobis,
+        DistanceType::MCEMahalanobis,
+    };
+    static const char* distanceTypeNames[] = {
+        "MultiClassEuclidean", "Euclidean", "Mahalanobis", "MCEMahalanobis",
+    };
+
+    PeopleTrackingBenchmarkFixture fixture;
+    auto tracker = fixture.createPeopleTracker();
+
+    const auto distanceType = distanceTypes[state.range(0)];
+    const size_t numPeople = static_cast<size_t>(state.range(1));
+    const double distanceThreshold = 5.0;
+    auto timestamp = fixture.getTimestamp();
+
+    const double frameTime = 0.033;
+    int frameCount = 0;
+    FrameStats aggregateStats;
+
+    for (auto _ : state) {
+        auto currentPeople = fixture.generateMovingPeopleScenario(numPeople, frameCount * frameTime);
+        tracker->track(std::move(currentPeople), timestamp, distanceType, distanceThreshold, 0.7);
+
+        frameCount++;
+        timestamp = fixture.getTimestamp(frameCount);
+
+        if (frameCount >= 100) {
+            frameCount = 0;
+            accumulateFrameStats(aggregateStats, tracker->getFrameStats());
+            tracker = fixture.createPeopleTracker();
+        }
+    }
+
+    accumulateFrameStats(aggregateStats, tracker->getFrameStats());
+    state.SetItemsProcessed(state.iterations() * numPeople);
+    state.SetLabel(distanceTypeNames[state.range(0)]);
+    reportStageBreakdown(state, aggregateStats);
+}
+BENCHMARK(BM_TrackingDistanceTypes)
+    ->ArgsProduct({{0, 1, 2, 3}, {200, 1000}})
+    ->Unit(::benchmark::kMillisecond);
+
+/**
+ * @brief Occlusion and churn benchmark
+ *
+ * Per frame a configurable share of the population (in per-mille) is replaced
+ * by fresh people at new positions, forcing track deletions and creations, and
+ * a fixed 10% of detections is withheld to simulate occlusions, forcing tracks
+ * through the suspended state. This keeps the create/suspend/delete machinery
+ * hot instead of measuring only the steady state.
+ */
+static void BM_TrackingOcclusionChurn(::benchmark::State& state) {
+    PeopleTrackingBenchmarkFixture fixture;
+    auto tracker = fixture.createPeopleTracker();
+
+    const size_t numPeople = static_cast<size_t>(state.range(0));
+    const double churnRate = static_cast<double>(state.range(1)) / 1000.0;
+    const double occlusionRate = 0.10;
+
+    std::mt19937 churnGen(1234);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    auto population = fixture.generateMovingPeopleScenario(numPeople);
+    Id nextId = static_cast<Id>(numPeople + 1);
+
+    auto timestamp = fixture.getTimestamp();
+    const double frameTime = 0.033;
+    int frameCount = 0;
+    FrameStats aggregateStats;
+
+    for (auto _ : state) {
+        std::vector<TrackedObject> detections;
+        detections.reserve(numPeople);
+
+        for (auto& person : population) {
+            // Leavers are replaced with fresh arrivals at new positions
+            if (uniform(churnGen) < churnRate) {
+                person = fixture.generateRandomPerson(nextId++);
+            } else {
+                person.x += person.vx * frameTime;
+                person.y += person.vy * frameTime;
+            }
+
+            // Occluded people produce no detection this frame
+            if (uniform(churnGen) >= occlusionRate) {
+                detections.push_back(person);
+            }
+        }
+
+        tracker->track(std::move(detections), timestamp, 0.7);
+
+        frameCount++;
+        timestamp = fixture.getTimestamp(frameCount);
+    }
+
+    accumulateFrameStats(aggregateStats, tracker->getFrameStats());
+    state.SetItemsProcessed(state.iterations() * numPeople);
+    reportStageBreakdown(state, aggregateStats);
+}
+BENCHMARK(BM_TrackingOcclusionChurn)
+    ->ArgsProduct({{200, 1000}, {10, 50, 200}})
+    ->Unit(::benchmark::kMillisecond);
+
 } // namespace benchmark
 } // namespace tracking
 } // namespace rv
@@ -0,0 +1,252 @@
+//# SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+//# SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+namespace benchmark {
+
+/**
+ * @brief Binary scene-recording format for detection streams (.rvsr)
+ *
+ * Layout (little-endian, every field 8-byte aligned):
+ *
+ *   Header   : magic "RVSR", u32 version, u64 frameCount, u32 classCount, u32 reserved
+ *   Offsets  : u64 frameOffsets[frameCount], byte offsets from the file start
+ *   Frame    : i64 timestampMicroseconds, u64 objectCount, then SoA arrays of
+ *              length objectCount each: i64 groundTruthIds[], double x[], y[],
+ *              z[], vx[], vy[], length[], width[], height[], yaw[], and
+ *              object-major double classification[objectCount * classCount]
+ *
+ * The offset table makes random frame access O(1) over a plain mmap; the SoA
+ * arrays mean a reader touches only the fields it needs. Ground-truth ids are
+ * carried for quality metrics and are not fed to the tracker.
+ */
+
+constexpr uint32_t kSceneRecordingMagic = 0x52535652; // "RVSR"
+constexpr uint32_t kSceneRecordingVersion = 1;
+
+struct SceneRecordingHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t frameCount;
+    uint32_t classCount;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(SceneRecordingHeader) == 24, "header layout must be stable across builds");
+
+/**
+ * @brief One decoded frame: ground-truth ids alongside tracker-ready detections
+ */
+struct SceneFrame {
+    std::chrono::system_clock::time_point timestamp;
+    std::vector<int64_t> groundTruthIds;
+    std::vector<TrackedObject> detections;
+};
+
+/**
+ * @brief Read-only mmap view over a scene recording
+ */
+class SceneRecordingReader {
+public:
+    explicit SceneRecordingReader(const std::string &path) {
+        mFd = ::open(path.c_str(), O_RDONLY);
+        if (mFd < 0) {
+            throw std::runtime_error("cannot open scene recording: " + path);
+        }
+        struct stat fileInfo;
+        if (::fstat(mFd, &fileInfo) != 0) {
+            ::close(mFd);
+            throw std::runtime_error("cannot stat scene recording: " + path);
+        }
+        mSize = static_cast<size_t>(fileInfo.st_size);
+        mData = static_cast<const uint8_t *>(::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, mFd, 0));
+        if (mData == MAP_FAILED) {
+            ::close(mFd);
+            throw std::runtime_error("cannot mmap scene recording: " + path);
+        }
+
+        if (mSize < sizeof(SceneRecordingHeader)) {
+            throw std::runtime_error("scene recording truncated: " + path);
+        }
+        std::memcpy(&mHeader, mData, sizeof(mHeader));
+        if (mHeader.magic != kSceneRecordingMagic || mHeader.version != kSceneRecordingVersion) {
+            throw std::runtime_error("not a scene recording (bad magic/version): " + path);
+        }
+        mFrameOffsets = reinterpret_cast<const uint64_t *>(mData + sizeof(SceneRecordingHeader));
+    }
+
+    ~SceneRecordingReader() {
+        if (mData != nullptr && mData != MAP_FAILED) {
+            ::munmap(const_cast<uint8_t *>(mData), mSize);
+        }
+        if (mFd >= 0) {
+            ::close(mFd);
+        }
+    }
+
+    SceneRecordingReader(const SceneRecordingReader &) = delete;
+    SceneRecordingReader &operator=(const SceneRecordingReader &) = delete;
+
+    size_t frameCount() const {
+        return mHeader.frameCount;
+    }
+
+    uint32_t classCount() const {
+        return mHeader.classCount;
+    }
+
+    /**
+     * @brief Decode one frame into tracker-ready detections
+     */
+    SceneFrame readFrame(size_t frameIndex) const {
+        const uint8_t *cursor = mData + mFrameOffsets[frameIndex];
+
+        int64_t timestampMicroseconds;
+        std::memcpy(&timestampMicroseconds, cursor, sizeof(timestampMicroseconds));
+        cursor += sizeof(timestampMicroseconds);
+        uint64_t objectCount;
+        std::memcpy(&objectCount, cursor, sizeof(objectCount));
+        cursor += sizeof(objectCount);
+
+        SceneFrame frame;
+        frame.timestamp = std::chrono::system_clock::time_point(std::chrono::microseconds(timestampMicroseconds));
+        frame.groundTruthIds.resize(objectCount);
+        std::memcpy(frame.groundTruthIds.data(), cursor, objectCount * sizeof(int64_t));
+        cursor += objectCount * sizeof(int64_t);
+
+        auto column = [&cursor, objectCount](size_t fieldIndex) {
+            return reinterpret_cast<const double *>(cursor) + fieldIndex * objectCount;
+        };
+
+        frame.detections.resize(objectCount);
+        for (size_t i = 0; i < objectCount; ++i) {
+            auto &object = frame.detections[i];
+            object.x = column(0)[i];
+            object.y = column(1)[i];
+            object.z = column(2)[i];
+            object.vx = column(3)[i];
+            object.vy = column(4)[i];
+            object.length = column(5)[i];
+            object.width = column(6)[i];
+            object.height = column(7)[i];
+            object.yaw = column(8)[i];
+            object.previousYaw = object.yaw;
+        }
+
+        const double *classification = column(9);
+        for (size_t i = 0; i < objectCount; ++i) {
+            auto &object = frame.detections[i];
+            object.classification = Eigen::VectorXd::Zero(mHeader.classCount);
+            for (uint32_t c = 0; c < mHeader.classCount; ++c) {
+                object.classification[c] = classification[i * mHeader.classCount + c];
+            }
+        }
+
+        return frame;
+    }
+
+private:
+    int mFd{-1};
+    size_t mSize{0};
+    const uint8_t *mData{nullptr};
+    SceneRecordingHeader mHeader{};
+    const uint64_t *mFrameOffsets{nullptr};
+};
+
+/**
+ * @brief Streaming writer producing the mmap layout above
+ */
+class SceneRecordingWriter {
+public:
+    SceneRecordingWriter(uint32_t classCount)
+        : mClassCount(classCount) {
+    }
+
+    void appendFrame(const SceneFrame &frame) {
+        std::vector<uint8_t> bytes;
+        const uint64_t objectCount = frame.detections.size();
+        bytes.reserve(16 + objectCount * (sizeof(int64_t) + (9 + mClassCount) * sizeof(double)));
+
+        auto append = [&bytes](const void *data, size_t size) {
+            const auto *raw = static_cast<const uint8_t *>(data);
+            bytes.insert(bytes.end(), raw, raw + size);
+        };
+
+        const int64_t timestampMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+            frame.timestamp.time_since_epoch()).count();
+        append(&timestampMicroseconds, sizeof(timestampMicroseconds));
+        append(&objectCount, sizeof(objectCount));
+        append(frame.groundTruthIds.data(), objectCount * sizeof(int64_t));
+
+        auto appendColumn = [&](auto field) {
+            for (const auto &object : frame.detections) {
+                const double value = field(object);
+                append(&value, sizeof(value));
+            }
+        };
+        appendColumn([](const TrackedObject &o) { return o.x; });
+        appendColumn([](const TrackedObject &o) { return o.y; });
+        appendColumn([](const TrackedObject &o) { return o.z; });
+        appendColumn([](const TrackedObject &o) { return o.vx; });
+        appendColumn([](const TrackedObject &o) { return o.vy; });
+        appendColumn([](const TrackedObject &o) { return o.length; });
+        appendColumn([](const TrackedObject &o) { return o.width; });
+        appendColumn([](const TrackedObject &o) { return o.height; });
+        appendColumn([](const TrackedObject &o) { return o.yaw; });
+
+        for (const auto &object : frame.detections) {
+            for (uint32_t c = 0; c < mClassCount; ++c) {
+                const double value = c < object.classification.size() ? object.classification[c] : 0.;
+                append(&value, sizeof(value));
+            }
+        }
+
+        mFrames.push_back(std::move(bytes));
+    }
+
+    void write(const std::string &path) const {
+        FILE *file = ::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            throw std::runtime_error("cannot write scene recording: " + path);
+        }
+
+        SceneRecordingHeader header{kSceneRecordingMagic, kSceneRecordingVersion, mFrames.size(), mClassCount, 0};
+        ::fwrite(&header, sizeof(header), 1, file);
+
+        uint64_t offset = sizeof(header) + mFrames.size() * sizeof(uint64_t);
+        for (const auto &frame : mFrames) {
+            ::fwrite(&offset, sizeof(offset), 1, file);
+            offset += frame.size();
+        }
+        for (const auto &frame : mFrames) {
+            ::fwrite(frame.data(), 1, frame.size(), file);
+        }
+        ::fclose(file);
+    }
+
+private:
+    uint32_t mClassCount;
+    std::vector<std::vector<uint8_t>> mFrames;
+};
+
+} // namespace benchmark
+} // namespace tracking
+} // namespace rv
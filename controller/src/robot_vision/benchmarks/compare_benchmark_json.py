@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""Diff two Google Benchmark JSON outputs and flag deltas beyond a threshold.
+
+Unlike compare_benchmarks.sh this needs no network access and no extra
+dependencies, so it can gate a controller upgrade from CI or an air-gapped
+deployment host:
+
+    ./run_benchmark.sh --json                 # on the baseline build
+    ./run_benchmark.sh --json                 # on the candidate build
+    ./compare_benchmark_json.py baseline.json candidate.json --threshold 5
+
+The exit code is non-zero when any benchmark regressed by more than the
+threshold, so the script can be used directly as a CI gate.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    """Map benchmark name to its time in nanoseconds.
+
+    With --benchmark_repetitions the file carries per-repetition entries plus
+    aggregates; the median aggregate is preferred as it is robust against a
+    single noisy repetition. Without repetitions the plain iteration entries
+    are used as-is.
+    """
+    with open(path) as f:
+        data = json.load(f)
+
+    unit_in_ns = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    results = {}
+    for entry in data.get("benchmarks", []):
+        run_type = entry.get("run_type", "iteration")
+        if run_type == "aggregate":
+            if entry.get("aggregate_name") != "median":
+                continue
+            name = entry["run_name"]
+        elif run_type == "iteration":
+            name = entry["name"]
+        else:
+            continue
+        scale = unit_in_ns.get(entry.get("time_unit", "ns"), 1.0)
+        # keep the first (or aggregate) entry per name; aggregates overwrite
+        # the per-repetition entries they summarize
+        if name not in results or run_type == "aggregate":
+            results[name] = entry["real_time"] * scale
+    return results
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return "%.3f %s" % (nanoseconds / scale, unit)
+    return "%.0f ns" % nanoseconds
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="benchmark JSON from the baseline build")
+    parser.add_argument("contender", help="benchmark JSON from the candidate build")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="flag deltas beyond this percentage (default: 5)")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    contender = load_results(args.contender)
+
+    common = sorted(set(baseline) & set(contender))
+    if not common:
+        print("error: the two files share no benchmark names", file=sys.stderr)
+        return 2
+
+    name_width = max(len(name) for name in common)
+    print("%-*s  %12s  %12s  %9s" % (name_width, "benchmark", "baseline", "contender", "delta"))
+
+    regressions = []
+    improvements = []
+    for name in common:
+        old, new = baseline[name], contender[name]
+        delta = (new - old) / old * 100.0 if old > 0 else 0.0
+        flag = ""
+        if delta > args.threshold:
+            flag = "  REGRESSED"
+            regressions.append(name)
+        elif delta < -args.threshold:
+            flag = "  improved"
+            improvements.append(name)
+        print("%-*s  %12s  %12s  %+8.1f%%%s"
+              % (name_width, name, format_time(old), format_time(new), delta, flag))
+
+    for name in sorted(set(baseline) - set(contender)):
+        print("%-*s  only in baseline" % (name_width, name))
+    for name in sorted(set(contender) - set(baseline)):
+        print("%-*s  only in contender" % (name_width, name))
+
+    print("\n%d compared, %d regressed, %d improved (threshold %.1f%%)"
+          % (len(common), len(regressions), len(improvements), args.threshold))
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace rv {
+
+/**
+ * @brief NumaTopology: the machine's NUMA nodes and the CPUs on each node
+ *
+ * Read once from sysfs, without a libnuma dependency. On single-socket
+ * machines, on non-Linux platforms or when sysfs is unavailable the topology
+ * collapses to one node holding every CPU, so callers can treat the
+ * single-node case uniformly.
+ */
+struct NumaTopology
+{
+  /// CPU ids per node, indexed by node; never empty after detect()
+  std::vector<std::vector<int>> mNodeCpus;
+
+  std::size_t nodeCount() const
+  {
+    return mNodeCpus.size();
+  }
+
+  static NumaTopology detect()
+  {
+    NumaTopology topology;
+#if defined(__linux__)
+    for (int node = 0;; ++node)
+    {
+      std::ifstream cpuListFile("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+      if (!cpuListFile.is_open())
+      {
+        break;
+      }
+      std::string cpuList;
+      std::getline(cpuListFile, cpuList);
+      auto cpus = parseCpuList(cpuList);
+      if (!cpus.empty())
+      {
+        topology.mNodeCpus.push_back(std::move(cpus));
+      }
+    }
+#endif
+    if (topology.mNodeCpus.empty())
+    {
+      // no NUMA information: one node with every hardware thread
+      std::vector<int> allCpus;
+      auto const cpuCount = std::max(1u, std::thread::hardware_concurrency());
+      for (unsigned int cpu = 0; cpu < cpuCount; ++cpu)
+      {
+        allCpus.push_back(static_cast<int>(cpu));
+      }
+      topology.mNodeCpus.push_back(std::move(allCpus));
+    }
+    return topology;
+  }
+
+  /// Parse a sysfs cpulist such as "0-15,32-47" into the individual CPU ids
+  static std::vector<int> parseCpuList(const std::string &cpuList)
+  {
+    std::vector<int> cpus;
+    std::size_t position = 0;
+    while (position < cpuList.size())
+    {
+      auto const separator = cpuList.find(',', position);
+      auto const token
+        = cpuList.substr(position, separator == std::string::npos ? std::string::npos : separator - position);
+      try
+      {
+        auto const dash = token.find('-');
+        if (dash == std::string::npos)
+        {
+          cpus.push_back(std::stoi(token));
+        }
+        else
+        {
+          auto const first = std::stoi(token.substr(0, dash));
+          auto const last = std::stoi(token.substr(dash + 1));
+          for (int cpu = first; cpu <= last; ++cpu)
+          {
+            cpus.push_back(cpu);
+          }
+        }
+      }
+      catch (const std::exception &)
+      {
+        // malformed token: skip it rather than fail topology detection
+      }
+      if (separator == std::string::npos)
+      {
+        break;
+      }
+      position = separator + 1;
+    }
+    return cpus;
+  }
+};
+
+} // namespace rv
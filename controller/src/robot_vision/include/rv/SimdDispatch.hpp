@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+/**
+ * @brief Runtime CPU dispatch for hot loop kernels
+ *
+ * RV_TARGET_CLONES makes the compiler emit one body per listed ISA level plus
+ * the baseline; the loader's ifunc resolver selects the best supported one via
+ * cpuid, so a single build of the library uses AVX-512 servers and AVX2-only
+ * edge machines fully. Annotated functions are called through the resolver and
+ * can never be inlined — keep the annotation on standalone loop kernels, not
+ * on small helpers. Compilers or architectures without the attribute fall back
+ * to a single baseline body.
+ */
+#if defined(__x86_64__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define RV_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#endif
+#endif
+
+#ifndef RV_TARGET_CLONES
+#define RV_TARGET_CLONES
+#endif
@@ -0,0 +1,340 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <rv/NumaTopology.hpp>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace rv {
+
+/**
+ * @brief WorkerPool: persistent worker threads shared by the tracking stages
+ *
+ * The per-frame loops (predict, correct, per-camera match, cost-matrix fill)
+ * used to open independent omp parallel regions each frame. This pool keeps
+ * its threads alive across frames and hands out loop ranges in chunks that
+ * idle workers claim with an atomic cursor, so load balances like a
+ * work-stealing scheduler without per-frame thread startup.
+ *
+ * parallelFor called from inside a worker runs the loop inline, so nested
+ * parallel stages (e.g. cost-matrix fill inside the per-camera match) do not
+ * deadlock and behave like non-nested omp.
+ */
+class WorkerPool
+{
+public:
+  static WorkerPool &instance()
+  {
+    static WorkerPool pool;
+    return pool;
+  }
+
+  /**
+   * @brief Resize the pool and optionally pin workers round-robin to cores
+   *
+   * A threadCount of zero selects the hardware concurrency. With numaAware
+   * set on a multi-node machine the workers are spread round-robin over the
+   * NUMA nodes and pinned to their node's CPUs (pinThreads narrows that to a
+   * single core within the node), and parallelFor shards its range so every
+   * worker claims chunks from its own node's sub-range first. Each slot range
+   * is then touched by the same socket frame after frame, which keeps the
+   * estimator working sets node-local instead of ping-ponging between
+   * sockets. Safe to call between frames; blocks until the current workers
+   * have drained.
+   */
+  void configure(std::size_t threadCount, bool pinThreads = false, bool numaAware = false)
+  {
+    stop();
+    start(threadCount == 0 ? std::thread::hardware_concurrency() : threadCount, pinThreads, numaAware);
+  }
+
+  std::size_t threadCount() const
+  {
+    return mThreads.size();
+  }
+
+  /// Number of NUMA nodes the dispatch shards over; 1 unless configured
+  /// numaAware on a multi-node machine
+  std::size_t shardCount() const
+  {
+    return mShardCount;
+  }
+
+  /**
+   * @brief Mark the calling thread so parallelFor runs its loops inline
+   *
+   * Used by engines that already parallelize at a coarser granularity (e.g.
+   * one thread per scene) and must not have intra-scene stages fan out to the
+   * shared pool underneath them.
+   */
+  static void markExternalWorker()
+  {
+    sInsideWorker = true;
+  }
+
+  /// Estimated loop cost (ns) below which cost-annotated loops run serial.
+  /// A dispatch to the pool costs roughly a fork/join — waking the workers
+  /// plus the final rendezvous — measured at 15-25 µs on the reference fleet
+  /// hardware, so loops cheaper than that are faster inline on the caller
+  static constexpr double kDefaultSerialCostFloorNs = 20000.0;
+
+  /**
+   * @brief Set the serial dispatch floor; 0 forces parallel dispatch
+   *
+   * Call between frames (e.g. from configuration), not concurrently with
+   * running loops.
+   */
+  void setSerialCostFloor(double floorNs)
+  {
+    mSerialCostFloorNs = floorNs;
+  }
+
+  double serialCostFloor() const
+  {
+    return mSerialCostFloorNs;
+  }
+
+  /**
+   * @brief parallelFor with a per-element cost model deciding the dispatch
+   *
+   * costPerElementNs is the call site's calibrated per-element body cost.
+   * When elements x cost falls below the serial cost floor the loop runs
+   * inline on the caller — small scenes skip the fork/join entirely, which
+   * otherwise costs more than the loop body for a handful of tracks.
+   */
+  template <typename Callback>
+  void parallelFor(std::size_t begin, std::size_t end, double costPerElementNs, Callback &&callback)
+  {
+    if (end > begin && static_cast<double>(end - begin) * costPerElementNs < mSerialCostFloorNs)
+    {
+      for (std::size_t index = begin; index < end; ++index)
+      {
+        callback(index);
+      }
+      return;
+    }
+    parallelFor(begin, end, std::forward<Callback>(callback));
+  }
+
+  /**
+   * @brief Run callback(index) for every index in [begin, end) on the pool
+   *
+   * Blocks until the whole range is processed; the calling thread works too.
+   */
+  template <typename Callback> void parallelFor(std::size_t begin, std::size_t end, Callback &&callback)
+  {
+    if (end <= begin)
+    {
+      return;
+    }
+
+    auto const range = end - begin;
+    if (sInsideWorker || mThreads.empty() || range == 1)
+    {
+      for (std::size_t index = begin; index < end; ++index)
+      {
+        callback(index);
+      }
+      return;
+    }
+
+    // Chunks small enough that a slow iteration does not leave workers idle,
+    // large enough to amortize the atomic claim
+    auto const chunkSize = std::max<std::size_t>(1, range / (mThreads.size() * 4));
+
+    struct ShardState
+    {
+      std::atomic<std::size_t> cursor{0};
+      std::size_t end{0};
+      std::size_t chunkSize{0};
+    };
+
+    // One cursor per NUMA shard: each worker drains its own node's contiguous
+    // sub-range first and only then steals from the other nodes, so the range
+    // keeps a stable index-to-socket mapping across frames without ever
+    // leaving work stranded on a slow node. Single-node machines collapse to
+    // one shard, which is the previous single-cursor behavior
+    auto const shardCount = std::min<std::size_t>(mShardCount, range);
+    std::vector<ShardState> shards(shardCount);
+    auto const perShard = range / shardCount;
+    for (std::size_t shard = 0; shard < shardCount; ++shard)
+    {
+      shards[shard].cursor = begin + shard * perShard;
+      shards[shard].end = shard + 1 == shardCount ? end : begin + (shard + 1) * perShard;
+      shards[shard].chunkSize = chunkSize;
+    }
+
+    auto runChunks = [&shards, shardCount, &callback]() {
+      auto const homeShard = sWorkerNode % shardCount;
+      for (std::size_t offset = 0; offset < shardCount; ++offset)
+      {
+        auto &state = shards[(homeShard + offset) % shardCount];
+        while (true)
+        {
+          auto const chunkBegin = state.cursor.fetch_add(state.chunkSize);
+          if (chunkBegin >= state.end)
+          {
+            break;
+          }
+          auto const chunkEnd = std::min(chunkBegin + state.chunkSize, state.end);
+          for (std::size_t index = chunkBegin; index < chunkEnd; ++index)
+          {
+            callback(index);
+          }
+        }
+      }
+    };
+
+    auto const helpers = std::min(mThreads.size(), range - 1);
+    std::atomic<std::size_t> pending{helpers};
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      for (std::size_t i = 0; i < helpers; ++i)
+      {
+        mTasks.emplace_back([&runChunks, &pending, this]() {
+          runChunks();
+          if (pending.fetch_sub(1) == 1)
+          {
+            std::lock_guard<std::mutex> doneLock(mMutex);
+            mDone.notify_all();
+          }
+        });
+      }
+    }
+    mWake.notify_all();
+
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDone.wait(lock, [&pending]() { return pending.load() == 0; });
+  }
+
+  ~WorkerPool()
+  {
+    stop();
+  }
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+private:
+  WorkerPool()
+  {
+    start(std::thread::hardware_concurrency(), false, false);
+  }
+
+  void start(std::size_t threadCount, bool pinThreads, bool numaAware)
+  {
+    mStopping = false;
+    auto const topology = numaAware ? NumaTopology::detect() : NumaTopology{};
+    mShardCount = std::max<std::size_t>(1, topology.nodeCount());
+    mThreads.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+      auto const node = i % mShardCount;
+      mThreads.emplace_back([this, node]() {
+        sWorkerNode = node;
+        workerLoop();
+      });
+#if defined(__linux__)
+      if (mShardCount > 1)
+      {
+        // node-local affinity; pinThreads narrows it to one core of the node
+        auto const &nodeCpus = topology.mNodeCpus[node];
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if (pinThreads)
+        {
+          CPU_SET(nodeCpus[(i / mShardCount) % nodeCpus.size()], &cpuSet);
+        }
+        else
+        {
+          for (auto const cpu : nodeCpus)
+          {
+            CPU_SET(cpu, &cpuSet);
+          }
+        }
+        pthread_setaffinity_np(mThreads.back().native_handle(), sizeof(cpuSet), &cpuSet);
+      }
+      else if (pinThreads)
+      {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(i % std::thread::hardware_concurrency(), &cpuSet);
+        pthread_setaffinity_np(mThreads.back().native_handle(), sizeof(cpuSet), &cpuSet);
+      }
+#else
+      (void)pinThreads;
+#endif
+    }
+  }
+
+  void stop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStopping = true;
+    }
+    mWake.notify_all();
+    for (auto &thread : mThreads)
+    {
+      thread.join();
+    }
+    mThreads.clear();
+    mTasks.clear();
+  }
+
+  void workerLoop()
+  {
+    sInsideWorker = true;
+    while (true)
+    {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWake.wait(lock, [this]() { return mStopping || !mTasks.empty(); });
+        if (mStopping && mTasks.empty())
+        {
+          return;
+        }
+        task = std::move(mTasks.front());
+        mTasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  static thread_local bool sInsideWorker;
+  /// NUMA node of the calling thread's shard; 0 for external callers, which
+  /// therefore help on shard 0 before stealing
+  static thread_local std::size_t sWorkerNode;
+
+  std::vector<std::thread> mThreads;
+  std::size_t mShardCount{1};
+  std::deque<std::function<void()>> mTasks;
+  std::mutex mMutex;
+  std::condition_variable mWake;
+  std::condition_variable mDone;
+  bool mStopping{false};
+  double mSerialCostFloorNs{kDefaultSerialCostFloorNs};
+};
+
+inline thread_local bool WorkerPool::sInsideWorker = false;
+inline thread_local std::size_t WorkerPool::sWorkerNode = 0;
+
+} // namespace rv
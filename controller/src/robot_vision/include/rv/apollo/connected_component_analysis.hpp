@@ -15,9 +15,18 @@ namespace common {
 /*
 * @brief: bfs based connected component analysis
 * @params[IN] graph: input graph for connected component analysis
-* @params[OUT] components: connected components of input graph
+* @params[IN] num_item: number of nodes to consider; allows callers that keep
+*             a grow-only adjacency buffer to pass a graph larger than the
+*             current problem
+* @params[OUT] components: connected components of input graph. resized, not
+*             reallocated: the inner vectors are reused across calls so
+*             steady-state analysis does not allocate
 * @return nothing
 * */
+void ConnectedComponentAnalysis(const std::vector<std::vector<int>> &graph,
+                                size_t num_item,
+                                std::vector<std::vector<int>> *components);
+
 void ConnectedComponentAnalysis(const std::vector<std::vector<int>> &graph, std::vector<std::vector<int>> *components);
 
 } // namespace common
@@ -5,8 +5,7 @@
 #pragma once
 
 #include <algorithm>
-#include <functional>
-#include <map>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -17,6 +16,7 @@
 
 #include "rv/apollo/connected_component_analysis.hpp"
 #include "rv/apollo/hungarian_optimizer.hpp"
+#include "rv/WorkerPool.hpp"
 
 namespace apollo {
 namespace perception {
@@ -34,7 +34,6 @@ public:
   explicit GatedHungarianMatcher(int max_matching_size = 1000)
   {
     global_costs_.Reserve(max_matching_size, max_matching_size);
-    optimizer_.costs()->Reserve(max_matching_size, max_matching_size);
   }
   ~GatedHungarianMatcher()
   {
@@ -51,6 +50,12 @@ public:
   {
     return global_costs_;
   }
+  /* @brief: bytes held by the global costs matrix, the per-Match component
+   * scratch and the calling thread's local optimizer. components solved on
+   * worker pool threads keep their optimizers thread_local on those threads,
+   * so those buffers are not visible from here. */
+  size_t MemoryFootprint() const;
+
   SecureMat<T> *mutable_global_costs()
   {
     return &global_costs_;
@@ -72,22 +77,26 @@ public:
 private:
   /* Step 1:
    * a. get number of rows & cols
-   * b. determine function of comparison */
+   * b. check the validity of the bound value */
   void MatchInit();
 
   /* Step 2:
    * to acclerate matching process, split input cost graph into several
    * small sub-parts. */
   void ComputeConnectedComponents(std::vector<std::vector<size_t>> *row_components,
-                                  std::vector<std::vector<size_t>> *col_components) const;
+                                  std::vector<std::vector<size_t>> *col_components);
 
   /* Step 3:
-   * optimize single connected component, which is part of the global one */
-  void OptimizeConnectedComponent(const std::vector<size_t> &row_component, const std::vector<size_t> &col_component);
+   * optimize single connected component, which is part of the global one.
+   * components are independent, so they run concurrently on the worker pool;
+   * each call writes into its own assignment list. */
+  void OptimizeConnectedComponent(const std::vector<size_t> &row_component,
+                                  const std::vector<size_t> &col_component,
+                                  std::vector<std::pair<size_t, size_t>> *component_assignments) const;
 
   /* Step 4:
    * generate the set of unassigned row or col index. */
-  void GenerateUnassignedData(std::vector<size_t> *unassigned_rows, std::vector<size_t> *unassigned_cols) const;
+  void GenerateUnassignedData(std::vector<size_t> *unassigned_rows, std::vector<size_t> *unassigned_cols);
 
   /* @brief: core function for updating the local cost matrix from global one,
    * we get queryed local costs and write them in the memeory of costs of
@@ -95,12 +104,25 @@ private:
    * @params[IN] row_component: the set of index of rows of sub-graph
    * @params[IN] col_component: the set of index of cols of sub-graph
    * @return: nothing */
-  void UpdateGatingLocalCostsMat(const std::vector<size_t> &row_component, const std::vector<size_t> &col_component);
+  void UpdateGatingLocalCostsMat(const std::vector<size_t> &row_component,
+                                 const std::vector<size_t> &col_component,
+                                 HungarianOptimizer<T> *optimizer) const;
 
-  void OptimizeAdapter(std::vector<std::pair<size_t, size_t>> *local_assignments);
+  void OptimizeAdapter(HungarianOptimizer<T> *optimizer, std::vector<std::pair<size_t, size_t>> *local_assignments) const;
 
-  /* hungarian optimizer */
-  HungarianOptimizer<T> optimizer_;
+  /* each worker keeps its own optimizer and assignment scratch, so components
+   * can be solved concurrently and the state persists across frames; accessor
+   * functions so MemoryFootprint can read the calling thread's copies */
+  static HungarianOptimizer<T> &LocalOptimizer()
+  {
+    static thread_local HungarianOptimizer<T> optimizer;
+    return optimizer;
+  }
+  static std::vector<std::pair<size_t, size_t>> &LocalAssignments()
+  {
+    static thread_local std::vector<std::pair<size_t, size_t>> local_assignments;
+    return local_assignments;
+  }
 
   /* global costs matrix */
   SecureMat<T> global_costs_;
@@ -117,9 +139,26 @@ private:
   size_t rows_num_ = 0;
   size_t cols_num_ = 0;
 
-  /* the rhs is always better than lhs */
-  std::function<bool(T, T)> compare_fun_;
-  std::function<bool(T)> is_valid_cost_;
+  /* the rhs is always better than lhs; plain member functions instead of the
+   * former std::function members, so MatchInit never allocates */
+  bool Compare(T lhs, T rhs) const
+  {
+    return (opt_flag_ == OptimizeFlag::OPTMAX) ? (lhs < rhs) : (lhs > rhs);
+  }
+  bool IsValidCost(T cost) const
+  {
+    return Compare(cost_thresh_, cost);
+  }
+
+  /* per-Match scratch, persistent like the optimizer's buffers: the sizes
+   * grow monotonically and steady-state matching does not allocate */
+  std::vector<std::vector<size_t>> row_components_;
+  std::vector<std::vector<size_t>> col_components_;
+  std::vector<std::vector<std::pair<size_t, size_t>>> component_assignments_;
+  std::vector<std::vector<int>> nb_graph_;
+  std::vector<std::vector<int>> components_;
+  std::vector<bool> row_assignment_flags_;
+  std::vector<bool> col_assignment_flags_;
 }; // class GatedHungarianMatcher
 
 template <typename T>
@@ -152,17 +191,30 @@ void GatedHungarianMatcher<T>::Match(T cost_thresh,
   MatchInit();
 
   /* compute components */
-  std::vector<std::vector<size_t>> row_components;
-  std::vector<std::vector<size_t>> col_components;
-  this->ComputeConnectedComponents(&row_components, &col_components);
-  CHECK_EQ(row_components.size(), col_components.size());
+  this->ComputeConnectedComponents(&row_components_, &col_components_);
+  CHECK_EQ(row_components_.size(), col_components_.size());
 
-  /* compute assignments */
+  /* compute assignments: the components are disjoint sub-graphs, so they are
+   * solved concurrently on the shared worker pool and merged afterwards */
   assignments_ptr_->clear();
   assignments_ptr_->reserve(std::max(rows_num_, cols_num_));
-  for (size_t i = 0; i < row_components.size(); ++i)
+
+  const size_t components_num = row_components_.size();
+  if (component_assignments_.size() < components_num)
+  {
+    component_assignments_.resize(components_num);
+  }
+  for (size_t i = 0; i < components_num; ++i)
+  {
+    component_assignments_[i].clear();
+  }
+  rv::WorkerPool::instance().parallelFor(0, components_num, [&](size_t i) {
+    this->OptimizeConnectedComponent(row_components_[i], col_components_[i], &component_assignments_[i]);
+  });
+
+  for (size_t i = 0; i < components_num; ++i)
   {
-    this->OptimizeConnectedComponent(row_components[i], col_components[i]);
+    assignments_ptr_->insert(assignments_ptr_->end(), component_assignments_[i].begin(), component_assignments_[i].end());
   }
 
   this->GenerateUnassignedData(unassigned_rows, unassigned_cols);
@@ -174,51 +226,48 @@ template <typename T> void GatedHungarianMatcher<T>::MatchInit()
   rows_num_ = global_costs_.height();
   cols_num_ = (rows_num_ == 0) ? 0 : global_costs_.width();
 
-  /* determine function of comparison */
-  static std::map<OptimizeFlag, std::function<bool(T, T)>> compare_fun_map = {
-    {OptimizeFlag::OPTMAX, std::less<T>()}, {OptimizeFlag::OPTMIN, std::greater<T>()},
-  };
-  auto find_ret = compare_fun_map.find(opt_flag_);
-  CHECK(find_ret != compare_fun_map.end());
-  compare_fun_ = find_ret->second;
-  is_valid_cost_ = [this](T value) { return compare_fun_(cost_thresh_, value); };
-
   /* check the validity of bound_value */
-  CHECK(!is_valid_cost_(bound_value_));
+  CHECK(!IsValidCost(bound_value_));
 }
 
 template <typename T>
 void GatedHungarianMatcher<T>::ComputeConnectedComponents(std::vector<std::vector<size_t>> *row_components,
-                                                          std::vector<std::vector<size_t>> *col_components) const
+                                                          std::vector<std::vector<size_t>> *col_components)
 {
   CHECK_NOTNULL(row_components);
   CHECK_NOTNULL(col_components);
 
-  std::vector<std::vector<int>> nb_graph;
-  nb_graph.resize(rows_num_ + cols_num_);
+  if (nb_graph_.size() < rows_num_ + cols_num_)
+  {
+    nb_graph_.resize(rows_num_ + cols_num_);
+  }
+  for (size_t i = 0; i < rows_num_ + cols_num_; ++i)
+  {
+    nb_graph_[i].clear();
+  }
   for (int i = 0; i < rows_num_; ++i)
   {
     for (int j = 0; j < cols_num_; ++j)
     {
-      if (is_valid_cost_(global_costs_(i, j)))
+      if (IsValidCost(global_costs_(i, j)))
       {
-        nb_graph[i].push_back(static_cast<int>(rows_num_) + j);
-        nb_graph[j + rows_num_].push_back(i);
+        nb_graph_[i].push_back(static_cast<int>(rows_num_) + j);
+        nb_graph_[j + rows_num_].push_back(i);
       }
     }
   }
 
-  std::vector<std::vector<int>> components;
-  ConnectedComponentAnalysis(nb_graph, &components);
-  row_components->clear();
-  row_components->resize(components.size());
-  col_components->clear();
-  col_components->resize(components.size());
-  for (size_t i = 0; i < components.size(); ++i)
+  ConnectedComponentAnalysis(nb_graph_, rows_num_ + cols_num_, &components_);
+  const size_t components_num = components_.size();
+  row_components->resize(components_num);
+  col_components->resize(components_num);
+  for (size_t i = 0; i < components_num; ++i)
   {
-    for (size_t j = 0; j < components[i].size(); ++j)
+    row_components->at(i).clear();
+    col_components->at(i).clear();
+    for (size_t j = 0; j < components_[i].size(); ++j)
     {
-      int id = components[i][j];
+      int id = components_[i][j];
       if (id < rows_num_)
       {
         row_components->at(i).push_back(id);
@@ -233,8 +282,10 @@ void GatedHungarianMatcher<T>::ComputeConnectedComponents(std::vector<std::vecto
 }
 
 template <typename T>
-void GatedHungarianMatcher<T>::OptimizeConnectedComponent(const std::vector<size_t> &row_component,
-                                                          const std::vector<size_t> &col_component)
+void GatedHungarianMatcher<T>::OptimizeConnectedComponent(
+  const std::vector<size_t> &row_component,
+  const std::vector<size_t> &col_component,
+  std::vector<std::pair<size_t, size_t>> *component_assignments) const
 {
   size_t local_rows_num = row_component.size();
   size_t local_cols_num = col_component.size();
@@ -249,19 +300,24 @@ void GatedHungarianMatcher<T>::OptimizeConnectedComponent(const std::vector<size
   {
     size_t idx_r = row_component[0];
     size_t idx_c = col_component[0];
-    if (is_valid_cost_(global_costs_(idx_r, idx_c)))
+    if (IsValidCost(global_costs_(idx_r, idx_c)))
     {
-      assignments_ptr_->push_back(std::make_pair(idx_r, idx_c));
+      component_assignments->push_back(std::make_pair(idx_r, idx_c));
     }
     return;
   }
 
+  /* each worker keeps its own optimizer, so components can be solved
+   * concurrently and the scratch state persists across frames */
+  HungarianOptimizer<T> &optimizer = LocalOptimizer();
+
   /* update local cost matrix */
-  UpdateGatingLocalCostsMat(row_component, col_component);
+  UpdateGatingLocalCostsMat(row_component, col_component, &optimizer);
 
-  /* get local assignments */
-  std::vector<std::pair<size_t, size_t>> local_assignments;
-  OptimizeAdapter(&local_assignments);
+  /* get local assignments; the scratch lives next to the thread's optimizer */
+  std::vector<std::pair<size_t, size_t>> &local_assignments = LocalAssignments();
+  local_assignments.clear();
+  OptimizeAdapter(&optimizer, &local_assignments);
 
   /* parse local assginments into global ones */
   for (size_t i = 0; i < local_assignments.size(); ++i)
@@ -269,41 +325,41 @@ void GatedHungarianMatcher<T>::OptimizeConnectedComponent(const std::vector<size
     auto local_assignment = local_assignments[i];
     size_t global_row_idx = row_component[local_assignment.first];
     size_t global_col_idx = col_component[local_assignment.second];
-    if (!is_valid_cost_(global_costs_(global_row_idx, global_col_idx)))
+    if (!IsValidCost(global_costs_(global_row_idx, global_col_idx)))
     {
       continue;
     }
-    assignments_ptr_->push_back(std::make_pair(global_row_idx, global_col_idx));
+    component_assignments->push_back(std::make_pair(global_row_idx, global_col_idx));
   }
 }
 
 template <typename T>
 void GatedHungarianMatcher<T>::GenerateUnassignedData(std::vector<size_t> *unassigned_rows,
-                                                      std::vector<size_t> *unassigned_cols) const
+                                                      std::vector<size_t> *unassigned_cols)
 {
   CHECK_NOTNULL(unassigned_rows);
   CHECK_NOTNULL(unassigned_cols);
 
-  const auto assignments = *assignments_ptr_;
+  const auto &assignments = *assignments_ptr_;
   unassigned_rows->clear(), unassigned_rows->reserve(rows_num_);
   unassigned_cols->clear(), unassigned_cols->reserve(cols_num_);
-  std::vector<bool> row_assignment_flags(rows_num_, false);
-  std::vector<bool> col_assignment_flags(cols_num_, false);
+  row_assignment_flags_.assign(rows_num_, false);
+  col_assignment_flags_.assign(cols_num_, false);
   for (const auto &assignment : assignments)
   {
-    row_assignment_flags[assignment.first] = true;
-    col_assignment_flags[assignment.second] = true;
+    row_assignment_flags_[assignment.first] = true;
+    col_assignment_flags_[assignment.second] = true;
   }
-  for (size_t i = 0; i < row_assignment_flags.size(); ++i)
+  for (size_t i = 0; i < row_assignment_flags_.size(); ++i)
   {
-    if (!row_assignment_flags[i])
+    if (!row_assignment_flags_[i])
     {
       unassigned_rows->push_back(i);
     }
   }
-  for (size_t i = 0; i < col_assignment_flags.size(); ++i)
+  for (size_t i = 0; i < col_assignment_flags_.size(); ++i)
   {
-    if (!col_assignment_flags[i])
+    if (!col_assignment_flags_[i])
     {
       unassigned_cols->push_back(i);
     }
@@ -312,17 +368,18 @@ void GatedHungarianMatcher<T>::GenerateUnassignedData(std::vector<size_t> *unass
 
 template <typename T>
 void GatedHungarianMatcher<T>::UpdateGatingLocalCostsMat(const std::vector<size_t> &row_component,
-                                                         const std::vector<size_t> &col_component)
+                                                         const std::vector<size_t> &col_component,
+                                                         HungarianOptimizer<T> *optimizer) const
 {
   /* set the invalid cost to bound value */
-  SecureMat<T> *local_costs = optimizer_.costs();
+  SecureMat<T> *local_costs = optimizer->costs();
   local_costs->Resize(row_component.size(), col_component.size());
   for (size_t i = 0; i < row_component.size(); ++i)
   {
     for (size_t j = 0; j < col_component.size(); ++j)
     {
-      T &current_cost = global_costs_(row_component[i], col_component[j]);
-      if (is_valid_cost_(current_cost))
+      const T &current_cost = global_costs_(row_component[i], col_component[j]);
+      if (IsValidCost(current_cost))
       {
         (*local_costs)(i, j) = current_cost;
       }
@@ -332,20 +389,52 @@ void GatedHungarianMatcher<T>::UpdateGatingLocalCostsMat(const std::vector<size_
       }
     }
   }
+
+  /* let the optimizer skip the bound-value entries when the component is
+   * sparse enough */
+  optimizer->SetInvalidCost(bound_value_);
   return;
 }
 
+template <typename T> size_t GatedHungarianMatcher<T>::MemoryFootprint() const
+{
+  /* outer capacity plus every inner vector's held storage */
+  auto nested_bytes = [](const auto &outer) {
+    using Inner = typename std::decay_t<decltype(outer)>::value_type;
+    size_t total = outer.capacity() * sizeof(Inner);
+    for (const auto &inner : outer)
+    {
+      total += inner.capacity() * sizeof(typename Inner::value_type);
+    }
+    return total;
+  };
+
+  size_t bytes = global_costs_.MemoryFootprint();
+  bytes += nested_bytes(row_components_);
+  bytes += nested_bytes(col_components_);
+  bytes += nested_bytes(component_assignments_);
+  bytes += nested_bytes(nb_graph_);
+  bytes += nested_bytes(components_);
+  /* vector<bool> packs its flags */
+  bytes += (row_assignment_flags_.capacity() + col_assignment_flags_.capacity()) / 8;
+
+  bytes += LocalOptimizer().MemoryFootprint();
+  bytes += LocalAssignments().capacity() * sizeof(std::pair<size_t, size_t>);
+  return bytes;
+}
+
 template <typename T>
-void GatedHungarianMatcher<T>::OptimizeAdapter(std::vector<std::pair<size_t, size_t>> *local_assignments)
+void GatedHungarianMatcher<T>::OptimizeAdapter(HungarianOptimizer<T> *optimizer,
+                                               std::vector<std::pair<size_t, size_t>> *local_assignments) const
 {
   CHECK_NOTNULL(local_assignments);
   if (opt_flag_ == OptimizeFlag::OPTMAX)
   {
-    optimizer_.Maximize(local_assignments);
+    optimizer->Maximize(local_assignments);
   }
   else
   {
-    optimizer_.Minimize(local_assignments);
+    optimizer->Minimize(local_assignments);
   }
 }
 
@@ -42,6 +42,27 @@ public:
   void Maximize(std::vector<std::pair<size_t, size_t>> *assignments);
   void Minimize(std::vector<std::pair<size_t, size_t>> *assignments);
 
+  /* declare the sentinel cost used for non-edges (e.g. the gated matcher's
+   * bound value) for the next optimization run. when the share of valid
+   * entries falls below the density threshold, the zero/minimum searches walk
+   * CSR-style per-row lists of valid columns and skip the sentinel entries
+   * entirely. cleared by OptimizationClear(). */
+  void SetInvalidCost(const T &invalid_cost)
+  {
+    invalid_cost_ = invalid_cost;
+    has_invalid_cost_ = true;
+  }
+
+  void set_sparse_density_threshold(const double threshold)
+  {
+    sparse_density_threshold_ = threshold;
+  }
+
+  /* @brief: bytes held by the cost matrix and the solver's scratch arrays.
+   * the capacities only grow across solves, so this reads as the steady-state
+   * footprint of this optimizer. */
+  size_t MemoryFootprint() const;
+
   void OptimizationInit();
   void OptimizationClear();
 
@@ -49,13 +70,6 @@ public:
   void PrintMatrix();
 
 private:
-  enum class Mark
-  {
-    NONE,
-    PRIME,
-    STAR
-  };
-
   /* Convert the final cost matrix into a set of assignments of agents to tasks.
    * Return the assignment in a vector of pair, the same as Minimize() and
    * Maximize() */
@@ -64,20 +78,31 @@ private:
   /* Is the cell (row, col) starred? */
   bool IsStarred(const size_t row, const size_t col) const
   {
-    return marks_(row, col) == Mark::STAR;
+    return star_in_row_[row] == static_cast<int>(col);
   }
 
   /* Mark cell (row, col) with a star */
   void Star(const size_t row, const size_t col)
   {
-    marks_(row, col) = Mark::STAR;
+    if (star_in_row_[row] >= 0)
+    {
+      /* defensive: a row holds at most one star */
+      Unstar(row, star_in_row_[row]);
+    }
+    star_in_row_[row] = static_cast<int>(col);
+    star_in_col_[col] = static_cast<int>(row);
     ++stars_in_col_[col];
   }
 
   /* Remove a star from cell (row, col) */
   void Unstar(const size_t row, const size_t col)
   {
-    marks_(row, col) = Mark::NONE;
+    if (star_in_row_[row] != static_cast<int>(col))
+    {
+      return;
+    }
+    star_in_row_[row] = kHungarianOptimizerColNotFound;
+    star_in_col_[col] = kHungarianOptimizerRowNotFound;
     --stars_in_col_[col];
   }
 
@@ -92,13 +117,13 @@ private:
   /* Is cell (row, col) marked with a prime? */
   bool IsPrimed(const size_t row, const size_t col) const
   {
-    return marks_(row, col) == Mark::PRIME;
+    return prime_in_row_[row] == static_cast<int>(col);
   }
 
   /* Mark cell (row, col) with a prime. */
   void Prime(const size_t row, const size_t col)
   {
-    marks_(row, col) = Mark::PRIME;
+    prime_in_row_[row] = static_cast<int>(col);
   }
 
   /* Find a column in row containing a prime, or return
@@ -226,12 +251,24 @@ private:
   std::vector<bool> rows_covered_;
   std::vector<bool> cols_covered_;
 
-  /* the marks (star/prime/none) on each element of the cost matrix. */
-  SecureMat<Mark> marks_;
+  /* star/prime positions indexed by row and column; a row or column holds at
+   * most one of each, so the former full-matrix mark scans are O(1) lookups */
+  std::vector<int> star_in_row_;
+  std::vector<int> star_in_col_;
+  std::vector<int> prime_in_row_;
 
   /* the number of stars in each column - used to speed up coverStarredZeroes.*/
   std::vector<int> stars_in_col_;
 
+  /* sparse (CSR-style) support: per-row lists of valid columns, built when a
+   * non-edge sentinel was declared and the valid density is below threshold.
+   * padding rows of the expanded square matrix are implicitly all-valid. */
+  bool has_invalid_cost_ = false;
+  T invalid_cost_{};
+  bool sparse_mode_ = false;
+  double sparse_density_threshold_ = 0.25;
+  std::vector<std::vector<size_t>> valid_cols_in_row_;
+
   /* representation of a path_ through the matrix - used in Step 5. */
   std::vector<std::pair<size_t, size_t>> assignments_;
 
@@ -243,8 +280,20 @@ private:
   int width_ = 0;
   int height_ = 0;
 
-  /* The current state of the algorithm */
-  std::function<void()> fn_state_ = nullptr;
+  /* The current state of the algorithm. a plain enum dispatched from
+   * DoMunkres: the former std::bind/std::function transitions allocated on
+   * every step, and the steps run many times per solve */
+  enum class State
+  {
+    kDone,
+    kReduceRows,
+    kStarZeroes,
+    kCoverStarredZeroes,
+    kPrimeZeroes,
+    kMakeAugmentingPath,
+    kAugmentPath
+  };
+  State state_ = State::kDone;
 
   std::vector<size_t> uncov_col_;
   std::vector<size_t> uncov_row_;
@@ -269,6 +318,24 @@ HungarianOptimizer<T>::HungarianOptimizer(const int max_optimization_size)
   uncov_col_.reserve(max_optimization_size);
 }
 
+template <typename T> size_t HungarianOptimizer<T>::MemoryFootprint() const
+{
+  size_t bytes = costs_.MemoryFootprint();
+  /* vector<bool> packs its flags */
+  bytes += (rows_covered_.capacity() + cols_covered_.capacity()) / 8;
+  bytes +=
+    (star_in_row_.capacity() + star_in_col_.capacity() + prime_in_row_.capacity() + stars_in_col_.capacity())
+    * sizeof(int);
+  bytes += valid_cols_in_row_.capacity() * sizeof(std::vector<size_t>);
+  for (const auto &cols : valid_cols_in_row_)
+  {
+    bytes += cols.capacity() * sizeof(size_t);
+  }
+  bytes += assignments_.capacity() * sizeof(std::pair<size_t, size_t>);
+  bytes += (uncov_col_.capacity() + uncov_row_.capacity()) * sizeof(size_t);
+  return bytes;
+}
+
 /* Find an assignment which maximizes the overall costs.
  * Return an array of pairs of integers. Each pair (i, j) corresponds to
  * assigning agent i to task j. */
@@ -337,17 +404,55 @@ template <typename T> void HungarianOptimizer<T>::OptimizationInit()
   }
 
   /* initially, none of the cells of the matrix are marked. */
-  marks_.Resize(matrix_size_, matrix_size_);
-  for (size_t row = 0; row < matrix_size_; ++row)
+  star_in_row_.assign(matrix_size_, kHungarianOptimizerColNotFound);
+  star_in_col_.assign(matrix_size_, kHungarianOptimizerRowNotFound);
+  prime_in_row_.assign(matrix_size_, kHungarianOptimizerColNotFound);
+
+  stars_in_col_.assign(matrix_size_, 0);
+
+  /* when a non-edge sentinel was declared and the matrix is sparse enough,
+   * build per-row lists of valid columns so the zero/minimum scans can skip
+   * the sentinel entries. padding columns of the expanded square matrix are
+   * real zeros and stay in the lists; all-padding rows are handled implicitly
+   * by the scan loops. */
+  sparse_mode_ = false;
+  if (has_invalid_cost_ && height_ > 0 && width_ > 0)
   {
-    for (size_t col = 0; col < matrix_size_; ++col)
+    size_t num_valid = 0;
+    for (size_t row = 0; row < height_; ++row)
     {
-      marks_(row, col) = Mark::NONE;
+      for (size_t col = 0; col < width_; ++col)
+      {
+        if (costs_(row, col) != invalid_cost_)
+        {
+          ++num_valid;
+        }
+      }
+    }
+    const double density = static_cast<double>(num_valid) / (static_cast<double>(height_) * static_cast<double>(width_));
+    if (density < sparse_density_threshold_)
+    {
+      sparse_mode_ = true;
+      valid_cols_in_row_.resize(matrix_size_);
+      for (size_t row = 0; row < height_; ++row)
+      {
+        std::vector<size_t> &cols = valid_cols_in_row_[row];
+        cols.clear();
+        for (size_t col = 0; col < width_; ++col)
+        {
+          if (costs_(row, col) != invalid_cost_)
+          {
+            cols.push_back(col);
+          }
+        }
+        for (size_t col = width_; col < matrix_size_; ++col)
+        {
+          cols.push_back(col);
+        }
+      }
     }
   }
 
-  stars_in_col_.assign(matrix_size_, 0);
-
   rows_covered_.assign(matrix_size_, false);
   cols_covered_.assign(matrix_size_, false);
 
@@ -359,6 +464,7 @@ template <typename T> void HungarianOptimizer<T>::OptimizationInit()
 template <typename T> void HungarianOptimizer<T>::OptimizationClear()
 {
   optimization_initialized_ = false;
+  has_invalid_cost_ = false;
 }
 
 /* Convert the final costs matrix into a set of assignments of agents to tasks.
@@ -384,15 +490,7 @@ template <typename T> void HungarianOptimizer<T>::FindAssignments(std::vector<st
  * kHungarianOptimizerColNotFound if no such column exists. */
 template <typename T> int HungarianOptimizer<T>::FindStarInRow(const size_t row) const
 {
-  for (size_t col = 0; col < matrix_size_; ++col)
-  {
-    if (IsStarred(row, col))
-    {
-      return static_cast<int>(col);
-    }
-  }
-
-  return kHungarianOptimizerColNotFound;
+  return star_in_row_[row];
 }
 
 /* Find a row in column 'col' containing a star, or return
@@ -404,46 +502,20 @@ template <typename T> int HungarianOptimizer<T>::FindStarInCol(const size_t col)
     return kHungarianOptimizerRowNotFound;
   }
 
-  for (size_t row = 0; row < matrix_size_; ++row)
-  {
-    if (IsStarred(row, col))
-    {
-      return static_cast<int>(row);
-    }
-  }
-
-  // NOT REACHED
-  return kHungarianOptimizerRowNotFound;
+  return star_in_col_[col];
 }
 
 /* Find a column in row containing a prime, or return
  * kHungarianOptimizerColNotFound if no such column exists. */
 template <typename T> int HungarianOptimizer<T>::FindPrimeInRow(const size_t row) const
 {
-  for (size_t col = 0; col < matrix_size_; ++col)
-  {
-    if (IsPrimed(row, col))
-    {
-      return static_cast<int>(col);
-    }
-  }
-
-  return kHungarianOptimizerColNotFound;
+  return prime_in_row_[row];
 }
 
 /* Remove the prime marks from every cell in the matrix. */
 template <typename T> void HungarianOptimizer<T>::ClearPrimes()
 {
-  for (size_t row = 0; row < matrix_size_; ++row)
-  {
-    for (size_t col = 0; col < matrix_size_; ++col)
-    {
-      if (IsPrimed(row, col))
-      {
-        marks_(row, col) = Mark::NONE;
-      }
-    }
-  }
+  prime_in_row_.assign(matrix_size_, kHungarianOptimizerColNotFound);
 }
 
 /* Uncover every row and column in the matrix. */
@@ -460,6 +532,46 @@ template <typename T> void HungarianOptimizer<T>::ClearCovers()
 template <typename T> T HungarianOptimizer<T>::FindSmallestUncovered()
 {
   T minval = std::numeric_limits<T>::max();
+
+  if (sparse_mode_)
+  {
+    /* restrict the scan to the valid (non-sentinel) columns of each row;
+     * all-padding rows below height_ have every column valid */
+    for (size_t row = 0; row < matrix_size_; ++row)
+    {
+      if (RowCovered(row))
+      {
+        continue;
+      }
+      if (row < static_cast<size_t>(height_))
+      {
+        for (const size_t col : valid_cols_in_row_[row])
+        {
+          if (!ColCovered(col))
+          {
+            minval = std::min(minval, costs_(row, col));
+          }
+        }
+      }
+      else
+      {
+        for (size_t col = 0; col < matrix_size_; ++col)
+        {
+          if (!ColCovered(col))
+          {
+            minval = std::min(minval, costs_(row, col));
+          }
+        }
+      }
+    }
+    if (minval != std::numeric_limits<T>::max())
+    {
+      return minval;
+    }
+    /* no valid uncovered cell left; fall through to the dense scan so the
+     * augmentation step keeps working on the sentinel entries */
+  }
+
   uncov_col_.clear();
   uncov_row_.clear();
 
@@ -490,6 +602,44 @@ template <typename T> T HungarianOptimizer<T>::FindSmallestUncovered()
  * and return true, or return false if no such cell exists. */
 template <typename T> bool HungarianOptimizer<T>::FindZero(size_t *zero_row, size_t *zero_col)
 {
+  if (sparse_mode_)
+  {
+    /* zeros only ever develop on valid entries (the sentinel keeps non-edges
+     * far above the reductions), so the scan skips the sentinel columns */
+    for (size_t row = 0; row < matrix_size_; ++row)
+    {
+      if (RowCovered(row))
+      {
+        continue;
+      }
+      if (row < static_cast<size_t>(height_))
+      {
+        for (const size_t col : valid_cols_in_row_[row])
+        {
+          if (!ColCovered(col) && costs_(row, col) == 0)
+          {
+            *zero_row = row;
+            *zero_col = col;
+            return true;
+          }
+        }
+      }
+      else
+      {
+        for (size_t col = 0; col < matrix_size_; ++col)
+        {
+          if (!ColCovered(col) && costs_(row, col) == 0)
+          {
+            *zero_row = row;
+            *zero_col = col;
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
   uncov_col_.clear();
   uncov_row_.clear();
 
@@ -552,10 +702,32 @@ template <typename T> void HungarianOptimizer<T>::DoMunkres()
 {
   int max_num_iter = 1000;
   int num_iter = 0;
-  fn_state_ = std::bind(&HungarianOptimizer::ReduceRows, this);
-  while (fn_state_ != nullptr && num_iter < max_num_iter)
+  state_ = State::kReduceRows;
+  while (state_ != State::kDone && num_iter < max_num_iter)
   {
-    fn_state_();
+    switch (state_)
+    {
+      case State::kReduceRows:
+        ReduceRows();
+        break;
+      case State::kStarZeroes:
+        StarZeroes();
+        break;
+      case State::kCoverStarredZeroes:
+        CoverStarredZeroes();
+        break;
+      case State::kPrimeZeroes:
+        PrimeZeroes();
+        break;
+      case State::kMakeAugmentingPath:
+        MakeAugmentingPath();
+        break;
+      case State::kAugmentPath:
+        AugmentPath();
+        break;
+      case State::kDone:
+        break;
+    }
     ++num_iter;
   }
   if (num_iter >= max_num_iter)
@@ -566,31 +738,15 @@ template <typename T> void HungarianOptimizer<T>::DoMunkres()
 
 template <typename T> void HungarianOptimizer<T>::CheckStar()
 {
+  /* a row can hold at most one star by construction of the index arrays;
+   * drop stars whose row/column entries disagree so an aborted run cannot
+   * report an inconsistent assignment */
   for (size_t row = 0; row < height_; ++row)
   {
-    int star_col = -1;
-    bool is_single = true;
-    for (int col = 0; col < width_; ++col)
+    const int star_col = star_in_row_[row];
+    if (star_col >= 0 && star_in_col_[star_col] != static_cast<int>(row))
     {
-      if (IsStarred(row, col))
-      {
-        if (star_col == -1)
-        {
-          star_col = col;
-        }
-        else
-        {
-          is_single = false;
-          break;
-        }
-      }
-    }
-    if (!is_single)
-    {
-      for (int col = 0; col < width_; ++col)
-      {
-        Unstar(row, col);
-      }
+      Unstar(row, star_col);
     }
   }
 }
@@ -612,7 +768,7 @@ template <typename T> void HungarianOptimizer<T>::ReduceRows()
       costs_(row, col) -= min_cost;
     }
   }
-  fn_state_ = std::bind(&HungarianOptimizer::StarZeroes, this);
+  state_ = State::kStarZeroes;
 }
 
 /* Step 2:
@@ -645,7 +801,7 @@ template <typename T> void HungarianOptimizer<T>::StarZeroes()
     }
   }
   ClearCovers();
-  fn_state_ = std::bind(&HungarianOptimizer::CoverStarredZeroes, this);
+  state_ = State::kCoverStarredZeroes;
 }
 
 /* Step 3:
@@ -667,10 +823,10 @@ template <typename T> void HungarianOptimizer<T>::CoverStarredZeroes()
 
   if (num_covered >= matrix_size_)
   {
-    fn_state_ = nullptr;
+    state_ = State::kDone;
     return;
   }
-  fn_state_ = std::bind(&HungarianOptimizer::PrimeZeroes, this);
+  state_ = State::kPrimeZeroes;
 }
 
 /* Step 4:
@@ -693,7 +849,7 @@ template <typename T> void HungarianOptimizer<T>::PrimeZeroes()
     if (!FindZero(&zero_row, &zero_col))
     {
       // No uncovered zeroes.
-      fn_state_ = std::bind(&HungarianOptimizer::AugmentPath, this);
+      state_ = State::kAugmentPath;
       return;
     }
 
@@ -709,7 +865,7 @@ template <typename T> void HungarianOptimizer<T>::PrimeZeroes()
     {
       std::pair<size_t, size_t> first_assignment = std::make_pair(zero_row, zero_col);
       assignments_[0] = first_assignment;
-      fn_state_ = std::bind(&HungarianOptimizer::MakeAugmentingPath, this);
+      state_ = State::kMakeAugmentingPath;
       return;
     }
   }
@@ -794,7 +950,7 @@ template <typename T> void HungarianOptimizer<T>::MakeAugmentingPath()
 
   ClearCovers();
   ClearPrimes();
-  fn_state_ = std::bind(&HungarianOptimizer::CoverStarredZeroes, this);
+  state_ = State::kCoverStarredZeroes;
 }
 
 /* Step 6:
@@ -825,7 +981,7 @@ template <typename T> void HungarianOptimizer<T>::AugmentPath()
       }
     }
   }
-  fn_state_ = std::bind(&HungarianOptimizer::PrimeZeroes, this);
+  state_ = State::kPrimeZeroes;
 }
 
 } // namespace common
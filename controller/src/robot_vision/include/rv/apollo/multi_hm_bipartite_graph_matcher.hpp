@@ -35,6 +35,12 @@ public:
     return "MultiHmBipartiteGraphMatcher";
   }
 
+  // @brief: bytes held by the wrapped matcher's cost matrix and scratch
+  size_t MemoryFootprint() const
+  {
+    return optimizer_.MemoryFootprint();
+  }
+
 protected:
   common::GatedHungarianMatcher<double> optimizer_;
 }; // class MultiHmObjectMatcher
@@ -4,7 +4,9 @@
 
 #pragma once
 
-#include <Eigen/Dense>
+#include <cstdint>
+#include <ostream>
+#include <vector>
 
 namespace apollo {
 namespace perception {
@@ -37,7 +39,7 @@ public:
   {
     max_height_ = (reserve_height > max_height_) ? reserve_height : max_height_;
     max_width_ = (reserve_width > max_width_) ? reserve_width : max_width_;
-    mat_.resize(max_height_, max_width_);
+    Allocate();
   }
 
   /* @brief: resize memory of SecureMat
@@ -54,7 +56,31 @@ public:
     }
     max_height_ = (resize_height > max_height_) ? resize_height : max_height_;
     max_width_ = (resize_width > max_width_) ? resize_width : max_width_;
-    mat_.resize(max_height_, max_width_);
+    Allocate();
+  }
+
+  /* @brief: bytes held by the padded storage. capacity only grows, so this
+   * doubles as the high-water mark of the matrix. */
+  size_t MemoryFootprint() const
+  {
+    return buffer_.capacity() * sizeof(T);
+  }
+
+  /* @brief: row stride of the padded storage, in elements */
+  size_t stride() const
+  {
+    return stride_;
+  }
+
+  /* @brief: pointer to the start of a row; every row starts 64-byte aligned */
+  const T *row_data(const size_t row) const
+  {
+    return data_ + row * stride_;
+  }
+
+  T *row_data(const size_t row)
+  {
+    return data_ + row * stride_;
   }
 
   void ToString(std::ostream *out_stream)
@@ -64,7 +90,7 @@ public:
     {
       for (size_t col = 0; col < width_; ++col)
       {
-        stream << mat_(row, col) << "\t";
+        stream << data_[row * stride_ + col] << "\t";
       }
       stream << "\n";
     }
@@ -72,16 +98,35 @@ public:
 
   inline const T &operator()(const size_t row, const size_t col) const
   {
-    return mat_(row, col);
+    return data_[row * stride_ + col];
   }
 
   inline T &operator()(const size_t row, const size_t col)
   {
-    return mat_(row, col);
+    return data_[row * stride_ + col];
   }
 
 private:
-  Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> mat_;
+  /* @brief: (re)allocate the padded storage for the current capacity.
+   * Rows are padded to the alignment quantum, so with a 64-byte aligned base
+   * every row starts on a cache-line/SIMD boundary. Capacity only grows, so
+   * steady-state frames never reallocate. */
+  void Allocate()
+  {
+    static_assert(kAlignment % sizeof(T) == 0, "element size must divide the alignment");
+    const size_t quantum = kAlignment / sizeof(T);
+    stride_ = ((max_width_ + quantum - 1) / quantum) * quantum;
+    buffer_.resize(max_height_ * stride_ + quantum);
+    auto const address = reinterpret_cast<std::uintptr_t>(buffer_.data());
+    auto const aligned = (address + kAlignment - 1) / kAlignment * kAlignment;
+    data_ = buffer_.data() + (aligned - address) / sizeof(T);
+  }
+
+  static constexpr size_t kAlignment = 64;
+
+  std::vector<T> buffer_;
+  T *data_ = nullptr;
+  size_t stride_ = 0;
   size_t max_height_ = 1000;
   size_t max_width_ = 1000;
   size_t height_ = 0;
@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief Process-wide interner mapping attribute names to small ids
+ *
+ * Attribute keys come from a fixed deployment vocabulary, so each distinct
+ * name is stored once and attribute entries carry a 32-bit id instead of
+ * their own std::string copy.
+ */
+class AttributeKeyRegistry
+{
+public:
+  static std::uint32_t intern(const std::string &key)
+  {
+    auto &registry = instance();
+    std::lock_guard<std::mutex> lock(registry.mMutex);
+
+    auto const entry = registry.mIds.find(key);
+    if (entry != registry.mIds.end())
+    {
+      return entry->second;
+    }
+
+    auto const keyId = static_cast<std::uint32_t>(registry.mNames.size());
+    registry.mNames.push_back(key);
+    registry.mIds.emplace(key, keyId);
+    return keyId;
+  }
+
+  static std::string name(std::uint32_t keyId)
+  {
+    auto &registry = instance();
+    std::lock_guard<std::mutex> lock(registry.mMutex);
+    return registry.mNames[keyId];
+  }
+
+private:
+  static AttributeKeyRegistry &instance()
+  {
+    static AttributeKeyRegistry registry;
+    return registry;
+  }
+
+  std::mutex mMutex;
+  std::unordered_map<std::string, std::uint32_t> mIds;
+  std::vector<std::string> mNames;
+};
+
+/**
+ * @brief AttributeSet: copy-on-write attribute storage with interned keys
+ *
+ * Copies share the underlying entry vector, so copying a TrackedObject
+ * through the tracking pipeline costs one shared_ptr increment instead of a
+ * node-by-node rebuild of an unordered_map. Mutation detaches from the shared
+ * state first.
+ */
+class AttributeSet
+{
+public:
+  AttributeSet() = default;
+
+  AttributeSet(const std::unordered_map<std::string, std::string> &values)
+  {
+    for (auto const &value : values)
+    {
+      set(value.first, value.second);
+    }
+  }
+
+  /**
+   * @brief Set or replace an attribute value
+   */
+  void set(const std::string &key, std::string value)
+  {
+    auto const keyId = AttributeKeyRegistry::intern(key);
+
+    auto entries
+      = mEntries ? std::make_shared<std::vector<Entry>>(*mEntries) : std::make_shared<std::vector<Entry>>();
+
+    auto const entry = std::find_if(
+      entries->begin(), entries->end(), [keyId](const Entry &candidate) { return candidate.keyId == keyId; });
+    if (entry != entries->end())
+    {
+      entry->value = std::move(value);
+    }
+    else
+    {
+      entries->push_back(Entry{keyId, std::move(value)});
+    }
+
+    mEntries = std::move(entries);
+    mGeneration = nextGeneration();
+  }
+
+  /**
+   * @brief Identifies the current attribute content snapshot
+   *
+   * Copies carry the generation of the set they were copied from; every
+   * mutation draws a fresh process-unique value. Consumers that convert the
+   * attributes to another representation (e.g. the Python bindings) can key a
+   * cache on it and skip the rebuild while the generation is unchanged. An
+   * empty, never-mutated set reports 0.
+   */
+  std::uint64_t generation() const
+  {
+    return mGeneration;
+  }
+
+  /**
+   * @brief Pointer to the value for the given key, nullptr when absent
+   */
+  const std::string *find(const std::string &key) const
+  {
+    if (!mEntries)
+    {
+      return nullptr;
+    }
+
+    auto const keyId = AttributeKeyRegistry::intern(key);
+    for (auto const &entry : *mEntries)
+    {
+      if (entry.keyId == keyId)
+      {
+        return &entry.value;
+      }
+    }
+    return nullptr;
+  }
+
+  bool contains(const std::string &key) const
+  {
+    return find(key) != nullptr;
+  }
+
+  std::size_t size() const
+  {
+    return mEntries ? mEntries->size() : 0;
+  }
+
+  bool empty() const
+  {
+    return size() == 0;
+  }
+
+  /**
+   * @brief Invoke callback(name, value) for every attribute
+   *
+   * Iterates the shared entry vector directly, so serialization does not
+   * need the map materialization of toMap()
+   */
+  template <typename Callback> void forEach(Callback &&callback) const
+  {
+    if (mEntries)
+    {
+      for (auto const &entry : *mEntries)
+      {
+        callback(AttributeKeyRegistry::name(entry.keyId), entry.value);
+      }
+    }
+  }
+
+  /**
+   * @brief Materialize the attributes as a plain map, e.g. for the bindings
+   */
+  std::unordered_map<std::string, std::string> toMap() const
+  {
+    std::unordered_map<std::string, std::string> values;
+    if (mEntries)
+    {
+      values.reserve(mEntries->size());
+      for (auto const &entry : *mEntries)
+      {
+        values.emplace(AttributeKeyRegistry::name(entry.keyId), entry.value);
+      }
+    }
+    return values;
+  }
+
+private:
+  struct Entry
+  {
+    std::uint32_t keyId;
+    std::string value;
+  };
+
+  static std::uint64_t nextGeneration()
+  {
+    static std::atomic<std::uint64_t> generation{0};
+    return ++generation;
+  }
+
+  std::shared_ptr<const std::vector<Entry>> mEntries;
+  std::uint64_t mGeneration{0};
+};
+
+} // namespace tracking
+} // namespace rv
@@ -5,6 +5,7 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -17,10 +18,96 @@ namespace tracking {
 
 using Classification = Eigen::VectorXd;
 
+/**
+ * @brief Compile-time-capacity classification vector
+ *
+ * The class list is fixed at deployment time, so the probabilities fit in a
+ * fixed block of kMaxClasses doubles, 64-byte aligned and zero padded. The
+ * padding keeps the kernels free of tail handling: they run over the full
+ * fixed trip count, which the compiler vectorizes, and the padded zeros
+ * contribute nothing to distances, products or sums. The vector sum and the
+ * dominant class/score are computed once on construction instead of per cost
+ * evaluation.
+ */
+class alignas(64) FixedClassification
+{
+public:
+  static constexpr std::size_t kMaxClasses = 16;
+
+  FixedClassification()
+  {
+    mValues.fill(0.);
+  }
+
+  /**
+   * @brief Construct from a dynamic classification; throws above kMaxClasses
+   */
+  explicit FixedClassification(const Classification &probabilities);
+
+  /**
+   * @brief Construct from a raw probability block, used by the kernels
+   */
+  FixedClassification(const double *values, std::size_t size);
+
+  inline std::size_t size() const
+  {
+    return mSize;
+  }
+
+  inline double operator[](std::size_t index) const
+  {
+    return mValues[index];
+  }
+
+  inline const double *data() const
+  {
+    return mValues.data();
+  }
+
+  inline double sum() const
+  {
+    return mSum;
+  }
+
+  /**
+   * @brief Index of the most probable class, -1 when empty
+   */
+  inline Eigen::Index dominantClass() const
+  {
+    return mDominantIndex;
+  }
+
+  inline double dominantScore() const
+  {
+    return mDominantScore;
+  }
+
+  Classification toEigen() const;
+
+private:
+  void finalize();
+
+  std::array<double, kMaxClasses> mValues;
+  std::size_t mSize{0};
+  double mSum{0.};
+  Eigen::Index mDominantIndex{-1};
+  double mDominantScore{0.};
+};
+
 namespace classification {
   double distance(const Classification & classificationA, const Classification & classificationB);
   Classification combine(const Classification & classificationA, const Classification & classificationB);
   double similarity(const Classification & classificationA, const Classification & classificationB);
+
+  /**
+   * @brief Allocation-free kernels over the fixed-capacity type
+   *
+   * Same math as the dynamic overloads, but no Eigen temporaries: the inputs
+   * and the result live in fixed stack blocks.
+   */
+  double distance(const FixedClassification & classificationA, const FixedClassification & classificationB);
+  FixedClassification combine(const FixedClassification & classificationA, const FixedClassification & classificationB);
+  double similarity(const FixedClassification & classificationA, const FixedClassification & classificationB);
 }
 
 class ClassificationData
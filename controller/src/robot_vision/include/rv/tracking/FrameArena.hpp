@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief FrameArena: frame-scoped monotonic allocator
+ *
+ * Backs the transient containers of one tracking iteration. Memory is handed
+ * out bump-pointer style from a buffer that outlives the frame; reset()
+ * reclaims everything in one shot, so steady-state frames whose working set
+ * fits the initial buffer never touch the global allocator.
+ */
+class FrameArena
+{
+public:
+  explicit FrameArena(std::size_t initialCapacity = 64 * 1024)
+    : mBuffer(initialCapacity)
+    , mResource(mBuffer.data(), mBuffer.size())
+  {
+  }
+
+  FrameArena(const FrameArena &) = delete;
+  FrameArena &operator=(const FrameArena &) = delete;
+
+  /**
+   * @brief Discard all allocations of the current frame
+   *
+   * Must not be called while containers backed by this arena are still alive.
+   */
+  void reset()
+  {
+    mResource.release();
+  }
+
+  std::pmr::memory_resource *resource()
+  {
+    return &mResource;
+  }
+
+private:
+  std::vector<char> mBuffer;
+  std::pmr::monotonic_buffer_resource mResource;
+};
+
+} // namespace tracking
+} // namespace rv
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if defined(RV_TRACKING_USE_ITT)
+#include <ittnotify.h>
+#endif
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief Pipeline stages timed inside MultipleObjectTracker::track
+ */
+enum class TrackingStage : std::size_t
+{
+  Predict = 0,
+  Associate,
+  Correct,
+  CreateTracks,
+  Count
+};
+
+inline const char *trackingStageName(TrackingStage stage)
+{
+  switch (stage)
+  {
+    case TrackingStage::Predict:
+      return "predict";
+    case TrackingStage::Associate:
+      return "associate";
+    case TrackingStage::Correct:
+      return "correct";
+    case TrackingStage::CreateTracks:
+      return "create_tracks";
+    default:
+      return "unknown";
+  }
+}
+
+/**
+ * @brief Latency distribution of one pipeline stage
+ *
+ * The histogram uses power-of-two microsecond buckets: bucket i counts
+ * samples in [2^i, 2^(i+1)) microseconds, with the first and last buckets
+ * absorbing the tails. Cheap enough to stay on in production and still
+ * coarse-grained enough to attribute a regression to a stage.
+ */
+struct StageStats
+{
+  static constexpr std::size_t kHistogramBuckets = 20;
+
+  uint64_t count{0};
+  double totalMicroseconds{0.};
+  double minMicroseconds{0.};
+  double maxMicroseconds{0.};
+  std::array<uint64_t, kHistogramBuckets> histogram{};
+
+  double averageMicroseconds() const
+  {
+    return count == 0 ? 0. : totalMicroseconds / static_cast<double>(count);
+  }
+
+  void record(double microseconds)
+  {
+    if (count == 0 || microseconds < minMicroseconds)
+    {
+      minMicroseconds = microseconds;
+    }
+    if (microseconds > maxMicroseconds)
+    {
+      maxMicroseconds = microseconds;
+    }
+    count++;
+    totalMicroseconds += microseconds;
+
+    std::size_t bucket = 0;
+    while (bucket + 1 < kHistogramBuckets && microseconds >= static_cast<double>(uint64_t{2} << bucket))
+    {
+      bucket++;
+    }
+    histogram[bucket]++;
+  }
+
+  std::string toString(const char *name) const
+  {
+    return std::string(name) + "( count:" + std::to_string(count) + ", avg_us:"
+      + std::to_string(averageMicroseconds()) + ", min_us:" + std::to_string(minMicroseconds) + ", max_us:"
+      + std::to_string(maxMicroseconds) + ")";
+  }
+};
+
+/**
+ * @brief Subsystems whose resident byte footprint is sampled once per frame
+ */
+enum class MemorySubsystem : std::size_t
+{
+  Estimators = 0,
+  MatcherScratch,
+  Snapshots,
+  Count
+};
+
+inline const char *memorySubsystemName(MemorySubsystem subsystem)
+{
+  switch (subsystem)
+  {
+    case MemorySubsystem::Estimators:
+      return "estimators";
+    case MemorySubsystem::MatcherScratch:
+      return "matcher_scratch";
+    case MemorySubsystem::Snapshots:
+      return "snapshots";
+    default:
+      return "unknown";
+  }
+}
+
+/**
+ * @brief Resident bytes of one subsystem with its high-water mark
+ *
+ * currentBytes is the footprint at the last sample, peakBytes the largest
+ * sample of the measurement window. Both derive from container capacities, so
+ * they report held memory rather than live objects and only shrink when the
+ * owning structures actually release their buffers.
+ */
+struct MemoryUsage
+{
+  uint64_t currentBytes{0};
+  uint64_t peakBytes{0};
+
+  void sample(uint64_t bytes)
+  {
+    currentBytes = bytes;
+    if (bytes > peakBytes)
+    {
+      peakBytes = bytes;
+    }
+  }
+
+  std::string toString(const char *name) const
+  {
+    return std::string(name) + "( current_bytes:" + std::to_string(currentBytes) + ", peak_bytes:"
+      + std::to_string(peakBytes) + ")";
+  }
+};
+
+/**
+ * @brief Per-stage latency statistics of the tracking pipeline
+ *
+ * Collected by the tracking thread; read it from the same thread or between
+ * frames. reset() starts a fresh measurement window.
+ */
+struct FrameStats
+{
+  std::array<StageStats, static_cast<std::size_t>(TrackingStage::Count)> stages{};
+
+  // Latency-budget degradation counters; see
+  // MultipleObjectTracker::setFrameLatencyBudget. A degraded frame skipped at
+  // least one association pass; deferred detections are the still-unmatched
+  // detections whose track creation moved to the next frame
+  uint64_t degradedFrames{0};
+  uint64_t skippedLowScorePasses{0};
+  uint64_t skippedSuspendedPasses{0};
+  uint64_t deferredDetections{0};
+
+  // Per-subsystem resident footprint, sampled at the end of every track()
+  // call. The estimator entry is the one that scales with the live track
+  // count; watch it when planning slot-map capacity or pooling work
+  std::array<MemoryUsage, static_cast<std::size_t>(MemorySubsystem::Count)> memory{};
+
+  const StageStats &stage(TrackingStage stage_) const
+  {
+    return stages[static_cast<std::size_t>(stage_)];
+  }
+
+  void record(TrackingStage stage_, double microseconds)
+  {
+    stages[static_cast<std::size_t>(stage_)].record(microseconds);
+  }
+
+  const MemoryUsage &memoryUsage(MemorySubsystem subsystem) const
+  {
+    return memory[static_cast<std::size_t>(subsystem)];
+  }
+
+  void sampleMemory(MemorySubsystem subsystem, uint64_t bytes)
+  {
+    memory[static_cast<std::size_t>(subsystem)].sample(bytes);
+  }
+
+  void reset()
+  {
+    *this = FrameStats{};
+  }
+
+  std::string toString() const
+  {
+    std::string text = "FrameStats(";
+    for (std::size_t i = 0; i < stages.size(); ++i)
+    {
+      text += " " + stages[i].toString(trackingStageName(static_cast<TrackingStage>(i)));
+    }
+    for (std::size_t i = 0; i < memory.size(); ++i)
+    {
+      text += " " + memory[i].toString(memorySubsystemName(static_cast<MemorySubsystem>(i)));
+    }
+    text += " degraded_frames:" + std::to_string(degradedFrames) + ", skipped_low_score_passes:"
+      + std::to_string(skippedLowScorePasses) + ", skipped_suspended_passes:"
+      + std::to_string(skippedSuspendedPasses) + ", deferred_detections:" + std::to_string(deferredDetections);
+    return text + " )";
+  }
+};
+
+#if defined(RV_TRACKING_USE_ITT)
+inline __itt_domain *trackingIttDomain()
+{
+  static __itt_domain *domain = __itt_domain_create("rv.tracking");
+  return domain;
+}
+#endif
+
+/**
+ * @brief Scoped timer feeding one stage of a FrameStats collector
+ *
+ * When built with RV_TRACKING_USE_ITT the same scope is annotated as an ITT
+ * task, so the stage boundaries line up with VTune captures.
+ */
+class ScopedStageTimer
+{
+public:
+  ScopedStageTimer(FrameStats &stats, TrackingStage stage)
+    : mStats(stats)
+    , mStage(stage)
+    , mStart(std::chrono::steady_clock::now())
+  {
+#if defined(RV_TRACKING_USE_ITT)
+    __itt_task_begin(trackingIttDomain(), __itt_null, __itt_null,
+                     __itt_string_handle_create(trackingStageName(stage)));
+#endif
+  }
+
+  ~ScopedStageTimer()
+  {
+#if defined(RV_TRACKING_USE_ITT)
+    __itt_task_end(trackingIttDomain());
+#endif
+    auto const elapsed = std::chrono::steady_clock::now() - mStart;
+    mStats.record(mStage, std::chrono::duration<double, std::micro>(elapsed).count());
+  }
+
+  ScopedStageTimer(const ScopedStageTimer &) = delete;
+  ScopedStageTimer &operator=(const ScopedStageTimer &) = delete;
+
+private:
+  FrameStats &mStats;
+  TrackingStage mStage;
+  std::chrono::steady_clock::time_point mStart;
+};
+
+} // namespace tracking
+} // namespace rv
+
+// Scoped stage timing, compiled out entirely with RV_TRACKING_DISABLE_STATS
+#if !defined(RV_TRACKING_DISABLE_STATS)
+#define RV_TRACKING_STATS_CONCAT_IMPL(a, b) a##b
+#define RV_TRACKING_STATS_CONCAT(a, b) RV_TRACKING_STATS_CONCAT_IMPL(a, b)
+#define RV_TRACKING_STATS_SCOPE(stats, stage)                                                                          \
+  rv::tracking::ScopedStageTimer RV_TRACKING_STATS_CONCAT(statsScope, __LINE__)((stats), (stage))
+#else
+#define RV_TRACKING_STATS_SCOPE(stats, stage) static_cast<void>(0)
+#endif
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief One connected component of the track/measurement gating graph
+ *
+ * Indices refer to the views passed to gatedConnectedComponents(). A component
+ * with an empty measurement list is a track that gated out entirely (and vice
+ * versa); callers can short-circuit those without running a solver.
+ */
+struct GatedComponent
+{
+  std::vector<std::size_t> trackIndices;
+  std::vector<std::size_t> measurementIndices;
+};
+
+/**
+ * @brief Label the connected components of the gating graph in parallel
+ *
+ * The bipartite graph has an edge between a track and a measurement when they
+ * are within gateRadius of each other. Unlike
+ * apollo::perception::common::ConnectedComponentAnalysis, no adjacency lists
+ * (and no dense cost matrix) are materialized: edges are discovered straight
+ * from a SpatialGridIndex radius query and merged into a lock-free union-find,
+ * with the per-track edge scans running on the worker pool. A final sequential
+ * pass compacts the union-find roots into dense component labels, so the whole
+ * discovery is O(nodes + in-gate edges) and stays well under a millisecond at
+ * thousands of nodes.
+ *
+ * Components are emitted in order of their lowest node, with track and
+ * measurement indices ascending, so the decomposition is deterministic
+ * regardless of worker scheduling.
+ */
+std::vector<GatedComponent>
+gatedConnectedComponents(const TrackView &tracks, const TrackView &measurements, double gateRadius);
+
+} // namespace tracking
+} // namespace rv
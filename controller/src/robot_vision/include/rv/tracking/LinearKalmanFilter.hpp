@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "rv/tracking/MultiModelKalmanEstimator.hpp"
+#include "rv/tracking/UnscentedKalmanFilter.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief LinearKalmanFilterMod: closed-form Kalman filter for the linear motion models
+ *
+ * CV, CA and CP have linear state-transition and measurement functions, so
+ * the unscented transform adds cost without adding information: propagating
+ * 2*DP+1 sigma points through F only reconstructs F*P*F^T. This filter
+ * implements the staged predict interface of UnscentedKalmanFilterMod with
+ * the standard linear Kalman equations — the mean is the single propagation
+ * column (which the batched engine gathers like a one-column sigma-point
+ * set), the covariance propagates in closed form against the model's
+ * transition matrix, and the measurement statistics project through the
+ * constant selection matrix H. The IMM combination on top sees the same
+ * estimates; only the nonlinear CTRV model keeps paying the UKF cost.
+ */
+class LinearKalmanFilterMod : public cv::detail::tracking::UnscentedKalmanFilterMod
+{
+public:
+  LinearKalmanFilterMod(const cv::detail::tracking::UnscentedKalmanFilterParams &params, MotionModel motionModel);
+
+  void computeSigmaPoints() override;
+  void propagateSigmaPoints(cv::InputArray control) override;
+  cv::Mat finishPredict(double deltaT) override;
+  cv::Mat correct(cv::InputArray measurement) override;
+
+  size_t memoryFootprint() const override
+  {
+    return UnscentedKalmanFilterMod::memoryFootprint() + mMeasurementMatrix.total() * mMeasurementMatrix.elemSize();
+  }
+
+private:
+  MotionModel mMotionModel;
+  cv::Mat mMeasurementMatrix; ///< constant selection matrix H, MP x DP
+};
+
+} // namespace tracking
+} // namespace rv
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cmath>
+
+#include "rv/tracking/TrackedObject.hpp"
+#include "rv/tracking/UnscentedKalmanFilterT.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief Fixed-size Eigen ports of the motion models for UnscentedKalmanFilterT
+ *
+ * These mirror the cv::Mat based CPModel/CVModel/CAModel/CTRVModel equations over
+ * the TrackedObject state layout (12 states, 7 measurements) without any per-call
+ * allocation. The shared measurement function picks x, y, z, length, width, height
+ * and yaw out of the state vector exactly as the cv::Mat models do.
+ */
+constexpr int TrackedObjectStateSize = 12;
+constexpr int TrackedObjectMeasurementSize = 7;
+
+using TrackedObjectSystemModelT = UkfSystemModelT<TrackedObjectStateSize, TrackedObjectMeasurementSize>;
+using TrackedObjectFilterT = UnscentedKalmanFilterT<TrackedObjectStateSize, TrackedObjectMeasurementSize>;
+
+namespace detail {
+inline void trackedObjectMeasurementFunction(const TrackedObjectSystemModelT::StateVector &x_k,
+                                             TrackedObjectSystemModelT::MeasurementVector &z_k)
+{
+  z_k(0) = x_k(0);  // Position in X
+  z_k(1) = x_k(1);  // Position in Y
+  z_k(2) = x_k(6);  // Position in Z
+  z_k(3) = x_k(7);  // Length
+  z_k(4) = x_k(8);  // Width
+  z_k(5) = x_k(9);  // Height
+  z_k(6) = x_k(10); // Yaw
+}
+} // namespace detail
+
+/**
+ * @brief Constant position model over fixed-size vectors (see CPModel)
+ */
+class CPModelT : public TrackedObjectSystemModelT
+{
+public:
+  void stateConversionFunction(const StateVector &x_k, double /*deltaT*/, StateVector &x_kplus1) const override
+  {
+    x_kplus1 = x_k;
+    x_kplus1(2) = 0.;  // Velocity in X
+    x_kplus1(3) = 0.;  // Velocity in Y
+    x_kplus1(4) = 0.;  // Acceleration in X
+    x_kplus1(5) = 0.;  // Acceleration in Y
+    x_kplus1(11) = 0.; // Yaw Rate
+  }
+
+  void measurementFunction(const StateVector &x_k, MeasurementVector &z_k) const override
+  {
+    detail::trackedObjectMeasurementFunction(x_k, z_k);
+  }
+};
+
+/**
+ * @brief Constant velocity model over fixed-size vectors (see CVModel)
+ */
+class CVModelT : public TrackedObjectSystemModelT
+{
+public:
+  void stateConversionFunction(const StateVector &x_k, double deltaT, StateVector &x_kplus1) const override
+  {
+    x_kplus1 = x_k;
+    x_kplus1(0) = x_k(0) + x_k(2) * deltaT; // Position in X
+    x_kplus1(1) = x_k(1) + x_k(3) * deltaT; // Position in Y
+    x_kplus1(4) = 0.;                       // Acceleration in X
+    x_kplus1(5) = 0.;                       // Acceleration in Y
+    x_kplus1(11) = 0.;                      // Yaw Rate
+  }
+
+  void measurementFunction(const StateVector &x_k, MeasurementVector &z_k) const override
+  {
+    detail::trackedObjectMeasurementFunction(x_k, z_k);
+  }
+};
+
+/**
+ * @brief Constant acceleration model over fixed-size vectors (see CAModel)
+ */
+class CAModelT : public TrackedObjectSystemModelT
+{
+public:
+  void stateConversionFunction(const StateVector &x_k, double deltaT, StateVector &x_kplus1) const override
+  {
+    x_kplus1 = x_k;
+    x_kplus1(0) = x_k(0) + x_k(2) * deltaT + 0.5 * x_k(4) * deltaT * deltaT; // Position in X
+    x_kplus1(1) = x_k(1) + x_k(3) * deltaT + 0.5 * x_k(5) * deltaT * deltaT; // Position in Y
+    x_kplus1(2) = x_k(2) + x_k(4) * deltaT;                                  // Velocity in X
+    x_kplus1(3) = x_k(3) + x_k(5) * deltaT;                                  // Velocity in Y
+    x_kplus1(11) = 0.;                                                       // Yaw Rate
+  }
+
+  void measurementFunction(const StateVector &x_k, MeasurementVector &z_k) const override
+  {
+    detail::trackedObjectMeasurementFunction(x_k, z_k);
+  }
+};
+
+/**
+ * @brief Constant turn rate and velocity model over fixed-size vectors (see CTRVModel)
+ */
+class CTRVModelT : public TrackedObjectSystemModelT
+{
+public:
+  void stateConversionFunction(const StateVector &x_k, double deltaT, StateVector &x_kplus1) const override
+  {
+    double x = x_k(0);
+    double y = x_k(1);
+    double vx = x_k(2);
+    double vy = x_k(3);
+    double w = x_k(11);
+
+    double v = std::sqrt(vx * vx + vy * vy);
+    double velocityYaw = std::atan2(vy, vx);      // Velocity yaw
+    double nextYaw = velocityYaw + w * deltaT;    // Velocity yaw for the next time iteration
+
+    double cosNextYaw = std::cos(nextYaw);
+    double sinNextYaw = std::sin(nextYaw);
+
+    x_kplus1 = x_k;
+
+    if (std::fabs(w) >= 1e-3)
+    {
+      x_kplus1(0) = x + v / w * (sinNextYaw - std::sin(velocityYaw)); // Position in X
+      x_kplus1(1) = y + v / w * (std::cos(velocityYaw) - cosNextYaw); // Position in Y
+    }
+    else
+    {
+      // as the turn rate converges to zero, the equations are:
+      x_kplus1(0) = x + v * cosNextYaw * deltaT; // Position in X
+      x_kplus1(1) = y + v * sinNextYaw * deltaT; // Position in Y
+    }
+
+    x_kplus1(2) = v * cosNextYaw; // Velocity in X
+    x_kplus1(3) = v * sinNextYaw; // Velocity in Y
+    x_kplus1(4) = 0.;             // Acceleration in X
+    x_kplus1(5) = 0.;             // Acceleration in Y
+  }
+
+  void measurementFunction(const StateVector &x_k, MeasurementVector &z_k) const override
+  {
+    detail::trackedObjectMeasurementFunction(x_k, z_k);
+  }
+};
+
+} // namespace tracking
+} // namespace rv
@@ -61,10 +61,64 @@ public:
    */
   void correct(const TrackedObject &measurement);
 
+  /**
+   * @brief Staged prediction interface for the batched engine
+   *
+   * beginBatchedPredict() runs the IMM interaction and draws each model's
+   * sigma points; the caller then propagates them (in bulk for the linear
+   * models, or per model via propagateModel()) and finishBatchedPredict()
+   * folds the propagated points into the combined estimate. The sequence
+   * begin / propagate-all / finish is equivalent to predict(deltaT).
+   */
+  void beginBatchedPredict();
+  void propagateModel(std::size_t modelIndex, double deltaT);
+  void finishBatchedPredict(double deltaT);
+
+  /**
+   * @brief Enable adaptive model pruning
+   *
+   * A model whose probability stays below probabilityFloor for frames
+   * consecutive corrected frames is suspended: its filter stops propagating
+   * and keeps its last estimate, which only enters the combination with its
+   * (tiny) probability. Suspended models are reactivated from the combined
+   * estimate when the measurement innovation spikes. frames == 0 disables
+   * pruning; the most probable model is never suspended.
+   */
+  void setModelPruning(double probabilityFloor, uint32_t frames)
+  {
+    mPruneProbabilityFloor = probabilityFloor;
+    mPruneFrames = frames;
+  }
+
+  bool isModelActive(std::size_t modelIndex) const
+  {
+    return mModelActive[modelIndex];
+  }
+
+  std::size_t modelCount() const
+  {
+    return mNumberOfModels;
+  }
+
+  MotionModel motionModel(std::size_t modelIndex) const
+  {
+    return mMotionModels[modelIndex];
+  }
+
+  const cv::Mat &modelSigmaPoints(std::size_t modelIndex) const
+  {
+    return mKalmanFilters[modelIndex]->currentSigmaPoints();
+  }
+
+  cv::Mat &modelTransitionValues(std::size_t modelIndex)
+  {
+    return mKalmanFilters[modelIndex]->transitionValues();
+  }
+
   /**
    * @brief Const access to the current state
    */
-  TrackedObject currentState() const
+  const TrackedObject &currentState() const
   {
     return mCurrentState;
   }
@@ -74,6 +128,17 @@ public:
     return mSystemModelStates;
   }
 
+  /**
+   * @brief Bytes held by this track's filter bank
+   *
+   * Sums the state and scratch matrices of every model's filter plus the IMM
+   * probability matrices; the small per-model vectors and the cached
+   * TrackedObject states are not counted. The value is fixed by the state
+   * dimensions at initialize() time, so it reads as the per-track matrix cost
+   * when planning slot-map capacity or pooling work.
+   */
+  std::size_t memoryFootprint() const;
+
   std::chrono::system_clock::time_point getTimestamp()
   {
     return mLastTimestamp;
@@ -95,15 +160,30 @@ private:
   TrackedObject mCurrentState;
   std::chrono::system_clock::time_point mLastTimestamp;
 
+  /**
+   * @brief Construct the system models and filters for the requested model set
+   *
+   * Only runs when a pooled estimator cannot be re-armed in place, i.e. on
+   * first use or when the configured motion models changed
+   */
+  void buildFilters(const TrackedObject &track, const std::vector<MotionModel> &motionModels, double processNoise, double measurementNoise, double initStateCovariance);
+
   /**
    * @brief Trigger the state prediction step
    */
   void predictState(const double deltaT);
 
   /**
-   * @brief Trigger the state prediction step
+   * @brief Second half of the prediction step, shared by predictState and
+   * finishBatchedPredict
    */
-  void singleModelPredict(double deltaT);
+  void finishPredictState(const double deltaT);
+
+  /**
+   * @brief Update the pruning counters after a correction step and
+   * suspend/reactivate models accordingly
+   */
+  void updateModelPruning(const cv::Mat &measurementVector);
 
   /**
    * @brief Correct the current state by measuring the current object state
@@ -129,10 +209,13 @@ private:
 
   /**
    * @brief Updates the Model Probability to be used in the correction step
+   *
+   * Takes the inverted innovation covariances S^-1 as cached by the filters'
+   * correct() step, so each S is decomposed only once per correction.
    */
   static void updateModelProbability(cv::Mat const &measurement,
                                      std::vector<cv::Mat> const &predictedMeasurements,
-                                     std::vector<cv::Mat> const &measurementNoiseCovariance,
+                                     std::vector<cv::Mat> const &measurementCovInverses,
                                      cv::Mat &modelProbability,
                                      double maxProbability,
                                      double minProbability);
@@ -159,6 +242,13 @@ private:
 
   std::vector<cv::Ptr<cv::detail::tracking::UnscentedKalmanFilterMod>> mKalmanFilters;
   std::vector<cv::Ptr<cv::detail::tracking::UkfSystemModel>> mSystemModels;
+  std::vector<MotionModel> mMotionModels;
+
+  // adaptive pruning state; all models start active
+  std::vector<bool> mModelActive;
+  std::vector<uint32_t> mLowProbabilityFrames;
+  double mPruneProbabilityFloor{0.05};
+  uint32_t mPruneFrames{0u};
 
   double mMaxProbability{1.};
   double mMinProbability{0.95};
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include "rv/tracking/FrameArena.hpp"
+#include "rv/tracking/FrameStats.hpp"
 #include "rv/tracking/ObjectMatching.hpp"
 #include "rv/tracking/TrackManager.hpp"
 #include "rv/tracking/TrackedObject.hpp"
 
 #include <chrono>
+#include <unordered_set>
 #include <vector>
 
 namespace rv {
@@ -50,6 +53,23 @@ public:
              const DistanceType & distanceType, double distanceThreshold,
              double scoreThreshold = 0.50);
 
+  /**
+   * @brief Zero-copy ingestion over a caller-owned span of detections
+   *
+   * The detections are neither copied nor reordered: the pipeline partitions
+   * an index workspace in place across the reliable/low-score/unreliable/
+   * suspended stages. The span only needs to stay valid for the duration of
+   * the call; the vector overloads forward here.
+   */
+  void track(const tracking::TrackedObject *objects, std::size_t objectCount,
+             const std::chrono::system_clock::time_point &timestamp,
+             double scoreThreshold = 0.50);
+
+  void track(const tracking::TrackedObject *objects, std::size_t objectCount,
+             const std::chrono::system_clock::time_point &timestamp,
+             const DistanceType & distanceType, double distanceThreshold,
+             double scoreThreshold = 0.50);
+
   /**
    * @brief Sets the list of measurements from multiple cameras and triggers the tracking procedure
    * @param objectsPerCamera Vector of vectors, where each inner vector contains objects from one camera
@@ -91,6 +111,71 @@ public:
     return mTrackManager.getTracks();
   }
 
+  /**
+   * @brief Latest frame snapshot, safe to read while track() is running
+   *
+   */
+  inline std::shared_ptr<const TrackSnapshot> getTrackSnapshot() const
+  {
+    return mTrackManager.getTrackSnapshot();
+  }
+
+  /**
+   * @brief Extrapolate the last published snapshot to a future timestamp
+   *
+   * Thread-safe and non-destructive; see TrackManager::predictTo. Intended
+   * for publishing high-rate interpolated scene updates between camera
+   * frames.
+   */
+  inline std::shared_ptr<const TrackSnapshot> predictTo(const std::chrono::system_clock::time_point &timestamp) const
+  {
+    return mTrackManager.predictTo(timestamp);
+  }
+
+  /**
+   * @brief Recent trajectory of a track, oldest sample first
+   *
+   * Requires mTrackHistoryCapacity in the tracker config; empty otherwise.
+   */
+  inline std::vector<TrackHistorySample> getTrackHistory(const Id &id) const
+  {
+    return mTrackManager.getTrackHistory(id);
+  }
+
+  /**
+   * @brief Register a track under the id it already carries
+   *
+   * Used by the cross-shard handoff; see TrackManager::adoptTrack.
+   */
+  inline Id adoptTrack(const TrackedObject &object, const std::chrono::system_clock::time_point &timestamp)
+  {
+    return mTrackManager.adoptTrack(object, timestamp);
+  }
+
+  /**
+   * @brief Remove a track from the tracker (active or suspended)
+   */
+  inline void removeTrack(const Id &id)
+  {
+    mTrackManager.deleteTrack(id);
+  }
+
+  /**
+   * @brief Whether the tracker holds a track with this id
+   */
+  inline bool hasTrack(const Id &id)
+  {
+    return mTrackManager.hasId(id);
+  }
+
+  /**
+   * @brief Seed the auto-generated track id sequence; see TrackManager::seedTrackIds
+   */
+  inline void seedTrackIds(Id seed)
+  {
+    mTrackManager.seedTrackIds(seed);
+  }
+
   /**
    * @brief Updates the frame-based params in mTrackManager
    *
@@ -109,13 +194,111 @@ public:
     return mLastTimestamp;
   }
 
+  /**
+   * @brief Sets the spatial gating radius used to build sparse cost matrices
+   *
+   * A non-positive radius disables explicit gating; Euclidean distance types
+   * then still gate implicitly at the distance threshold.
+   */
+  inline void setGatingRadius(double gatingRadius)
+  {
+    mGatingRadius = gatingRadius;
+  }
+
+  /**
+   * @brief Enables warm-started association seeded from the previous frame
+   *
+   * Tracks that carried an assignment in the previous frame are paired with
+   * their mutual-nearest in-gate measurement first; only the residual sets go
+   * through the full Hungarian solve.
+   */
+  inline void setIncrementalMatching(bool enable)
+  {
+    mIncrementalMatching = enable;
+  }
+
+  /**
+   * @brief Enables per-class partitioned association
+   *
+   * Tracks and measurements are bucketed by dominant class and each bucket is
+   * solved as an independent Hungarian problem in parallel, so cross-class
+   * pairs never enter a cost matrix. Takes precedence over incremental
+   * matching when both are enabled.
+   */
+  inline void setPartitionedMatching(bool enable)
+  {
+    mPartitionedMatching = enable;
+  }
+
+  /**
+   * @brief Frame latency budget in microseconds; 0 (default) disables it
+   *
+   * When the elapsed time of a frame exceeds the budget mid-pipeline, the
+   * tracker degrades gracefully instead of falling further behind: the
+   * low-score confirmation pass and the suspended-track matching are skipped,
+   * and new-track creation for the still-unmatched detections is deferred to
+   * the next frame (they re-enter with that frame's detections). The skips
+   * are reported through the frame stats counters.
+   */
+  inline void setFrameLatencyBudget(double microseconds)
+  {
+    mFrameBudgetMicroseconds = microseconds;
+  }
+
+  /**
+   * @brief Per-stage latency statistics and per-subsystem memory footprints
+   * accumulated across track() calls
+   *
+   * Collected by the tracking thread; read from the same thread or between
+   * frames. Compiled out (empty stats) with RV_TRACKING_DISABLE_STATS.
+   */
+  inline FrameStats getFrameStats() const
+  {
+    return mFrameStats;
+  }
+
+  /**
+   * @brief Start a fresh measurement window
+   */
+  inline void resetFrameStats()
+  {
+    mFrameStats.reset();
+  }
+
 private:
   TrackManager mTrackManager;
   DistanceType mDistanceType;
   double mDistanceThreshold{5.0};
+  double mGatingRadius{0.};
+  bool mIncrementalMatching{false};
+  bool mPartitionedMatching{false};
+  double mFrameBudgetMicroseconds{0.};
+
+  FrameStats mFrameStats;
+
+  /**
+   * @brief Track ids that received a measurement in the previous and in the
+   * current frame, used to seed incremental matching
+   */
+  std::unordered_set<Id> mLastAssignedTrackIds;
+  std::unordered_set<Id> mFrameAssignedTrackIds;
+
+  /**
+   * @brief Frame-scoped arena backing the transient pipeline containers,
+   * reset once per track() call
+   */
+  FrameArena mArena;
 
   std::chrono::system_clock::time_point mLastTimestamp;
 
+  /**
+   * @brief Sample the per-subsystem resident footprint into the frame stats
+   *
+   * Runs at the end of every track() call; compiled out with
+   * RV_TRACKING_DISABLE_STATS.
+   */
+  void sampleMemoryStats();
+
   /**
    * @brief Helper function to match tracks with objects and update measurements
    *
@@ -126,12 +309,29 @@ private:
    * @param[out] unassignedObjects Indices of objects that were not assigned to any track
    * @return Updated vector of unassigned tracks
    */
-  std::vector<tracking::TrackedObject> matchAndAssignMeasurements(
-    const std::vector<tracking::TrackedObject> &tracks,
+  tracking::TrackView matchAndAssignMeasurements(
+    const tracking::TrackView &tracks,
     const std::vector<tracking::TrackedObject> &objects,
     const DistanceType &distanceType,
     double distanceThreshold,
-    std::vector<size_t> &unassignedObjects);
+    IndexVector &unassignedObjects);
+
+  /**
+   * @brief View-based variant used by the span ingestion path; the reported
+   * unassigned indices refer to positions in the object view
+   */
+  tracking::TrackView matchAndAssignMeasurements(
+    const tracking::TrackView &tracks,
+    const tracking::TrackView &objects,
+    const DistanceType &distanceType,
+    double distanceThreshold,
+    IndexVector &unassignedObjects);
+
+  /**
+   * @brief Indices of tracks in the view that were assigned in the previous
+   * frame; empty unless incremental matching is enabled
+   */
+  IndexVector seededTrackIndices(const tracking::TrackView &tracks, std::pmr::memory_resource *resource);
 
   /**
    * @brief Helper function to match tracks with objects batched from multiple cameras
@@ -144,8 +344,8 @@ private:
    * @param distanceThreshold Maximum distance for matching
    * @return Updated vector of unassigned tracks
    */
-  std::vector<tracking::TrackedObject> matchAndAssignMeasurements(
-    const std::vector<tracking::TrackedObject> &tracks,
+  tracking::TrackView matchAndAssignMeasurements(
+    const tracking::TrackView &tracks,
     std::vector<std::vector<tracking::TrackedObject>> &objectsPerCamera,
     const DistanceType &distanceType,
     double distanceThreshold);
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
 #include "rv/tracking/TrackedObject.hpp"
@@ -27,12 +29,93 @@ enum class DistanceType
   MCEMahalanobis
 };
 
+/**
+ * @brief Allocator-aware containers for association results
+ *
+ * The tracking pipeline backs these with its frame arena; standalone callers
+ * get the default resource.
+ */
+using IndexVector = std::pmr::vector<size_t>;
+using AssignmentVector = std::pmr::vector<std::pair<size_t, size_t>>;
+
+/**
+ * @brief Associate measurements to tracks with a gated Hungarian matcher
+ *
+ * When gatingRadius is positive (or implied by a Euclidean distance type's
+ * threshold), measurements are indexed in a uniform grid and only pairs within
+ * the gating radius get a distance computed; everything else is written as the
+ * matcher's bound value, so the cost matrix is built in near-linear time and the
+ * matcher decomposes into small independent subproblems.
+ */
 void match(const std::vector<TrackedObject> &tracks,
             const std::vector<TrackedObject> &measurements,
             std::vector<std::pair<size_t, size_t>> &assignments,
             std::vector<size_t> &unassignedTracks,
             std::vector<size_t> &unassignedMeasurements,
-            const DistanceType &distanceType, double threshold);
+            const DistanceType &distanceType, double threshold,
+            double gatingRadius = 0.);
+
+/**
+ * @brief View-based overload used by the tracking pipeline
+ *
+ * Operates on non-owning views so callers can associate against track state
+ * without copying it out of the estimator stores first.
+ */
+void match(const TrackView &tracks,
+            const TrackView &measurements,
+            AssignmentVector &assignments,
+            IndexVector &unassignedTracks,
+            IndexVector &unassignedMeasurements,
+            const DistanceType &distanceType, double threshold,
+            double gatingRadius = 0.);
+
+/**
+ * @brief Partitioned association: one Hungarian problem per dominant class
+ *
+ * The multi-class distance inflates cross-class costs so far that cross-class
+ * assignments never survive the threshold in practice; partitioning makes
+ * that explicit. Tracks and measurements are bucketed by their dominant class
+ * (the index of classification.maxCoeff()) and each bucket is solved as an
+ * independent, parallel match() over only its own pairs, dividing the
+ * quadratic term by the number of classes in mixed scenes. Objects whose
+ * class has no counterpart on the other side are reported unassigned.
+ */
+void matchByClass(const TrackView &tracks,
+            const TrackView &measurements,
+            AssignmentVector &assignments,
+            IndexVector &unassignedTracks,
+            IndexVector &unassignedMeasurements,
+            const DistanceType &distanceType, double threshold,
+            double gatingRadius = 0.);
+
+/**
+ * @brief Incremental association seeded from the previous frame
+ *
+ * seededTracks holds indices into tracks that carried an assignment in the
+ * previous frame. Each seed is paired greedily with its mutual-nearest
+ * measurement inside the gate, and only the residual unmatched sets go
+ * through the full Hungarian solve. Falls back to match() when no spatial
+ * gate applies (e.g. Mahalanobis distances without an explicit radius).
+ */
+void matchIncremental(const TrackView &tracks,
+            const TrackView &measurements,
+            const IndexVector &seededTracks,
+            AssignmentVector &assignments,
+            IndexVector &unassignedTracks,
+            IndexVector &unassignedMeasurements,
+            const DistanceType &distanceType, double threshold,
+            double gatingRadius = 0.);
+
+/**
+ * @brief Bytes held by the calling thread's persistent matcher scratch
+ *
+ * Every thread running match() keeps a thread_local gated Hungarian matcher
+ * plus the bridge vectors at the apollo boundary; both grow monotonically and
+ * persist across frames. The value covers the calling thread only: sampled
+ * from the tracking thread it reports the serial association passes, while
+ * matchers living on worker pool threads are not included.
+ */
+std::size_t matcherScratchFootprint();
 
 } // namespace tracking
 } // namespace rv
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "rv/tracking/MultipleObjectTracker.hpp"
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+
+struct ShardedSceneTrackerConfig
+{
+  // Sorted x coordinates of the boundaries between adjacent shards; N - 1
+  // entries partition the scene into N strips along x
+  std::vector<double> mBoundaries;
+
+  // Width (m) of the sticky band on either side of a boundary. A track only
+  // hands off after moving this far into the neighboring strip, and
+  // detections inside the band route to whichever adjacent shard holds the
+  // nearest track, so a track oscillating around a boundary does not thrash
+  // between owners
+  double mHandoffHysteresis{2.0};
+
+  DistanceType mDistanceType{DistanceType::MultiClassEuclidean};
+  double mDistanceThreshold{5.0};
+
+  TrackManagerConfig mTrackerConfig;
+};
+
+/**
+ * @brief ShardedSceneTracker: One scene spatially partitioned over trackers
+ *
+ * Scenes too large for a single tracker at frame rate are split into strips
+ * along x; each strip is owned by its own MultipleObjectTracker and the
+ * strips track concurrently on the shared worker pool. Detections route to
+ * the shard owning their position, with a hysteresis band around each
+ * boundary where they follow the nearest existing track instead, and tracks
+ * that move past a boundary by more than the band hand their state off to
+ * the neighboring shard through the flat TrackedObject serialization,
+ * keeping their id (the shards draw ids from disjoint ranges). The handoff
+ * carries the combined track state; the receiving shard re-initializes its
+ * estimator from it, the same way a restored snapshot does.
+ *
+ * The shard boundaries here separate trackers inside one process; the same
+ * routing and handoff rules apply when the shards live on different
+ * machines and the serialized handoff blob travels over the wire.
+ */
+class ShardedSceneTracker
+{
+public:
+  explicit ShardedSceneTracker(const ShardedSceneTrackerConfig &config);
+
+  ShardedSceneTracker(const ShardedSceneTracker &) = delete;
+  ShardedSceneTracker &operator=(const ShardedSceneTracker &) = delete;
+
+  std::size_t shardCount() const
+  {
+    return mShards.size();
+  }
+
+  /**
+   * @brief Route the detections to their shards and track one frame
+   *
+   * All shards track concurrently; boundary crossers hand off afterwards,
+   * so a handoff becomes visible in the receiving shard's next frame.
+   */
+  void track(std::vector<TrackedObject> detections,
+             const std::chrono::system_clock::time_point &timestamp,
+             double scoreThreshold = 0.50);
+
+  /**
+   * @brief All active tracks across the shards
+   */
+  std::vector<TrackedObject> getTracks();
+
+  /**
+   * @brief All reliable tracks across the shards
+   */
+  std::vector<TrackedObject> getReliableTracks();
+
+  /**
+   * @brief Tracks handed off between shards since construction
+   */
+  uint64_t handoffCount() const
+  {
+    return mHandoffs;
+  }
+
+  /**
+   * @brief Direct access to one shard's tracker
+   */
+  MultipleObjectTracker &shard(std::size_t shardIndex)
+  {
+    return mShards[shardIndex]->tracker;
+  }
+
+private:
+  struct Shard
+  {
+    Shard(const ShardedSceneTrackerConfig &config)
+      : tracker(config.mTrackerConfig, config.mDistanceType, config.mDistanceThreshold)
+    {
+    }
+
+    MultipleObjectTracker tracker;
+    std::vector<TrackedObject> frameDetections;
+  };
+
+  /// Strip owning the position: index of the first boundary above x
+  std::size_t shardOf(double x) const;
+
+  /// Owner shard with the sticky-band override for boundary detections
+  std::size_t routeDetection(const TrackedObject &detection) const;
+
+  /// Move tracks that left their strip by more than the hysteresis band
+  void handoffBoundaryCrossers(const std::chrono::system_clock::time_point &timestamp);
+
+  ShardedSceneTrackerConfig mConfig;
+  std::vector<std::unique_ptr<Shard>> mShards;
+  uint64_t mHandoffs{0};
+};
+
+} // namespace tracking
+} // namespace rv
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief SpatialGridIndex: Uniform-grid index over object x/y positions
+ *
+ * Buckets objects into square cells of the gating radius so radius queries only
+ * touch the 3x3 cell neighbourhood instead of scanning the whole population.
+ * Used to build sparse cost matrices in match(): pairs further apart than the
+ * gating radius never get a distance computed.
+ */
+class SpatialGridIndex
+{
+public:
+  explicit SpatialGridIndex(double cellSize)
+    : mCellSize(cellSize)
+  {
+  }
+
+  /**
+   * @brief Index the given objects; indices reported by queries refer to this vector
+   */
+  void build(const std::vector<TrackedObject> &objects)
+  {
+    mX.clear();
+    mY.clear();
+    mCells.clear();
+
+    mX.reserve(objects.size());
+    mY.reserve(objects.size());
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+      mX.push_back(objects[i].x);
+      mY.push_back(objects[i].y);
+      mCells[cellKey(cellCoordinate(objects[i].x), cellCoordinate(objects[i].y))].push_back(i);
+    }
+  }
+
+  /**
+   * @brief Index the objects behind a non-owning view
+   */
+  void build(const TrackView &objects)
+  {
+    mX.clear();
+    mY.clear();
+    mCells.clear();
+
+    mX.reserve(objects.size());
+    mY.reserve(objects.size());
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+      mX.push_back(objects[i]->x);
+      mY.push_back(objects[i]->y);
+      mCells[cellKey(cellCoordinate(objects[i]->x), cellCoordinate(objects[i]->y))].push_back(i);
+    }
+  }
+
+  /**
+   * @brief Invoke callback(index) for every indexed object within radius of (x, y)
+   */
+  template <typename Callback> void forEachInRadius(double x, double y, double radius, Callback &&callback) const
+  {
+    auto const minCellX = cellCoordinate(x - radius);
+    auto const maxCellX = cellCoordinate(x + radius);
+    auto const minCellY = cellCoordinate(y - radius);
+    auto const maxCellY = cellCoordinate(y + radius);
+
+    auto const radiusSquared = radius * radius;
+
+    for (auto cellX = minCellX; cellX <= maxCellX; ++cellX)
+    {
+      for (auto cellY = minCellY; cellY <= maxCellY; ++cellY)
+      {
+        auto const cell = mCells.find(cellKey(cellX, cellY));
+        if (cell == mCells.end())
+        {
+          continue;
+        }
+
+        for (auto const &index : cell->second)
+        {
+          auto const deltaX = mX[index] - x;
+          auto const deltaY = mY[index] - y;
+          if (deltaX * deltaX + deltaY * deltaY <= radiusSquared)
+          {
+            callback(index);
+          }
+        }
+      }
+    }
+  }
+
+  std::size_t size() const
+  {
+    return mX.size();
+  }
+
+private:
+  std::int32_t cellCoordinate(double value) const
+  {
+    return static_cast<std::int32_t>(std::floor(value / mCellSize));
+  }
+
+  static std::int64_t cellKey(std::int32_t cellX, std::int32_t cellY)
+  {
+    return (static_cast<std::int64_t>(cellX) << 32) | static_cast<std::int64_t>(static_cast<std::uint32_t>(cellY));
+  }
+
+  double mCellSize;
+  std::vector<double> mX;
+  std::vector<double> mY;
+  std::unordered_map<std::int64_t, std::vector<std::size_t>> mCells;
+};
+
+} // namespace tracking
+} // namespace rv
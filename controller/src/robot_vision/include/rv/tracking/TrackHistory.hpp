@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief One trajectory point: the kinematic state at a corrected frame
+ *
+ * Deliberately compact — no covariances, classification or attributes — so a
+ * full ring of samples stays a few cache lines per track.
+ */
+struct TrackHistorySample
+{
+  std::chrono::system_clock::time_point timestamp;
+  double x{0.};
+  double y{0.};
+  double z{0.};
+  double vx{0.};
+  double vy{0.};
+  double yaw{0.};
+};
+
+/**
+ * @brief Fixed-capacity ring buffer of recent per-track states
+ *
+ * Backed by one contiguous allocation sized once at construction; append is
+ * O(1) and overwrites the oldest sample when full. Lets downstream consumers
+ * fetch trajectories on demand instead of accumulating every published frame.
+ */
+class TrackHistory
+{
+public:
+  explicit TrackHistory(std::size_t capacity)
+    : mSamples(capacity)
+  {
+  }
+
+  inline std::size_t capacity() const
+  {
+    return mSamples.size();
+  }
+
+  inline std::size_t size() const
+  {
+    return mCount;
+  }
+
+  inline void append(const TrackHistorySample &sample)
+  {
+    if (mSamples.empty())
+    {
+      return;
+    }
+    mSamples[mHead] = sample;
+    mHead = (mHead + 1) % mSamples.size();
+    if (mCount < mSamples.size())
+    {
+      mCount++;
+    }
+  }
+
+  /**
+   * @brief Samples in chronological order, oldest first
+   */
+  std::vector<TrackHistorySample> samples() const
+  {
+    std::vector<TrackHistorySample> ordered;
+    ordered.reserve(mCount);
+    std::size_t const start = (mHead + mSamples.size() - mCount) % mSamples.size();
+    for (std::size_t i = 0; i < mCount; ++i)
+    {
+      ordered.push_back(mSamples[(start + i) % mSamples.size()]);
+    }
+    return ordered;
+  }
+
+private:
+  std::vector<TrackHistorySample> mSamples;
+  std::size_t mHead{0};
+  std::size_t mCount{0};
+};
+
+} // namespace tracking
+} // namespace rv
@@ -3,13 +3,17 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <stdint.h>
 #include <string>
-#include <unordered_map>
 #include <chrono>
+#include <unordered_map>
 #include <vector>
 #include "rv/tracking/MultiModelKalmanEstimator.hpp"
+#include "rv/tracking/TrackHistory.hpp"
+#include "rv/tracking/TrackSnapshot.hpp"
+#include "rv/tracking/TrackStore.hpp"
 #include "rv/tracking/TrackedObject.hpp"
 
 namespace rv {
@@ -30,6 +34,46 @@ struct TrackManagerConfig
   double mDefaultMeasurementNoise{1e-2};
   double mInitStateCovariance{1.};
 
+  // Worker pool shared by the tracking stages; 0 threads selects the
+  // hardware concurrency
+  uint32_t mWorkerThreads{0};
+  bool mPinWorkerThreads{false};
+
+  // Shard the worker pool over the NUMA nodes on multi-socket machines:
+  // workers are pinned to their node's CPUs and each parallel stage splits
+  // its range into per-node sub-ranges (with stealing), so a track's
+  // estimator memory is touched by the same socket frame after frame
+  bool mNumaAwareWorkers{false};
+
+  // Serial dispatch floor (ns) for the pool's cost-model dispatch: a stage
+  // whose estimated cost (elements x calibrated per-element cost) falls below
+  // the floor runs serial, so small scenes do not pay the fork/join. 0 forces
+  // parallel dispatch at every annotated site
+  double mSerialDispatchFloorNs{20000.0};
+
+  // Adaptive IMM model pruning: a model whose probability stays below the
+  // floor for this many corrected frames stops propagating until the
+  // measurement innovation spikes. 0 frames disables pruning
+  double mModelPruneProbabilityFloor{0.05};
+  uint32_t mModelPruneFrames{0};
+
+  // Opt-in per-track trajectory ring buffer, sampled at every corrected
+  // frame. 0 disables history collection
+  uint32_t mTrackHistoryCapacity{0};
+
+  // Bounded-capacity mode: maximum live tracks (active + suspended). At the
+  // budget a new track is only admitted by evicting the longest-unmatched
+  // unreliable track; when no track is evictable the detection is rejected,
+  // so worst-case frame latency is set by this knob instead of by the input.
+  // 0 keeps the unbounded behavior
+  uint32_t mMaxTracks{0};
+
+  // Admission score floor for new tracks. The default score is the
+  // detection's dominant classification confidence; the multi-camera
+  // pipeline adds 1.0 per agreeing camera, so corroborated detections always
+  // outrank single-camera confidence. 0 admits every score
+  double mMinAdmissionScore{0.0};
+
   std::vector<MotionModel> mMotionModels{MotionModel::CV, MotionModel::CA, MotionModel::CTRV};
 
   std::string toString() const
@@ -67,7 +111,7 @@ struct TrackManagerConfig
 /**
  * @brief TrackManager: Provides interfaces to create new tracks and assign measurements to existing tracks
  *
- * The TrackManager module maintains tracks as a map of <Id, KalmanEstimator>
+ * The TrackManager module maintains tracks in a contiguous slot-map of KalmanEstimators (TrackStore)
  * It also provides the functionality of Reliable/unreliable track, this reduces the number of false positives
  * and allows the user to work only with the reliable objects. An object becomes reliable when at least
  * mMaxNumberOfUnreliableFrames frames have been measured.
@@ -82,6 +126,7 @@ public:
   TrackManager(TrackManagerConfig const &trackManagerConfig)
     : mConfig(trackManagerConfig)
   {
+    applyWorkerConfig();
   }
 
   TrackManager(bool autoIdGeneration)
@@ -93,14 +138,46 @@ public:
     : mConfig(trackManagerConfig)
     , mAutoIdGeneration(autoIdGeneration)
   {
+    applyWorkerConfig();
   }
 
   /**
    * @brief Create a new track with the object information
    *
+   * Under bounded-capacity mode (mMaxTracks / mMinAdmissionScore) the object
+   * is scored by its dominant classification confidence and may be rejected;
+   * rejected detections return InvalidObjectId and create nothing.
    */
   Id createTrack(TrackedObject object, const std::chrono::system_clock::time_point &timestamp);
 
+  /**
+   * @brief Create a new track with a caller-provided admission score
+   *
+   * Used by the multi-camera pipeline, which can add the camera-agreement
+   * signal the manager cannot see; otherwise identical to createTrack above.
+   */
+  Id createTrack(TrackedObject object, const std::chrono::system_clock::time_point &timestamp, double admissionScore);
+
+  /**
+   * @brief Register a track under the id it already carries
+   *
+   * Bypasses auto id generation; used by the cross-shard handoff, where a
+   * track moving between scene shards must keep its id. Exempt from the
+   * admission gate: the track is already live in the scene.
+   */
+  Id adoptTrack(TrackedObject object, const std::chrono::system_clock::time_point &timestamp);
+
+  /**
+   * @brief Seed the auto-generated id sequence; the next track gets seed + 1
+   *
+   * Lets cooperating trackers (e.g. scene shards) draw from disjoint id
+   * ranges. Call before the first createTrack.
+   */
+  void seedTrackIds(Id seed)
+  {
+    mCurrentId = seed;
+  }
+
   /**
    * @brief Trigger state estimation update
    *
@@ -120,6 +197,20 @@ public:
    */
   void setMeasurement(const Id &id, const TrackedObject &measurement);
 
+  /**
+   * @brief Assign a batch of pre-identified measurements in one pass
+   *
+   * Resolves every id against the active and suspended stores exactly once
+   * (instead of the four probes per object of a hasId()/setMeasurement()
+   * pair), assigns the measurement to each known track and compacts the
+   * unknown objects to the front of the vector, preserving their order.
+   *
+   * @param measurements Batch of measurements; on return the first
+   *        returned-count entries are the objects with no matching track
+   * @return Number of unmatched objects, left at the front of the vector
+   */
+  std::size_t setMeasurements(std::vector<TrackedObject> &measurements);
+
   /**
    * @brief Triggers the correct measurements step
    *
@@ -132,12 +223,30 @@ public:
    */
   TrackedObject getTrack(const Id &id);
 
+  /**
+   * @brief Copy a track's state without cloning its estimator
+   *
+   * Single lookup across the active and suspended stores; returns false for
+   * unknown ids instead of throwing. Preferred over getTrack() on hot paths.
+   */
+  bool tryGetTrack(const Id &id, TrackedObject &track) const;
+
   /**
    * @brief Access a specific kalman estimator
    *
    */
   MultiModelKalmanEstimator getKalmanEstimator(const Id &id);
 
+  /**
+   * @brief Non-copying access to a track's estimator
+   *
+   * Returns the estimator in place instead of deep-copying its filter bank.
+   * The reference stays valid until the next call that creates, deletes,
+   * suspends or reactivates a track. Throws for unknown ids, like
+   * getKalmanEstimator().
+   */
+  const MultiModelKalmanEstimator &kalmanEstimator(const Id &id) const;
+
   /**
    * @brief Returns a list of tracked objects states
    *
@@ -148,6 +257,68 @@ public:
   std::vector<TrackedObject> getSuspendedTracks();
   std::vector<TrackedObject> getDriftingTracks();
 
+  /**
+   * @brief Latest frame snapshot, safe to read concurrently with track()
+   *
+   * correct() publishes a fresh snapshot atomically at frame end; readers on
+   * other threads get a consistent, immutable frame without taking a lock and
+   * without copying. Returns an empty pointer before the first corrected
+   * frame.
+   */
+  std::shared_ptr<const TrackSnapshot> getTrackSnapshot() const;
+
+  /**
+   * @brief Record the frame timestamp stamped onto the next snapshot
+   */
+  void setFrameTimestamp(const std::chrono::system_clock::time_point &timestamp)
+  {
+    mFrameTimestamp = timestamp;
+  }
+
+  /**
+   * @brief Extrapolate the last published snapshot to a future timestamp
+   *
+   * Thread-safe and non-destructive: reads the atomically published snapshot
+   * and advances each track with the closed-form kinematics of the combined
+   * state (constant-acceleration position/velocity, constant yaw rate),
+   * without touching the estimators or the correction state. Lets callers
+   * publish interpolated scene updates at a higher rate than the cameras
+   * deliver measurements. Returns the snapshot unchanged for past timestamps
+   * and an empty pointer before the first corrected frame.
+   */
+  std::shared_ptr<const TrackSnapshot> predictTo(const std::chrono::system_clock::time_point &timestamp) const;
+
+  /**
+   * @brief Recent trajectory of a track, oldest sample first
+   *
+   * Populated during correct() when mTrackHistoryCapacity is non-zero; empty
+   * for unknown ids or when history collection is disabled. Bounded memory:
+   * capacity samples per live track, freed with the track.
+   */
+  std::vector<TrackHistorySample> getTrackHistory(const Id &id) const;
+
+  /**
+   * @brief Returns non-owning views of the track states
+   *
+   * The pointers refer to state owned by the estimator stores and stay valid
+   * until the next call that creates, deletes, suspends or reactivates a track
+   */
+  TrackView getReliableTrackView(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+  TrackView getUnreliableTrackView(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+  TrackView getSuspendedTrackView(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+  /**
+   * @brief Suspended tracks within radius of any of the given detections
+   *
+   * Served from an incrementally maintained spatial hash — suspended tracks
+   * are static by definition, so cells are only touched on suspend and
+   * reactivate — making the query cost proportional to the detections rather
+   * than the suspended population.
+   */
+  TrackView getSuspendedTrackViewNear(const TrackView &detections,
+                                      double radius,
+                                      std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
   /**
    * @brief Check wether the given Id is registered in the track manager
    *
@@ -178,7 +349,7 @@ public:
   bool isReliable(const Id &id);
 
   /**
-   * @brief Track is in the mSuspendedKalmanEstimators map
+   * @brief Track is in the mSuspendedKalmanEstimators store
    */
   bool isSuspended(const Id &id);
 
@@ -192,15 +363,133 @@ public:
     return mConfig;
   }
 
+  /**
+   * @brief Live tracks counted against the mMaxTracks budget
+   */
+  std::size_t liveTrackCount() const
+  {
+    return mKalmanEstimators.size() + mSuspendedKalmanEstimators.size();
+  }
+
+  /**
+   * @brief Detections rejected by the admission gate since construction
+   */
+  uint64_t admissionRejections() const
+  {
+    return mAdmissionRejections;
+  }
+
+  /**
+   * @brief Unreliable tracks evicted to admit new tracks at the budget
+   */
+  uint64_t capacityEvictions() const
+  {
+    return mCapacityEvictions;
+  }
+
+  /**
+   * @brief Bytes held by the filter banks of all active and suspended tracks
+   *
+   * Scales linearly with the live track count; see
+   * MultiModelKalmanEstimator::memoryFootprint for what each track counts.
+   */
+  std::size_t estimatorMemoryFootprint() const
+  {
+    std::size_t bytes = 0;
+    auto accumulate = [&bytes](const Id &, const MultiModelKalmanEstimator &estimator) {
+      bytes += estimator.memoryFootprint();
+    };
+    mKalmanEstimators.forEach(accumulate);
+    mSuspendedKalmanEstimators.forEach(accumulate);
+    return bytes;
+  }
+
+  /**
+   * @brief Bytes held by the ping-pong snapshot buffers
+   *
+   * Counts the buffers' track-vector capacities, so a buffer replaced because
+   * a slow reader still held its predecessor shows up as soon as it is
+   * allocated.
+   */
+  std::size_t snapshotMemoryFootprint() const
+  {
+    std::size_t bytes = 0;
+    for (auto const &buffer : mSnapshotBuffers)
+    {
+      if (buffer)
+      {
+        bytes += sizeof(TrackSnapshot) + buffer->tracks.capacity() * sizeof(TrackedObject);
+      }
+    }
+    return bytes;
+  }
+
 private:
-  std::unordered_map<Id, MultiModelKalmanEstimator> mKalmanEstimators;
-  std::unordered_map<Id, MultiModelKalmanEstimator> mSuspendedKalmanEstimators;
-  std::unordered_map<Id, TrackedObject> mMeasurementMap;
-  std::unordered_map<Id, uint32_t> mNonMeasurementFrames;
-  std::unordered_map<Id, uint32_t> mNumberOfTrackedFrames;
+  /**
+   * @brief Reconfigure the shared worker pool when the config requests an
+   * explicit thread count or pinning
+   */
+  void applyWorkerConfig();
+
+  /**
+   * @brief Admission gate of the bounded-capacity mode
+   *
+   * Applies the score floor, then the track budget; at the budget it tries
+   * to evict the longest-unmatched unreliable track to make room.
+   */
+  bool admitNewTrack(double admissionScore);
+
+  /**
+   * @brief Drop pending measurements of suspended tracks at frame start
+   */
+  void clearSuspendedMeasurements();
+
+  /**
+   * @brief Propagate all tracks' sigma points for one linear motion model as
+   * a single bulk multiply against the frame's cached transition matrix
+   */
+  void batchedPropagate(MotionModel model, double deltaT);
+
+  /**
+   * @brief Fill the inactive snapshot buffer and publish it atomically
+   *
+   * The writer ping-pongs between two preallocated buffers; a buffer is only
+   * reused once no reader holds it, so a slow reader costs one allocation but
+   * never a wait
+   */
+  void publishSnapshot();
+
+  /**
+   * @brief Append the corrected state of every active track to its ring
+   */
+  void recordTrackHistories();
+
+  TrackStore mKalmanEstimators;
+  TrackStore mSuspendedKalmanEstimators;
+
+  std::unordered_map<Id, TrackHistory> mTrackHistories;
+
+  /**
+   * @brief Spatial hash over suspended track positions, cell -> track ids
+   *
+   * The per-id key map gives O(1) removal on reactivation
+   */
+  std::unordered_map<std::int64_t, std::vector<Id>> mSuspendedCells;
+  std::unordered_map<Id, std::int64_t> mSuspendedCellKeys;
+
+  std::chrono::system_clock::time_point mFrameTimestamp;
+
+  std::shared_ptr<const TrackSnapshot> mPublishedSnapshot;
+  std::array<std::shared_ptr<TrackSnapshot>, 2> mSnapshotBuffers;
+  std::size_t mNextSnapshotBuffer{0};
+  uint64_t mSnapshotVersion{0};
 
   Id mCurrentId = 0;
 
+  // Bounded-capacity bookkeeping
+  uint64_t mAdmissionRejections{0};
+  uint64_t mCapacityEvictions{0};
+
   bool mAutoIdGeneration{true};
 
   TrackManagerConfig mConfig;
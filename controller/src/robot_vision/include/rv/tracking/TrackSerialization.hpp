@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "rv/tracking/TrackSnapshot.hpp"
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief Flat, versioned binary serialization of track snapshots
+ *
+ * Layout (little-endian):
+ *
+ *   TrackBlobHeader  : magic, format version, snapshot version, timestamp,
+ *                      track count
+ *   Per track        : TrackRecordCore with the kinematic fields at fixed
+ *                      offsets, then a length-prefixed classification
+ *                      (u32 count + doubles) and a length-prefixed attribute
+ *                      section (u32 count + per entry u32-prefixed key and
+ *                      value bytes)
+ *
+ * The fixed-offset core lets shared-memory readers pick kinematic fields
+ * without parsing; serializeTracks() sizes the buffer in one pre-pass and
+ * fills it with plain copies, so there is no per-field allocation.
+ */
+
+constexpr uint32_t kTrackBlobMagic = 0x4b545652; // "RVTK"
+constexpr uint16_t kTrackBlobVersion = 1;
+
+struct TrackBlobHeader
+{
+  uint32_t magic{kTrackBlobMagic};
+  uint16_t version{kTrackBlobVersion};
+  uint16_t reserved{0};
+  uint64_t snapshotVersion{0};
+  int64_t timestampMicroseconds{0};
+  uint64_t trackCount{0};
+};
+
+static_assert(sizeof(TrackBlobHeader) == 32, "serialized header layout must be stable");
+
+/**
+ * @brief Fixed-offset mirror of the kinematic core of TrackedObject
+ */
+struct TrackRecordCore
+{
+  int32_t id{InvalidObjectId};
+  uint8_t corrected{0};
+  uint8_t reserved[3]{0, 0, 0};
+  double x{0.};
+  double y{0.};
+  double z{0.};
+  double vx{0.};
+  double vy{0.};
+  double ax{0.};
+  double ay{0.};
+  double yaw{0.};
+  double previousYaw{0.};
+  double w{0.};
+  double length{0.};
+  double width{0.};
+  double height{0.};
+};
+
+static_assert(sizeof(TrackRecordCore) == 112, "serialized record layout must be stable");
+
+/**
+ * @brief Serialize a span of tracks into the flat format
+ *
+ * The buffer is resized once to the exact payload size and overwritten.
+ * snapshotVersion and timestampMicroseconds are recorded in the header for
+ * the snapshot overload; the span overload leaves them zero.
+ */
+void serializeTracks(const TrackedObject *tracks, std::size_t trackCount, std::vector<uint8_t> &buffer);
+
+void serializeTracks(const TrackSnapshot &snapshot, std::vector<uint8_t> &buffer);
+
+/**
+ * @brief Decode a flat track blob; throws on bad magic, version or truncation
+ */
+std::vector<TrackedObject> deserializeTracks(const uint8_t *data, std::size_t size);
+
+} // namespace tracking
+} // namespace rv
@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: (C) 2019 - 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief TrackSnapshot: Immutable copy of the track outputs of one frame
+ *
+ * Published by TrackManager at the end of every correct() and handed to
+ * readers as a shared_ptr-to-const, so MQTT serialization and analytics can
+ * consume a consistent frame without blocking the tracking thread. The
+ * version increases by one per published frame, letting readers detect
+ * skipped or duplicate frames.
+ */
+struct TrackSnapshot
+{
+  uint64_t version{0};
+  std::chrono::system_clock::time_point timestamp;
+  std::vector<TrackedObject> tracks;
+};
+
+} // namespace tracking
+} // namespace rv
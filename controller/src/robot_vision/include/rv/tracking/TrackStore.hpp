@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: (C) 2017 - 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "rv/tracking/MultiModelKalmanEstimator.hpp"
+#include "rv/tracking/TrackedObject.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief TrackStore: Contiguous slot-map storage for per-track Kalman estimators
+ *
+ * Estimators live in a dense vector of slots with a free list, so the per-frame
+ * predict/correct loops iterate the slot array directly instead of walking a
+ * node-based map and rebuilding a reference vector every call. Slot indices are
+ * stable for the lifetime of a track; the Id->slot hash is only consulted at the
+ * create/delete/lookup boundary.
+ */
+class TrackStore
+{
+public:
+  static constexpr std::size_t InvalidSlot = std::numeric_limits<std::size_t>::max();
+
+  struct Slot
+  {
+    Id id{InvalidObjectId};
+    bool occupied{false};
+
+    /**
+     * @brief Per-track lifecycle record
+     *
+     * Keeping the counters and the pending measurement next to the estimator
+     * lets the per-frame correct/lifecycle pass run as one linear sweep over
+     * the slot array without any id hashing.
+     */
+    uint32_t nonMeasurementFrames{0};
+    uint32_t trackedFrames{0};
+    bool hasMeasurement{false};
+    TrackedObject measurement;
+
+    MultiModelKalmanEstimator estimator;
+  };
+
+  /**
+   * @brief Create (or reuse) a slot for the given id and return its estimator
+   */
+  MultiModelKalmanEstimator &emplace(const Id &id)
+  {
+    std::size_t slotIndex;
+    if (!mFreeSlots.empty())
+    {
+      slotIndex = mFreeSlots.back();
+      mFreeSlots.pop_back();
+    }
+    else
+    {
+      slotIndex = mSlots.size();
+      mSlots.emplace_back();
+    }
+
+    mSlots[slotIndex].id = id;
+    mSlots[slotIndex].occupied = true;
+    mSlots[slotIndex].nonMeasurementFrames = 0;
+    mSlots[slotIndex].trackedFrames = 0;
+    mSlots[slotIndex].hasMeasurement = false;
+    mSlotIndex[id] = slotIndex;
+
+    return mSlots[slotIndex].estimator;
+  }
+
+  /**
+   * @brief Move an estimator into a new slot for the given id
+   */
+  void insert(const Id &id, MultiModelKalmanEstimator &&estimator)
+  {
+    emplace(id) = std::move(estimator);
+  }
+
+  /**
+   * @brief Release the slot of the given id back to the free list
+   */
+  void erase(const Id &id)
+  {
+    auto it = mSlotIndex.find(id);
+    if (it == mSlotIndex.end())
+    {
+      return;
+    }
+
+    auto const slotIndex = it->second;
+    mSlots[slotIndex].id = InvalidObjectId;
+    mSlots[slotIndex].occupied = false;
+    mFreeSlots.push_back(slotIndex);
+    mSlotIndex.erase(it);
+  }
+
+  bool contains(const Id &id) const
+  {
+    return mSlotIndex.count(id) > 0;
+  }
+
+  MultiModelKalmanEstimator &at(const Id &id)
+  {
+    return mSlots[mSlotIndex.at(id)].estimator;
+  }
+
+  Slot &slotFor(const Id &id)
+  {
+    return mSlots[mSlotIndex.at(id)];
+  }
+
+  const Slot &slotFor(const Id &id) const
+  {
+    return mSlots[mSlotIndex.at(id)];
+  }
+
+  /**
+   * @brief Slot of the given id, or nullptr when the id is not stored
+   *
+   * Single hash probe: lets callers combine the contains()/slotFor() pair
+   * into one lookup on hot ingestion paths
+   */
+  Slot *findSlot(const Id &id)
+  {
+    auto const it = mSlotIndex.find(id);
+    return it == mSlotIndex.end() ? nullptr : &mSlots[it->second];
+  }
+
+  const Slot *findSlot(const Id &id) const
+  {
+    auto const it = mSlotIndex.find(id);
+    return it == mSlotIndex.end() ? nullptr : &mSlots[it->second];
+  }
+
+  const MultiModelKalmanEstimator &at(const Id &id) const
+  {
+    return mSlots[mSlotIndex.at(id)].estimator;
+  }
+
+  /**
+   * @brief Number of live tracks in the store
+   */
+  std::size_t size() const
+  {
+    return mSlotIndex.size();
+  }
+
+  /**
+   * @brief Number of slots (occupied and free); the iteration bound for the dense loops
+   */
+  std::size_t slotCount() const
+  {
+    return mSlots.size();
+  }
+
+  Slot &slot(std::size_t slotIndex)
+  {
+    return mSlots[slotIndex];
+  }
+
+  const Slot &slot(std::size_t slotIndex) const
+  {
+    return mSlots[slotIndex];
+  }
+
+  /**
+   * @brief Invoke callback(id, estimator) for every occupied slot
+   */
+  template <typename Callback> void forEach(Callback &&callback)
+  {
+    for (auto &slot : mSlots)
+    {
+      if (slot.occupied)
+      {
+        callback(slot.id, slot.estimator);
+      }
+    }
+  }
+
+  template <typename Callback> void forEach(Callback &&callback) const
+  {
+    for (auto const &slot : mSlots)
+    {
+      if (slot.occupied)
+      {
+        callback(slot.id, slot.estimator);
+      }
+    }
+  }
+
+private:
+  std::vector<Slot> mSlots;
+  std::vector<std::size_t> mFreeSlots;
+  std::unordered_map<Id, std::size_t> mSlotIndex;
+};
+
+} // namespace tracking
+} // namespace rv
@@ -8,7 +8,10 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
+#include <vector>
 
+#include "rv/tracking/AttributeSet.hpp"
 #include "rv/tracking/Classification.hpp"
 
 namespace rv {
@@ -57,13 +60,51 @@ public:
 
   // tracked object parameters
   cv::Mat predictedMeasurementMean;
-  cv::Mat predictedMeasurementCov;
-  cv::Mat predictedMeasurementCovInv;
   cv::Mat errorCovariance;
 
+  /**
+   * @brief Replace the predicted measurement covariance, invalidating the cached inverse.
+   */
+  void setPredictedMeasurementCov(cv::Mat cov);
+
+  const cv::Mat &getPredictedMeasurementCov() const
+  {
+    return predictedMeasurementCov;
+  }
+
+  /**
+   * @brief Cholesky-backed inverse of the predicted measurement covariance.
+   *
+   * Computed lazily on first access and cached; deployments that only use
+   * Euclidean distances never pay for the inversion.
+   */
+  const cv::Mat &predictedMeasurementCovInverse() const;
+
   Classification classification;
 
-  std::unordered_map<std::string, std::string> attributes;
+  /**
+   * @brief Most probable class index and its score, cached on first access
+   *
+   * The association stage reads these once per cost evaluation, so the
+   * maxCoeff scan runs once per object instead. Code that writes the
+   * classification field directly must call invalidateDominantClass();
+   * the estimator does so after combining measurements.
+   */
+  Eigen::Index dominantClass() const;
+  double dominantScore() const;
+
+  void invalidateDominantClass()
+  {
+    dominantClassValid = false;
+  }
+
+  /**
+   * @brief Copy-on-write attribute storage with interned keys
+   *
+   * Kept out of the hot kinematic block above; pipeline copies only bump a
+   * reference count.
+   */
+  AttributeSet attributes;
 
   bool isDynamic() const;
 
@@ -85,9 +126,39 @@ public:
    * @brief Convert to a cv::Mat vector.
    */
   cv::Mat measurementVector() const;
-};
 
+private:
+  cv::Mat predictedMeasurementCov;
+  mutable cv::Mat predictedMeasurementCovInv;
+  mutable bool predictedMeasurementCovInvValid{false};
+  mutable Eigen::Index dominantClassIndex{-1};
+  mutable double dominantClassScore{0.};
+  mutable bool dominantClassValid{false};
+};
 
+/**
+ * @brief Non-owning view over tracked objects
+ *
+ * Used to hand track state through the association pipeline without
+ * deep-copying the covariance matrices, classification vector and attributes
+ * of every object. Allocator-aware so views can live in a frame arena.
+ */
+using TrackView = std::pmr::vector<const TrackedObject *>;
+
+/**
+ * @brief Build a non-owning view over an object vector
+ */
+inline TrackView makeTrackView(const std::vector<TrackedObject> &objects,
+                               std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+{
+  TrackView view{resource};
+  view.reserve(objects.size());
+  for (auto const &object : objects)
+  {
+    view.push_back(&object);
+  }
+  return view;
+}
 
 } // namespace tracking
 } // namespace rv
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "rv/tracking/MultipleObjectTracker.hpp"
+#include "rv/tracking/TrackSnapshot.hpp"
+
+namespace rv {
+namespace tracking {
+
+struct TrackerPoolConfig
+{
+  std::size_t mSceneCount{1};
+
+  // 0 selects one worker per scene, capped at the hardware concurrency
+  std::size_t mWorkerThreads{0};
+  bool mPinWorkerThreads{false};
+
+  // Frames a scene may have queued before submit() rejects; bounds the
+  // latency of a scene that falls behind
+  std::size_t mMaxQueuedFrames{4};
+
+  DistanceType mDistanceType{DistanceType::MultiClassEuclidean};
+  double mDistanceThreshold{5.0};
+
+  TrackManagerConfig mTrackerConfig;
+};
+
+/**
+ * @brief TrackerPool: Runs many single-scene trackers concurrently
+ *
+ * A controller process tracking dozens of scenes gets its real parallelism
+ * across scenes, not inside one. The pool owns one MultipleObjectTracker per
+ * scene, shards the scenes over a fixed set of worker threads (optionally
+ * pinned round-robin to cores), and feeds each scene from its own bounded
+ * input queue, so frames of one scene always run in order on one thread
+ * while different scenes run concurrently.
+ *
+ * submit() enqueues a frame without blocking and reports when a scene's
+ * queue is full; poll() returns the scene's latest published TrackSnapshot,
+ * so readers never touch a tracker mid-frame. Intra-scene stages run inline
+ * on the owning worker instead of fanning out to the shared WorkerPool.
+ */
+class TrackerPool
+{
+public:
+  explicit TrackerPool(const TrackerPoolConfig &config);
+  ~TrackerPool();
+
+  TrackerPool(const TrackerPool &) = delete;
+  TrackerPool &operator=(const TrackerPool &) = delete;
+
+  std::size_t sceneCount() const
+  {
+    return mScenes.size();
+  }
+
+  std::size_t workerCount() const
+  {
+    return mWorkers.size();
+  }
+
+  /**
+   * @brief Queue one frame of measurements for a scene
+   *
+   * Returns false without queueing when the scene already has
+   * mMaxQueuedFrames frames pending; the caller decides whether to drop the
+   * frame or retry.
+   */
+  bool submit(std::size_t sceneIndex,
+              std::vector<std::vector<TrackedObject>> objectsPerCamera,
+              const std::chrono::system_clock::time_point &timestamp);
+
+  /**
+   * @brief Latest published snapshot of a scene
+   *
+   * Lock-free read of the scene tracker's snapshot; empty before the scene's
+   * first tracked frame.
+   */
+  std::shared_ptr<const TrackSnapshot> poll(std::size_t sceneIndex) const;
+
+  /**
+   * @brief Frames queued but not yet tracked for a scene
+   */
+  std::size_t pendingFrames(std::size_t sceneIndex) const;
+
+  /**
+   * @brief Block until every queued frame has been tracked
+   */
+  void drain();
+
+private:
+  struct Frame
+  {
+    std::vector<std::vector<TrackedObject>> objectsPerCamera;
+    std::chrono::system_clock::time_point timestamp;
+  };
+
+  struct Scene
+  {
+    explicit Scene(const TrackerPoolConfig &config)
+      : tracker(config.mTrackerConfig, config.mDistanceType, config.mDistanceThreshold)
+    {
+    }
+
+    MultipleObjectTracker tracker;
+    std::deque<Frame> queue; // guarded by the owning worker's mutex
+  };
+
+  struct Worker
+  {
+    std::thread thread;
+    mutable std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::vector<std::size_t> scenes;
+    std::size_t activeFrames{0};
+  };
+
+  Worker &workerFor(std::size_t sceneIndex)
+  {
+    return *mWorkers[sceneIndex % mWorkers.size()];
+  }
+
+  const Worker &workerFor(std::size_t sceneIndex) const
+  {
+    return *mWorkers[sceneIndex % mWorkers.size()];
+  }
+
+  void workerLoop(Worker &worker);
+
+  TrackerPoolConfig mConfig;
+  std::vector<std::unique_ptr<Scene>> mScenes;
+  std::vector<std::unique_ptr<Worker>> mWorkers;
+  bool mStopping{false};
+};
+
+} // namespace tracking
+} // namespace rv
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: (C) 2019 - 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <opencv2/core.hpp>
+
+#include "rv/tracking/MultiModelKalmanEstimator.hpp"
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief TransitionMatrixCache: Frame-scoped transition matrices for the linear motion models
+ *
+ * For CV, CA and CP the state-transition structure depends only on deltaT, and
+ * TrackManager::predict(deltaT) applies one global deltaT to every estimator.
+ * Priming the cache once per frame lets all estimators propagate their sigma
+ * points against the same precomputed matrices instead of redoing the identical
+ * per-step setup. The CTRV model is nonlinear in the state and is not cached.
+ */
+class TransitionMatrixCache
+{
+public:
+  static TransitionMatrixCache &instance();
+
+  /**
+   * @brief Rebuild the linear-model matrices for the frame's deltaT
+   *
+   * Called once before the parallel predict sweep; lookups during the sweep
+   * only read the primed frame.
+   */
+  void prime(double deltaT);
+
+  /**
+   * @brief Cached transition matrix for the model and deltaT
+   *
+   * Returns an empty pointer when the cache was primed for a different deltaT
+   * (e.g. per-track timestamps); callers then fall back to the scalar path.
+   */
+  std::shared_ptr<const cv::Mat> transition(MotionModel model, double deltaT) const;
+
+  /**
+   * @brief Build the transition matrix for a linear model and arbitrary deltaT
+   *
+   * Uncached fallback for per-track timesteps; prime() uses the same builders.
+   * Returns an empty matrix for nonlinear models.
+   */
+  static cv::Mat build(MotionModel model, double deltaT);
+
+private:
+  TransitionMatrixCache() = default;
+
+  struct Frame
+  {
+    double deltaT{-1.};
+    cv::Mat constantVelocity;
+    cv::Mat constantAcceleration;
+    cv::Mat constantPosition;
+  };
+
+  std::shared_ptr<const Frame> mFrame;
+  mutable std::mutex mMutex;
+};
+
+} // namespace tracking
+} // namespace rv
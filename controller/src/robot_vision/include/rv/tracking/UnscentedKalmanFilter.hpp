@@ -52,6 +52,9 @@ template <typename _Tp> bool inline choleskyDecomposition(const _Tp *A, size_t a
 
 class UnscentedKalmanFilterMod : public UnscentedKalmanFilter
 {
+protected:
+  // shared with LinearKalmanFilterMod, which implements the same staged
+  // interface with the closed-form linear equations
   int DP;       // dimensionality of the state vector
   int MP;       // dimensionality of the measurement vector
   int CP;       // dimensionality of the control vector
@@ -90,9 +93,10 @@ class UnscentedKalmanFilterMod : public UnscentedKalmanFilter
   Mat Wm; // vector of weights for estimate mean, 2*DP+1 x 1
   Mat Wc; // matrix of weights for estimate covariance, 2*DP+1 x 2*DP+1
 
-  Mat gain;  // Kalman gain matrix (K), DP x MP
-  Mat xyCov; // estimate of the covariance between x* and y* (Sxy), DP x MP
-  Mat yyCov; // estimate of the y* cross-covariance matrix (Syy), MP x MP
+  Mat gain;     // Kalman gain matrix (K), DP x MP
+  Mat xyCov;    // estimate of the covariance between x* and y* (Sxy), DP x MP
+  Mat yyCov;    // estimate of the y* cross-covariance matrix (Syy), MP x MP
+  Mat yyCovInv; // inverse of yyCov, cached by correct() for the gain
 
   Mat r; // zero vector of process noise for getting transitionSPFuncVals,
   Mat q; // zero vector of measurement noise for getting measurementSPFuncVals
@@ -107,6 +111,29 @@ public:
   // control - the optional control vector, CP x 1
   Mat predict(InputArray control = noArray()) override;
 
+  // staged prediction used by the batched engine: computeSigmaPoints() draws
+  // the sigma points from the current state, propagateSigmaPoints() runs the
+  // system model over them, finishPredict() folds the propagated points back
+  // into state, covariance and measurement estimates. predict() is the
+  // composition of the three stages. Virtual so LinearKalmanFilterMod can
+  // substitute the closed-form linear equations; this filter derives its
+  // covariance from the propagated points and ignores deltaT
+  virtual void computeSigmaPoints();
+  virtual void propagateSigmaPoints(InputArray control);
+  virtual Mat finishPredict(double deltaT = 0.);
+
+  // raw access for the batched engine: the propagated values written into
+  // transitionValues() must match what propagateSigmaPoints() would produce
+  const Mat &currentSigmaPoints() const
+  {
+    return sigmaPoints;
+  }
+
+  Mat &transitionValues()
+  {
+    return transitionSPFuncVals;
+  }
+
   // perform correction step
   // measurement - current measurement vector, MP x 1
   Mat correct(InputArray measurement) override;
@@ -117,12 +144,56 @@ public:
   Mat getErrorCov() const override;
   Mat getMeasurementCov() const;
 
+  // Syy^-1 as cached by the last correct() call. The IMM model-likelihood
+  // update reuses it instead of running a second SVD inverse of the same
+  // matrix; empty before the first correction
+  Mat getMeasurementCovInv() const
+  {
+    return yyCovInv;
+  }
+
+  // bytes held by the filter's state and scratch matrices. The sizes are
+  // fixed by DP/MP at construction, so this reads as the per-track cost of
+  // one IMM model. Virtual so LinearKalmanFilterMod can add its own members
+  virtual size_t memoryFootprint() const
+  {
+    const Mat *mats[] = {&state, &errorCov, &processNoiseCov, &measurementNoiseCov, &measurementEstimate,
+                         &sigmaPoints, &transitionSPFuncVals, &measurementSPFuncVals, &transitionSPFuncValsCenter,
+                         &measurementSPFuncValsCenter, &Wm, &Wc, &gain, &xyCov, &yyCov, &yyCovInv, &r, &q};
+    size_t bytes = 0;
+    for (auto const *mat : mats)
+    {
+      bytes += mat->total() * mat->elemSize();
+    }
+    return bytes;
+  }
+
   void setStateAndCovariance(cv::Mat state, cv::Mat errorCov)
   {
     state = state.clone();
     errorCov = errorCov.clone();
   }
 
+  // re-arm a pooled filter for a new track: rewrites the state and the noise
+  // and covariance diagonals in place, without reallocating any of the
+  // sigma-point or gain buffers. Everything else is transient per predict
+  // cycle and gets overwritten before it is read
+  void reset(const cv::Mat &stateInit, double initStateCovariance, double processNoise, double measurementNoise)
+  {
+    stateInit.copyTo(state);
+    cv::setIdentity(errorCov, initStateCovariance);
+    cv::setIdentity(processNoiseCov, processNoise);
+    cv::setIdentity(measurementNoiseCov, measurementNoise);
+  }
+
+  // reseed the filter in place; used when a pruned IMM model is reactivated
+  // and must restart from the combined estimate
+  void resetStateAndCovariance(const cv::Mat &newState, const cv::Mat &newErrorCov)
+  {
+    newState.copyTo(state);
+    newErrorCov.copyTo(errorCov);
+  }
+
   //  Get the state estimate
   Mat getState() const override;
 };
@@ -132,6 +203,92 @@ Ptr<UnscentedKalmanFilterMod> inline createUnscentedKalmanFilterMod(const Unscen
   Ptr<UnscentedKalmanFilterMod> kfu(new UnscentedKalmanFilterMod(params));
   return kfu;
 }
+
+// Square-root formulation of the UKF: the filter maintains the lower Cholesky
+// factor S of the error covariance instead of the full matrix P. Sigma points
+// are drawn directly from the columns of S, which removes the per-step matrix
+// square root of the dense filter, and S*S.t() stays symmetric positive
+// semi-definite by construction over long track lifetimes. The predicted
+// factor is rebuilt with a QR decomposition of the weighted sigma-point
+// deviations plus the process noise factor, followed by a rank-1 update for
+// the (possibly negative) center weight. CV_64F only.
+class SquareRootUnscentedKalmanFilterMod : public UnscentedKalmanFilter
+{
+  int DP;       // dimensionality of the state vector
+  int MP;       // dimensionality of the measurement vector
+  int CP;       // dimensionality of the control vector
+  int dataType; // type of elements of vectors and matrices
+
+  Mat state;       // estimate of the system state (x*), DP x 1
+  Mat errorCovL;   // lower Cholesky factor of the state covariance (S), DP x DP
+
+  Mat processNoiseL;     // lower Cholesky factor of the process noise (sqrt(Q)), DP x DP
+  Mat measurementNoiseL; // lower Cholesky factor of the measurement noise (sqrt(R)), MP x MP
+
+  Ptr<UkfSystemModel> model;
+
+  // Parameters of algorithm
+  double alpha;
+  double k;
+  double beta;
+
+  double lambda;
+  double tmpLambda;
+
+  // Auxillary members
+  Mat measurementEstimate; // estimate of current measurement (y*), MP x 1
+
+  Mat sigmaPoints; // set of sigma points ( x_i, i = 1..2*DP+1 ), DP x 2*DP+1
+
+  Mat transitionSPFuncVals;  // state function values at sigma points, DP x 2*DP+1
+  Mat measurementSPFuncVals; // measurement function values at sigma points, MP x 2*DP+1
+
+  Mat transitionSPFuncValsCenter;  // state function values minus state estimate, DP x 2*DP+1
+  Mat measurementSPFuncValsCenter; // measurement function values minus measurement estimate, MP x 2*DP+1
+
+  Mat Wm; // vector of weights for estimate mean, 2*DP+1 x 1
+  Mat Wc; // matrix of weights for estimate covariance, 2*DP+1 x 2*DP+1
+
+  double sqrtWi; // square root of the (identical) non-center covariance weights
+  double Wc0;    // center covariance weight, may be negative
+
+  Mat gain;    // Kalman gain matrix (K), DP x MP
+  Mat xyCov;   // estimate of the covariance between x* and y* (Sxy), DP x MP
+  Mat yyCovL;  // lower Cholesky factor of the y* covariance (Sy), MP x MP
+
+  Mat r; // zero vector of measurement noise for getting measurementSPFuncVals
+  Mat q; // zero vector of process noise for getting transitionSPFuncVals
+
+  // draw sigma points from the maintained factor: x_0 = mean,
+  // x_i = mean +/- coef * S.col(i); no decomposition involved
+  Mat getSigmaPointsFromFactor(const Mat &mean, const Mat &covFactor, double coef);
+
+  // rebuild the lower factor from the weighted deviations and a noise factor
+  // via QR, then fold in the center deviation with the center weight
+  void factorFromDeviations(
+    const Mat &deviations, const Mat &noiseL, const Mat &centerDeviation, Mat &factor);
+
+public:
+  SquareRootUnscentedKalmanFilterMod(const UnscentedKalmanFilterParams &params);
+  ~SquareRootUnscentedKalmanFilterMod();
+
+  Mat predict(InputArray control = noArray()) override;
+  Mat correct(InputArray measurement) override;
+
+  Mat getProcessNoiseCov() const override;
+  Mat getMeasurementNoiseCov() const override;
+  Mat getErrorCov() const override;
+  Mat getMeasurementCov() const;
+
+  Mat getState() const override;
+};
+
+Ptr<SquareRootUnscentedKalmanFilterMod> inline createSquareRootUnscentedKalmanFilterMod(
+  const UnscentedKalmanFilterParams &params)
+{
+  Ptr<SquareRootUnscentedKalmanFilterMod> kfu(new SquareRootUnscentedKalmanFilterMod(params));
+  return kfu;
+}
 }
 }
 }
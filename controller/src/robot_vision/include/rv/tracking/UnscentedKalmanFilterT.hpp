@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <Eigen/Cholesky>
+#include <Eigen/Dense>
+#include <cmath>
+
+namespace rv {
+namespace tracking {
+
+/**
+ * @brief UkfSystemModelT: Fixed-size system model interface for UnscentedKalmanFilterT
+ *
+ * Mirrors cv::detail::tracking::UkfSystemModel but operates on compile-time-sized
+ * Eigen vectors so sigma-point propagation never touches the heap.
+ */
+template <int StateDim, int MeasurementDim> class UkfSystemModelT
+{
+public:
+  using StateVector = Eigen::Matrix<double, StateDim, 1>;
+  using MeasurementVector = Eigen::Matrix<double, MeasurementDim, 1>;
+
+  virtual ~UkfSystemModelT() = default;
+
+  /**
+   * @brief State transition function, deltaT is the control input
+   */
+  virtual void stateConversionFunction(const StateVector &x_k, double deltaT, StateVector &x_kplus1) const = 0;
+
+  /**
+   * @brief State measurement function
+   */
+  virtual void measurementFunction(const StateVector &x_k, MeasurementVector &z_k) const = 0;
+};
+
+/**
+ * @brief UnscentedKalmanFilterT: Compile-time fixed-size unscented Kalman filter
+ *
+ * Implements the same unscented transform as UnscentedKalmanFilterMod, but over
+ * Eigen matrices whose dimensions are template parameters. All working storage
+ * lives inline in the filter object, so predict/correct perform zero heap
+ * allocations and the compiler can fully unroll and vectorize the small
+ * fixed-size matrix products that dominate the per-track hot loop.
+ */
+template <int StateDim, int MeasurementDim> class UnscentedKalmanFilterT
+{
+public:
+  static constexpr int SigmaPointCount = 2 * StateDim + 1;
+
+  using StateVector = Eigen::Matrix<double, StateDim, 1>;
+  using MeasurementVector = Eigen::Matrix<double, MeasurementDim, 1>;
+  using StateCovariance = Eigen::Matrix<double, StateDim, StateDim>;
+  using MeasurementCovariance = Eigen::Matrix<double, MeasurementDim, MeasurementDim>;
+  using CrossCovariance = Eigen::Matrix<double, StateDim, MeasurementDim>;
+  using StateSigmaPoints = Eigen::Matrix<double, StateDim, SigmaPointCount>;
+  using MeasurementSigmaPoints = Eigen::Matrix<double, MeasurementDim, SigmaPointCount>;
+  using WeightVector = Eigen::Matrix<double, SigmaPointCount, 1>;
+  using SystemModel = UkfSystemModelT<StateDim, MeasurementDim>;
+
+  UnscentedKalmanFilterT(const SystemModel &model,
+                         const StateVector &stateInit,
+                         const StateCovariance &errorCovInit,
+                         const StateCovariance &processNoiseCov,
+                         const MeasurementCovariance &measurementNoiseCov,
+                         double alpha = 1.0,
+                         double beta = 2.0,
+                         double kappa = 3.0 - StateDim)
+    : mModel(&model)
+    , mState(stateInit)
+    , mErrorCov(errorCovInit)
+    , mProcessNoiseCov(processNoiseCov)
+    , mMeasurementNoiseCov(measurementNoiseCov)
+  {
+    double lambda = alpha * alpha * (StateDim + kappa) - StateDim;
+    mTmpLambda = lambda + StateDim;
+
+    mWm.setConstant(0.5 / mTmpLambda);
+    mWc = mWm;
+    mWm(0) = lambda / mTmpLambda;
+    mWc(0) = lambda / mTmpLambda + 1.0 - alpha * alpha + beta;
+
+    mMeasurementEstimate.setZero();
+    mYYCov = measurementNoiseCov;
+  }
+
+  /**
+   * @brief Perform the prediction step, deltaT is the control input
+   */
+  const StateVector &predict(double deltaT)
+  {
+    generateSigmaPoints();
+
+    // f_i = f(x_i, deltaT), i = 0..2*DP
+    StateVector fx;
+    for (int i = 0; i < SigmaPointCount; ++i)
+    {
+      mModel->stateConversionFunction(mSigmaPoints.col(i), deltaT, fx);
+      mTransitionSPFuncVals.col(i) = fx;
+    }
+
+    // x* = SUM_{i=0}^{2*DP}( Wm[i]*f_i )
+    mState.noalias() = mTransitionSPFuncVals * mWm;
+
+    // fc_i = f_i - x*;  P = SUM( Wc[i]*fc_i*fc_i.t ) + Q
+    mTransitionSPFuncValsCenter = mTransitionSPFuncVals.colwise() - mState;
+    mErrorCov.noalias() = mTransitionSPFuncValsCenter * mWc.asDiagonal() * mTransitionSPFuncValsCenter.transpose();
+    mErrorCov += mProcessNoiseCov;
+
+    // regenerate sigma points from x* and P to derive the measurement covariance
+    generateSigmaPoints();
+
+    // h_i = h(x_i), i = 0..2*DP
+    MeasurementVector hx;
+    for (int i = 0; i < SigmaPointCount; ++i)
+    {
+      mModel->measurementFunction(mSigmaPoints.col(i), hx);
+      mMeasurementSPFuncVals.col(i) = hx;
+    }
+
+    // y* = SUM( Wm[i]*h_i );  hc_i = h_i - y*;  Syy = SUM( Wc[i]*hc_i*hc_i.t ) + R
+    mMeasurementEstimate.noalias() = mMeasurementSPFuncVals * mWm;
+    mMeasurementSPFuncValsCenter = mMeasurementSPFuncVals.colwise() - mMeasurementEstimate;
+    mYYCov.noalias() = mMeasurementSPFuncValsCenter * mWc.asDiagonal() * mMeasurementSPFuncValsCenter.transpose();
+    mYYCov += mMeasurementNoiseCov;
+
+    return mState;
+  }
+
+  /**
+   * @brief Perform the correction step with the given measurement
+   */
+  const StateVector &correct(const MeasurementVector &measurement)
+  {
+    // Sxy = SUM( Wc[i]*fc_i*hc_i.t )
+    CrossCovariance xyCov;
+    xyCov.noalias() = mTransitionSPFuncValsCenter * mWc.asDiagonal() * mMeasurementSPFuncValsCenter.transpose();
+
+    // K = Sxy * Syy^(-1), solved through the Cholesky factor of Syy
+    CrossCovariance gain = mYYCov.llt().solve(xyCov.transpose()).transpose();
+
+    // x* = x* + K*(y - y*)
+    mState.noalias() += gain * (measurement - mMeasurementEstimate);
+
+    // P = P - K*Sxy.t
+    mErrorCov.noalias() -= gain * xyCov.transpose();
+
+    return mState;
+  }
+
+  const StateVector &getState() const
+  {
+    return mState;
+  }
+
+  const StateCovariance &getErrorCov() const
+  {
+    return mErrorCov;
+  }
+
+  const StateCovariance &getProcessNoiseCov() const
+  {
+    return mProcessNoiseCov;
+  }
+
+  const MeasurementCovariance &getMeasurementNoiseCov() const
+  {
+    return mMeasurementNoiseCov;
+  }
+
+  const MeasurementCovariance &getMeasurementCov() const
+  {
+    return mYYCov;
+  }
+
+  const MeasurementVector &getMeasurementEstimate() const
+  {
+    return mMeasurementEstimate;
+  }
+
+  void setStateAndCovariance(const StateVector &state, const StateCovariance &errorCov)
+  {
+    mState = state;
+    mErrorCov = errorCov;
+  }
+
+private:
+  /**
+   * @brief Fill mSigmaPoints from the current state and covariance
+   *
+   * x_0 = x*;  x_i = x* +/- sqrt(lambda + DP) * cholesky(P), i = 1..DP
+   */
+  void generateSigmaPoints()
+  {
+    StateCovariance scaledL = mErrorCov.llt().matrixL();
+    scaledL *= std::sqrt(mTmpLambda);
+
+    mSigmaPoints.col(0) = mState;
+    for (int i = 0; i < StateDim; ++i)
+    {
+      mSigmaPoints.col(1 + i) = mState + scaledL.col(i);
+      mSigmaPoints.col(1 + StateDim + i) = mState - scaledL.col(i);
+    }
+  }
+
+  const SystemModel *mModel;
+
+  StateVector mState;
+  StateCovariance mErrorCov;
+  StateCovariance mProcessNoiseCov;
+  MeasurementCovariance mMeasurementNoiseCov;
+  MeasurementCovariance mYYCov;
+  MeasurementVector mMeasurementEstimate;
+
+  StateSigmaPoints mSigmaPoints;
+  StateSigmaPoints mTransitionSPFuncVals;
+  StateSigmaPoints mTransitionSPFuncValsCenter;
+  MeasurementSigmaPoints mMeasurementSPFuncVals;
+  MeasurementSigmaPoints mMeasurementSPFuncValsCenter;
+
+  WeightVector mWm;
+  WeightVector mWc;
+
+  double mTmpLambda{0.};
+};
+
+} // namespace tracking
+} // namespace rv
@@ -4,12 +4,16 @@
 #include <opencv2/core.hpp>
 #include <pybind11/chrono.h>
 #include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <rv/tracking/MultiModelKalmanEstimator.hpp>
 #include <rv/tracking/MultipleObjectTracker.hpp>
 #include <rv/tracking/TrackManager.hpp>
 #include <rv/tracking/TrackTracker.hpp>
+#include <rv/tracking/FrameStats.hpp>
+#include <rv/tracking/TrackSerialization.hpp>
+#include <rv/tracking/TrackerPool.hpp>
 #include <rv/tracking/TrackedObject.hpp>
 #include <rv/tracking/Classification.hpp>
 #include <rv/tracking/CameraUtils.hpp>
@@ -19,6 +23,45 @@
 
 namespace py = pybind11;
 
+// Attribute conversion cache. Attribute keys and most values repeat for a
+// track's lifetime, so the py::str objects are interned and reused, and the
+// whole dict is rebuilt only when the AttributeSet's generation changed. Both
+// caches are flushed when they outgrow their bound, and are intentionally
+// leaked so no Python objects are destroyed after interpreter shutdown. The
+// getter runs with the GIL held, which also serializes the cache access.
+static py::str internedAttributeString(const std::string &value) {
+    static constexpr std::size_t maxInternedStrings = 8192;
+    static auto &interned = *new std::unordered_map<std::string, py::str>();
+
+    auto entry = interned.find(value);
+    if (entry == interned.end()) {
+        if (interned.size() >= maxInternedStrings) {
+            interned.clear();
+        }
+        entry = interned.emplace(value, py::str(value)).first;
+    }
+    return entry->second;
+}
+
+static py::dict convertAttributes(const rv::tracking::AttributeSet &attributes) {
+    static constexpr std::size_t maxCachedDicts = 4096;
+    static auto &cache = *new std::unordered_map<std::uint64_t, py::dict>();
+
+    auto const generation = attributes.generation();
+    auto entry = cache.find(generation);
+    if (entry == cache.end()) {
+        if (cache.size() >= maxCachedDicts) {
+            cache.clear();
+        }
+        py::dict values;
+        attributes.forEach([&values](const std::string &key, const std::string &value) {
+            values[internedAttributeString(key)] = internedAttributeString(value);
+        });
+        entry = cache.emplace(generation, std::move(values)).first;
+    }
+    return entry->second;
+}
+
 // Helper function to convert numpy array to cv::Mat
 cv::Mat numpy_to_mat(py::array_t<double> input) {
     py::buffer_info buf_info = input.request();
@@ -36,8 +79,28 @@ cv::Mat numpy_to_mat(py::array_t<double> input) {
     }
 }
 
+/**
+ * @brief Scalar track fields exported as one structured-array record
+ *
+ * Class probabilities are variable length per deployment, so they travel in a
+ * companion (tracks, classes) float array instead of the record itself.
+ */
+struct TrackRecord {
+    int64_t id;
+    double x;
+    double y;
+    double z;
+    double vx;
+    double vy;
+    double length;
+    double width;
+    double height;
+    double yaw;
+};
+
 PYBIND11_MODULE(tracking, tracking)
 {
+  PYBIND11_NUMPY_DTYPE(TrackRecord, id, x, y, z, vx, vy, length, width, height, yaw);
   tracking.doc() = R"pbdoc(
     Algorithms for tracking 3D objects
     -----------------------
@@ -88,13 +151,23 @@ py::class_<rv::tracking::Classification>(tracking, "Classification", "Classifica
     .def_readwrite("id", &rv::tracking::TrackedObject::id, "Object's identification number.")
     .def("isDynamic", &rv::tracking::TrackedObject::isDynamic, "Returns True if the TrackedObject is considered to be moving.")
     .def_readwrite("classification", &rv::tracking::TrackedObject::classification, "Returns a numpy array with classification probabilities.")
-    .def_readwrite("attributes", &rv::tracking::TrackedObject::attributes, "Dictionary of attributes. Note: only string types are supported.")
+    .def_property("attributes",
+                  [](const rv::tracking::TrackedObject &object) { return convertAttributes(object.attributes); },
+                  [](rv::tracking::TrackedObject &object, const std::unordered_map<std::string, std::string> &values) {
+                    object.attributes = rv::tracking::AttributeSet(values);
+                  },
+                  "Dictionary of attributes. Note: only string types are supported. The returned dict is a cached "
+                  "snapshot shared between reads; copy it before mutating (assigning a dict to the property is "
+                  "unaffected).")
     .def_property("vector",
                   &rv::tracking::TrackedObject::getVectorXf,
                   &rv::tracking::TrackedObject::setVectorXf,
                   py::return_value_policy::take_ownership, "Returns this object's state vector as numpy array.")
     .def_readwrite("measurement_mean", &rv::tracking::TrackedObject::predictedMeasurementMean, "Returns this object's measurement vector as numpy array.")
-    .def_readwrite("measurement_covariance", &rv::tracking::TrackedObject::predictedMeasurementCov, "Measurement covariance matrix, convert to numpy using np.array(tracked_object.measurement_covariance).")
+    .def_property("measurement_covariance",
+                  &rv::tracking::TrackedObject::getPredictedMeasurementCov,
+                  &rv::tracking::TrackedObject::setPredictedMeasurementCov,
+                  "Measurement covariance matrix, convert to numpy using np.array(tracked_object.measurement_covariance).")
     .def_readwrite("error_covariance", &rv::tracking::TrackedObject::errorCovariance, "Error covariance matrix, convert to numpy using np.array(tracked_object.error_covariance).")
     .def("__repr__", &rv::tracking::TrackedObject::toString, "String representation.");
 
@@ -194,11 +267,111 @@ py::class_<rv::tracking::Classification>(tracking, "Classification", "Classifica
      "Default measurement noise passed to the KalmanEstimator init function.")
     .def_readwrite("init_state_covariance", &rv::tracking::TrackManagerConfig::mInitStateCovariance,
      "Default init state covariance passed to the KalmanEstimator init function.")
+    .def_readwrite("worker_threads", &rv::tracking::TrackManagerConfig::mWorkerThreads,
+                   "Number of worker pool threads shared by the tracking stages; 0 selects the hardware concurrency.")
+    .def_readwrite("pin_worker_threads", &rv::tracking::TrackManagerConfig::mPinWorkerThreads,
+                   "Pin the worker pool threads round-robin to CPU cores.")
+    .def_readwrite("model_prune_probability_floor", &rv::tracking::TrackManagerConfig::mModelPruneProbabilityFloor,
+                   "IMM model probability below which a model counts as inactive for pruning purposes.")
+    .def_readwrite("model_prune_frames", &rv::tracking::TrackManagerConfig::mModelPruneFrames,
+                   "Consecutive sub-floor frames before an IMM model is suspended; 0 disables pruning.")
+    .def_readwrite("track_history_capacity", &rv::tracking::TrackManagerConfig::mTrackHistoryCapacity,
+                   "Ring-buffer capacity of per-track trajectory history sampled at each corrected frame; 0 disables collection.")
+    .def_readwrite("max_tracks", &rv::tracking::TrackManagerConfig::mMaxTracks,
+                   "Upper bound on live (active plus suspended) tracks; 0 disables bounded-capacity mode.")
+    .def_readwrite("min_admission_score", &rv::tracking::TrackManagerConfig::mMinAdmissionScore,
+                   "Admission score below which a new track is rejected outright; 0 admits all scores.")
     .def_readwrite("motion_models", &rv::tracking::TrackManagerConfig::mMotionModels,
      "List of motion models to use. It defaults to [CV, CA, CTRV]")
     .def("__repr__", &rv::tracking::TrackManagerConfig::toString, "String representation");
 
 
+  py::class_<rv::tracking::StageStats>(tracking, "StageStats",
+      "Latency distribution of one tracking pipeline stage; the histogram uses power-of-two microsecond buckets.")
+    .def_readonly("count", &rv::tracking::StageStats::count, "Number of recorded scopes.")
+    .def_readonly("total_microseconds", &rv::tracking::StageStats::totalMicroseconds, "Summed stage latency.")
+    .def_readonly("min_microseconds", &rv::tracking::StageStats::minMicroseconds, "Fastest recorded scope.")
+    .def_readonly("max_microseconds", &rv::tracking::StageStats::maxMicroseconds, "Slowest recorded scope.")
+    .def_readonly("histogram", &rv::tracking::StageStats::histogram,
+     "Bucket i counts samples in [2^i, 2^(i+1)) microseconds.")
+    .def("average_microseconds", &rv::tracking::StageStats::averageMicroseconds, "Mean stage latency.");
+
+  py::enum_<rv::tracking::TrackingStage>(tracking, "TrackingStage", "Pipeline stages timed inside track().")
+    .value("Predict", rv::tracking::TrackingStage::Predict)
+    .value("Associate", rv::tracking::TrackingStage::Associate)
+    .value("Correct", rv::tracking::TrackingStage::Correct)
+    .value("CreateTracks", rv::tracking::TrackingStage::CreateTracks)
+    .export_values();
+
+  py::enum_<rv::tracking::MemorySubsystem>(tracking, "MemorySubsystem",
+      "Subsystems whose resident byte footprint is sampled once per frame.")
+    .value("Estimators", rv::tracking::MemorySubsystem::Estimators)
+    .value("MatcherScratch", rv::tracking::MemorySubsystem::MatcherScratch)
+    .value("Snapshots", rv::tracking::MemorySubsystem::Snapshots)
+    .export_values();
+
+  py::class_<rv::tracking::MemoryUsage>(tracking, "MemoryUsage",
+      "Resident bytes of one subsystem with its high-water mark; derived from container "
+      "capacities, so the values report held memory rather than live objects.")
+    .def_readonly("current_bytes", &rv::tracking::MemoryUsage::currentBytes, "Footprint at the last sample.")
+    .def_readonly("peak_bytes", &rv::tracking::MemoryUsage::peakBytes,
+     "Largest sample of the measurement window.");
+
+  py::class_<rv::tracking::FrameStats>(tracking, "FrameStats",
+      "Per-stage latency statistics and per-subsystem memory footprints of the tracking pipeline.")
+    .def("stage", &rv::tracking::FrameStats::stage,
+     "Statistics for one pipeline stage.", py::arg("stage"), py::return_value_policy::copy)
+    .def("memory_usage", &rv::tracking::FrameStats::memoryUsage,
+     "Resident footprint of one subsystem.", py::arg("subsystem"), py::return_value_policy::copy)
+    .def("__repr__", &rv::tracking::FrameStats::toString, "String representation");
+
+  tracking.def("serialize_tracks",
+      [](const std::vector<rv::tracking::TrackedObject> &tracks) {
+        std::vector<uint8_t> buffer;
+        rv::tracking::serializeTracks(tracks.data(), tracks.size(), buffer);
+        return py::bytes(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+      },
+      "Serialize tracks into the flat versioned binary format, suitable for an MQTT payload or "
+      "shared memory without per-field allocation.",
+      py::arg("tracks"));
+
+  tracking.def("serialize_snapshot",
+      [](const rv::tracking::TrackSnapshot &snapshot) {
+        std::vector<uint8_t> buffer;
+        rv::tracking::serializeTracks(snapshot, buffer);
+        return py::bytes(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+      },
+      "Serialize a frame snapshot including its version and timestamp.",
+      py::arg("snapshot"));
+
+  tracking.def("deserialize_tracks",
+      [](const py::bytes &blob) {
+        py::buffer_info info(py::buffer(blob).request());
+        return rv::tracking::deserializeTracks(static_cast<const uint8_t *>(info.ptr),
+                                               static_cast<std::size_t>(info.size));
+      },
+      "Decode a flat track blob back into a list of tracked objects.",
+      py::arg("blob"));
+
+  py::class_<rv::tracking::TrackHistorySample>(tracking, "TrackHistorySample",
+      "One trajectory point: the kinematic state of a track at a corrected frame.")
+    .def_readonly("timestamp", &rv::tracking::TrackHistorySample::timestamp, "Frame timestamp.")
+    .def_readonly("x", &rv::tracking::TrackHistorySample::x)
+    .def_readonly("y", &rv::tracking::TrackHistorySample::y)
+    .def_readonly("z", &rv::tracking::TrackHistorySample::z)
+    .def_readonly("vx", &rv::tracking::TrackHistorySample::vx)
+    .def_readonly("vy", &rv::tracking::TrackHistorySample::vy)
+    .def_readonly("yaw", &rv::tracking::TrackHistorySample::yaw);
+
+  py::class_<rv::tracking::TrackSnapshot, std::shared_ptr<rv::tracking::TrackSnapshot>>(tracking, "TrackSnapshot",
+      "Immutable per-frame copy of the track outputs, published atomically at the end of each correct step.")
+    .def_readonly("version", &rv::tracking::TrackSnapshot::version,
+     "Monotonic frame counter, increases by one per published frame.")
+    .def_readonly("timestamp", &rv::tracking::TrackSnapshot::timestamp,
+     "Timestamp the snapshot states refer to.")
+    .def_readonly("tracks", &rv::tracking::TrackSnapshot::tracks,
+     "List of tracked objects captured for the frame.");
+
      py::class_<rv::tracking::TrackManager>(tracking, "TrackManager",
       "Track management system for multiple objects, it holds databases of the current objects on the scene and facilitates updates of multiple objects via id queries.")
     .def(py::init<>(), "Construct with default config")
@@ -210,8 +383,10 @@ py::class_<rv::tracking::Classification>(tracking, "Classification", "Classifica
      "Construct with default config. Set auto_id_generation to False to use the already assigned track_id instead.",
      py::arg("track_manager_config"), py::arg("auto_id_generation"))
     .def("create_track",
-         &rv::tracking::TrackManager::createTrack,
-         "Create a new track, returns object id of new track.",
+         py::overload_cast<rv::tracking::TrackedObject, const std::chrono::system_clock::time_point &>(
+           &rv::tracking::TrackManager::createTrack),
+         "Create a new track, returns object id of new track (InvalidObjectId when the "
+         "bounded-capacity admission gate rejects the detection).",
          py::arg("object"),
          py::arg("timestamp"))
     .def("predict",
@@ -229,6 +404,19 @@ py::class_<rv::tracking::Classification>(tracking, "Classification", "Classifica
          py::arg("measurement"))
      .def("correct", &rv::tracking::TrackManager::correct, "Trigger state correction for all tracks.")
      .def("get_tracks", &rv::tracking::TrackManager::getTracks, "returns a list of all active tracks.")
+     .def("get_track_history",
+          &rv::tracking::TrackManager::getTrackHistory,
+          "Recent trajectory of a track, oldest sample first; requires track_history_capacity in the config.",
+          py::arg("id"))
+     .def("predict_to",
+          &rv::tracking::TrackManager::predictTo,
+          "Extrapolate the last published snapshot to a future timestamp without touching the "
+          "correction state; thread-safe, usable for high-rate interpolated publishing.",
+          py::arg("timestamp"),
+          py::call_guard<py::gil_scoped_release>())
+     .def("get_track_snapshot",
+          &rv::tracking::TrackManager::getTrackSnapshot,
+          "Returns the latest published frame snapshot; safe to call from another thread while tracking runs. None before the first corrected frame.")
      .def("get_reliable_tracks",
           &rv::tracking::TrackManager::getReliableTracks,
           "Returns a list of all tracks classified as reliable.")
@@ -246,8 +434,9 @@ py::class_<rv::tracking::Classification>(tracking, "Classification", "Classifica
           "Returns the TrackedObject stored for the given id.",
           py::arg("id"))
      .def("get_kalman_estimator",
-          &rv::tracking::TrackManager::getKalmanEstimator,
-          "Returns the MultiModelKalmanEstimator  stored for the given id.",
+          &rv::tracking::TrackManager::kalmanEstimator,
+          py::return_value_policy::reference_internal,
+          "Returns the MultiModelKalmanEstimator stored for the given id, without copying it.",
           py::arg("id"))
      .def("has_id",
          &rv::tracking::TrackManager::hasId,
@@ -320,12 +509,184 @@ py::class_<rv::tracking::Classification>(tracking, "Classification", "Classifica
          py::arg("probability_threshold") = 0.5)
     .def("timestamp", &rv::tracking::MultipleObjectTracker::getTimestamp, "Read current timestamp.")
     .def("get_tracks", &rv::tracking::MultipleObjectTracker::getTracks, "Returns a list of all active tracks")
+    .def("get_track_history",
+         &rv::tracking::MultipleObjectTracker::getTrackHistory,
+         "Recent trajectory of a track, oldest sample first; requires track_history_capacity in the config.",
+         py::arg("id"))
+    .def("predict_to",
+         &rv::tracking::MultipleObjectTracker::predictTo,
+         "Extrapolate the last published snapshot to a future timestamp without touching the "
+         "correction state; thread-safe, usable for high-rate interpolated publishing.",
+         py::arg("timestamp"),
+         py::call_guard<py::gil_scoped_release>())
+    .def("get_track_snapshot",
+         &rv::tracking::MultipleObjectTracker::getTrackSnapshot,
+         "Returns the latest published frame snapshot; safe to call from another thread while track() runs. None before the first corrected frame.")
     .def("get_reliable_tracks",
          &rv::tracking::MultipleObjectTracker::getReliableTracks,
          "Returns a list of all active reliable tracks.")
     .def("update_tracker_params",
          &rv::tracking::MultipleObjectTracker::updateTrackerParams,
-         "Updates tracker frame based parameters.");
+         "Updates tracker frame based parameters.")
+    .def("set_partitioned_matching",
+         &rv::tracking::MultipleObjectTracker::setPartitionedMatching,
+         "Enable per-class partitioned association: one parallel Hungarian problem per dominant class; cross-class pairs never enter a cost matrix.",
+         py::arg("enable"))
+    .def("set_incremental_matching",
+         &rv::tracking::MultipleObjectTracker::setIncrementalMatching,
+         "Enable warm-started association seeded from the previous frame's assignments.",
+         py::arg("enable"))
+    .def("track_batch",
+         [](rv::tracking::MultipleObjectTracker &self,
+            py::array_t<double, py::array::c_style | py::array::forcecast> x,
+            py::array_t<double, py::array::c_style | py::array::forcecast> y,
+            py::array_t<double, py::array::c_style | py::array::forcecast> sizes,
+            py::array_t<double, py::array::c_style | py::array::forcecast> classProbabilities,
+            py::array_t<int64_t, py::array::c_style | py::array::forcecast> cameraIndex,
+            const std::chrono::system_clock::time_point &timestamp,
+            double scoreThreshold) {
+           auto xView = x.unchecked<1>();
+           auto yView = y.unchecked<1>();
+           auto sizesView = sizes.unchecked<2>();
+           auto classView = classProbabilities.unchecked<2>();
+           auto cameraView = cameraIndex.unchecked<1>();
+
+           const py::ssize_t detectionCount = xView.shape(0);
+           if (yView.shape(0) != detectionCount || sizesView.shape(0) != detectionCount
+               || classView.shape(0) != detectionCount || cameraView.shape(0) != detectionCount)
+           {
+             throw std::invalid_argument("track_batch: all columns must share the detection count");
+           }
+           if (sizesView.shape(1) != 3)
+           {
+             throw std::invalid_argument("track_batch: sizes must have shape (detections, 3): length, width, height");
+           }
+
+           // The raw buffers stay alive through the argument handles, so the
+           // whole conversion and track() run without the interpreter
+           py::gil_scoped_release release;
+
+           int64_t cameraCount = 0;
+           for (py::ssize_t i = 0; i < detectionCount; ++i)
+           {
+             if (cameraView(i) < 0)
+             {
+               throw std::invalid_argument("track_batch: camera_index must be non-negative");
+             }
+             cameraCount = std::max(cameraCount, cameraView(i) + 1);
+           }
+
+           std::vector<std::vector<rv::tracking::TrackedObject>> objectsPerCamera(
+             static_cast<size_t>(cameraCount));
+           const py::ssize_t classCount = classView.shape(1);
+           for (py::ssize_t i = 0; i < detectionCount; ++i)
+           {
+             rv::tracking::TrackedObject object;
+             object.x = xView(i);
+             object.y = yView(i);
+             object.length = sizesView(i, 0);
+             object.width = sizesView(i, 1);
+             object.height = sizesView(i, 2);
+             object.classification = Eigen::VectorXd(classCount);
+             for (py::ssize_t c = 0; c < classCount; ++c)
+             {
+               object.classification[c] = classView(i, c);
+             }
+             objectsPerCamera[static_cast<size_t>(cameraView(i))].push_back(std::move(object));
+           }
+
+           self.track(std::move(objectsPerCamera), timestamp, scoreThreshold);
+         },
+         "Batch ingestion from NumPy columns: x, y, sizes (detections x 3: length/width/height), "
+         "class_probabilities (detections x classes) and camera_index. Builds the per-camera "
+         "detection lists in one pass without touching the interpreter per field and runs the "
+         "whole track() call with the GIL released.",
+         py::arg("x"),
+         py::arg("y"),
+         py::arg("sizes"),
+         py::arg("class_probabilities"),
+         py::arg("camera_index"),
+         py::arg("timestamp"),
+         py::arg("probability_threshold") = 0.5)
+    .def("get_tracks_batch",
+         [](rv::tracking::MultipleObjectTracker &self, bool reliableOnly) {
+           std::vector<rv::tracking::TrackedObject> tracks;
+           {
+             py::gil_scoped_release release;
+             tracks = reliableOnly ? self.getReliableTracks() : self.getTracks();
+           }
+
+           const py::ssize_t trackCount = static_cast<py::ssize_t>(tracks.size());
+           const py::ssize_t classCount = tracks.empty() ? 0 : tracks.front().classification.size();
+           py::array_t<TrackRecord> records(trackCount);
+           py::array_t<double> classProbabilities({trackCount, classCount});
+
+           auto recordsView = records.mutable_unchecked<1>();
+           auto classView = classProbabilities.mutable_unchecked<2>();
+           for (py::ssize_t i = 0; i < trackCount; ++i)
+           {
+             const auto &track = tracks[static_cast<size_t>(i)];
+             recordsView(i) = TrackRecord{static_cast<int64_t>(track.id), track.x, track.y, track.z,
+                                          track.vx, track.vy, track.length, track.width, track.height, track.yaw};
+             for (py::ssize_t c = 0; c < classCount && c < track.classification.size(); ++c)
+             {
+               classView(i, c) = track.classification[c];
+             }
+           }
+           return py::make_tuple(records, classProbabilities);
+         },
+         "Track output as a (records, class_probabilities) pair: a structured array with the "
+         "scalar track fields and a (tracks, classes) float array, instead of a list of Python "
+         "objects.",
+         py::arg("reliable_only") = false)
+    .def("get_frame_stats",
+         &rv::tracking::MultipleObjectTracker::getFrameStats,
+         "Per-stage latency statistics accumulated since construction or the last reset_frame_stats().")
+    .def("reset_frame_stats",
+         &rv::tracking::MultipleObjectTracker::resetFrameStats,
+         "Start a fresh latency measurement window.");
+
+  py::class_<rv::tracking::TrackerPoolConfig>(tracking, "TrackerPoolConfig", "Configuration for the multi-scene TrackerPool.")
+    .def(py::init<>(), "Construct with defaults")
+    .def_readwrite("scene_count", &rv::tracking::TrackerPoolConfig::mSceneCount,
+     "Number of scenes (trackers) owned by the pool.")
+    .def_readwrite("worker_threads", &rv::tracking::TrackerPoolConfig::mWorkerThreads,
+     "Number of scene worker threads; 0 selects one per scene capped at the hardware concurrency.")
+    .def_readwrite("pin_worker_threads", &rv::tracking::TrackerPoolConfig::mPinWorkerThreads,
+     "Pin the scene workers round-robin to CPU cores.")
+    .def_readwrite("max_queued_frames", &rv::tracking::TrackerPoolConfig::mMaxQueuedFrames,
+     "Frames a scene may have queued before submit() rejects.")
+    .def_readwrite("distance_type", &rv::tracking::TrackerPoolConfig::mDistanceType,
+     "Distance type used for matching in every scene.")
+    .def_readwrite("distance_threshold", &rv::tracking::TrackerPoolConfig::mDistanceThreshold,
+     "Distance threshold used for matching in every scene.")
+    .def_readwrite("tracker_config", &rv::tracking::TrackerPoolConfig::mTrackerConfig,
+     "TrackManagerConfig applied to every scene tracker.");
+
+  py::class_<rv::tracking::TrackerPool>(tracking, "TrackerPool",
+    "Runs many single-scene trackers concurrently on a sharded worker pool with per-scene bounded input queues.")
+    .def(py::init<const rv::tracking::TrackerPoolConfig &>(), "Construct with given config", py::arg("config"))
+    .def("scene_count", &rv::tracking::TrackerPool::sceneCount, "Number of scenes owned by the pool.")
+    .def("worker_count", &rv::tracking::TrackerPool::workerCount, "Number of scene worker threads.")
+    .def("submit",
+         &rv::tracking::TrackerPool::submit,
+         py::call_guard<py::gil_scoped_release>(),
+         "Queue one frame of per-camera measurements for a scene. Returns False when the scene queue is full.",
+         py::arg("scene_index"),
+         py::arg("objects_per_camera"),
+         py::arg("timestamp"))
+    .def("poll",
+         &rv::tracking::TrackerPool::poll,
+         "Latest published snapshot of the scene; None before its first tracked frame.",
+         py::arg("scene_index"))
+    .def("pending_frames",
+         &rv::tracking::TrackerPool::pendingFrames,
+         "Frames queued but not yet tracked for the scene.",
+         py::arg("scene_index"))
+    .def("drain",
+         &rv::tracking::TrackerPool::drain,
+         py::call_guard<py::gil_scoped_release>(),
+         "Block until every queued frame has been tracked.");
 
   py::class_<rv::tracking::TrackTracker>(tracking,
   "TrackTracker", "Multiple Object Tracking algorithm using the TrackManager in the background. This tracker does not perform any association step, instead it relies on the object's id for association.")
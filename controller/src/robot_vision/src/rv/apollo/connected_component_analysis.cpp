@@ -8,17 +8,22 @@ namespace apollo {
 namespace perception {
 namespace common {
 
-void ConnectedComponentAnalysis(const std::vector<std::vector<int>> &graph, std::vector<std::vector<int>> *components)
+void ConnectedComponentAnalysis(const std::vector<std::vector<int>> &graph,
+                                size_t num_item,
+                                std::vector<std::vector<int>> *components)
 {
-  int num_item = static_cast<int>(graph.size());
-  std::vector<int> visited;
-  visited.resize(num_item, 0);
-  std::queue<int> que;
-  std::vector<int> component;
+  /* traversal scratch, persistent per thread: the association stage runs this
+   * once per Match and must not allocate in steady state */
+  static thread_local std::vector<int> visited;
+  static thread_local std::queue<int> que;
+  static thread_local std::vector<int> component;
+
+  visited.assign(num_item, 0);
+  component.clear();
   component.reserve(num_item);
-  components->clear();
 
-  for (int index = 0; index < num_item; ++index)
+  size_t num_components = 0;
+  for (int index = 0; index < static_cast<int>(num_item); ++index)
   {
     if (visited[index])
     {
@@ -42,9 +47,21 @@ void ConnectedComponentAnalysis(const std::vector<std::vector<int>> &graph, std:
         }
       }
     }
-    components->push_back(component);
+    /* copy into a reused slot; vector assignment keeps the slot's capacity */
+    if (num_components == components->size())
+    {
+      components->emplace_back();
+    }
+    (*components)[num_components] = component;
+    ++num_components;
     component.clear();
   }
+  components->resize(num_components);
+}
+
+void ConnectedComponentAnalysis(const std::vector<std::vector<int>> &graph, std::vector<std::vector<int>> *components)
+{
+  ConnectedComponentAnalysis(graph, graph.size(), components);
 }
 
 } // namespace common
@@ -2,19 +2,30 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "rv/tracking/CAModel.hpp"
+#include "rv/tracking/TransitionMatrixCache.hpp"
 
 namespace rv {
 namespace tracking {
 
 void CAModel::stateConversionFunction(const cv::Mat &x_k, const cv::Mat &u_k, const cv::Mat &v_k, cv::Mat &x_kplus1)
 {
-  cv::Mat vk = v_k.clone();
-
   /*
    * The time is considered the control input
    */
   double deltaT = u_k.at<double>(0, 0);
 
+  /*
+   * Propagate against the frame's cached transition matrix when it was primed
+   * for this deltaT; the scalar path below remains for per-track timesteps
+   */
+  if (auto transition = TransitionMatrixCache::instance().transition(MotionModel::CA, deltaT))
+  {
+    x_kplus1 = (*transition) * x_k + v_k;
+    return;
+  }
+
+  cv::Mat vk = v_k.clone();
+
   double x = x_k.at<double>(0, 0);
   double y = x_k.at<double>(1, 0);
   double vx = x_k.at<double>(2, 0);
@@ -2,19 +2,30 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <rv/tracking/CPModel.hpp>
+#include "rv/tracking/TransitionMatrixCache.hpp"
 
 namespace rv {
 namespace tracking {
 
 void CPModel::stateConversionFunction(const cv::Mat &x_k, const cv::Mat &u_k, const cv::Mat &v_k, cv::Mat &x_kplus1)
 {
-  cv::Mat vk = v_k.clone();
-
   /*
    * The time is considered the control input
    */
   double deltaT = u_k.at<double>(0, 0);
 
+  /*
+   * Propagate against the frame's cached transition matrix when it was primed
+   * for this deltaT; the scalar path below remains for per-track timesteps
+   */
+  if (auto transition = TransitionMatrixCache::instance().transition(MotionModel::CP, deltaT))
+  {
+    x_kplus1 = (*transition) * x_k + v_k;
+    return;
+  }
+
+  cv::Mat vk = v_k.clone();
+
   x_kplus1.at<double>(0, 0) = x_k.at<double>(0, 0);  // Position in X
   x_kplus1.at<double>(1, 0) = x_k.at<double>(1, 0);  // Position in Y
   x_kplus1.at<double>(2, 0) = 0;                     // Velocity in X
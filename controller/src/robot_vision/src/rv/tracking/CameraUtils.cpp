@@ -3,20 +3,123 @@
 
 #include "rv/tracking/CameraUtils.hpp"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace rv {
 
+namespace {
+
+/**
+ * @brief Derived per-camera undistortion data, computed once per calibration
+ *
+ * Holds CV_64F copies of the calibration (so repeated calls skip the per-call
+ * type conversion inside OpenCV) plus the pinhole scalars for the fast path:
+ * with no distortion coefficients, undistortPoints reduces to the linear
+ * normalization ((x - cx) / fx, (y - cy) / fy), which we apply directly
+ * without entering OpenCV at all.
+ */
+struct CachedCamera {
+    cv::Mat intrinsics;
+    cv::Mat distortion;
+    double fx{1.0};
+    double fy{1.0};
+    double cx{0.0};
+    double cy{0.0};
+    bool hasDistortion{false};
+};
+
+/**
+ * @brief Flatten a calibration into a comparable key
+ */
+std::vector<double> cameraKey(const CameraParams& params) {
+    std::vector<double> key;
+    key.reserve(params.intrinsics.total() + params.distortion.total());
+    for (const cv::Mat* mat : {&params.intrinsics, &params.distortion}) {
+        cv::Mat values;
+        mat->convertTo(values, CV_64F);
+        key.insert(key.end(), values.begin<double>(), values.end<double>());
+    }
+    return key;
+}
+
+struct CameraKeyHash {
+    size_t operator()(const std::vector<double>& key) const {
+        size_t hash = key.size();
+        for (const double value : key) {
+            hash ^= std::hash<double>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
+
+/**
+ * @brief Process-wide cache of derived undistortion data keyed on calibration
+ *
+ * Deployments hold a handful of camera calibrations that never change at
+ * runtime, so the cache is tiny and never evicts. Lookup is guarded by a
+ * mutex; the returned entries are immutable and safe to share across threads.
+ */
+std::shared_ptr<const CachedCamera> getCachedCamera(const CameraParams& params) {
+    static std::mutex cacheMutex;
+    static std::unordered_map<std::vector<double>, std::shared_ptr<const CachedCamera>, CameraKeyHash> cache;
+
+    auto key = cameraKey(params);
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto existing = cache.find(key);
+    if (existing != cache.end()) {
+        return existing->second;
+    }
+
+    auto entry = std::make_shared<CachedCamera>();
+    params.intrinsics.convertTo(entry->intrinsics, CV_64F);
+    params.distortion.convertTo(entry->distortion, CV_64F);
+    entry->fx = entry->intrinsics.at<double>(0, 0);
+    entry->fy = entry->intrinsics.at<double>(1, 1);
+    entry->cx = entry->intrinsics.at<double>(0, 2);
+    entry->cy = entry->intrinsics.at<double>(1, 2);
+    entry->hasDistortion = cv::countNonZero(entry->distortion != 0) > 0;
+
+    cache.emplace(std::move(key), entry);
+    return entry;
+}
+
+/**
+ * @brief Undistort a gathered corner list with one OpenCV call (or none)
+ */
+void undistortCorners(const std::vector<cv::Point2f>& corners,
+                      std::vector<cv::Point2f>& undistorted,
+                      const CachedCamera& camera) {
+    if (!camera.hasDistortion) {
+        undistorted.resize(corners.size());
+        for (size_t i = 0; i < corners.size(); ++i) {
+            undistorted[i].x = static_cast<float>((corners[i].x - camera.cx) / camera.fx);
+            undistorted[i].y = static_cast<float>((corners[i].y - camera.cy) / camera.fy);
+        }
+        return;
+    }
+
+    cv::undistortPoints(corners, undistorted, camera.intrinsics, camera.distortion);
+}
+
+} // namespace
+
 cv::Rect2f computePixelsToMeterPlane(
     const cv::Rect2f& bbox,
     const CameraParams& params
 ) {
+    auto camera = getCachedCamera(params);
+
     // Undistort top-left and bottom-right corners
     std::vector<cv::Point2f> points = {
         {bbox.x, bbox.y},
         {bbox.x + bbox.width, bbox.y + bbox.height}
     };
     std::vector<cv::Point2f> undistorted;
-
-    cv::undistortPoints(points, undistorted, params.intrinsics, params.distortion);
+    undistortCorners(points, undistorted, *camera);
 
     return cv::Rect2f(
         undistorted[0].x,
@@ -31,12 +134,36 @@ std::vector<cv::Rect2f> computePixelsToMeterPlane(
     const CameraParams& params
 ) {
     std::vector<cv::Rect2f> results;
-    results.reserve(bboxes.size());
-    
+    if (bboxes.empty()) {
+        return results;
+    }
+
+    auto camera = getCachedCamera(params);
+
+    // Gather every corner from every box so the distortion model runs once
+    // over the whole frame instead of once per detection
+    std::vector<cv::Point2f> corners;
+    corners.reserve(bboxes.size() * 2);
     for (const auto& bbox : bboxes) {
-        results.push_back(computePixelsToMeterPlane(bbox, params));
+        corners.emplace_back(bbox.x, bbox.y);
+        corners.emplace_back(bbox.x + bbox.width, bbox.y + bbox.height);
+    }
+
+    std::vector<cv::Point2f> undistorted;
+    undistortCorners(corners, undistorted, *camera);
+
+    results.reserve(bboxes.size());
+    for (size_t i = 0; i < bboxes.size(); ++i) {
+        const auto& topLeft = undistorted[2 * i];
+        const auto& bottomRight = undistorted[2 * i + 1];
+        results.emplace_back(
+            topLeft.x,
+            topLeft.y,
+            bottomRight.x - topLeft.x,
+            bottomRight.y - topLeft.y
+        );
     }
-    
+
     return results;
 }
 
@@ -41,8 +41,107 @@ namespace classification {
   {
     return 1.0 - distance(classificationA, classificationB);
   }
+  double distance(const FixedClassification & classificationA, const FixedClassification & classificationB)
+  {
+    if (classificationA.size() != classificationB.size())
+    {
+      throw std::runtime_error("The vectors should be of the same size");
+    }
+
+    // Fixed trip count over the padded block; the zero tail adds nothing
+    double sumOfSquares = 0.;
+    for (std::size_t i = 0; i < FixedClassification::kMaxClasses; ++i)
+    {
+      double const residual = classificationA[i] - classificationB[i];
+      sumOfSquares += residual * residual;
+    }
+
+    return std::sqrt(0.5 * sumOfSquares);
+  }
+
+  FixedClassification combine(const FixedClassification & classificationA, const FixedClassification & classificationB)
+  {
+    if (classificationA.size() != classificationB.size())
+    {
+      throw std::runtime_error("The classification sizes are different");
+    }
+
+    // If classification probabilities are well defined these terms should be zero
+    double unknownA = rv::clamp<double>(1.0 - classificationA.sum(), 0., 1.0);
+    double unknownB = rv::clamp<double>(1.0 - classificationB.sum(), 0., 1.0);
+
+    std::array<double, FixedClassification::kMaxClasses> products;
+    double productSum = 0.;
+    for (std::size_t i = 0; i < FixedClassification::kMaxClasses; ++i)
+    {
+      products[i] = classificationA[i] * classificationB[i];
+      productSum += products[i];
+    }
+
+    double const normalization = productSum + unknownA * unknownB + 1e-6;
+    for (std::size_t i = 0; i < FixedClassification::kMaxClasses; ++i)
+    {
+      products[i] /= normalization;
+    }
+
+    return FixedClassification(products.data(), classificationA.size());
+  }
+
+  double similarity(const FixedClassification & classificationA, const FixedClassification & classificationB)
+  {
+    return 1.0 - distance(classificationA, classificationB);
+  }
 } // enf of namespace classification
 
+  FixedClassification::FixedClassification(const Classification &probabilities)
+  {
+    if (static_cast<std::size_t>(probabilities.size()) > kMaxClasses)
+    {
+      throw std::runtime_error("The classification exceeds the fixed capacity");
+    }
+
+    mValues.fill(0.);
+    mSize = static_cast<std::size_t>(probabilities.size());
+    std::copy(probabilities.data(), probabilities.data() + mSize, mValues.begin());
+    finalize();
+  }
+
+  FixedClassification::FixedClassification(const double *values, std::size_t size)
+  {
+    if (size > kMaxClasses)
+    {
+      throw std::runtime_error("The classification exceeds the fixed capacity");
+    }
+
+    mValues.fill(0.);
+    mSize = size;
+    std::copy(values, values + size, mValues.begin());
+    finalize();
+  }
+
+  void FixedClassification::finalize()
+  {
+    mSum = 0.;
+    mDominantIndex = -1;
+    mDominantScore = 0.;
+    for (std::size_t i = 0; i < mSize; ++i)
+    {
+      mSum += mValues[i];
+      if (mDominantIndex < 0 || mValues[i] > mDominantScore)
+      {
+        mDominantIndex = static_cast<Eigen::Index>(i);
+        mDominantScore = mValues[i];
+      }
+    }
+  }
+
+  Classification FixedClassification::toEigen() const
+  {
+    Classification probabilities(mSize);
+    std::copy(mValues.begin(), mValues.begin() + mSize, probabilities.data());
+    return probabilities;
+  }
+
   Classification ClassificationData::classification(const std::string & className, const double probability) const
   {
     std::size_t j = classIndex(className);
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rv/tracking/GatedComponents.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+#include "rv/WorkerPool.hpp"
+#include "rv/tracking/SpatialGridIndex.hpp"
+
+namespace rv {
+namespace tracking {
+
+namespace {
+
+/**
+ * @brief Lock-free union-find over a fixed node universe
+ *
+ * Roots are always the lowest index of their set: unite() only ever attaches a
+ * larger root under a smaller one with a single CAS on a node that is still its
+ * own parent, so concurrent unions cannot create cycles and retries terminate.
+ * find() applies path halving with plain stores, which is safe because parents
+ * only ever move towards the root.
+ */
+class LockFreeUnionFind
+{
+public:
+  explicit LockFreeUnionFind(std::size_t nodeCount)
+    : mParent(nodeCount)
+  {
+    for (std::size_t i = 0; i < nodeCount; ++i)
+    {
+      mParent[i].store(static_cast<std::uint32_t>(i), std::memory_order_relaxed);
+    }
+  }
+
+  std::uint32_t find(std::uint32_t node)
+  {
+    auto parent = mParent[node].load(std::memory_order_relaxed);
+    while (parent != node)
+    {
+      auto const grandparent = mParent[parent].load(std::memory_order_relaxed);
+      mParent[node].store(grandparent, std::memory_order_relaxed);
+      node = parent;
+      parent = grandparent;
+    }
+    return node;
+  }
+
+  void unite(std::uint32_t a, std::uint32_t b)
+  {
+    while (true)
+    {
+      a = find(a);
+      b = find(b);
+      if (a == b)
+      {
+        return;
+      }
+      if (a > b)
+      {
+        std::swap(a, b);
+      }
+      auto expected = b;
+      if (mParent[b].compare_exchange_strong(expected, a, std::memory_order_relaxed))
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  std::vector<std::atomic<std::uint32_t>> mParent;
+};
+
+} // namespace
+
+std::vector<GatedComponent>
+gatedConnectedComponents(const TrackView &tracks, const TrackView &measurements, double gateRadius)
+{
+  // Measurements occupy the node range [trackCount, trackCount + measurements.size())
+  auto const trackCount = tracks.size();
+  auto const nodeCount = trackCount + measurements.size();
+
+  LockFreeUnionFind forest(nodeCount);
+
+  SpatialGridIndex measurementIndex(gateRadius);
+  measurementIndex.build(measurements);
+
+  // Edge discovery straight off the grid index; unions are lock-free, so the
+  // per-track radius scans need no coordination
+  rv::WorkerPool::instance().parallelFor(0, trackCount, [&](std::size_t i) {
+    measurementIndex.forEachInRadius(tracks[i]->x, tracks[i]->y, gateRadius, [&](std::size_t j) {
+      forest.unite(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(trackCount + j));
+    });
+  });
+
+  // Compact roots into dense component labels; walking nodes in order makes
+  // the component numbering and the per-component index order deterministic
+  constexpr auto kUnlabelled = std::numeric_limits<std::uint32_t>::max();
+  std::vector<std::uint32_t> componentOfRoot(nodeCount, kUnlabelled);
+  std::vector<GatedComponent> components;
+
+  for (std::size_t node = 0; node < nodeCount; ++node)
+  {
+    auto const root = forest.find(static_cast<std::uint32_t>(node));
+    if (componentOfRoot[root] == kUnlabelled)
+    {
+      componentOfRoot[root] = static_cast<std::uint32_t>(components.size());
+      components.emplace_back();
+    }
+
+    auto &component = components[componentOfRoot[root]];
+    if (node < trackCount)
+    {
+      component.trackIndices.push_back(node);
+    }
+    else
+    {
+      component.measurementIndices.push_back(node - trackCount);
+    }
+  }
+
+  return components;
+}
+
+} // namespace tracking
+} // namespace rv
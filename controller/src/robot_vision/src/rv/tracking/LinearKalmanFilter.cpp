@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rv/tracking/LinearKalmanFilter.hpp"
+#include "rv/tracking/TransitionMatrixCache.hpp"
+
+namespace rv {
+namespace tracking {
+
+namespace {
+
+/*
+ * z = [x, y, z, length, width, height, yaw]: the selection the linear models
+ * implement in their measurementFunction()
+ */
+cv::Mat measurementMatrix(int stateSize, int measurementSize)
+{
+  constexpr int kMeasuredStates[] = {0, 1, 6, 7, 8, 9, 10};
+
+  cv::Mat selection = cv::Mat::zeros(measurementSize, stateSize, CV_64F);
+  for (int row = 0; row < measurementSize; ++row)
+  {
+    selection.at<double>(row, kMeasuredStates[row]) = 1.;
+  }
+  return selection;
+}
+
+} // namespace
+
+LinearKalmanFilterMod::LinearKalmanFilterMod(const cv::detail::tracking::UnscentedKalmanFilterParams &params,
+                                             MotionModel motionModel)
+  : cv::detail::tracking::UnscentedKalmanFilterMod(params)
+  , mMotionModel(motionModel)
+  , mMeasurementMatrix(measurementMatrix(params.DP, params.MP))
+{
+}
+
+void LinearKalmanFilterMod::computeSigmaPoints()
+{
+  // the mean is the only propagation column a linear model needs
+  sigmaPoints = state.clone();
+  transitionSPFuncVals = cv::Mat::zeros(state.rows, 1, state.type());
+}
+
+void LinearKalmanFilterMod::propagateSigmaPoints(cv::InputArray control)
+{
+  // the system model applies F (via the frame cache when primed), exactly as
+  // the unscented path applies it to every sigma point
+  model->stateConversionFunction(sigmaPoints, control.getMat(), q, transitionSPFuncVals);
+}
+
+cv::Mat LinearKalmanFilterMod::finishPredict(double deltaT)
+{
+  transitionSPFuncVals.copyTo(state);
+
+  auto const cached = TransitionMatrixCache::instance().transition(mMotionModel, deltaT);
+  cv::Mat const transition = cached ? *cached : TransitionMatrixCache::build(mMotionModel, deltaT);
+
+  // P = F * P * F^T + Q in closed form; the unscented reconstruction of a
+  // linear model converges to exactly this
+  errorCov = transition * errorCov * transition.t() + processNoiseCov;
+
+  measurementEstimate = mMeasurementMatrix * state;
+  yyCov = mMeasurementMatrix * errorCov * mMeasurementMatrix.t() + measurementNoiseCov;
+
+  return state.clone();
+}
+
+cv::Mat LinearKalmanFilterMod::correct(cv::InputArray _measurement)
+{
+  cv::Mat const measurement = _measurement.getMat();
+
+  // Sxy = P * H^T; the gain, state and covariance updates then match the
+  // unscented correct() step with the linear cross-covariances
+  xyCov = errorCov * mMeasurementMatrix.t();
+  yyCovInv = yyCov.inv(cv::DECOMP_SVD);
+  gain = xyCov * yyCovInv;
+
+  state = state + gain * (measurement - measurementEstimate);
+  errorCov = errorCov - gain * xyCov.t();
+
+  return state.clone();
+}
+
+} // namespace tracking
+} // namespace rv
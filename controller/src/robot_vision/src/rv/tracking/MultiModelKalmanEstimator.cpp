@@ -7,6 +7,7 @@
 #include "rv/tracking/CVModel.hpp"
 #include "rv/tracking/CPModel.hpp"
 #include "rv/tracking/Classification.hpp"
+#include "rv/tracking/LinearKalmanFilter.hpp"
 
 namespace rv {
 namespace tracking {
@@ -25,39 +26,28 @@ void MultiModelKalmanEstimator::initialize(TrackedObject track, const std::chron
 {
   mLastTimestamp = timestamp;
 
-  mSystemModels.clear();
+  static const std::vector<MotionModel> kDefaultMotionModels{MotionModel::CTRV, MotionModel::CV, MotionModel::CA};
+  auto const &requestedModels = motionModels.empty() ? kDefaultMotionModels : motionModels;
 
-  if (motionModels.empty())
+  // Track churn pools estimators through the store's slot free list; when a
+  // recycled estimator already holds filters for the requested model set,
+  // re-arm them in place instead of reallocating three filters and their
+  // buffers per created track
+  if (mMotionModels == requestedModels && mKalmanFilters.size() == requestedModels.size())
   {
-    mSystemModels.push_back(cv::makePtr<tracking::CTRVModel>());
-    mSystemModels.push_back(cv::makePtr<tracking::CVModel>());
-    mSystemModels.push_back(cv::makePtr<tracking::CAModel>());
+    for (auto const &kalmanFilter : mKalmanFilters)
+    {
+      kalmanFilter->reset(track.stateVector(), initStateCovariance, processNoise, measurementNoise);
+    }
+    mSystemModelStates.assign(mNumberOfModels, track);
   }
   else
   {
-    for (auto const &motionModel : motionModels)
-    {
-      switch(motionModel)
-      {
-        case MotionModel::CV:
-          mSystemModels.push_back(cv::makePtr<tracking::CVModel>());
-          break;
-        case MotionModel::CA:
-          mSystemModels.push_back(cv::makePtr<tracking::CAModel>());
-          break;
-        case MotionModel::CP:
-          mSystemModels.push_back(cv::makePtr<tracking::CPModel>());
-          break;
-        case MotionModel::CTRV:
-          mSystemModels.push_back(cv::makePtr<tracking::CTRVModel>());
-          break;
-        default:
-          break;
-      }
-    }
+    buildFilters(track, requestedModels, processNoise, measurementNoise, initStateCovariance);
   }
 
-  mNumberOfModels = mSystemModels.size();
+  mModelActive.assign(mNumberOfModels, true);
+  mLowProbabilityFrames.assign(mNumberOfModels, 0u);
 
   mMaxProbability = 0.95;
   mMinProbability = (1.0 - mMaxProbability) / std::max(static_cast<double>(mNumberOfModels - 1), 1.0);
@@ -72,10 +62,44 @@ void MultiModelKalmanEstimator::initialize(TrackedObject track, const std::chron
   mTransitionProbability = cv::Mat(mNumberOfModels, mNumberOfModels, CV_64F, cv::Scalar(pxOtherModels));
   mTransitionProbability += cv::Mat::eye(mNumberOfModels, mNumberOfModels, CV_64F) * pxSameModel;
 
-  for (auto &model : mSystemModels)
+  mCurrentState = std::move(track);
+}
+
+void MultiModelKalmanEstimator::buildFilters(const TrackedObject &track, const std::vector<MotionModel> &motionModels, double processNoise, double measurementNoise, double initStateCovariance)
+{
+  mSystemModels.clear();
+  mMotionModels.clear();
+  mKalmanFilters.clear();
+  mSystemModelStates.clear();
+
+  for (auto const &motionModel : motionModels)
+  {
+    switch(motionModel)
+    {
+      case MotionModel::CV:
+        mSystemModels.push_back(cv::makePtr<tracking::CVModel>());
+        break;
+      case MotionModel::CA:
+        mSystemModels.push_back(cv::makePtr<tracking::CAModel>());
+        break;
+      case MotionModel::CP:
+        mSystemModels.push_back(cv::makePtr<tracking::CPModel>());
+        break;
+      case MotionModel::CTRV:
+        mSystemModels.push_back(cv::makePtr<tracking::CTRVModel>());
+        break;
+      default:
+        break;
+    }
+    mMotionModels.push_back(motionModel);
+  }
+
+  mNumberOfModels = mSystemModels.size();
+
+  for (std::size_t i = 0; i < mNumberOfModels; ++i)
   {
     cv::detail::tracking::UnscentedKalmanFilterParams modelParams;
-    modelParams = cv::detail::tracking::UnscentedKalmanFilterParams(mDP, mMP, mCP, 0, 0, model);
+    modelParams = cv::detail::tracking::UnscentedKalmanFilterParams(mDP, mMP, mCP, 0, 0, mSystemModels[i]);
     modelParams.stateInit = track.stateVector().clone();
     modelParams.errorCovInit = cv::Mat::eye(mDP, mDP, CV_64F) * initStateCovariance;
     modelParams.measurementNoiseCov = cv::Mat::eye(mMP, mMP, CV_64F) * measurementNoise;
@@ -83,45 +107,81 @@ void MultiModelKalmanEstimator::initialize(TrackedObject track, const std::chron
     modelParams.alpha = mAlpha;
     modelParams.beta = mBeta;
     modelParams.k = mKappa;
-    mKalmanFilters.push_back(createUnscentedKalmanFilterMod(modelParams));
+
+    // only the nonlinear CTRV model needs the unscented transform; the linear
+    // models run the closed-form filter and skip the sigma-point machinery
+    if (mMotionModels[i] == MotionModel::CTRV)
+    {
+      mKalmanFilters.push_back(createUnscentedKalmanFilterMod(modelParams));
+    }
+    else
+    {
+      mKalmanFilters.push_back(cv::makePtr<LinearKalmanFilterMod>(modelParams, mMotionModels[i]));
+    }
     mSystemModelStates.push_back(track);
   }
-
-  mCurrentState = std::move(track);
 }
 
 
-void MultiModelKalmanEstimator::singleModelPredict(double deltaT)
+void MultiModelKalmanEstimator::beginBatchedPredict()
 {
-  cv::Mat deltaTVector = cv::Mat(mCP, 1, CV_64F, cv::Scalar(deltaT));
-  cv::Mat noiseVector = cv::Mat::zeros(mMP, 1, CV_64F);
+  if (mNumberOfModels == 1)
+  {
+    mKalmanFilters[0]->computeSigmaPoints();
+    return;
+  }
 
-  auto predictedState = mKalmanFilters[0]->predict(deltaTVector);
+  cv::Mat conditionalProbability = cv::Mat::zeros(mNumberOfModels, mNumberOfModels, CV_64F);
 
-  mCurrentState.previousYaw = mCurrentState.yaw;
-  mCurrentState.setStateVector(predictedState); // combined current state
-  mCurrentState.errorCovariance = mKalmanFilters[0]->getErrorCov();
-  mCurrentState.predictedMeasurementMean = cv::Mat::zeros(mMP, 1, CV_64F);
+  combiningProbability(mTransitionProbability, mModelProbability, conditionalProbability);
 
-  mSystemModels[0]->measurementFunction(predictedState, noiseVector, mCurrentState.predictedMeasurementMean);
+  std::vector<cv::Mat> states;
+  std::vector<cv::Mat> covariances;
 
-  if (mKalmanFilters[0]->getMeasurementCov().empty())
+  for (auto const &state : mSystemModelStates)
   {
-    mCurrentState.predictedMeasurementCov = mKalmanFilters[0]->getMeasurementNoiseCov();
+    states.push_back(state.stateVector());
   }
-  else
+  for (auto const &kalmanFilter : mKalmanFilters)
   {
-    mCurrentState.predictedMeasurementCov = mKalmanFilters[0]->getMeasurementCov();
+    covariances.push_back(kalmanFilter->getErrorCov());
   }
 
-  mCurrentState.predictedMeasurementCovInv = mCurrentState.predictedMeasurementCov.inv(cv::DECOMP_SVD);
+  std::vector<cv::Mat> covarianceEstimate;
+  std::vector<cv::Mat> stateEstimate;
+
+  interaction(states, covariances, conditionalProbability, covarianceEstimate, stateEstimate);
 
-  if (deltaT >= 1e-3)
+  for (std::size_t i = 0; i < mNumberOfModels; ++i)
   {
-    mCurrentState.corrected = false;
+    if (!mModelActive[i])
+    {
+      // suspended model: keep the last estimate and measurement prediction
+      continue;
+    }
+    mKalmanFilters[i]->setStateAndCovariance(stateEstimate[i], covarianceEstimate[i]);
+    mSystemModelStates[i].predictedMeasurementMean = cv::Mat::zeros(mMP, 1, CV_64F);
+    mKalmanFilters[i]->computeSigmaPoints();
   }
 }
 
+void MultiModelKalmanEstimator::propagateModel(std::size_t modelIndex, double deltaT)
+{
+  if (!mModelActive[modelIndex])
+  {
+    return;
+  }
+  cv::Mat deltaTVector = cv::Mat(mCP, 1, CV_64F, cv::Scalar(deltaT));
+  mKalmanFilters[modelIndex]->propagateSigmaPoints(deltaTVector);
+}
+
+void MultiModelKalmanEstimator::finishBatchedPredict(double deltaT)
+{
+  finishPredictState(deltaT);
+
+  mLastTimestamp = addSecondsToTimestamp(mLastTimestamp, std::chrono::duration<double>(deltaT));
+}
+
 void MultiModelKalmanEstimator::predict(const std::chrono::system_clock::time_point &timestamp)
 {
   predictState(rv::toSeconds(timestamp - mLastTimestamp));
@@ -138,42 +198,57 @@ void MultiModelKalmanEstimator::predict(const double deltaT)
 
 void MultiModelKalmanEstimator::predictState(const double deltaT)
 {
-  if (mNumberOfModels == 1)
+  beginBatchedPredict();
+  for (std::size_t i = 0; i < mNumberOfModels; ++i)
   {
-    return singleModelPredict(deltaT);
+    propagateModel(i, deltaT);
   }
+  finishPredictState(deltaT);
+}
 
-  cv::Mat deltaTVector = cv::Mat(mCP, 1, CV_64F, cv::Scalar(deltaT));
+void MultiModelKalmanEstimator::finishPredictState(const double deltaT)
+{
   cv::Mat noiseVector = cv::Mat::zeros(mMP, 1, CV_64F);
-  cv::Mat conditionalProbability = cv::Mat::zeros(mNumberOfModels, mNumberOfModels, CV_64F);
 
-  combiningProbability(mTransitionProbability, mModelProbability, conditionalProbability);
+  if (mNumberOfModels == 1)
+  {
+    auto predictedState = mKalmanFilters[0]->finishPredict(deltaT);
 
-  std::vector<cv::Mat> states;
-  std::vector<cv::Mat> covariances;
+    mCurrentState.previousYaw = mCurrentState.yaw;
+    mCurrentState.setStateVector(predictedState); // combined current state
+    mCurrentState.errorCovariance = mKalmanFilters[0]->getErrorCov();
+    mCurrentState.predictedMeasurementMean = cv::Mat::zeros(mMP, 1, CV_64F);
 
-  for (auto const &state : mSystemModelStates)
-  {
-    states.push_back(state.stateVector());
-  }
-  for (auto const &kalmanFilter : mKalmanFilters)
-  {
-    covariances.push_back(kalmanFilter->getErrorCov());
-  }
+    mSystemModels[0]->measurementFunction(predictedState, noiseVector, mCurrentState.predictedMeasurementMean);
 
-  std::vector<cv::Mat> covarianceEstimate;
-  std::vector<cv::Mat> stateEstimate;
+    if (mKalmanFilters[0]->getMeasurementCov().empty())
+    {
+      mCurrentState.setPredictedMeasurementCov(mKalmanFilters[0]->getMeasurementNoiseCov());
+    }
+    else
+    {
+      mCurrentState.setPredictedMeasurementCov(mKalmanFilters[0]->getMeasurementCov());
+    }
 
-  interaction(states, covariances, conditionalProbability, covarianceEstimate, stateEstimate);
+    if (deltaT >= 1e-3)
+    {
+      mCurrentState.corrected = false;
+    }
+    return;
+  }
 
   std::vector<cv::Mat> predictedStates;
   std::vector<cv::Mat> predictedStateCovariances;
 
   for (std::size_t i = 0; i < mNumberOfModels; ++i)
   {
-    mKalmanFilters[i]->setStateAndCovariance(stateEstimate[i], covarianceEstimate[i]);
-    mSystemModelStates[i].predictedMeasurementMean = cv::Mat::zeros(mMP, 1, CV_64F);
-    auto predictedState = mKalmanFilters[i]->predict(deltaTVector);
+    if (!mModelActive[i])
+    {
+      predictedStates.push_back(mSystemModelStates[i].stateVector());
+      predictedStateCovariances.push_back(mKalmanFilters[i]->getErrorCov());
+      continue;
+    }
+    auto predictedState = mKalmanFilters[i]->finishPredict(deltaT);
     predictedStates.push_back(predictedState);
     predictedStateCovariances.push_back(mKalmanFilters[i]->getErrorCov());
     mSystemModelStates[i].setStateVector(predictedState);
@@ -217,8 +292,7 @@ void MultiModelKalmanEstimator::predictState(const double deltaT)
     measurements, measurementCovariances, mModelProbability, combinedMeasurement, combinedMeasurementCovariance);
 
   mCurrentState.predictedMeasurementMean = combinedMeasurement;
-  mCurrentState.predictedMeasurementCov = combinedMeasurementCovariance;
-  mCurrentState.predictedMeasurementCovInv = combinedMeasurementCovariance.inv(cv::DECOMP_SVD);
+  mCurrentState.setPredictedMeasurementCov(combinedMeasurementCovariance);
 
   if (deltaT >= 1e-3)
   {
@@ -237,6 +311,7 @@ void MultiModelKalmanEstimator::singleModelCorrect(const TrackedObject &measurem
   mCurrentState.setStateVector(correctedState);
 
   mCurrentState.classification = rv::tracking::classification::combine(mCurrentState.classification , measurement.classification);
+  mCurrentState.invalidateDominantClass();
   mCurrentState.attributes = measurement.attributes;
   mCurrentState.corrected = true;
 }
@@ -254,17 +329,31 @@ void MultiModelKalmanEstimator::correct(const TrackedObject &measurement)
   std::vector<cv::Mat> states;
   std::vector<cv::Mat> covariances;
   std::vector<cv::Mat> predictedMeasurements;
-  std::vector<cv::Mat> measurementCovariances;
+  std::vector<cv::Mat> measurementCovInverses;
 
   for (std::size_t i = 0; i < mNumberOfModels; ++i)
   {
+    if (!mModelActive[i])
+    {
+      // suspended model: carry the last estimate through the combination. The
+      // cached S^-1 is frozen together with S, so it stays consistent
+      states.push_back(mSystemModelStates[i].stateVector());
+      covariances.push_back(mKalmanFilters[i]->getErrorCov());
+      predictedMeasurements.push_back(mSystemModelStates[i].predictedMeasurementMean);
+      auto measurementCovInv = mKalmanFilters[i]->getMeasurementCovInv();
+      measurementCovInverses.push_back(measurementCovInv.empty()
+                                         ? mKalmanFilters[i]->getMeasurementNoiseCov().inv(cv::DECOMP_SVD)
+                                         : measurementCovInv);
+      continue;
+    }
+
     auto correctedState = mKalmanFilters[i]->correct(newMeasurement.measurementVector());
     mSystemModelStates[i].setStateVector(correctedState);
 
     states.push_back(correctedState);
     covariances.push_back(mKalmanFilters[i]->getErrorCov());
     predictedMeasurements.push_back(mSystemModelStates[i].predictedMeasurementMean);
-    measurementCovariances.push_back(mKalmanFilters[i]->getMeasurementCov());
+    measurementCovInverses.push_back(mKalmanFilters[i]->getMeasurementCovInv());
   }
 
   cv::Mat combinedState;
@@ -272,7 +361,7 @@ void MultiModelKalmanEstimator::correct(const TrackedObject &measurement)
 
   updateModelProbability(newMeasurement.measurementVector(),
                          predictedMeasurements,
-                         measurementCovariances,
+                         measurementCovInverses,
                          mModelProbability,
                          mMaxProbability,
                          mMinProbability);
@@ -282,9 +371,65 @@ void MultiModelKalmanEstimator::correct(const TrackedObject &measurement)
   mCurrentState.setStateVector(combinedState);
 
   mCurrentState.classification = rv::tracking::classification::combine(mCurrentState.classification , measurement.classification);
+  mCurrentState.invalidateDominantClass();
   mCurrentState.attributes = measurement.attributes;
 
   mCurrentState.corrected = true;
+
+  updateModelPruning(newMeasurement.measurementVector());
+}
+
+void MultiModelKalmanEstimator::updateModelPruning(const cv::Mat &measurementVector)
+{
+  if (mPruneFrames == 0u || mNumberOfModels <= 1)
+  {
+    return;
+  }
+
+  // a roughly 3-sigma gate on the squared Mahalanobis innovation; beyond it
+  // the active models clearly mispredicted and the suspended ones get another
+  // chance from the combined estimate
+  constexpr double kReactivationInnovationGate = 9.0;
+
+  cv::Mat innovation = measurementVector - mCurrentState.predictedMeasurementMean;
+  cv::Mat innovationDistance = innovation.t() * mCurrentState.predictedMeasurementCovInverse() * innovation;
+  const bool innovationSpike = innovationDistance.at<double>(0, 0) > kReactivationInnovationGate;
+
+  std::size_t mostProbableModel = 0u;
+  for (std::size_t i = 1; i < mNumberOfModels; ++i)
+  {
+    if (mModelProbability.at<double>(i, 0) > mModelProbability.at<double>(mostProbableModel, 0))
+    {
+      mostProbableModel = i;
+    }
+  }
+
+  for (std::size_t i = 0; i < mNumberOfModels; ++i)
+  {
+    if (mModelActive[i])
+    {
+      if (mModelProbability.at<double>(i, 0) < mPruneProbabilityFloor && i != mostProbableModel)
+      {
+        if (++mLowProbabilityFrames[i] >= mPruneFrames)
+        {
+          mModelActive[i] = false;
+        }
+      }
+      else
+      {
+        mLowProbabilityFrames[i] = 0u;
+      }
+    }
+    else if (innovationSpike)
+    {
+      // restart the suspended filter from the combined estimate
+      mKalmanFilters[i]->resetStateAndCovariance(mCurrentState.stateVector(), mCurrentState.errorCovariance);
+      mSystemModelStates[i].setStateVector(mCurrentState.stateVector());
+      mSystemModelStates[i].predictedMeasurementMean = mCurrentState.predictedMeasurementMean.clone();
+      mModelActive[i] = true;
+      mLowProbabilityFrames[i] = 0u;
+    }
+  }
 }
 
 void MultiModelKalmanEstimator::combiningProbability(cv::Mat const &transitionProbability,
@@ -375,7 +520,7 @@ double inline reescale(double value, double maxValue, double minValue)
 
 void MultiModelKalmanEstimator::updateModelProbability(cv::Mat const &measurement,
                                                        std::vector<cv::Mat> const &predictedMeasurements,
-                                                       std::vector<cv::Mat> const &measurementNoiseCovariance,
+                                                       std::vector<cv::Mat> const &measurementCovInverses,
                                                        cv::Mat &modelProbability,
                                                        double maxProbability,
                                                        double minProbability)
@@ -403,13 +548,14 @@ void MultiModelKalmanEstimator::updateModelProbability(cv::Mat const &measuremen
   for (std::size_t j = 0; j < nModels; ++j)
   {
     intermediateCalculation[j]
-      = measurementDifference[j].t() * measurementNoiseCovariance[j].inv(cv::DECOMP_SVD) * measurementDifference[j];
+      = measurementDifference[j].t() * measurementCovInverses[j] * measurementDifference[j];
   }
-  // Calculate log likelihood per model
+  // Calculate log likelihood per model; the determinant is derived from the
+  // cached inverse: log det(2*pi*S) = MP*log(2*pi) - log det(S^-1)
   for (std::size_t j = 0; j < nModels; ++j)
   {
-    double det = determinant(2.0 * M_PI * measurementNoiseCovariance[j]);
-    double logLikelihood = -0.5 * std::log(det) - 0.5 * intermediateCalculation[j].at<double>(0, 0);
+    double logDet = measurementSize * std::log(2.0 * M_PI) - std::log(determinant(measurementCovInverses[j]));
+    double logLikelihood = -0.5 * logDet - 0.5 * intermediateCalculation[j].at<double>(0, 0);
 
     likelihood.push_back(logLikelihood);
   }
@@ -486,5 +632,17 @@ cv::Mat MultiModelKalmanEstimator::getKalmanFilterErrorCovariance(std::size_t j)
   return mKalmanFilters[j]->getMeasurementCov();
 }
 
+std::size_t MultiModelKalmanEstimator::memoryFootprint() const
+{
+  std::size_t bytes = 0;
+  for (auto const &filter : mKalmanFilters)
+  {
+    bytes += filter->memoryFootprint();
+  }
+  bytes += mTransitionProbability.total() * mTransitionProbability.elemSize();
+  bytes += mModelProbability.total() * mModelProbability.elemSize();
+  return bytes;
+}
+
 } // namespace tracking
 } // namespace rv
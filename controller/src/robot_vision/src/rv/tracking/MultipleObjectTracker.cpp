@@ -2,16 +2,21 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 #include "rv/Utils.hpp"
+#include "rv/WorkerPool.hpp"
 #include "rv/tracking/MultipleObjectTracker.hpp"
 #include "rv/tracking/Classification.hpp"
 
 namespace rv {
 namespace tracking {
 
-template <class ElementType> std::vector<ElementType> filterByIndex(const std::vector<ElementType> &elements, const std::vector<size_t> indexToKeep)
+template <class VectorType, class IndexVectorType>
+VectorType filterByIndex(const VectorType &elements, const IndexVectorType &indexToKeep)
 {
-  std::vector<ElementType> filtered;
+  // Keep the input's allocator so arena-backed views stay in the arena
+  VectorType filtered(elements.get_allocator());
   filtered.reserve(indexToKeep.size());
 
   for (auto const &index : indexToKeep)
@@ -21,6 +26,33 @@ template <class ElementType> std::vector<ElementType> filterByIndex(const std::v
   return filtered;
 }
 
+// Number of other cameras with a still-unmatched detection within radius of
+// the object; under a track budget, corroboration across cameras is the
+// strongest admission signal a frame can offer for a brand-new track
+static size_t cameraAgreement(const tracking::TrackedObject &object,
+                              const std::vector<std::vector<tracking::TrackedObject>> &objectsPerCamera,
+                              const std::vector<tracking::TrackedObject> *ownCamera,
+                              double radius)
+{
+  size_t agreeing = 0;
+  for (auto const &cameraObjects : objectsPerCamera)
+  {
+    if (&cameraObjects == ownCamera)
+    {
+      continue;
+    }
+    for (auto const &candidate : cameraObjects)
+    {
+      if (std::hypot(candidate.x - object.x, candidate.y - object.y) <= radius)
+      {
+        agreeing++;
+        break;
+      }
+    }
+  }
+  return agreeing;
+}
+
 void splitByThreshold(std::vector<tracking::TrackedObject> &objects,
                       std::vector<tracking::TrackedObject> &lowScoreObjects,
                       double scoreThreshold)
@@ -28,8 +60,7 @@ void splitByThreshold(std::vector<tracking::TrackedObject> &objects,
   lowScoreObjects.clear();
 
   auto divider = [scoreThreshold](const tracking::TrackedObject &object) {
-    double score = object.classification.maxCoeff();
-    return score >= scoreThreshold;
+    return object.dominantScore() >= scoreThreshold;
   };
 
   auto it = std::partition(objects.begin(), objects.end(), divider);
@@ -38,91 +69,263 @@ void splitByThreshold(std::vector<tracking::TrackedObject> &objects,
   objects.erase(it, objects.end());
 }
 
-std::vector<tracking::TrackedObject> MultipleObjectTracker::matchAndAssignMeasurements(
-    const std::vector<tracking::TrackedObject> &tracks,
-    const std::vector<tracking::TrackedObject> &objects,
+IndexVector MultipleObjectTracker::seededTrackIndices(const tracking::TrackView &tracks,
+                                                      std::pmr::memory_resource *resource)
+{
+  IndexVector seeded{resource};
+  if (!mIncrementalMatching || mLastAssignedTrackIds.empty())
+  {
+    return seeded;
+  }
+
+  seeded.reserve(tracks.size());
+  for (size_t i = 0; i < tracks.size(); ++i)
+  {
+    if (mLastAssignedTrackIds.count(tracks[i]->id) > 0)
+    {
+      seeded.push_back(i);
+    }
+  }
+  return seeded;
+}
+
+tracking::TrackView MultipleObjectTracker::matchAndAssignMeasurements(
+    const tracking::TrackView &tracks,
+    const tracking::TrackView &objects,
     const DistanceType &distanceType,
     double distanceThreshold,
-    std::vector<size_t> &unassignedObjects)
+    IndexVector &unassignedObjects)
 {
-  std::vector<std::pair<size_t, size_t>> assignments;
-  std::vector<size_t> unassignedTracks;
+  AssignmentVector assignments{tracks.get_allocator()};
+  IndexVector unassignedTracks{tracks.get_allocator()};
 
-  match(tracks, objects, assignments, unassignedTracks, unassignedObjects, distanceType, distanceThreshold);
+  if (mPartitionedMatching)
+  {
+    matchByClass(tracks, objects, assignments, unassignedTracks, unassignedObjects, distanceType, distanceThreshold,
+                 mGatingRadius);
+  }
+  else
+  {
+    matchIncremental(tracks, objects, seededTrackIndices(tracks, tracks.get_allocator().resource()), assignments,
+                     unassignedTracks, unassignedObjects, distanceType, distanceThreshold, mGatingRadius);
+  }
 
   // Update measurements - set measurement
   for (const auto &assignment : assignments)
   {
-    auto const &track = tracks[assignment.first];
-    auto const &object = objects[assignment.second];
+    auto const &track = *tracks[assignment.first];
+    auto const &object = *objects[assignment.second];
     mTrackManager.setMeasurement(track.id, object);
+    mFrameAssignedTrackIds.insert(track.id);
   }
 
   // Remove tracks already assigned
   return filterByIndex(tracks, unassignedTracks);
 }
 
+tracking::TrackView MultipleObjectTracker::matchAndAssignMeasurements(
+    const tracking::TrackView &tracks,
+    const std::vector<tracking::TrackedObject> &objects,
+    const DistanceType &distanceType,
+    double distanceThreshold,
+    IndexVector &unassignedObjects)
+{
+  return matchAndAssignMeasurements(tracks, makeTrackView(objects, tracks.get_allocator().resource()), distanceType,
+                                    distanceThreshold, unassignedObjects);
+}
+
 void MultipleObjectTracker::track(std::vector<tracking::TrackedObject> objects, const std::chrono::system_clock::time_point &timestamp,
                                   double scoreThreshold)
 {
-  track(objects, timestamp, mDistanceType, mDistanceThreshold, scoreThreshold);
+  track(objects.data(), objects.size(), timestamp, mDistanceType, mDistanceThreshold, scoreThreshold);
 }
 
 void MultipleObjectTracker::track(std::vector<tracking::TrackedObject> objects, const std::chrono::system_clock::time_point &timestamp,
                                   const DistanceType & distanceType, double distanceThreshold, double scoreThreshold)
 {
-  if (objects.empty())
+  track(objects.data(), objects.size(), timestamp, distanceType, distanceThreshold, scoreThreshold);
+}
+
+void MultipleObjectTracker::track(const tracking::TrackedObject *objects, std::size_t objectCount,
+                                  const std::chrono::system_clock::time_point &timestamp, double scoreThreshold)
+{
+  track(objects, objectCount, timestamp, mDistanceType, mDistanceThreshold, scoreThreshold);
+}
+
+void MultipleObjectTracker::track(const tracking::TrackedObject *objects, std::size_t objectCount,
+                                  const std::chrono::system_clock::time_point &timestamp,
+                                  const DistanceType & distanceType, double distanceThreshold, double scoreThreshold)
+{
+  auto const frameStart = std::chrono::steady_clock::now();
+  auto overBudget = [this, frameStart]() {
+    return mFrameBudgetMicroseconds > 0.
+      && std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - frameStart).count()
+        > mFrameBudgetMicroseconds;
+  };
+
+  // Reclaim all transient allocations of the previous frame in one shot
+  mArena.reset();
+  mFrameAssignedTrackIds.clear();
+  mTrackManager.setFrameTimestamp(timestamp);
+
+  if (objectCount == 0)
   {
     mTrackManager.predict(timestamp);
     mTrackManager.correct();
+    std::swap(mLastAssignedTrackIds, mFrameAssignedTrackIds);
     mLastTimestamp = timestamp;
     return;
   }
 
-  std::vector<tracking::TrackedObject> lowScoreObjects;
-  splitByThreshold(objects, lowScoreObjects, scoreThreshold);
+  // The detections are never copied or compacted; the pipeline works on an
+  // arena-backed index workspace that is partitioned in place per stage
+  IndexVector workspace{mArena.resource()};
+  workspace.resize(objectCount);
+  std::iota(workspace.begin(), workspace.end(), 0);
+
+  auto const lowScoreBegin =
+    std::partition(workspace.begin(), workspace.end(), [objects, scoreThreshold](std::size_t index) {
+      return objects[index].dominantScore() >= scoreThreshold;
+    });
+
+  auto makeWorkspaceView = [this, objects](IndexVector::const_iterator begin, IndexVector::const_iterator end) {
+    TrackView view{mArena.resource()};
+    view.reserve(static_cast<std::size_t>(end - begin));
+    for (auto it = begin; it != end; ++it)
+    {
+      view.push_back(&objects[*it]);
+    }
+    return view;
+  };
 
-  // 1. - Predict
-  mTrackManager.predict(rv::toSeconds(timestamp - mLastTimestamp));
+  // Shrink a workspace range to the stage's unassigned objects; the stage
+  // reported indices into its view, which line up with the range order.
+  // Sorting first keeps the compaction a left-to-right move, so no slot is
+  // overwritten before it is read
+  auto compactRange = [](IndexVector::iterator begin, IndexVector &unassigned) {
+    std::sort(unassigned.begin(), unassigned.end());
+    auto writeIt = begin;
+    for (auto const viewIndex : unassigned)
+    {
+      *writeIt++ = *(begin + viewIndex);
+    }
+    return writeIt;
+  };
 
-  // 2.- Associate with the reliable states first
-  auto tracks = mTrackManager.getReliableTracks();
+  // 1. - Predict
+  {
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::Predict);
+    mTrackManager.predict(rv::toSeconds(timestamp - mLastTimestamp));
+  }
 
-  std::vector<size_t> unassignedObjects;
-  tracks = matchAndAssignMeasurements(tracks, objects, distanceType, distanceThreshold, unassignedObjects);
+  // 2.- Associate with the reliable states first; the views point into the
+  // estimator stores, so the pipeline never copies full track state
+  auto tracks = mTrackManager.getReliableTrackView(mArena.resource());
 
-  std::vector<size_t> unassignedLowScoreObjects;
-  tracks = matchAndAssignMeasurements(tracks, lowScoreObjects, distanceType, distanceThreshold, unassignedLowScoreObjects);
+  IndexVector unassignedObjects{mArena.resource()};
+  auto highScoreEnd = workspace.begin();
+  bool frameDegraded = false;
+  bool deferNewTracks = false;
+  {
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::Associate);
 
-  // 3.1 Update measurements - Match to unreliable objects first and then suspended tracks.
-  // Remove objects already assigned to tracks
-  objects = filterByIndex(objects, unassignedObjects);
+    tracks = matchAndAssignMeasurements(tracks, makeWorkspaceView(workspace.begin(), lowScoreBegin), distanceType,
+                                        distanceThreshold, unassignedObjects);
+    highScoreEnd = compactRange(workspace.begin(), unassignedObjects);
 
-  auto unreliableTracks = mTrackManager.getUnreliableTracks();
-  matchAndAssignMeasurements(unreliableTracks, objects, distanceType, distanceThreshold, unassignedObjects);
+    // Low-score detections only confirm reliable tracks; their leftovers are
+    // dropped, so the range needs no compaction. Over budget the pass is
+    // skipped outright - it never feeds new tracks
+    if (!overBudget())
+    {
+      IndexVector unassignedLowScoreObjects{mArena.resource()};
+      tracks = matchAndAssignMeasurements(tracks, makeWorkspaceView(lowScoreBegin, workspace.cend()), distanceType,
+                                          distanceThreshold, unassignedLowScoreObjects);
+    }
+    else
+    {
+      mFrameStats.skippedLowScorePasses++;
+      frameDegraded = true;
+    }
 
-  // Remove objects already assigned to Unreliable tracks
-  objects = filterByIndex(objects, unassignedObjects);
+    // 3.1 Update measurements - Match to unreliable objects first and then suspended tracks
+    auto unreliableTracks = mTrackManager.getUnreliableTrackView(mArena.resource());
+    matchAndAssignMeasurements(unreliableTracks, makeWorkspaceView(workspace.begin(), highScoreEnd), distanceType,
+                               distanceThreshold, unassignedObjects);
+    highScoreEnd = compactRange(workspace.begin(), unassignedObjects);
 
-  auto suspendedTracks = mTrackManager.getSuspendedTracks();
-  matchAndAssignMeasurements(suspendedTracks, objects, distanceType, distanceThreshold, unassignedObjects);
+    if (!overBudget())
+    {
+      // Euclidean distance types gate implicitly at the threshold, so only
+      // suspended tracks near a remaining detection can match; Mahalanobis
+      // types without an explicit gating radius fall back to the full view
+      auto const remainingObjects = makeWorkspaceView(workspace.begin(), highScoreEnd);
+      double const suspendedRadius = mGatingRadius > 0. ? mGatingRadius
+        : (distanceType == DistanceType::Euclidean || distanceType == DistanceType::MultiClassEuclidean)
+          ? distanceThreshold
+          : 0.;
+      auto suspendedTracks = suspendedRadius > 0.
+        ? mTrackManager.getSuspendedTrackViewNear(remainingObjects, suspendedRadius, mArena.resource())
+        : mTrackManager.getSuspendedTrackView(mArena.resource());
+      matchAndAssignMeasurements(suspendedTracks, remainingObjects, distanceType,
+                                 distanceThreshold, unassignedObjects);
+      highScoreEnd = compactRange(workspace.begin(), unassignedObjects);
+    }
+    else
+    {
+      // Without the suspended pass the leftovers may belong to suspended
+      // tracks; creating tracks from them now would duplicate those, so
+      // creation is deferred - the objects re-enter with the next frame's
+      // detections
+      mFrameStats.skippedSuspendedPasses++;
+      frameDegraded = true;
+      deferNewTracks = true;
+    }
+  }
 
   // 3.2 Update measurements - Correct measurements
-  mTrackManager.correct();
+  {
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::Correct);
+    mTrackManager.correct();
+  }
 
   // 4. - Create new tracks
-  for (const auto &id : unassignedObjects)
   {
-    auto const newTrack = objects[id];
-
-    mTrackManager.createTrack(newTrack, timestamp);
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::CreateTracks);
+    if (deferNewTracks)
+    {
+      mFrameStats.deferredDetections += static_cast<uint64_t>(highScoreEnd - workspace.begin());
+    }
+    else
+    {
+      for (auto it = workspace.begin(); it != highScoreEnd; ++it)
+      {
+        mTrackManager.createTrack(objects[*it], timestamp);
+      }
+    }
+  }
+  if (frameDegraded)
+  {
+    mFrameStats.degradedFrames++;
   }
 
+  sampleMemoryStats();
+
+  std::swap(mLastAssignedTrackIds, mFrameAssignedTrackIds);
   mLastTimestamp = timestamp;
 }
 
-std::vector<tracking::TrackedObject> MultipleObjectTracker::matchAndAssignMeasurements(
-    const std::vector<tracking::TrackedObject> &tracks,
+void MultipleObjectTracker::sampleMemoryStats()
+{
+#if !defined(RV_TRACKING_DISABLE_STATS)
+  mFrameStats.sampleMemory(MemorySubsystem::Estimators, mTrackManager.estimatorMemoryFootprint());
+  mFrameStats.sampleMemory(MemorySubsystem::MatcherScratch, matcherScratchFootprint());
+  mFrameStats.sampleMemory(MemorySubsystem::Snapshots, mTrackManager.snapshotMemoryFootprint());
+#endif
+}
+
+tracking::TrackView MultipleObjectTracker::matchAndAssignMeasurements(
+    const tracking::TrackView &tracks,
     std::vector<std::vector<tracking::TrackedObject>> &objectsPerCamera,
     const DistanceType &distanceType,
     double distanceThreshold)
@@ -134,28 +337,42 @@ std::vector<tracking::TrackedObject> MultipleObjectTracker::matchAndAssignMeasur
   }
 
   // Boolean vector to track which tracks have been assigned
-  std::vector<bool> isTrackAssigned(tracks.size(), false);
-
-  // Store assignments and unassigned objects for each camera
-  std::vector<std::vector<std::pair<size_t, size_t>>> assignments(numCameras);
-  std::vector<std::vector<size_t>> unassignedObjectsPerCamera(numCameras);
-
-  // Parallelizable matching phase
-  #pragma omp parallel for
-  for (size_t i = 0; i < numCameras; ++i)
-  {
-    std::vector<size_t> unassignedTracks;
-    match(tracks, objectsPerCamera[i], assignments[i], unassignedTracks, unassignedObjectsPerCamera[i], distanceType, distanceThreshold);
-  }
+  std::pmr::vector<bool> isTrackAssigned(tracks.size(), false, tracks.get_allocator());
+
+  // Store assignments and unassigned objects for each camera. The monotonic
+  // arena is not thread-safe, so the per-camera containers filled inside the
+  // parallel region stay on the default resource
+  std::vector<AssignmentVector> assignments(numCameras);
+  std::vector<IndexVector> unassignedObjectsPerCamera(numCameras);
+
+  // Parallelizable matching phase; one task per camera on the shared pool.
+  // The seed list is built once up front and only read inside the region.
+  // The per-camera cost scales with the candidate pairs, so scenes with a
+  // handful of tracks match serial and skip the fork/join
+  constexpr double kPerPairMatchCostNs = 200.0;
+  auto const cameraCostNs = static_cast<double>(tracks.size() + 1) * kPerPairMatchCostNs;
+  const IndexVector seededTracks = seededTrackIndices(tracks, std::pmr::get_default_resource());
+  rv::WorkerPool::instance().parallelFor(0, numCameras, cameraCostNs, [&](std::size_t i) {
+    IndexVector unassignedTracks;
+    if (mPartitionedMatching)
+    {
+      matchByClass(tracks, makeTrackView(objectsPerCamera[i]), assignments[i], unassignedTracks, unassignedObjectsPerCamera[i], distanceType, distanceThreshold, mGatingRadius);
+    }
+    else
+    {
+      matchIncremental(tracks, makeTrackView(objectsPerCamera[i]), seededTracks, assignments[i], unassignedTracks, unassignedObjectsPerCamera[i], distanceType, distanceThreshold, mGatingRadius);
+    }
+  });
 
   // Sequential assignment phase to avoid race conditions
   for (size_t i = 0; i < numCameras; ++i)
   {
     for (const auto &assignment : assignments[i])
     {
-      const auto &track = tracks[assignment.first];
+      const auto &track = *tracks[assignment.first];
       const auto &object = objectsPerCamera[i][assignment.second];
       mTrackManager.setMeasurement(track.id, object);
+      mFrameAssignedTrackIds.insert(track.id);
 
       // Mark track as assigned
       isTrackAssigned[assignment.first] = true;
@@ -170,7 +387,7 @@ std::vector<tracking::TrackedObject> MultipleObjectTracker::matchAndAssignMeasur
   }
 
   // Filter unassigned tracks
-  std::vector<tracking::TrackedObject> unassignedTracks;
+  tracking::TrackView unassignedTracks{tracks.get_allocator()};
   unassignedTracks.reserve(tracks.size());
   for (size_t i = 0; i < tracks.size(); ++i)
   {
@@ -196,10 +413,23 @@ void MultipleObjectTracker::track(std::vector<std::vector<tracking::TrackedObjec
                                   const DistanceType & distanceType, double distanceThreshold,
                                   double scoreThreshold)
 {
+  auto const frameStart = std::chrono::steady_clock::now();
+  auto overBudget = [this, frameStart]() {
+    return mFrameBudgetMicroseconds > 0.
+      && std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - frameStart).count()
+        > mFrameBudgetMicroseconds;
+  };
+
+  // Reclaim all transient allocations of the previous frame in one shot
+  mArena.reset();
+  mFrameAssignedTrackIds.clear();
+  mTrackManager.setFrameTimestamp(timestamp);
+
   if (objectsPerCamera.empty())
   {
     mTrackManager.predict(timestamp);
     mTrackManager.correct();
+    std::swap(mLastAssignedTrackIds, mFrameAssignedTrackIds);
     mLastTimestamp = timestamp;
     return;
   }
@@ -214,55 +444,154 @@ void MultipleObjectTracker::track(std::vector<std::vector<tracking::TrackedObjec
   }
 
   // 1. - Predict
-  mTrackManager.predict(rv::toSeconds(timestamp - mLastTimestamp));
+  {
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::Predict);
+    mTrackManager.predict(rv::toSeconds(timestamp - mLastTimestamp));
+  }
 
-  // 2.- Associate with the reliable states first
-  auto tracks = mTrackManager.getReliableTracks();
+  // 2.- Associate with the reliable states first; the views point into the
+  // estimator stores, so the pipeline never copies full track state
+  auto tracks = mTrackManager.getReliableTrackView(mArena.resource());
 
-  tracks = matchAndAssignMeasurements(tracks, objectsPerCamera, distanceType, distanceThreshold);
+  bool frameDegraded = false;
+  bool deferNewTracks = false;
+  {
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::Associate);
 
-  tracks = matchAndAssignMeasurements(tracks, lowScoreObjectsPerCamera, distanceType, distanceThreshold);
+    tracks = matchAndAssignMeasurements(tracks, objectsPerCamera, distanceType, distanceThreshold);
 
-  // 3.1 Update measurements - Match to unreliable objects first and then suspended tracks.
-  auto unreliableTracks = mTrackManager.getUnreliableTracks();
-  matchAndAssignMeasurements(unreliableTracks, objectsPerCamera, distanceType, distanceThreshold);
+    // The low-score detections only confirm reliable tracks; over budget the
+    // pass is skipped outright - it never feeds new tracks
+    if (!overBudget())
+    {
+      tracks = matchAndAssignMeasurements(tracks, lowScoreObjectsPerCamera, distanceType, distanceThreshold);
+    }
+    else
+    {
+      mFrameStats.skippedLowScorePasses++;
+      frameDegraded = true;
+    }
 
-  auto suspendedTracks = mTrackManager.getSuspendedTracks();
-  matchAndAssignMeasurements(suspendedTracks, objectsPerCamera, distanceType, distanceThreshold);
+    // 3.1 Update measurements - Match to unreliable objects first and then suspended tracks.
+    auto unreliableTracks = mTrackManager.getUnreliableTrackView(mArena.resource());
+    matchAndAssignMeasurements(unreliableTracks, objectsPerCamera, distanceType, distanceThreshold);
 
-  // 3.2 Update measurements - Correct measurements
-  mTrackManager.correct();
+    if (!overBudget())
+    {
+      // Query the suspended spatial hash with the detections still unassigned
+      // across all cameras; see the single-camera path for the gate reasoning
+      double const suspendedRadius = mGatingRadius > 0. ? mGatingRadius
+        : (distanceType == DistanceType::Euclidean || distanceType == DistanceType::MultiClassEuclidean)
+          ? distanceThreshold
+          : 0.;
+      TrackView suspendedTracks{mArena.resource()};
+      if (suspendedRadius > 0.)
+      {
+        TrackView remainingObjects{mArena.resource()};
+        for (auto const &cameraObjects : objectsPerCamera)
+        {
+          for (auto const &object : cameraObjects)
+          {
+            remainingObjects.push_back(&object);
+          }
+        }
+        suspendedTracks = mTrackManager.getSuspendedTrackViewNear(remainingObjects, suspendedRadius, mArena.resource());
+      }
+      else
+      {
+        suspendedTracks = mTrackManager.getSuspendedTrackView(mArena.resource());
+      }
+      matchAndAssignMeasurements(suspendedTracks, objectsPerCamera, distanceType, distanceThreshold);
+    }
+    else
+    {
+      // Without the suspended pass the leftovers may belong to suspended
+      // tracks; creating tracks from them now would duplicate those, so
+      // creation is deferred - the objects re-enter with the next frame's
+      // detections
+      mFrameStats.skippedSuspendedPasses++;
+      frameDegraded = true;
+      deferNewTracks = true;
+    }
+  }
 
-  // 4. - Create new tracks sequentially for each camera
-  std::vector<tracking::TrackedObject> newTracks;
-  size_t totalUnassignedObjects = 0;
-  for (auto &cameraObjects : objectsPerCamera)
+  // 3.2 Update measurements - Correct measurements
   {
-    totalUnassignedObjects += cameraObjects.size();
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::Correct);
+    mTrackManager.correct();
   }
-  newTracks.reserve(totalUnassignedObjects);
 
-  // Process cameras in reverse order to prioritize latest camera's objects for accuracy
-  for (auto it = objectsPerCamera.rbegin(); it != objectsPerCamera.rend(); ++it)
+  // 4. - Create new tracks sequentially for each camera
   {
-    auto &cameraObjects = *it;
-    // first assign objects to already created new tracks (in case multiple cameras see the same new object)
-    if (!newTracks.empty())
+    RV_TRACKING_STATS_SCOPE(mFrameStats, TrackingStage::CreateTracks);
+    size_t totalUnassignedObjects = 0;
+    for (auto &cameraObjects : objectsPerCamera)
     {
-      std::vector<size_t> unassignedObjects;
-      // the goal of this step is to filter out objects matching existing new tracks, the assignment will be skipped
-      matchAndAssignMeasurements(newTracks, cameraObjects, distanceType, distanceThreshold, unassignedObjects);
-      cameraObjects = filterByIndex(cameraObjects, unassignedObjects);
+      totalUnassignedObjects += cameraObjects.size();
     }
 
-    // Create new tracks for remaining unmatched objects
-    for (const auto &object : cameraObjects)
+    if (deferNewTracks)
+    {
+      mFrameStats.deferredDetections += totalUnassignedObjects;
+    }
+    else
     {
-      Id newTrackId = mTrackManager.createTrack(object, timestamp);
-      newTracks.push_back(mTrackManager.getTrack(newTrackId));
+      std::vector<tracking::TrackedObject> newTracks;
+      newTracks.reserve(totalUnassignedObjects);
+
+      // Under a track budget, score admissions with the camera-agreement
+      // signal only this multi-camera path can see: each agreeing camera
+      // adds 1.0, so corroborated detections always outrank single-camera
+      // classification confidence (which is at most 1.0)
+      bool const scoreAdmissions = mTrackManager.getConfig().mMaxTracks > 0;
+      double const agreementRadius = mGatingRadius > 0. ? mGatingRadius : distanceThreshold;
+
+      // Process cameras in reverse order to prioritize latest camera's objects for accuracy
+      for (auto it = objectsPerCamera.rbegin(); it != objectsPerCamera.rend(); ++it)
+      {
+        auto &cameraObjects = *it;
+        // first assign objects to already created new tracks (in case multiple cameras see the same new object)
+        if (!newTracks.empty())
+        {
+          IndexVector unassignedObjects{mArena.resource()};
+          // the goal of this step is to filter out objects matching existing new tracks, the assignment will be skipped
+          matchAndAssignMeasurements(makeTrackView(newTracks, mArena.resource()), cameraObjects, distanceType, distanceThreshold, unassignedObjects);
+          cameraObjects = filterByIndex(cameraObjects, unassignedObjects);
+        }
+
+        // Create new tracks for remaining unmatched objects; tryGetTrack copies
+        // the state only, not the estimator's filter bank. Admission-rejected
+        // detections return InvalidObjectId, which tryGetTrack filters out
+        for (const auto &object : cameraObjects)
+        {
+          Id newTrackId;
+          if (scoreAdmissions)
+          {
+            auto const admissionScore = object.dominantScore()
+              + static_cast<double>(cameraAgreement(object, objectsPerCamera, &cameraObjects, agreementRadius));
+            newTrackId = mTrackManager.createTrack(object, timestamp, admissionScore);
+          }
+          else
+          {
+            newTrackId = mTrackManager.createTrack(object, timestamp);
+          }
+          tracking::TrackedObject newTrack;
+          if (mTrackManager.tryGetTrack(newTrackId, newTrack))
+          {
+            newTracks.push_back(std::move(newTrack));
+          }
+        }
+      }
     }
   }
+  if (frameDegraded)
+  {
+    mFrameStats.degradedFrames++;
+  }
+
+  sampleMemoryStats();
 
+  std::swap(mLastAssignedTrackIds, mFrameAssignedTrackIds);
   mLastTimestamp = timestamp;
 }
 } // namespace tracking
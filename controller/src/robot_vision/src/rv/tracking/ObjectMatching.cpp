@@ -1,12 +1,17 @@
 // SPDX-FileCopyrightText: 2019 - 2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
-#include <functional>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <opencv2/core.hpp>
 #include <omp.h>
 
+#include "rv/SimdDispatch.hpp"
+#include "rv/WorkerPool.hpp"
+
 #include "rv/tracking/ObjectMatching.hpp"
+#include "rv/tracking/SpatialGridIndex.hpp"
 #include "rv/apollo/multi_hm_bipartite_graph_matcher.hpp"
 #include "rv/apollo/secure_matrix.hpp"
 #include "rv/tracking/Classification.hpp"
@@ -39,7 +44,7 @@ double calculateMahalanobisDistance(const TrackedObject &measurement, const Trac
   // ignore yaw, 2D detectors cannot detect orientation
   innovation.at<double>(6, 0) = 0.;
 
-  cv::Mat mahalanobisDistance = innovation.t() * (track.predictedMeasurementCovInv) * innovation;
+  cv::Mat mahalanobisDistance = innovation.t() * track.predictedMeasurementCovInverse() * innovation;
 
   return 0.5 * std::sqrt(mahalanobisDistance.at<double>(0, 0));
 }
@@ -52,14 +57,294 @@ double calculateCompundDistance(const TrackedObject &measurement, const TrackedO
   return 0.5 * euclideanDist + 0.5 * mahalanobisDist;
 }
 
+namespace {
+
+// Calibrated per-element costs (ns) for the worker pool's cost-model
+// dispatch: a loop runs serial when elements x cost cannot amortize a
+// fork/join. The cost-matrix loops scale per track-measurement pair, so the
+// call sites multiply by the measurement count
+constexpr double kCostPairNs = 120.0;        // one distance kernel evaluation
+constexpr double kBucketSolveCostNs = 30000.0; // one per-class Hungarian solve
+
+/**
+ * @brief Structure-of-arrays copy of measurement positions
+ *
+ * The row kernels stream these contiguous arrays instead of striding through
+ * the TrackedObject layout, so the inner distance loops vectorize.
+ */
+struct MeasurementSoA
+{
+  explicit MeasurementSoA(const TrackView &measurements)
+  {
+    x.reserve(measurements.size());
+    y.reserve(measurements.size());
+    for (auto const &measurement : measurements)
+    {
+      x.push_back(measurement->x);
+      y.push_back(measurement->y);
+    }
+  }
+
+  std::vector<double> x;
+  std::vector<double> y;
+};
+
+template <DistanceType Type>
+inline double pairDistance(const TrackedObject &measurement, const TrackedObject &track);
+
+template <> inline double pairDistance<DistanceType::Euclidean>(const TrackedObject &measurement, const TrackedObject &track)
+{
+  return calculateEuclideanDistance(measurement, track);
+}
+
+template <>
+inline double pairDistance<DistanceType::MultiClassEuclidean>(const TrackedObject &measurement, const TrackedObject &track)
+{
+  return calculateMulticlassScaledDistance(measurement, track);
+}
+
+template <> inline double pairDistance<DistanceType::Mahalanobis>(const TrackedObject &measurement, const TrackedObject &track)
+{
+  return calculateMahalanobisDistance(measurement, track);
+}
+
+template <> inline double pairDistance<DistanceType::MCEMahalanobis>(const TrackedObject &measurement, const TrackedObject &track)
+{
+  return calculateCompundDistance(measurement, track);
+}
+
+/**
+ * @brief Fill one dense cost-matrix row for a track
+ *
+ * The Euclidean variants stream the SoA arrays with a simd inner loop; the
+ * Mahalanobis variants stay scalar because each pair reads a per-track cv::Mat.
+ */
+template <DistanceType Type>
+inline void fillRow(const TrackedObject &track,
+                    const TrackView &measurements,
+                    const MeasurementSoA &soa,
+                    apollo::perception::common::SecureMat<double> *costMatrix,
+                    size_t row)
+{
+  (void)soa;
+  for (size_t j = 0; j < measurements.size(); ++j)
+  {
+    (*costMatrix)(row, j) = pairDistance<Type>(*measurements[j], track);
+  }
+}
+
+/**
+ * @brief One track against all measurement columns: the streaming Euclidean
+ * row kernel. Compiled once per ISA level and dispatched at load (see
+ * SimdDispatch.hpp), so the same build uses the widest lanes the CPU has.
+ */
+RV_TARGET_CLONES
+static void euclideanRowKernel(
+  double trackX, double trackY, const double *measurementX, const double *measurementY, double *row, size_t count)
+{
+  #pragma omp simd
+  for (size_t j = 0; j < count; ++j)
+  {
+    auto const deltaX = measurementX[j] - trackX;
+    auto const deltaY = measurementY[j] - trackY;
+    row[j] = std::sqrt(deltaX * deltaX + deltaY * deltaY);
+  }
+}
+
+template <>
+inline void fillRow<DistanceType::Euclidean>(const TrackedObject &track,
+                                             const TrackView &measurements,
+                                             const MeasurementSoA &soa,
+                                             apollo::perception::common::SecureMat<double> *costMatrix,
+                                             size_t row)
+{
+  euclideanRowKernel(track.x, track.y, soa.x.data(), soa.y.data(), costMatrix->row_data(row), measurements.size());
+}
+
+template <>
+inline void fillRow<DistanceType::MultiClassEuclidean>(const TrackedObject &track,
+                                                       const TrackView &measurements,
+                                                       const MeasurementSoA &soa,
+                                                       apollo::perception::common::SecureMat<double> *costMatrix,
+                                                       size_t row)
+{
+  fillRow<DistanceType::Euclidean>(track, measurements, soa, costMatrix, row);
+
+  // Scale the vectorized Euclidean row by the class conflict factor; the
+  // classification residual involves Eigen temporaries, so it stays scalar
+  for (size_t j = 0; j < measurements.size(); ++j)
+  {
+    auto conflict = rv::tracking::classification::distance(measurements[j]->classification, track.classification);
+    (*costMatrix)(row, j) *= (1.0 + conflict);
+  }
+}
+
+template <DistanceType Type>
+void fillCostMatrix(const TrackView &tracks,
+                    const TrackView &measurements,
+                    double gateRadius,
+                    double boundValue,
+                    apollo::perception::common::SecureMat<double> *costMatrix)
+{
+  MeasurementSoA soa(measurements);
+
+  if (gateRadius > 0.)
+  {
+    SpatialGridIndex measurementIndex(gateRadius);
+    measurementIndex.build(measurements);
+
+    // Only compute distances for pairs within the gating radius; everything else
+    // stays at the bound value, which the gated matcher treats as a non-edge
+    auto const rowCostNs = static_cast<double>(measurements.size()) * kCostPairNs;
+    rv::WorkerPool::instance().parallelFor(0, tracks.size(), rowCostNs, [&](std::size_t i) {
+      for (size_t j = 0; j < measurements.size(); ++j)
+      {
+        (*costMatrix)(i, j) = boundValue;
+      }
+
+      measurementIndex.forEachInRadius(tracks[i]->x, tracks[i]->y, gateRadius, [&](size_t j) {
+        (*costMatrix)(i, j) = pairDistance<Type>(*measurements[j], *tracks[i]);
+      });
+    });
+  }
+  else
+  {
+    // Parallelize the cost matrix computation over tracks; each row is filled
+    // by the type-specialized kernel. Runs inline when already on a worker
+    // (e.g. inside the per-camera match), like non-nested omp used to
+    auto const rowCostNs = static_cast<double>(measurements.size()) * kCostPairNs;
+    rv::WorkerPool::instance().parallelFor(0, tracks.size(), rowCostNs, [&](std::size_t i) {
+      fillRow<Type>(*tracks[i], measurements, soa, costMatrix, i);
+    });
+  }
+}
+
+/**
+ * @brief Pair each seeded track with its mutual-nearest in-gate measurement
+ *
+ * Greedy and conflict-free: a pair is accepted only when the measurement is
+ * also the seed's best candidate among all seeds, so contested pairs fall
+ * through to the residual Hungarian solve unchanged.
+ */
+template <DistanceType Type>
+void seedAssignments(const TrackView &tracks,
+                     const TrackView &measurements,
+                     const IndexVector &seededTracks,
+                     double gateRadius,
+                     double threshold,
+                     AssignmentVector &assignments,
+                     std::pmr::vector<bool> &trackTaken,
+                     std::pmr::vector<bool> &measurementTaken)
+{
+  constexpr size_t kNoCandidate = std::numeric_limits<size_t>::max();
+
+  SpatialGridIndex measurementIndex(gateRadius);
+  measurementIndex.build(measurements);
+
+  auto const allocator = assignments.get_allocator();
+  IndexVector bestMeasurement(seededTracks.size(), kNoCandidate, allocator);
+  IndexVector bestSeed(measurements.size(), kNoCandidate, allocator);
+  std::pmr::vector<double> bestMeasurementDistance(seededTracks.size(), threshold, allocator);
+  std::pmr::vector<double> bestSeedDistance(measurements.size(), threshold, allocator);
+
+  for (size_t seed = 0; seed < seededTracks.size(); ++seed)
+  {
+    auto const &track = *tracks[seededTracks[seed]];
+    measurementIndex.forEachInRadius(track.x, track.y, gateRadius, [&](size_t j) {
+      auto const distance = pairDistance<Type>(*measurements[j], track);
+      if (distance < bestMeasurementDistance[seed])
+      {
+        bestMeasurementDistance[seed] = distance;
+        bestMeasurement[seed] = j;
+      }
+      if (distance < bestSeedDistance[j])
+      {
+        bestSeedDistance[j] = distance;
+        bestSeed[j] = seed;
+      }
+    });
+  }
+
+  for (size_t seed = 0; seed < seededTracks.size(); ++seed)
+  {
+    auto const candidate = bestMeasurement[seed];
+    if (candidate != kNoCandidate && bestSeed[candidate] == seed)
+    {
+      assignments.push_back({seededTracks[seed], candidate});
+      trackTaken[seededTracks[seed]] = true;
+      measurementTaken[candidate] = true;
+    }
+  }
+}
+
+} // namespace
+
 void match(const std::vector<TrackedObject> &tracks,
                           const std::vector<TrackedObject> &measurements,
                           std::vector<std::pair<size_t, size_t>> &assignments,
                           std::vector<size_t> &unassignedTracks,
                           std::vector<size_t> &unassignedMeasurements,
-                          const DistanceType &distanceType, double threshold)
+                          const DistanceType &distanceType, double threshold,
+                          double gatingRadius)
+{
+  AssignmentVector viewAssignments;
+  IndexVector viewUnassignedTracks;
+  IndexVector viewUnassignedMeasurements;
+
+  match(makeTrackView(tracks), makeTrackView(measurements), viewAssignments, viewUnassignedTracks,
+        viewUnassignedMeasurements, distanceType, threshold, gatingRadius);
+
+  assignments.assign(viewAssignments.begin(), viewAssignments.end());
+  unassignedTracks.assign(viewUnassignedTracks.begin(), viewUnassignedTracks.end());
+  unassignedMeasurements.assign(viewUnassignedMeasurements.begin(), viewUnassignedMeasurements.end());
+}
+
+// Per-thread matcher state behind accessor functions, so both match() and
+// matcherScratchFootprint() see the calling thread's copies
+static apollo::perception::lidar::MultiHmBipartiteGraphMatcher &localMatcher()
+{
+  static thread_local apollo::perception::lidar::MultiHmBipartiteGraphMatcher matcher;
+  return matcher;
+}
+
+static std::vector<std::pair<size_t, size_t>> &localMatcherAssignments()
+{
+  static thread_local std::vector<std::pair<size_t, size_t>> assignments;
+  return assignments;
+}
+
+static std::vector<size_t> &localUnassignedTracks()
+{
+  static thread_local std::vector<size_t> unassignedTracks;
+  return unassignedTracks;
+}
+
+static std::vector<size_t> &localUnassignedMeasurements()
 {
-  apollo::perception::lidar::MultiHmBipartiteGraphMatcher matcher;
+  static thread_local std::vector<size_t> unassignedMeasurements;
+  return unassignedMeasurements;
+}
+
+std::size_t matcherScratchFootprint()
+{
+  return localMatcher().MemoryFootprint()
+    + localMatcherAssignments().capacity() * sizeof(std::pair<size_t, size_t>)
+    + (localUnassignedTracks().capacity() + localUnassignedMeasurements().capacity()) * sizeof(size_t);
+}
+
+void match(const TrackView &tracks,
+                          const TrackView &measurements,
+                          AssignmentVector &assignments,
+                          IndexVector &unassignedTracks,
+                          IndexVector &unassignedMeasurements,
+                          const DistanceType &distanceType, double threshold,
+                          double gatingRadius)
+{
+  // One persistent matcher per worker thread: match() runs concurrently per
+  // camera and per class bucket, so a shared member would race, but the
+  // thread_local's cost matrix and optimizer arrays grow monotonically and
+  // amortize across all five match calls of every frame
+  auto &matcher = localMatcher();
 
   matcher.cost_matrix()->Reserve(tracks.size(), measurements.size());
 
@@ -77,46 +362,271 @@ void match(const std::vector<TrackedObject> &tracks,
   }
 
   apollo::perception::lidar::BipartiteGraphMatcherOptions matcherOptions;
-  std::function<double(const TrackedObject &, const TrackedObject &)> distanceFunction;
+  matcherOptions.cost_thresh = threshold;
+  matcherOptions.bound_value = kDefaultClassBoundValue;
+
+  apollo::perception::common::SecureMat<double> *costMatrix = matcher.cost_matrix();
+  costMatrix->Resize(tracks.size(), measurements.size());
+
+  // The class conflict factor only ever inflates the Euclidean distance, so the
+  // association threshold itself is a safe gating radius for both Euclidean
+  // distance types; Mahalanobis-based distances need an explicit radius
+  double gateRadius = gatingRadius;
+  if (gateRadius <= 0.
+      && (distanceType == DistanceType::Euclidean || distanceType == DistanceType::MultiClassEuclidean))
+  {
+    gateRadius = threshold;
+  }
+
+  // Resolve the distance type once per call so the fill loops make direct,
+  // inlinable calls instead of going through a std::function per cell
   switch (distanceType)
   {
     case DistanceType::MCEMahalanobis:
-      distanceFunction = std::bind(&calculateCompundDistance, std::placeholders::_1, std::placeholders::_2);
-      matcherOptions.cost_thresh = threshold;
-      matcherOptions.bound_value = kDefaultClassBoundValue;
+      fillCostMatrix<DistanceType::MCEMahalanobis>(tracks, measurements, gateRadius, matcherOptions.bound_value, costMatrix);
       break;
     case DistanceType::Mahalanobis:
-      distanceFunction = std::bind(&calculateMahalanobisDistance, std::placeholders::_1, std::placeholders::_2);
-      matcherOptions.cost_thresh = threshold;
-      matcherOptions.bound_value = kDefaultClassBoundValue;
+      fillCostMatrix<DistanceType::Mahalanobis>(tracks, measurements, gateRadius, matcherOptions.bound_value, costMatrix);
       break;
     case DistanceType::MultiClassEuclidean:
-      distanceFunction = std::bind(&calculateMulticlassScaledDistance, std::placeholders::_1, std::placeholders::_2);
-      matcherOptions.cost_thresh = threshold;
-      matcherOptions.bound_value = kDefaultClassBoundValue;
+      fillCostMatrix<DistanceType::MultiClassEuclidean>(tracks, measurements, gateRadius, matcherOptions.bound_value, costMatrix);
       break;
     case DistanceType::Euclidean:
     default:
-      distanceFunction = std::bind(&calculateEuclideanDistance, std::placeholders::_1, std::placeholders::_2);
-      matcherOptions.cost_thresh = threshold;
-      matcherOptions.bound_value = kDefaultClassBoundValue;
+      fillCostMatrix<DistanceType::Euclidean>(tracks, measurements, gateRadius, matcherOptions.bound_value, costMatrix);
       break;
   }
 
-  apollo::perception::common::SecureMat<double> *costMatrix = matcher.cost_matrix();
-  costMatrix->Resize(tracks.size(), measurements.size());
+  // The apollo matcher stack still works on plain std::vector; bridge at this
+  // boundary and copy the small index arrays into the caller's containers.
+  // The bridge vectors persist per thread like the matcher itself, so the
+  // boundary crossing stops allocating once they reach steady-state size
+  auto &matcherAssignments = localMatcherAssignments();
+  auto &matcherUnassignedTracks = localUnassignedTracks();
+  auto &matcherUnassignedMeasurements = localUnassignedMeasurements();
+  matcher.Match(matcherOptions, &matcherAssignments, &matcherUnassignedTracks, &matcherUnassignedMeasurements);
+
+  assignments.assign(matcherAssignments.begin(), matcherAssignments.end());
+  unassignedTracks.assign(matcherUnassignedTracks.begin(), matcherUnassignedTracks.end());
+  unassignedMeasurements.assign(matcherUnassignedMeasurements.begin(), matcherUnassignedMeasurements.end());
+}
+
+void matchByClass(const TrackView &tracks,
+                          const TrackView &measurements,
+                          AssignmentVector &assignments,
+                          IndexVector &unassignedTracks,
+                          IndexVector &unassignedMeasurements,
+                          const DistanceType &distanceType, double threshold,
+                          double gatingRadius)
+{
+  assignments.clear();
+  unassignedTracks.clear();
+  unassignedMeasurements.clear();
+  if (measurements.empty() || tracks.empty())
+  {
+    unassignedMeasurements.resize(measurements.size());
+    unassignedTracks.resize(tracks.size());
+
+    std::iota(unassignedMeasurements.begin(), unassignedMeasurements.end(), 0);
+    std::iota(unassignedTracks.begin(), unassignedTracks.end(), 0);
+    return;
+  }
 
-  // Parallelize the cost matrix computation
-  #pragma omp parallel for collapse(2)
+  auto dominantClass = [](const TrackedObject &object) -> Eigen::Index {
+    return object.dominantClass();
+  };
+
+  // Bucket both sides by dominant class; ordered so the output is
+  // deterministic regardless of scheduling
+  struct ClassBucket
+  {
+    std::vector<size_t> trackIndices;
+    std::vector<size_t> measurementIndices;
+  };
+  std::map<Eigen::Index, ClassBucket> buckets;
   for (size_t i = 0; i < tracks.size(); ++i)
   {
-    for (size_t j = 0; j < measurements.size(); ++j)
+    buckets[dominantClass(*tracks[i])].trackIndices.push_back(i);
+  }
+  for (size_t j = 0; j < measurements.size(); ++j)
+  {
+    buckets[dominantClass(*measurements[j])].measurementIndices.push_back(j);
+  }
+
+  // A class present on only one side can never match in partitioned mode
+  std::vector<const ClassBucket *> solvable;
+  for (auto const &entry : buckets)
+  {
+    auto const &bucket = entry.second;
+    if (bucket.trackIndices.empty())
+    {
+      unassignedMeasurements.insert(
+        unassignedMeasurements.end(), bucket.measurementIndices.begin(), bucket.measurementIndices.end());
+    }
+    else if (bucket.measurementIndices.empty())
     {
-      (*costMatrix)(i, j) = distanceFunction(measurements[j], tracks[i]);
+      unassignedTracks.insert(unassignedTracks.end(), bucket.trackIndices.begin(), bucket.trackIndices.end());
+    }
+    else
+    {
+      solvable.push_back(&bucket);
     }
   }
 
-  matcher.Match(matcherOptions, &assignments, &unassignedTracks, &unassignedMeasurements);
+  struct BucketResult
+  {
+    std::vector<std::pair<size_t, size_t>> assignments;
+    std::vector<size_t> unassignedTracks;
+    std::vector<size_t> unassignedMeasurements;
+  };
+  std::vector<BucketResult> results(solvable.size());
+
+  // Solve the per-class problems in parallel; the bucket-local containers use
+  // the default resource because the frame arena is not thread-safe
+  rv::WorkerPool::instance().parallelFor(0, solvable.size(), kBucketSolveCostNs, [&](std::size_t b) {
+    auto const &bucket = *solvable[b];
+    auto &result = results[b];
+
+    TrackView bucketTracks;
+    bucketTracks.reserve(bucket.trackIndices.size());
+    for (auto const index : bucket.trackIndices)
+    {
+      bucketTracks.push_back(tracks[index]);
+    }
+    TrackView bucketMeasurements;
+    bucketMeasurements.reserve(bucket.measurementIndices.size());
+    for (auto const index : bucket.measurementIndices)
+    {
+      bucketMeasurements.push_back(measurements[index]);
+    }
+
+    AssignmentVector bucketAssignments;
+    IndexVector bucketUnassignedTracks;
+    IndexVector bucketUnassignedMeasurements;
+    match(bucketTracks, bucketMeasurements, bucketAssignments, bucketUnassignedTracks, bucketUnassignedMeasurements,
+          distanceType, threshold, gatingRadius);
+
+    // Map back to the caller's index space while still on the worker
+    for (auto const &assignment : bucketAssignments)
+    {
+      result.assignments.push_back(
+        {bucket.trackIndices[assignment.first], bucket.measurementIndices[assignment.second]});
+    }
+    for (auto const &index : bucketUnassignedTracks)
+    {
+      result.unassignedTracks.push_back(bucket.trackIndices[index]);
+    }
+    for (auto const &index : bucketUnassignedMeasurements)
+    {
+      result.unassignedMeasurements.push_back(bucket.measurementIndices[index]);
+    }
+  });
+
+  for (auto const &result : results)
+  {
+    assignments.insert(assignments.end(), result.assignments.begin(), result.assignments.end());
+    unassignedTracks.insert(unassignedTracks.end(), result.unassignedTracks.begin(), result.unassignedTracks.end());
+    unassignedMeasurements.insert(
+      unassignedMeasurements.end(), result.unassignedMeasurements.begin(), result.unassignedMeasurements.end());
+  }
+}
+
+void matchIncremental(const TrackView &tracks,
+                          const TrackView &measurements,
+                          const IndexVector &seededTracks,
+                          AssignmentVector &assignments,
+                          IndexVector &unassignedTracks,
+                          IndexVector &unassignedMeasurements,
+                          const DistanceType &distanceType, double threshold,
+                          double gatingRadius)
+{
+  double gateRadius = gatingRadius;
+  if (gateRadius <= 0.
+      && (distanceType == DistanceType::Euclidean || distanceType == DistanceType::MultiClassEuclidean))
+  {
+    gateRadius = threshold;
+  }
+
+  // Seeding needs a spatial gate to look up candidates; without one the full
+  // solve is the only correct option
+  if (seededTracks.empty() || gateRadius <= 0. || tracks.empty() || measurements.empty())
+  {
+    match(tracks, measurements, assignments, unassignedTracks, unassignedMeasurements, distanceType, threshold,
+          gatingRadius);
+    return;
+  }
+
+  assignments.clear();
+  unassignedTracks.clear();
+  unassignedMeasurements.clear();
+
+  auto const allocator = assignments.get_allocator();
+  std::pmr::vector<bool> trackTaken(tracks.size(), false, allocator);
+  std::pmr::vector<bool> measurementTaken(measurements.size(), false, allocator);
+
+  switch (distanceType)
+  {
+    case DistanceType::MCEMahalanobis:
+      seedAssignments<DistanceType::MCEMahalanobis>(tracks, measurements, seededTracks, gateRadius, threshold,
+                                                    assignments, trackTaken, measurementTaken);
+      break;
+    case DistanceType::Mahalanobis:
+      seedAssignments<DistanceType::Mahalanobis>(tracks, measurements, seededTracks, gateRadius, threshold,
+                                                 assignments, trackTaken, measurementTaken);
+      break;
+    case DistanceType::MultiClassEuclidean:
+      seedAssignments<DistanceType::MultiClassEuclidean>(tracks, measurements, seededTracks, gateRadius, threshold,
+                                                         assignments, trackTaken, measurementTaken);
+      break;
+    case DistanceType::Euclidean:
+    default:
+      seedAssignments<DistanceType::Euclidean>(tracks, measurements, seededTracks, gateRadius, threshold, assignments,
+                                               trackTaken, measurementTaken);
+      break;
+  }
+
+  // Solve the Hungarian problem only on the residual unmatched sets
+  TrackView residualTracks{allocator};
+  IndexVector residualTrackIndices{allocator};
+  for (size_t i = 0; i < tracks.size(); ++i)
+  {
+    if (!trackTaken[i])
+    {
+      residualTracks.push_back(tracks[i]);
+      residualTrackIndices.push_back(i);
+    }
+  }
+
+  TrackView residualMeasurements{allocator};
+  IndexVector residualMeasurementIndices{allocator};
+  for (size_t j = 0; j < measurements.size(); ++j)
+  {
+    if (!measurementTaken[j])
+    {
+      residualMeasurements.push_back(measurements[j]);
+      residualMeasurementIndices.push_back(j);
+    }
+  }
+
+  AssignmentVector residualAssignments{allocator};
+  IndexVector residualUnassignedTracks{allocator};
+  IndexVector residualUnassignedMeasurements{allocator};
+  match(residualTracks, residualMeasurements, residualAssignments, residualUnassignedTracks,
+        residualUnassignedMeasurements, distanceType, threshold, gatingRadius);
+
+  // Map the residual solution back to the caller's index space
+  for (auto const &assignment : residualAssignments)
+  {
+    assignments.push_back({residualTrackIndices[assignment.first], residualMeasurementIndices[assignment.second]});
+  }
+  for (auto const &index : residualUnassignedTracks)
+  {
+    unassignedTracks.push_back(residualTrackIndices[index]);
+  }
+  for (auto const &index : residualUnassignedMeasurements)
+  {
+    unassignedMeasurements.push_back(residualMeasurementIndices[index]);
+  }
 }
 
 } // namespace tracking
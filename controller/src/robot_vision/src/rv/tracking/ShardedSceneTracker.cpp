@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "rv/WorkerPool.hpp"
+#include "rv/tracking/ShardedSceneTracker.hpp"
+#include "rv/tracking/TrackSerialization.hpp"
+
+namespace rv {
+namespace tracking {
+
+namespace {
+
+// Disjoint id ranges per shard: 256 shards with 16M auto ids each before the
+// int32 id space runs out
+constexpr Id kShardIdStride = Id{1} << 24;
+
+// Squared distance from a position to the shard's nearest track in its last
+// published snapshot; the snapshot read is lock-free and never blocks the
+// shard's tracking thread
+double nearestTrackDistanceSquared(MultipleObjectTracker &tracker, double x, double y)
+{
+  auto const snapshot = tracker.getTrackSnapshot();
+  double nearest = std::numeric_limits<double>::max();
+  if (snapshot == nullptr)
+  {
+    return nearest;
+  }
+  for (auto const &track : snapshot->tracks)
+  {
+    auto const dx = track.x - x;
+    auto const dy = track.y - y;
+    nearest = std::min(nearest, dx * dx + dy * dy);
+  }
+  return nearest;
+}
+
+} // namespace
+
+ShardedSceneTracker::ShardedSceneTracker(const ShardedSceneTrackerConfig &config)
+  : mConfig(config)
+{
+  if (!std::is_sorted(mConfig.mBoundaries.begin(), mConfig.mBoundaries.end()))
+  {
+    throw std::runtime_error("Shard boundaries must be sorted along x.");
+  }
+
+  auto const shardCount = mConfig.mBoundaries.size() + 1;
+  mShards.reserve(shardCount);
+  for (std::size_t i = 0; i < shardCount; ++i)
+  {
+    mShards.push_back(std::make_unique<Shard>(mConfig));
+    mShards.back()->tracker.seedTrackIds(static_cast<Id>(i) * kShardIdStride);
+  }
+}
+
+std::size_t ShardedSceneTracker::shardOf(double x) const
+{
+  auto const it = std::upper_bound(mConfig.mBoundaries.begin(), mConfig.mBoundaries.end(), x);
+  return static_cast<std::size_t>(it - mConfig.mBoundaries.begin());
+}
+
+std::size_t ShardedSceneTracker::routeDetection(const TrackedObject &detection) const
+{
+  auto const owner = shardOf(detection.x);
+
+  // Inside the sticky band the detection follows the adjacent shard that
+  // already holds the nearest track, so a not-yet-handed-off track keeps
+  // receiving its measurements from across the boundary. The routing band is
+  // twice the handoff band: a track at handoff depth still gets its
+  // measurement from the old owner in the frame that moves it
+  auto stickier = [this, &detection, owner](std::size_t neighbor) {
+    auto const ownerDistance = nearestTrackDistanceSquared(mShards[owner]->tracker, detection.x, detection.y);
+    auto const neighborDistance = nearestTrackDistanceSquared(mShards[neighbor]->tracker, detection.x, detection.y);
+    auto const gate = mConfig.mDistanceThreshold * mConfig.mDistanceThreshold;
+    return neighborDistance < ownerDistance && neighborDistance <= gate;
+  };
+
+  auto const routingBand = 2.0 * mConfig.mHandoffHysteresis;
+  if (owner > 0 && detection.x - mConfig.mBoundaries[owner - 1] < routingBand && stickier(owner - 1))
+  {
+    return owner - 1;
+  }
+  if (owner < mConfig.mBoundaries.size() && mConfig.mBoundaries[owner] - detection.x < routingBand
+      && stickier(owner + 1))
+  {
+    return owner + 1;
+  }
+  return owner;
+}
+
+void ShardedSceneTracker::track(std::vector<TrackedObject> detections,
+                                const std::chrono::system_clock::time_point &timestamp,
+                                double scoreThreshold)
+{
+  for (auto &shard : mShards)
+  {
+    shard->frameDetections.clear();
+  }
+  for (auto &detection : detections)
+  {
+    mShards[routeDetection(detection)]->frameDetections.push_back(std::move(detection));
+  }
+
+  // The shards are independent trackers; their frames run concurrently and
+  // the intra-shard stages stay inline on the owning worker
+  rv::WorkerPool::instance().parallelFor(0, mShards.size(), [this, &timestamp, scoreThreshold](std::size_t i) {
+    mShards[i]->tracker.track(std::move(mShards[i]->frameDetections), timestamp, scoreThreshold);
+  });
+
+  handoffBoundaryCrossers(timestamp);
+}
+
+void ShardedSceneTracker::handoffBoundaryCrossers(const std::chrono::system_clock::time_point &timestamp)
+{
+  std::vector<uint8_t> blob;
+  for (std::size_t i = 0; i < mShards.size(); ++i)
+  {
+    for (auto const &track : mShards[i]->tracker.getTracks())
+    {
+      auto const target = shardOf(track.x);
+      if (target == i)
+      {
+        continue;
+      }
+
+      // Hand off only past the hysteresis band, so a track oscillating
+      // around the boundary stays with its owner
+      auto const departedBoundary = target > i ? mConfig.mBoundaries[i] : mConfig.mBoundaries[i - 1];
+      auto const penetration = target > i ? track.x - departedBoundary : departedBoundary - track.x;
+      if (penetration <= mConfig.mHandoffHysteresis)
+      {
+        continue;
+      }
+
+      // The handoff payload is the flat serialized track, the same format a
+      // cross-machine handoff would put on the wire
+      serializeTracks(&track, 1, blob);
+      auto restored = deserializeTracks(blob.data(), blob.size());
+      if (!mShards[target]->tracker.hasTrack(track.id))
+      {
+        mShards[target]->tracker.adoptTrack(restored.front(), timestamp);
+      }
+      mShards[i]->tracker.removeTrack(track.id);
+      mHandoffs++;
+    }
+  }
+}
+
+std::vector<TrackedObject> ShardedSceneTracker::getTracks()
+{
+  std::vector<TrackedObject> tracks;
+  for (auto &shard : mShards)
+  {
+    auto shardTracks = shard->tracker.getTracks();
+    tracks.insert(tracks.end(), std::make_move_iterator(shardTracks.begin()),
+                  std::make_move_iterator(shardTracks.end()));
+  }
+  return tracks;
+}
+
+std::vector<TrackedObject> ShardedSceneTracker::getReliableTracks()
+{
+  std::vector<TrackedObject> tracks;
+  for (auto &shard : mShards)
+  {
+    auto shardTracks = shard->tracker.getReliableTracks();
+    tracks.insert(tracks.end(), std::make_move_iterator(shardTracks.begin()),
+                  std::make_move_iterator(shardTracks.end()));
+  }
+  return tracks;
+}
+
+} // namespace tracking
+} // namespace rv
@@ -2,26 +2,120 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "rv/Utils.hpp"
+#include "rv/WorkerPool.hpp"
 #include "rv/tracking/TrackManager.hpp"
+#include "rv/tracking/TransitionMatrixCache.hpp"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
-#include <omp.h>
 
 namespace rv {
 namespace tracking {
 
+namespace {
+
+// Cell size of the suspended-track spatial hash. Queries accept any radius by
+// scanning the covered cell range, so the size only trades hash occupancy
+// against cells visited per detection; 5 m matches the default gate
+constexpr double kSuspendedCellSize = 5.0;
+
+std::int64_t suspendedCellKey(double x, double y)
+{
+  auto const cellX = static_cast<std::int32_t>(std::floor(x / kSuspendedCellSize));
+  auto const cellY = static_cast<std::int32_t>(std::floor(y / kSuspendedCellSize));
+  return (static_cast<std::int64_t>(cellX) << 32) | static_cast<std::int64_t>(static_cast<std::uint32_t>(cellY));
+}
+
+// Calibrated per-element costs (ns) for the pool's cost-model dispatch,
+// measured per track on the release build. The pool runs a stage serial when
+// elements x cost cannot amortize a fork/join (see mSerialDispatchFloorNs)
+constexpr double kPredictCostNs = 4000.0;       // full per-track UKF predict
+constexpr double kSigmaStageCostNs = 1200.0;    // interaction / fold phase of the batched predict
+constexpr double kGatherScatterCostNs = 250.0;  // sigma-point copy in/out of the bulk matrix
+constexpr double kCorrectCostNs = 5000.0;       // measurement update + lifecycle bookkeeping
+
+} // namespace
+
 Id TrackManager::createTrack(TrackedObject object, const std::chrono::system_clock::time_point &timestamp)
 {
+  auto const admissionScore = object.dominantScore();
+  return createTrack(std::move(object), timestamp, admissionScore);
+}
+
+Id TrackManager::createTrack(TrackedObject object, const std::chrono::system_clock::time_point &timestamp, double admissionScore)
+{
+  if (!admitNewTrack(admissionScore))
+  {
+    return InvalidObjectId;
+  }
+
   if (mAutoIdGeneration)
   {
     mCurrentId++;
     object.id = mCurrentId;
   }
 
-  mKalmanEstimators[object.id].initialize(object, timestamp, mConfig.mDefaultProcessNoise, mConfig.mDefaultMeasurementNoise, mConfig.mInitStateCovariance, mConfig.mMotionModels);
+  // emplace() resets the slot's lifecycle counters alongside the estimator
+  auto &estimator = mKalmanEstimators.emplace(object.id);
+  estimator.initialize(object, timestamp, mConfig.mDefaultProcessNoise, mConfig.mDefaultMeasurementNoise, mConfig.mInitStateCovariance, mConfig.mMotionModels);
+  estimator.setModelPruning(mConfig.mModelPruneProbabilityFloor, mConfig.mModelPruneFrames);
+
+  return object.id;
+}
+
+bool TrackManager::admitNewTrack(double admissionScore)
+{
+  if (mConfig.mMinAdmissionScore > 0. && admissionScore < mConfig.mMinAdmissionScore)
+  {
+    mAdmissionRejections++;
+    return false;
+  }
+  if (mConfig.mMaxTracks == 0 || liveTrackCount() < mConfig.mMaxTracks)
+  {
+    return true;
+  }
+
+  // At the budget: prefer evicting the longest-unmatched unreliable track.
+  // Reliable tracks, tracks with a measurement pending this frame and tracks
+  // created this frame (no miss yet) are protected, so a detection flood
+  // cannot churn established tracks or its own admissions
+  Id evictId = InvalidObjectId;
+  uint32_t longestMiss = 0;
+  uint32_t fewestTrackedFrames = 0;
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
+  {
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (!slot.occupied || slot.hasMeasurement || slot.nonMeasurementFrames == 0
+        || slot.trackedFrames >= mConfig.mMaxNumberOfUnreliableFrames)
+    {
+      continue;
+    }
+    if (evictId == InvalidObjectId || slot.nonMeasurementFrames > longestMiss
+        || (slot.nonMeasurementFrames == longestMiss && slot.trackedFrames < fewestTrackedFrames))
+    {
+      evictId = slot.id;
+      longestMiss = slot.nonMeasurementFrames;
+      fewestTrackedFrames = slot.trackedFrames;
+    }
+  }
+
+  if (evictId == InvalidObjectId)
+  {
+    mAdmissionRejections++;
+    return false;
+  }
+
+  deleteTrack(evictId);
+  mCapacityEvictions++;
+  return true;
+}
+
+Id TrackManager::adoptTrack(TrackedObject object, const std::chrono::system_clock::time_point &timestamp)
+{
+  auto &estimator = mKalmanEstimators.emplace(object.id);
+  estimator.initialize(object, timestamp, mConfig.mDefaultProcessNoise, mConfig.mDefaultMeasurementNoise, mConfig.mInitStateCovariance, mConfig.mMotionModels);
+  estimator.setModelPruning(mConfig.mModelPruneProbabilityFloor, mConfig.mModelPruneFrames);
 
-  // Initialize non measurement and tracked frames counters
-  mNonMeasurementFrames[object.id] = 0;
-  mNumberOfTrackedFrames[object.id] = 0;
   return object.id;
 }
 
@@ -33,158 +127,254 @@ void TrackManager::deleteTrack(const Id &id)
   }
 
   mKalmanEstimators.erase(id);
-  mNonMeasurementFrames.erase(id);
-  mNumberOfTrackedFrames.erase(id);
+  mTrackHistories.erase(id);
 }
 
 void TrackManager::suspendTrack(const Id &id)
 {
-  mSuspendedKalmanEstimators[id] = std::move(mKalmanEstimators.at(id));
+  auto const trackedFrames = mKalmanEstimators.slotFor(id).trackedFrames;
+
+  mSuspendedKalmanEstimators.insert(id, std::move(mKalmanEstimators.at(id)));
   mKalmanEstimators.erase(id);
-  mNonMeasurementFrames.erase(id);
+
+  // Keep the reliability history with the suspended track
+  mSuspendedKalmanEstimators.slotFor(id).trackedFrames = trackedFrames;
+
+  // Suspended tracks are static, so one insertion keeps the hash current
+  auto const &state = mSuspendedKalmanEstimators.at(id).currentState();
+  auto const key = suspendedCellKey(state.x, state.y);
+  mSuspendedCells[key].push_back(id);
+  mSuspendedCellKeys[id] = key;
 }
 
 void TrackManager::reactivateTrack(const Id &id)
 {
-  mKalmanEstimators[id] = std::move(mSuspendedKalmanEstimators.at(id));
+  mKalmanEstimators.insert(id, std::move(mSuspendedKalmanEstimators.at(id)));
 
   // Initialize non measurement and tracked frames counters
-  mNonMeasurementFrames[id] = 0;
-  mNumberOfTrackedFrames[id] = mConfig.mMaxNumberOfUnreliableFrames - mConfig.mReactivationFrames;
+  auto &slot = mKalmanEstimators.slotFor(id);
+  slot.nonMeasurementFrames = 0;
+  slot.trackedFrames = mConfig.mMaxNumberOfUnreliableFrames - mConfig.mReactivationFrames;
 
   mSuspendedKalmanEstimators.erase(id);
-}
 
-void TrackManager::predict(const std::chrono::system_clock::time_point &timestamp)
-{
-  // Convert map to vector for parallel iteration
-  std::vector<std::reference_wrapper<MultiModelKalmanEstimator>> estimators;
-  estimators.reserve(mKalmanEstimators.size());
-
-  for (auto &element : mKalmanEstimators)
+  auto const keyEntry = mSuspendedCellKeys.find(id);
+  if (keyEntry != mSuspendedCellKeys.end())
   {
-    estimators.push_back(std::ref(element.second));
+    auto &cell = mSuspendedCells[keyEntry->second];
+    cell.erase(std::remove(cell.begin(), cell.end(), id), cell.end());
+    if (cell.empty())
+    {
+      mSuspendedCells.erase(keyEntry->second);
+    }
+    mSuspendedCellKeys.erase(keyEntry);
   }
+}
 
-  // Parallelize the prediction step
-  #pragma omp parallel for
-  for (size_t i = 0; i < estimators.size(); ++i)
+void TrackManager::applyWorkerConfig()
+{
+  if (mConfig.mWorkerThreads > 0 || mConfig.mPinWorkerThreads || mConfig.mNumaAwareWorkers)
   {
-    estimators[i].get().predict(timestamp);
+    rv::WorkerPool::instance().configure(
+      mConfig.mWorkerThreads, mConfig.mPinWorkerThreads, mConfig.mNumaAwareWorkers);
   }
-  mMeasurementMap.clear();
+  rv::WorkerPool::instance().setSerialCostFloor(mConfig.mSerialDispatchFloorNs);
+}
+
+void TrackManager::predict(const std::chrono::system_clock::time_point &timestamp)
+{
+  // Parallelize the prediction step over the dense slot array
+  rv::WorkerPool::instance().parallelFor(0, mKalmanEstimators.slotCount(), kPredictCostNs, [this, &timestamp](std::size_t i) {
+    auto &slot = mKalmanEstimators.slot(i);
+    if (slot.occupied)
+    {
+      slot.hasMeasurement = false;
+      slot.estimator.predict(timestamp);
+    }
+  });
+  clearSuspendedMeasurements();
 }
 
 
 void TrackManager::predict(double deltaT)
 {
-  // Convert map to vector for parallel iteration
-  std::vector<std::reference_wrapper<MultiModelKalmanEstimator>> estimators;
-  estimators.reserve(mKalmanEstimators.size());
+  // Prime the shared transition-matrix cache once; the parallel sweeps below
+  // only read the primed frame
+  TransitionMatrixCache::instance().prime(deltaT);
+
+  // Phase 1: IMM interaction and sigma-point generation per track; the
+  // nonlinear CTRV model propagates its points here as well
+  rv::WorkerPool::instance().parallelFor(0, mKalmanEstimators.slotCount(), kSigmaStageCostNs, [this, deltaT](std::size_t i) {
+    auto &slot = mKalmanEstimators.slot(i);
+    if (!slot.occupied)
+    {
+      return;
+    }
+
+    slot.hasMeasurement = false;
+    slot.estimator.beginBatchedPredict();
+    for (std::size_t model = 0; model < slot.estimator.modelCount(); ++model)
+    {
+      if (slot.estimator.motionModel(model) == MotionModel::CTRV)
+      {
+        slot.estimator.propagateModel(model, deltaT);
+      }
+    }
+  });
+
+  // Phase 2: propagate all tracks' sigma points per linear model with one
+  // bulk multiply instead of thousands of tiny per-sigma-point operations
+  batchedPropagate(MotionModel::CV, deltaT);
+  batchedPropagate(MotionModel::CA, deltaT);
+  batchedPropagate(MotionModel::CP, deltaT);
+
+  // Phase 3: fold the propagated points back into the combined estimates
+  rv::WorkerPool::instance().parallelFor(0, mKalmanEstimators.slotCount(), kSigmaStageCostNs, [this, deltaT](std::size_t i) {
+    auto &slot = mKalmanEstimators.slot(i);
+    if (slot.occupied)
+    {
+      slot.estimator.finishBatchedPredict(deltaT);
+    }
+  });
+
+  clearSuspendedMeasurements();
+}
 
-  for (auto &element : mKalmanEstimators)
+void TrackManager::batchedPropagate(MotionModel model, double deltaT)
+{
+  std::vector<std::pair<std::size_t, std::size_t>> slotAndModel;
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
   {
-    estimators.push_back(std::ref(element.second));
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (!slot.occupied)
+    {
+      continue;
+    }
+    for (std::size_t m = 0; m < slot.estimator.modelCount(); ++m)
+    {
+      if (slot.estimator.motionModel(m) == model && slot.estimator.isModelActive(m))
+      {
+        slotAndModel.push_back({i, m});
+      }
+    }
+  }
+  if (slotAndModel.empty())
+  {
+    return;
   }
 
-  // Parallelize the prediction step
-  #pragma omp parallel for
-  for (size_t i = 0; i < estimators.size(); ++i)
+  auto const transition = TransitionMatrixCache::instance().transition(model, deltaT);
+  if (!transition)
   {
-    estimators[i].get().predict(deltaT);
+    // No cached matrix for this deltaT; propagate per model as before
+    rv::WorkerPool::instance().parallelFor(0, slotAndModel.size(), kSigmaStageCostNs, [this, deltaT, &slotAndModel](std::size_t k) {
+      auto const &entry = slotAndModel[k];
+      mKalmanEstimators.slot(entry.first).estimator.propagateModel(entry.second, deltaT);
+    });
+    return;
   }
 
-  mMeasurementMap.clear();
+  auto const &firstPoints =
+    mKalmanEstimators.slot(slotAndModel.front().first).estimator.modelSigmaPoints(slotAndModel.front().second);
+  const int stateSize = firstPoints.rows;
+  const int pointsPerTrack = firstPoints.cols;
+
+  // Gather every track's sigma points into one contiguous matrix
+  cv::Mat gathered(stateSize, pointsPerTrack * static_cast<int>(slotAndModel.size()), CV_64F);
+  rv::WorkerPool::instance().parallelFor(0, slotAndModel.size(), kGatherScatterCostNs, [this, &slotAndModel, &gathered, pointsPerTrack](std::size_t k) {
+    auto const &entry = slotAndModel[k];
+    auto const &points = mKalmanEstimators.slot(entry.first).estimator.modelSigmaPoints(entry.second);
+    points.copyTo(gathered.colRange(static_cast<int>(k) * pointsPerTrack, (static_cast<int>(k) + 1) * pointsPerTrack));
+  });
+
+  // One bulk propagation for the whole model; the process noise vector in the
+  // per-point path is zero, so this matches the scalar propagation exactly
+  cv::Mat propagated;
+  cv::gemm(*transition, gathered, 1.0, cv::noArray(), 0.0, propagated);
+
+  // Scatter the propagated points back into each filter
+  rv::WorkerPool::instance().parallelFor(0, slotAndModel.size(), kGatherScatterCostNs, [this, &slotAndModel, &propagated, pointsPerTrack](std::size_t k) {
+    auto const &entry = slotAndModel[k];
+    auto &values = mKalmanEstimators.slot(entry.first).estimator.modelTransitionValues(entry.second);
+    propagated.colRange(static_cast<int>(k) * pointsPerTrack, (static_cast<int>(k) + 1) * pointsPerTrack).copyTo(values);
+  });
 }
 
 void TrackManager::correct()
 {
-  // Convert map to vector for parallel iteration
-  std::vector<std::pair<Id, std::reference_wrapper<MultiModelKalmanEstimator>>> estimators;
-  estimators.reserve(mKalmanEstimators.size());
-
-  for (auto &element : mKalmanEstimators)
-  {
-    estimators.push_back(std::make_pair(element.first, std::ref(element.second)));
-  }
-
-  // Parallelize the correction step
-  #pragma omp parallel for
-  for (size_t i = 0; i < estimators.size(); ++i)
-  {
-    auto const &id = estimators[i].first;
-    auto &estimator = estimators[i].second.get();
-
-    if (mMeasurementMap.count(id))
+  // Parallelize the correction step over the dense slot array; the lifecycle
+  // counters live in the slot, so each task only touches its own record
+  rv::WorkerPool::instance().parallelFor(0, mKalmanEstimators.slotCount(), kCorrectCostNs, [this](std::size_t i) {
+    auto &slot = mKalmanEstimators.slot(i);
+    if (!slot.occupied)
     {
-      auto const measurement = mMeasurementMap.find(id);
-      estimator.correct(measurement->second);
+      return;
     }
-  }
 
-  // Update counters sequentially to avoid race conditions
-  for (auto &element : mKalmanEstimators)
-  {
-    auto const &id = element.first;
-    if (mMeasurementMap.count(id))
+    if (slot.hasMeasurement)
     {
-      // Reset non measurement frames counter, increment tracked frames
-      mNonMeasurementFrames[id] = 0;
-      mNumberOfTrackedFrames[id]++;
+      slot.estimator.correct(slot.measurement);
+      slot.nonMeasurementFrames = 0;
+      slot.trackedFrames++;
     }
     else
     {
-      mNonMeasurementFrames[id]++;
+      slot.nonMeasurementFrames++;
     }
-  }
+  });
 
-  std::vector<Id> reactivationList;
-  for (auto &element : mSuspendedKalmanEstimators)
+  std::vector<std::pair<Id, TrackedObject>> reactivationList;
+  for (std::size_t i = 0; i < mSuspendedKalmanEstimators.slotCount(); ++i)
   {
-    if (mMeasurementMap.count(element.first) > 0)
+    auto const &slot = mSuspendedKalmanEstimators.slot(i);
+    if (slot.occupied && slot.hasMeasurement)
     {
-      reactivationList.push_back(element.first);
+      reactivationList.push_back({slot.id, slot.measurement});
     }
   }
-  for (const auto &id : reactivationList)
+  for (const auto &entry : reactivationList)
   {
-    reactivateTrack(id);
-    mKalmanEstimators[id].correct(mMeasurementMap[id]);
+    reactivateTrack(entry.first);
+    mKalmanEstimators.at(entry.first).correct(entry.second);
   }
 
   std::vector<Id> deletionList;
   std::vector<Id> suspendList;
 
-  // Check no longer valid states and delete accordingly
-  for (const auto &element : mNonMeasurementFrames)
+  // Check no longer valid states and delete accordingly; a single linear
+  // sweep over the slot array with no id hashing
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
   {
-    auto const &id = element.first;
-    auto const &nonmeasurementFrames = element.second;
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (!slot.occupied)
+    {
+      continue;
+    }
 
-    if (isReliable(id))
+    auto const reliable = slot.trackedFrames >= mConfig.mMaxNumberOfUnreliableFrames;
+    if (reliable)
     {
-      uint32_t maxNonMeasurementFrames = 0;
       // let static objects stay longer
-      if (mKalmanEstimators[id].currentState().isDynamic())
+      if (slot.estimator.currentState().isDynamic())
       {
-        if (nonmeasurementFrames > mConfig.mNonMeasurementFramesDynamic)
+        if (slot.nonMeasurementFrames > mConfig.mNonMeasurementFramesDynamic)
         {
-          deletionList.push_back(id);
+          deletionList.push_back(slot.id);
         }
       }
       else
       {
-        if (nonmeasurementFrames > mConfig.mNonMeasurementFramesStatic)
+        if (slot.nonMeasurementFrames > mConfig.mNonMeasurementFramesStatic)
         {
-          suspendList.push_back(id);
+          suspendList.push_back(slot.id);
         }
       }
     }
     else
     {
-      if (nonmeasurementFrames > mConfig.mNonMeasurementFramesDynamic)
+      if (slot.nonMeasurementFrames > mConfig.mNonMeasurementFramesDynamic)
       {
-        deletionList.push_back(id);
+        deletionList.push_back(slot.id);
       }
     }
   }
@@ -196,20 +386,128 @@ void TrackManager::correct()
   {
     suspendTrack(id);
   }
+
+  recordTrackHistories();
+  publishSnapshot();
 }
 
-std::vector<TrackedObject> TrackManager::getTracks()
+void TrackManager::recordTrackHistories()
 {
-  std::vector<TrackedObject> tracks;
+  if (mConfig.mTrackHistoryCapacity == 0)
+  {
+    return;
+  }
 
-  for (const auto &element : mKalmanEstimators)
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
   {
-    tracks.push_back(element.second.currentState());
+    auto &slot = mKalmanEstimators.slot(i);
+    if (!slot.occupied)
+    {
+      continue;
+    }
+
+    auto history = mTrackHistories.find(slot.id);
+    if (history == mTrackHistories.end())
+    {
+      history = mTrackHistories.emplace(slot.id, TrackHistory(mConfig.mTrackHistoryCapacity)).first;
+    }
+
+    auto const &state = slot.estimator.currentState();
+    history->second.append(TrackHistorySample{
+      slot.estimator.getTimestamp(), state.x, state.y, state.z, state.vx, state.vy, state.yaw});
   }
-  for (const auto &element : mSuspendedKalmanEstimators)
+}
+
+std::vector<TrackHistorySample> TrackManager::getTrackHistory(const Id &id) const
+{
+  auto history = mTrackHistories.find(id);
+  if (history == mTrackHistories.end())
   {
-    tracks.push_back(element.second.currentState());
+    return {};
   }
+  return history->second.samples();
+}
+
+void TrackManager::publishSnapshot()
+{
+  auto &buffer = mSnapshotBuffers[mNextSnapshotBuffer];
+  // reuse the inactive buffer unless a reader still holds it from an earlier
+  // publication
+  if (!buffer || buffer.use_count() > 1)
+  {
+    buffer = std::make_shared<TrackSnapshot>();
+  }
+  mNextSnapshotBuffer = 1 - mNextSnapshotBuffer;
+
+  buffer->version = ++mSnapshotVersion;
+  buffer->timestamp = mFrameTimestamp;
+  buffer->tracks.clear();
+  buffer->tracks.reserve(mKalmanEstimators.size() + mSuspendedKalmanEstimators.size());
+  mKalmanEstimators.forEach([&buffer](const Id &, const MultiModelKalmanEstimator &estimator) {
+    buffer->tracks.push_back(estimator.currentState());
+  });
+  mSuspendedKalmanEstimators.forEach([&buffer](const Id &, const MultiModelKalmanEstimator &estimator) {
+    buffer->tracks.push_back(estimator.currentState());
+  });
+
+  std::atomic_store_explicit(
+    &mPublishedSnapshot, std::shared_ptr<const TrackSnapshot>(buffer), std::memory_order_release);
+}
+
+std::shared_ptr<const TrackSnapshot> TrackManager::getTrackSnapshot() const
+{
+  return std::atomic_load_explicit(&mPublishedSnapshot, std::memory_order_acquire);
+}
+
+std::shared_ptr<const TrackSnapshot> TrackManager::predictTo(const std::chrono::system_clock::time_point &timestamp) const
+{
+  auto snapshot = getTrackSnapshot();
+  if (!snapshot)
+  {
+    return snapshot;
+  }
+
+  auto const deltaT = rv::toSeconds(timestamp - snapshot->timestamp);
+  if (deltaT <= 0.)
+  {
+    return snapshot;
+  }
+
+  auto extrapolated = std::make_shared<TrackSnapshot>();
+  extrapolated->version = snapshot->version;
+  extrapolated->timestamp = timestamp;
+  extrapolated->tracks = snapshot->tracks;
+  for (auto &track : extrapolated->tracks)
+  {
+    track.x += track.vx * deltaT + 0.5 * track.ax * deltaT * deltaT;
+    track.y += track.vy * deltaT + 0.5 * track.ay * deltaT * deltaT;
+    track.vx += track.ax * deltaT;
+    track.vy += track.ay * deltaT;
+    track.previousYaw = track.yaw;
+    track.yaw += track.w * deltaT;
+  }
+  return extrapolated;
+}
+
+void TrackManager::clearSuspendedMeasurements()
+{
+  for (std::size_t i = 0; i < mSuspendedKalmanEstimators.slotCount(); ++i)
+  {
+    mSuspendedKalmanEstimators.slot(i).hasMeasurement = false;
+  }
+}
+
+std::vector<TrackedObject> TrackManager::getTracks()
+{
+  std::vector<TrackedObject> tracks;
+  tracks.reserve(mKalmanEstimators.size() + mSuspendedKalmanEstimators.size());
+
+  mKalmanEstimators.forEach([&tracks](const Id &, const MultiModelKalmanEstimator &estimator) {
+    tracks.push_back(estimator.currentState());
+  });
+  mSuspendedKalmanEstimators.forEach([&tracks](const Id &, const MultiModelKalmanEstimator &estimator) {
+    tracks.push_back(estimator.currentState());
+  });
 
   return tracks;
 }
@@ -218,11 +516,12 @@ std::vector<TrackedObject> TrackManager::getReliableTracks()
 {
   std::vector<TrackedObject> tracks;
 
-  for (const auto &element : mKalmanEstimators)
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
   {
-    if (isReliable(element.first))
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (slot.occupied && slot.trackedFrames >= mConfig.mMaxNumberOfUnreliableFrames)
     {
-      tracks.push_back(element.second.currentState());
+      tracks.push_back(slot.estimator.currentState());
     }
   }
 
@@ -234,11 +533,12 @@ std::vector<TrackedObject> TrackManager::getUnreliableTracks()
 {
   std::vector<TrackedObject> tracks;
 
-  for (const auto &element : mKalmanEstimators)
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
   {
-    if (!isReliable(element.first))
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (slot.occupied && slot.trackedFrames < mConfig.mMaxNumberOfUnreliableFrames)
     {
-      tracks.push_back(element.second.currentState());
+      tracks.push_back(slot.estimator.currentState());
     }
   }
 
@@ -248,11 +548,11 @@ std::vector<TrackedObject> TrackManager::getUnreliableTracks()
 std::vector<TrackedObject> TrackManager::getSuspendedTracks()
 {
   std::vector<TrackedObject> tracks;
+  tracks.reserve(mSuspendedKalmanEstimators.size());
 
-  for (const auto &element : mSuspendedKalmanEstimators)
-  {
-    tracks.push_back(element.second.currentState());
-  }
+  mSuspendedKalmanEstimators.forEach([&tracks](const Id &, const MultiModelKalmanEstimator &estimator) {
+    tracks.push_back(estimator.currentState());
+  });
 
   return tracks;
 }
@@ -261,11 +561,108 @@ std::vector<TrackedObject> TrackManager::getDriftingTracks()
 {
   std::vector<TrackedObject> tracks;
 
-  for (const auto &element : mKalmanEstimators)
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
+  {
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (slot.occupied && slot.trackedFrames >= mConfig.mMaxNumberOfUnreliableFrames
+        && slot.nonMeasurementFrames > mConfig.mNonMeasurementFramesDynamic / 2)
+    {
+      tracks.push_back(slot.estimator.currentState());
+    }
+  }
+
+  return tracks;
+}
+
+TrackView TrackManager::getReliableTrackView(std::pmr::memory_resource *resource)
+{
+  TrackView tracks{resource};
+
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
+  {
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (slot.occupied && slot.trackedFrames >= mConfig.mMaxNumberOfUnreliableFrames)
+    {
+      tracks.push_back(&slot.estimator.currentState());
+    }
+  }
+
+  return tracks;
+}
+
+TrackView TrackManager::getUnreliableTrackView(std::pmr::memory_resource *resource)
+{
+  TrackView tracks{resource};
+
+  for (std::size_t i = 0; i < mKalmanEstimators.slotCount(); ++i)
   {
-    if (isReliable(element.first) && (mNonMeasurementFrames[element.first] > mConfig.mNonMeasurementFramesDynamic / 2))
+    auto const &slot = mKalmanEstimators.slot(i);
+    if (slot.occupied && slot.trackedFrames < mConfig.mMaxNumberOfUnreliableFrames)
     {
-      tracks.push_back(element.second.currentState());
+      tracks.push_back(&slot.estimator.currentState());
+    }
+  }
+
+  return tracks;
+}
+
+TrackView TrackManager::getSuspendedTrackView(std::pmr::memory_resource *resource)
+{
+  TrackView tracks{resource};
+  tracks.reserve(mSuspendedKalmanEstimators.size());
+
+  mSuspendedKalmanEstimators.forEach([&tracks](const Id &, const MultiModelKalmanEstimator &estimator) {
+    tracks.push_back(&estimator.currentState());
+  });
+
+  return tracks;
+}
+
+TrackView TrackManager::getSuspendedTrackViewNear(const TrackView &detections,
+                                                  double radius,
+                                                  std::pmr::memory_resource *resource)
+{
+  TrackView tracks{resource};
+  if (mSuspendedKalmanEstimators.size() == 0)
+  {
+    return tracks;
+  }
+
+  auto const radiusSquared = radius * radius;
+  for (auto const *detection : detections)
+  {
+    auto const minCellX = static_cast<std::int32_t>(std::floor((detection->x - radius) / kSuspendedCellSize));
+    auto const maxCellX = static_cast<std::int32_t>(std::floor((detection->x + radius) / kSuspendedCellSize));
+    auto const minCellY = static_cast<std::int32_t>(std::floor((detection->y - radius) / kSuspendedCellSize));
+    auto const maxCellY = static_cast<std::int32_t>(std::floor((detection->y + radius) / kSuspendedCellSize));
+
+    for (auto cellX = minCellX; cellX <= maxCellX; ++cellX)
+    {
+      for (auto cellY = minCellY; cellY <= maxCellY; ++cellY)
+      {
+        auto const key =
+          (static_cast<std::int64_t>(cellX) << 32) | static_cast<std::int64_t>(static_cast<std::uint32_t>(cellY));
+        auto const cell = mSuspendedCells.find(key);
+        if (cell == mSuspendedCells.end())
+        {
+          continue;
+        }
+
+        for (auto const &id : cell->second)
+        {
+          auto const &state = mSuspendedKalmanEstimators.at(id).currentState();
+          auto const deltaX = state.x - detection->x;
+          auto const deltaY = state.y - detection->y;
+          if (deltaX * deltaX + deltaY * deltaY > radiusSquared)
+          {
+            continue;
+          }
+          if (std::find(tracks.begin(), tracks.end(), &state) == tracks.end())
+          {
+            tracks.push_back(&state);
+          }
+        }
+      }
     }
   }
 
@@ -274,52 +671,110 @@ std::vector<TrackedObject> TrackManager::getDriftingTracks()
 
 void TrackManager::setMeasurement(const Id &id, const TrackedObject &measurement)
 {
-  auto previousMeasurement = mMeasurementMap.find(id);
-  if (previousMeasurement != mMeasurementMap.end())
+  if (mKalmanEstimators.contains(id))
   {
-    mMeasurementMap[id] = measurement;
+    auto &slot = mKalmanEstimators.slotFor(id);
+    slot.measurement = measurement;
+    slot.hasMeasurement = true;
   }
-  else
+  else if (mSuspendedKalmanEstimators.contains(id))
   {
-    mMeasurementMap.insert(std::make_pair(id, measurement));
+    auto &slot = mSuspendedKalmanEstimators.slotFor(id);
+    slot.measurement = measurement;
+    slot.hasMeasurement = true;
   }
 }
 
+std::size_t TrackManager::setMeasurements(std::vector<TrackedObject> &measurements)
+{
+  std::size_t unmatchedCount = 0;
+  for (std::size_t i = 0; i < measurements.size(); ++i)
+  {
+    auto *slot = mKalmanEstimators.findSlot(measurements[i].id);
+    if (slot == nullptr)
+    {
+      slot = mSuspendedKalmanEstimators.findSlot(measurements[i].id);
+    }
+
+    if (slot != nullptr)
+    {
+      slot->measurement = std::move(measurements[i]);
+      slot->hasMeasurement = true;
+    }
+    else if (unmatchedCount++ != i)
+    {
+      // compact the unmatched objects to the front, keeping their order so
+      // auto-generated ids stay deterministic when the caller creates tracks
+      measurements[unmatchedCount - 1] = std::move(measurements[i]);
+    }
+  }
+
+  return unmatchedCount;
+}
+
 TrackedObject TrackManager::getTrack(const Id &id)
 {
-  return getKalmanEstimator(id).currentState();
+  return kalmanEstimator(id).currentState();
 }
 
-MultiModelKalmanEstimator TrackManager::getKalmanEstimator(const Id &id)
+bool TrackManager::tryGetTrack(const Id &id, TrackedObject &track) const
 {
-  if (mKalmanEstimators.count(id) > 0)
+  auto const *slot = mKalmanEstimators.findSlot(id);
+  if (slot == nullptr)
   {
-    return mKalmanEstimators[id];
+    slot = mSuspendedKalmanEstimators.findSlot(id);
   }
-  else if(mSuspendedKalmanEstimators.count(id) > 0)
+  if (slot == nullptr)
   {
-    return mSuspendedKalmanEstimators[id];
+    return false;
   }
-  else
+
+  track = slot->estimator.currentState();
+  return true;
+}
+
+MultiModelKalmanEstimator TrackManager::getKalmanEstimator(const Id &id)
+{
+  return kalmanEstimator(id);
+}
+
+const MultiModelKalmanEstimator &TrackManager::kalmanEstimator(const Id &id) const
+{
+  auto const *slot = mKalmanEstimators.findSlot(id);
+  if (slot == nullptr)
+  {
+    slot = mSuspendedKalmanEstimators.findSlot(id);
+  }
+  if (slot == nullptr)
   {
     throw std::runtime_error("The given id is not registered in this TrackManager.");
   }
+
+  return slot->estimator;
 }
 
 
 bool TrackManager::hasId(const Id &id)
 {
-  return (mKalmanEstimators.count(id) > 0) || (mSuspendedKalmanEstimators.count(id) > 0);
+  return mKalmanEstimators.contains(id) || mSuspendedKalmanEstimators.contains(id);
 }
 
 bool TrackManager::isReliable(const Id &id)
 {
-  return mNumberOfTrackedFrames[id] >= mConfig.mMaxNumberOfUnreliableFrames;
+  if (mKalmanEstimators.contains(id))
+  {
+    return mKalmanEstimators.slotFor(id).trackedFrames >= mConfig.mMaxNumberOfUnreliableFrames;
+  }
+  if (mSuspendedKalmanEstimators.contains(id))
+  {
+    return mSuspendedKalmanEstimators.slotFor(id).trackedFrames >= mConfig.mMaxNumberOfUnreliableFrames;
+  }
+  return false;
 }
 
 bool TrackManager::isSuspended(const Id &id)
 {
-  return mSuspendedKalmanEstimators.count(id) > 0;
+  return mSuspendedKalmanEstimators.contains(id);
 }
 
 void TrackManager::updateTrackerConfig(int camera_frame_rate)
@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rv/tracking/TrackSerialization.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace rv {
+namespace tracking {
+
+namespace {
+
+std::size_t serializedSize(const TrackedObject &track)
+{
+  std::size_t size = sizeof(TrackRecordCore);
+  size += sizeof(uint32_t) + static_cast<std::size_t>(track.classification.size()) * sizeof(double);
+  size += sizeof(uint32_t);
+  track.attributes.forEach([&size](const std::string &key, const std::string &value) {
+    size += 2 * sizeof(uint32_t) + key.size() + value.size();
+  });
+  return size;
+}
+
+uint8_t *writeBytes(uint8_t *cursor, const void *data, std::size_t size)
+{
+  std::memcpy(cursor, data, size);
+  return cursor + size;
+}
+
+uint8_t *writeTrack(uint8_t *cursor, const TrackedObject &track)
+{
+  TrackRecordCore core;
+  core.id = track.id;
+  core.corrected = track.corrected ? 1 : 0;
+  core.x = track.x;
+  core.y = track.y;
+  core.z = track.z;
+  core.vx = track.vx;
+  core.vy = track.vy;
+  core.ax = track.ax;
+  core.ay = track.ay;
+  core.yaw = track.yaw;
+  core.previousYaw = track.previousYaw;
+  core.w = track.w;
+  core.length = track.length;
+  core.width = track.width;
+  core.height = track.height;
+  cursor = writeBytes(cursor, &core, sizeof(core));
+
+  auto const classCount = static_cast<uint32_t>(track.classification.size());
+  cursor = writeBytes(cursor, &classCount, sizeof(classCount));
+  cursor = writeBytes(cursor, track.classification.data(), classCount * sizeof(double));
+
+  auto const attributeCount = static_cast<uint32_t>(track.attributes.size());
+  cursor = writeBytes(cursor, &attributeCount, sizeof(attributeCount));
+  track.attributes.forEach([&cursor](const std::string &key, const std::string &value) {
+    auto const keySize = static_cast<uint32_t>(key.size());
+    auto const valueSize = static_cast<uint32_t>(value.size());
+    cursor = writeBytes(cursor, &keySize, sizeof(keySize));
+    cursor = writeBytes(cursor, key.data(), keySize);
+    cursor = writeBytes(cursor, &valueSize, sizeof(valueSize));
+    cursor = writeBytes(cursor, value.data(), valueSize);
+  });
+
+  return cursor;
+}
+
+void serializeWithHeader(const TrackedObject *tracks,
+                         std::size_t trackCount,
+                         TrackBlobHeader header,
+                         std::vector<uint8_t> &buffer)
+{
+  // Size pre-pass so the buffer is resized exactly once
+  std::size_t payloadSize = sizeof(TrackBlobHeader);
+  for (std::size_t i = 0; i < trackCount; ++i)
+  {
+    payloadSize += serializedSize(tracks[i]);
+  }
+
+  header.trackCount = trackCount;
+  buffer.resize(payloadSize);
+
+  auto *cursor = writeBytes(buffer.data(), &header, sizeof(header));
+  for (std::size_t i = 0; i < trackCount; ++i)
+  {
+    cursor = writeTrack(cursor, tracks[i]);
+  }
+}
+
+const uint8_t *readBytes(const uint8_t *cursor, const uint8_t *end, void *data, std::size_t size)
+{
+  if (static_cast<std::size_t>(end - cursor) < size)
+  {
+    throw std::runtime_error("truncated track blob");
+  }
+  std::memcpy(data, cursor, size);
+  return cursor + size;
+}
+
+} // namespace
+
+void serializeTracks(const TrackedObject *tracks, std::size_t trackCount, std::vector<uint8_t> &buffer)
+{
+  serializeWithHeader(tracks, trackCount, TrackBlobHeader{}, buffer);
+}
+
+void serializeTracks(const TrackSnapshot &snapshot, std::vector<uint8_t> &buffer)
+{
+  TrackBlobHeader header;
+  header.snapshotVersion = snapshot.version;
+  header.timestampMicroseconds =
+    std::chrono::duration_cast<std::chrono::microseconds>(snapshot.timestamp.time_since_epoch()).count();
+  serializeWithHeader(snapshot.tracks.data(), snapshot.tracks.size(), header, buffer);
+}
+
+std::vector<TrackedObject> deserializeTracks(const uint8_t *data, std::size_t size)
+{
+  auto const *cursor = data;
+  auto const *end = data + size;
+
+  TrackBlobHeader header;
+  cursor = readBytes(cursor, end, &header, sizeof(header));
+  if (header.magic != kTrackBlobMagic || header.version != kTrackBlobVersion)
+  {
+    throw std::runtime_error("not a track blob (bad magic/version)");
+  }
+
+  std::vector<TrackedObject> tracks;
+  tracks.reserve(header.trackCount);
+  for (uint64_t i = 0; i < header.trackCount; ++i)
+  {
+    TrackRecordCore core;
+    cursor = readBytes(cursor, end, &core, sizeof(core));
+
+    TrackedObject track;
+    track.id = core.id;
+    track.corrected = core.corrected != 0;
+    track.x = core.x;
+    track.y = core.y;
+    track.z = core.z;
+    track.vx = core.vx;
+    track.vy = core.vy;
+    track.ax = core.ax;
+    track.ay = core.ay;
+    track.yaw = core.yaw;
+    track.previousYaw = core.previousYaw;
+    track.w = core.w;
+    track.length = core.length;
+    track.width = core.width;
+    track.height = core.height;
+
+    uint32_t classCount = 0;
+    cursor = readBytes(cursor, end, &classCount, sizeof(classCount));
+    track.classification = Classification(classCount);
+    cursor = readBytes(cursor, end, track.classification.data(), classCount * sizeof(double));
+
+    uint32_t attributeCount = 0;
+    cursor = readBytes(cursor, end, &attributeCount, sizeof(attributeCount));
+    for (uint32_t j = 0; j < attributeCount; ++j)
+    {
+      uint32_t keySize = 0;
+      cursor = readBytes(cursor, end, &keySize, sizeof(keySize));
+      std::string key(keySize, '\0');
+      cursor = readBytes(cursor, end, key.data(), keySize);
+
+      uint32_t valueSize = 0;
+      cursor = readBytes(cursor, end, &valueSize, sizeof(valueSize));
+      std::string value(valueSize, '\0');
+      cursor = readBytes(cursor, end, value.data(), valueSize);
+
+      track.attributes.set(key, std::move(value));
+    }
+
+    tracks.push_back(std::move(track));
+  }
+
+  return tracks;
+}
+
+} // namespace tracking
+} // namespace rv
@@ -18,29 +18,23 @@ void TrackTracker::track(std::vector<tracking::TrackedObject> trackedObjects, co
     mLastTimestamp = timestamp;
     return;
   }
-  std::vector<tracking::TrackedObject> tracks; // temporary vector used to hold the tracks at every match stage
-
   // 1. - Predict
   mTrackManager.predict(timestamp);
 
-  // 2. - Update measurements - set measurement
-  for (const auto &trackedObject : trackedObjects)
-  {
-    if (mTrackManager.hasId(trackedObject.id))
-    {
-      mTrackManager.setMeasurement(trackedObject.id, trackedObject);
-    }
-  }
+  // 2. - Update measurements - one bulk pass resolves every id once, assigns
+  // the known tracks and leaves the unmatched objects at the vector front
+  auto const unmatchedCount = mTrackManager.setMeasurements(trackedObjects);
 
   // Update measurements - Correct measurements
   mTrackManager.correct();
 
-  // 3. - Create new tracks
-  for (const auto &trackedObject : trackedObjects)
+  // 3. - Create new tracks from the unmatched objects; the hasId() guard
+  // keeps a duplicate id within one batch from spawning two tracks
+  for (std::size_t i = 0; i < unmatchedCount; ++i)
   {
-    if (!mTrackManager.hasId(trackedObject.id))
+    if (!mTrackManager.hasId(trackedObjects[i].id))
     {
-      mTrackManager.createTrack(trackedObject, timestamp);
+      mTrackManager.createTrack(std::move(trackedObjects[i]), timestamp);
     }
   }
 
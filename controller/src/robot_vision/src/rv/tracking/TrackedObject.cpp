@@ -15,10 +15,51 @@ TrackedObject::TrackedObject()
 
   predictedMeasurementMean = cv::Mat::zeros(TrackedObject::MeasurementSize, 1, CV_64F);
   predictedMeasurementCov = 1e-4 * cv::Mat::eye(TrackedObject::MeasurementSize, TrackedObject::MeasurementSize, CV_64F);
-  predictedMeasurementCovInv = 1e4 * cv::Mat::eye(TrackedObject::MeasurementSize, TrackedObject::MeasurementSize, CV_64F);
   errorCovariance = 1e-4 * cv::Mat::eye(TrackedObject::StateSize, TrackedObject::StateSize, CV_64F);
 }
 
+void TrackedObject::setPredictedMeasurementCov(cv::Mat cov)
+{
+  predictedMeasurementCov = std::move(cov);
+  predictedMeasurementCovInvValid = false;
+}
+
+const cv::Mat &TrackedObject::predictedMeasurementCovInverse() const
+{
+  if (!predictedMeasurementCovInvValid)
+  {
+    // The predicted measurement covariance is symmetric positive definite, so a
+    // Cholesky factorization is sufficient and considerably cheaper than SVD
+    predictedMeasurementCovInv = predictedMeasurementCov.inv(cv::DECOMP_CHOLESKY);
+    predictedMeasurementCovInvValid = true;
+  }
+  return predictedMeasurementCovInv;
+}
+
+Eigen::Index TrackedObject::dominantClass() const
+{
+  if (!dominantClassValid)
+  {
+    if (classification.size() == 0)
+    {
+      dominantClassIndex = -1;
+      dominantClassScore = 0.;
+    }
+    else
+    {
+      dominantClassScore = classification.maxCoeff(&dominantClassIndex);
+    }
+    dominantClassValid = true;
+  }
+  return dominantClassIndex;
+}
+
+double TrackedObject::dominantScore() const
+{
+  dominantClass();
+  return dominantClassScore;
+}
+
 std::string TrackedObject::toString() const
 {
   return "TrackedObject( id: " + std::to_string(id) + ", x:" + std::to_string(x) + ", y:" + std::to_string(y)
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rv/tracking/TrackerPool.hpp"
+
+#include <algorithm>
+
+#include "rv/WorkerPool.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace rv {
+namespace tracking {
+
+TrackerPool::TrackerPool(const TrackerPoolConfig &config)
+  : mConfig(config)
+{
+  auto const sceneCount = std::max<std::size_t>(1, config.mSceneCount);
+  mScenes.reserve(sceneCount);
+  for (std::size_t i = 0; i < sceneCount; ++i)
+  {
+    mScenes.push_back(std::make_unique<Scene>(config));
+  }
+
+  auto workerCount = config.mWorkerThreads;
+  if (workerCount == 0)
+  {
+    workerCount = std::min<std::size_t>(sceneCount, std::thread::hardware_concurrency());
+  }
+  workerCount = std::max<std::size_t>(1, std::min(workerCount, sceneCount));
+
+  mWorkers.reserve(workerCount);
+  for (std::size_t i = 0; i < workerCount; ++i)
+  {
+    mWorkers.push_back(std::make_unique<Worker>());
+  }
+
+  // scenes shard to workers by index, so one scene is always tracked by the
+  // same thread and its frames stay ordered
+  for (std::size_t i = 0; i < sceneCount; ++i)
+  {
+    workerFor(i).scenes.push_back(i);
+  }
+
+  for (std::size_t i = 0; i < workerCount; ++i)
+  {
+    auto &worker = *mWorkers[i];
+    worker.thread = std::thread([this, &worker]() { workerLoop(worker); });
+#if defined(__linux__)
+    if (config.mPinWorkerThreads)
+    {
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      CPU_SET(i % std::thread::hardware_concurrency(), &cpuSet);
+      pthread_setaffinity_np(worker.thread.native_handle(), sizeof(cpuSet), &cpuSet);
+    }
+#endif
+  }
+}
+
+TrackerPool::~TrackerPool()
+{
+  for (auto &worker : mWorkers)
+  {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    mStopping = true;
+  }
+  for (auto &worker : mWorkers)
+  {
+    worker->wake.notify_all();
+  }
+  for (auto &worker : mWorkers)
+  {
+    worker->thread.join();
+  }
+}
+
+bool TrackerPool::submit(std::size_t sceneIndex,
+                         std::vector<std::vector<TrackedObject>> objectsPerCamera,
+                         const std::chrono::system_clock::time_point &timestamp)
+{
+  auto &worker = workerFor(sceneIndex);
+  auto &scene = *mScenes[sceneIndex];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (scene.queue.size() >= mConfig.mMaxQueuedFrames)
+    {
+      return false;
+    }
+    scene.queue.push_back({std::move(objectsPerCamera), timestamp});
+  }
+  worker.wake.notify_one();
+  return true;
+}
+
+std::shared_ptr<const TrackSnapshot> TrackerPool::poll(std::size_t sceneIndex) const
+{
+  return mScenes[sceneIndex]->tracker.getTrackSnapshot();
+}
+
+std::size_t TrackerPool::pendingFrames(std::size_t sceneIndex) const
+{
+  auto const &worker = workerFor(sceneIndex);
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  return mScenes[sceneIndex]->queue.size();
+}
+
+void TrackerPool::drain()
+{
+  for (auto &worker : mWorkers)
+  {
+    std::unique_lock<std::mutex> lock(worker->mutex);
+    worker->idle.wait(lock, [this, &worker]() {
+      if (worker->activeFrames != 0)
+      {
+        return false;
+      }
+      for (auto const sceneIndex : worker->scenes)
+      {
+        if (!mScenes[sceneIndex]->queue.empty())
+        {
+          return false;
+        }
+      }
+      return true;
+    });
+  }
+}
+
+void TrackerPool::workerLoop(Worker &worker)
+{
+  // intra-scene stages (predict/correct sweeps, cost-matrix fill) run inline
+  // on this thread; the cross-scene sharding is the parallelism
+  rv::WorkerPool::markExternalWorker();
+
+  std::unique_lock<std::mutex> lock(worker.mutex);
+  std::size_t nextScene = 0;
+  while (true)
+  {
+    bool processed = false;
+    // round-robin over the worker's scenes so one busy scene cannot starve
+    // the others
+    for (std::size_t scan = 0; scan < worker.scenes.size(); ++scan)
+    {
+      auto const sceneIndex = worker.scenes[(nextScene + scan) % worker.scenes.size()];
+      auto &scene = *mScenes[sceneIndex];
+      if (scene.queue.empty())
+      {
+        continue;
+      }
+
+      Frame frame = std::move(scene.queue.front());
+      scene.queue.pop_front();
+      worker.activeFrames++;
+      nextScene = (nextScene + scan + 1) % worker.scenes.size();
+
+      lock.unlock();
+      scene.tracker.track(std::move(frame.objectsPerCamera), frame.timestamp);
+      lock.lock();
+
+      worker.activeFrames--;
+      processed = true;
+      break;
+    }
+
+    if (processed)
+    {
+      worker.idle.notify_all();
+      continue;
+    }
+
+    if (mStopping)
+    {
+      return;
+    }
+    worker.wake.wait(lock);
+  }
+}
+
+} // namespace tracking
+} // namespace rv
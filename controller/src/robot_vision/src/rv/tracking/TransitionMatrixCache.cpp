@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: (C) 2019 - 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rv/tracking/TransitionMatrixCache.hpp"
+
+namespace rv {
+namespace tracking {
+
+namespace {
+
+constexpr int kStateSize = 12;
+
+/*
+ * The state layout matches the motion models:
+ * [x, y, vx, vy, ax, ay, z, length, width, height, yaw, yawRate]
+ */
+cv::Mat constantVelocityTransition(double deltaT)
+{
+  cv::Mat transition = cv::Mat::zeros(kStateSize, kStateSize, CV_64F);
+  transition.at<double>(0, 0) = 1.;
+  transition.at<double>(0, 2) = deltaT;
+  transition.at<double>(1, 1) = 1.;
+  transition.at<double>(1, 3) = deltaT;
+  transition.at<double>(2, 2) = 1.;
+  transition.at<double>(3, 3) = 1.;
+  for (int i = 6; i <= 10; ++i)
+  {
+    transition.at<double>(i, i) = 1.;
+  }
+  return transition;
+}
+
+cv::Mat constantAccelerationTransition(double deltaT)
+{
+  cv::Mat transition = constantVelocityTransition(deltaT);
+  transition.at<double>(0, 4) = 0.5 * deltaT * deltaT;
+  transition.at<double>(1, 5) = 0.5 * deltaT * deltaT;
+  transition.at<double>(2, 4) = deltaT;
+  transition.at<double>(3, 5) = deltaT;
+  transition.at<double>(4, 4) = 1.;
+  transition.at<double>(5, 5) = 1.;
+  return transition;
+}
+
+cv::Mat constantPositionTransition()
+{
+  cv::Mat transition = cv::Mat::zeros(kStateSize, kStateSize, CV_64F);
+  transition.at<double>(0, 0) = 1.;
+  transition.at<double>(1, 1) = 1.;
+  for (int i = 6; i <= 10; ++i)
+  {
+    transition.at<double>(i, i) = 1.;
+  }
+  return transition;
+}
+
+} // namespace
+
+TransitionMatrixCache &TransitionMatrixCache::instance()
+{
+  static TransitionMatrixCache cache;
+  return cache;
+}
+
+void TransitionMatrixCache::prime(double deltaT)
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  if (mFrame && mFrame->deltaT == deltaT)
+  {
+    return;
+  }
+
+  auto frame = std::make_shared<Frame>();
+  frame->deltaT = deltaT;
+  frame->constantVelocity = constantVelocityTransition(deltaT);
+  frame->constantAcceleration = constantAccelerationTransition(deltaT);
+  frame->constantPosition = constantPositionTransition();
+  mFrame = std::move(frame);
+}
+
+cv::Mat TransitionMatrixCache::build(MotionModel model, double deltaT)
+{
+  switch (model)
+  {
+    case MotionModel::CV:
+      return constantVelocityTransition(deltaT);
+    case MotionModel::CA:
+      return constantAccelerationTransition(deltaT);
+    case MotionModel::CP:
+      return constantPositionTransition();
+    default:
+      return cv::Mat();
+  }
+}
+
+std::shared_ptr<const cv::Mat> TransitionMatrixCache::transition(MotionModel model, double deltaT) const
+{
+  std::shared_ptr<const Frame> frame;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    frame = mFrame;
+  }
+
+  if (!frame || frame->deltaT != deltaT)
+  {
+    return nullptr;
+  }
+
+  switch (model)
+  {
+    case MotionModel::CV:
+      return std::shared_ptr<const cv::Mat>(frame, &frame->constantVelocity);
+    case MotionModel::CA:
+      return std::shared_ptr<const cv::Mat>(frame, &frame->constantAcceleration);
+    case MotionModel::CP:
+      return std::shared_ptr<const cv::Mat>(frame, &frame->constantPosition);
+    default:
+      return nullptr;
+  }
+}
+
+} // namespace tracking
+} // namespace rv
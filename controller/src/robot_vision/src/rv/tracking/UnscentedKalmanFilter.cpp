@@ -5,6 +5,9 @@
 
 #include "rv/tracking/UnscentedKalmanFilter.hpp"
 
+#include <cmath>
+#include <limits>
+
 #include <opencv2/core.hpp>
 #include <opencv2/tracking/kalman_filters.hpp>
 
@@ -94,6 +97,7 @@ UnscentedKalmanFilterMod::~UnscentedKalmanFilterMod()
   gain.release();
   xyCov.release();
   yyCov.release();
+  yyCovInv.release();
 
   r.release();
   q.release();
@@ -132,8 +136,21 @@ Mat UnscentedKalmanFilterMod::getSigmaPoints(const Mat &mean, const Mat &covMatr
 Mat UnscentedKalmanFilterMod::predict(InputArray _control)
 {
   Mat control = _control.getMat();
+
+  computeSigmaPoints();
+  propagateSigmaPoints(_control);
+  return finishPredict(control.empty() ? 0. : control.at<double>(0, 0));
+}
+
+void UnscentedKalmanFilterMod::computeSigmaPoints()
+{
   // get sigma points from x* and P
   sigmaPoints = getSigmaPoints(state, errorCov, sqrt(tmpLambda));
+}
+
+void UnscentedKalmanFilterMod::propagateSigmaPoints(InputArray _control)
+{
+  Mat control = _control.getMat();
 
   // compute f-function values at sigma points
   // f_i = f(x_i, control, 0), i = 0..2*DP
@@ -144,6 +161,10 @@ Mat UnscentedKalmanFilterMod::predict(InputArray _control)
     fx = transitionSPFuncVals(Rect(i, 0, 1, DP));
     model->stateConversionFunction(x, control, q, fx);
   }
+}
+
+Mat UnscentedKalmanFilterMod::finishPredict(double /* deltaT */)
+{
   // compute the estimate of state as mean f-function value at sigma point
   // x* = SUM_{i=0}^{2*DP}( Wm[i]*f_i )
   state = transitionSPFuncVals * Wm;
@@ -194,8 +215,9 @@ Mat UnscentedKalmanFilterMod::correct(InputArray _measurement)
   xyCov = transitionSPFuncValsCenter * Wc * measurementSPFuncValsCenter.t();
 
   // compute the Kalman gain matrix
-  // K = Sxy * Syy^(-1)
-  gain = xyCov * yyCov.inv(DECOMP_SVD);
+  // K = Sxy * Syy^(-1); Syy^(-1) is kept for the IMM likelihood update
+  yyCovInv = yyCov.inv(DECOMP_SVD);
+  gain = xyCov * yyCovInv;
 
   // compute the corrected estimate of state
   // x* = x* + K*(y - y*), y - current measurement
@@ -233,6 +255,366 @@ Mat UnscentedKalmanFilterMod::getState() const
   return state.clone();
 }
 
+namespace {
+
+// R factor of the thin QR decomposition of A (rows >= cols) via Householder
+// reflections; A is overwritten. R is returned with a non-negative diagonal,
+// so R.t() is the lower Cholesky factor of A.t() * A.
+void qrUpperTriangular(Mat &A, Mat &R)
+{
+  const int rows = A.rows;
+  const int cols = A.cols;
+
+  for (int k = 0; k < cols; ++k)
+  {
+    double columnNorm = 0.;
+    for (int i = k; i < rows; ++i)
+    {
+      columnNorm += A.at<double>(i, k) * A.at<double>(i, k);
+    }
+    columnNorm = std::sqrt(columnNorm);
+    if (columnNorm < std::numeric_limits<double>::epsilon())
+    {
+      continue;
+    }
+
+    double pivot = (A.at<double>(k, k) > 0.) ? -columnNorm : columnNorm;
+    double v0 = A.at<double>(k, k) - pivot;
+    double vNormSquared = v0 * v0;
+    for (int i = k + 1; i < rows; ++i)
+    {
+      vNormSquared += A.at<double>(i, k) * A.at<double>(i, k);
+    }
+    A.at<double>(k, k) = pivot;
+
+    // reflect the remaining columns; the reflector tail lives in column k
+    // below the diagonal
+    for (int j = k + 1; j < cols; ++j)
+    {
+      double dot = v0 * A.at<double>(k, j);
+      for (int i = k + 1; i < rows; ++i)
+      {
+        dot += A.at<double>(i, k) * A.at<double>(i, j);
+      }
+      double factor = 2. * dot / vNormSquared;
+      A.at<double>(k, j) -= factor * v0;
+      for (int i = k + 1; i < rows; ++i)
+      {
+        A.at<double>(i, j) -= factor * A.at<double>(i, k);
+      }
+    }
+  }
+
+  R = Mat::zeros(cols, cols, CV_64F);
+  for (int i = 0; i < cols; ++i)
+  {
+    double sign = (A.at<double>(i, i) < 0.) ? -1. : 1.;
+    for (int j = i; j < cols; ++j)
+    {
+      R.at<double>(i, j) = sign * A.at<double>(i, j);
+    }
+  }
+}
+
+// rank-1 Cholesky update (weight > 0) or downdate (weight < 0) of the lower
+// factor L; returns false when the downdate would lose positive definiteness
+bool cholUpdate(Mat &L, const Mat &vector, double weight)
+{
+  const int n = L.rows;
+  Mat work = std::sqrt(std::abs(weight)) * vector;
+  const double sign = (weight < 0.) ? -1. : 1.;
+
+  for (int k = 0; k < n; ++k)
+  {
+    double Lkk = L.at<double>(k, k);
+    double vk = work.at<double>(k, 0);
+    double rSquared = Lkk * Lkk + sign * vk * vk;
+    if (rSquared <= 0.)
+    {
+      return false;
+    }
+    double radius = std::sqrt(rSquared);
+    double c = radius / Lkk;
+    double s = vk / Lkk;
+    L.at<double>(k, k) = radius;
+    for (int i = k + 1; i < n; ++i)
+    {
+      L.at<double>(i, k) = (L.at<double>(i, k) + sign * s * work.at<double>(i, 0)) / c;
+      work.at<double>(i, 0) = c * work.at<double>(i, 0) - s * L.at<double>(i, k);
+    }
+  }
+  return true;
+}
+
+// update L in place so L*L.t() gains weight * vector * vector.t(); when a
+// downdate is not representable (rounding pushed the factor to the PSD
+// boundary) rebuild the factor from the full matrix instead
+void applyRankUpdate(Mat &L, const Mat &vector, double weight)
+{
+  Mat attempt = L.clone();
+  if (cholUpdate(attempt, vector, weight))
+  {
+    L = attempt;
+    return;
+  }
+
+  Mat full = L * L.t() + weight * vector * vector.t();
+  Mat rebuilt = full.clone();
+  if (choleskyDecomposition<double>(full.ptr<double>(), full.step, full.rows, rebuilt.ptr<double>(), rebuilt.step))
+  {
+    L = rebuilt;
+  }
+}
+
+} // namespace
+
+SquareRootUnscentedKalmanFilterMod::SquareRootUnscentedKalmanFilterMod(const UnscentedKalmanFilterParams &params)
+{
+  alpha = params.alpha;
+  beta = params.beta;
+  k = params.k;
+
+  CV_Assert(params.DP > 0 && params.MP > 0);
+  CV_Assert(params.dataType == CV_64F);
+  DP = params.DP;
+  MP = params.MP;
+  CP = std::max(params.CP, 0);
+  dataType = params.dataType;
+
+  model = params.model;
+
+  CV_Assert(params.stateInit.cols == 1 && params.stateInit.rows == DP);
+  CV_Assert(params.errorCovInit.cols == DP && params.errorCovInit.rows == DP);
+  state = params.stateInit.clone();
+
+  // the covariances are factored once at construction; from here on only the
+  // factors are propagated
+  errorCovL = params.errorCovInit.clone();
+  choleskyDecomposition<double>(params.errorCovInit.ptr<double>(),
+                                params.errorCovInit.step,
+                                DP,
+                                errorCovL.ptr<double>(),
+                                errorCovL.step);
+
+  CV_Assert(params.processNoiseCov.cols == DP && params.processNoiseCov.rows == DP);
+  CV_Assert(params.measurementNoiseCov.cols == MP && params.measurementNoiseCov.rows == MP);
+  processNoiseL = params.processNoiseCov.clone();
+  choleskyDecomposition<double>(params.processNoiseCov.ptr<double>(),
+                                params.processNoiseCov.step,
+                                DP,
+                                processNoiseL.ptr<double>(),
+                                processNoiseL.step);
+  measurementNoiseL = params.measurementNoiseCov.clone();
+  choleskyDecomposition<double>(params.measurementNoiseCov.ptr<double>(),
+                                params.measurementNoiseCov.step,
+                                MP,
+                                measurementNoiseL.ptr<double>(),
+                                measurementNoiseL.step);
+
+  measurementEstimate = Mat::zeros(MP, 1, dataType);
+
+  q = Mat::zeros(DP, 1, dataType);
+  r = Mat::zeros(MP, 1, dataType);
+
+  gain = Mat::zeros(DP, DP, dataType);
+
+  transitionSPFuncVals = Mat::zeros(DP, 2 * DP + 1, dataType);
+  measurementSPFuncVals = Mat::zeros(MP, 2 * DP + 1, dataType);
+
+  transitionSPFuncValsCenter = Mat::zeros(DP, 2 * DP + 1, dataType);
+  measurementSPFuncValsCenter = Mat::zeros(MP, 2 * DP + 1, dataType);
+
+  lambda = alpha * alpha * (DP + k) - DP;
+  tmpLambda = lambda + DP;
+
+  double tmp2Lambda = 0.5 / tmpLambda;
+
+  Wm = tmp2Lambda * Mat::ones(2 * DP + 1, 1, dataType);
+  Wc = tmp2Lambda * Mat::eye(2 * DP + 1, 2 * DP + 1, dataType);
+
+  Wm.at<double>(0, 0) = lambda / tmpLambda;
+  Wc.at<double>(0, 0) = lambda / tmpLambda + 1.0 - alpha * alpha + beta;
+
+  sqrtWi = std::sqrt(tmp2Lambda);
+  Wc0 = Wc.at<double>(0, 0);
+}
+
+SquareRootUnscentedKalmanFilterMod::~SquareRootUnscentedKalmanFilterMod()
+{
+  state.release();
+  errorCovL.release();
+
+  processNoiseL.release();
+  measurementNoiseL.release();
+
+  measurementEstimate.release();
+
+  sigmaPoints.release();
+
+  transitionSPFuncVals.release();
+  measurementSPFuncVals.release();
+
+  transitionSPFuncValsCenter.release();
+  measurementSPFuncValsCenter.release();
+
+  Wm.release();
+  Wc.release();
+
+  gain.release();
+  xyCov.release();
+  yyCovL.release();
+
+  r.release();
+  q.release();
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::getSigmaPointsFromFactor(const Mat &mean, const Mat &covFactor, double coef)
+{
+  // x_0 = mean
+  // x_i = mean + coef * covFactor.col(i), i = 1..n
+  // x_(i+n) = mean - coef * covFactor.col(i), i = 1..n
+  //
+  // covFactor is already a Cholesky factor, so unlike the dense filter no
+  // decomposition runs here
+
+  int n = mean.rows;
+  Mat points = repeat(mean, 1, 2 * n + 1);
+
+  Mat scaledFactor = coef * covFactor;
+
+  Mat p_plus = points(Rect(1, 0, n, n));
+  Mat p_minus = points(Rect(n + 1, 0, n, n));
+
+  add(p_plus, scaledFactor, p_plus);
+  subtract(p_minus, scaledFactor, p_minus);
+
+  return points;
+}
+
+void SquareRootUnscentedKalmanFilterMod::factorFromDeviations(
+  const Mat &deviations, const Mat &noiseL, const Mat &centerDeviation, Mat &factor)
+{
+  // stack the weighted non-center deviations and the noise factor as rows of
+  // the QR input: R.t() is then the factor of their outer-product sum
+  const int n = deviations.rows;
+  const int spread = deviations.cols - 1;
+
+  Mat compound(spread + n, n, CV_64F);
+  for (int i = 1; i <= spread; ++i)
+  {
+    Mat row = compound.row(i - 1);
+    Mat(sqrtWi * deviations.col(i).t()).copyTo(row);
+  }
+  Mat noiseRows = compound(Rect(0, spread, n, n));
+  Mat(noiseL.t()).copyTo(noiseRows);
+
+  Mat upper;
+  qrUpperTriangular(compound, upper);
+  factor = upper.t();
+
+  // fold in the center deviation; its weight is negative for the usual
+  // parameter choices, making this a downdate
+  applyRankUpdate(factor, centerDeviation, Wc0);
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::predict(InputArray _control)
+{
+  Mat control = _control.getMat();
+
+  // get sigma points from x* and S
+  sigmaPoints = getSigmaPointsFromFactor(state, errorCovL, sqrt(tmpLambda));
+
+  // compute f-function values at sigma points
+  Mat x, fx;
+  for (int i = 0; i < 2 * DP + 1; i++)
+  {
+    x = sigmaPoints(Rect(i, 0, 1, DP));
+    fx = transitionSPFuncVals(Rect(i, 0, 1, DP));
+    model->stateConversionFunction(x, control, q, fx);
+  }
+
+  // compute the estimate of state as mean f-function value at sigma points
+  state = transitionSPFuncVals * Wm;
+
+  subtract(transitionSPFuncVals, repeat(state, 1, 2 * DP + 1), transitionSPFuncValsCenter);
+
+  // rebuild S from the weighted deviations and sqrt(Q)
+  factorFromDeviations(transitionSPFuncValsCenter, processNoiseL, transitionSPFuncValsCenter.col(0), errorCovL);
+
+  // redraw sigma points from x* and the predicted S for the measurement pass
+  sigmaPoints = getSigmaPointsFromFactor(state, errorCovL, sqrt(tmpLambda));
+
+  // compute h-function values at sigma points
+  Mat hx;
+  for (int i = 0; i < 2 * DP + 1; i++)
+  {
+    x = sigmaPoints(Rect(i, 0, 1, DP));
+    hx = measurementSPFuncVals(Rect(i, 0, 1, MP));
+    model->measurementFunction(x, r, hx);
+  }
+
+  measurementEstimate = measurementSPFuncVals * Wm;
+
+  subtract(measurementSPFuncVals, repeat(measurementEstimate, 1, 2 * DP + 1), measurementSPFuncValsCenter);
+
+  // rebuild Sy from the weighted deviations and sqrt(R)
+  factorFromDeviations(measurementSPFuncValsCenter, measurementNoiseL, measurementSPFuncValsCenter.col(0), yyCovL);
+
+  return state.clone();
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::correct(InputArray _measurement)
+{
+  Mat measurement = _measurement.getMat();
+
+  // compute the estimate of the covariance between x* and y*
+  xyCov = transitionSPFuncValsCenter * Wc * measurementSPFuncValsCenter.t();
+
+  // compute the Kalman gain matrix from the measurement factor:
+  // K = Sxy * (Sy*Sy.t())^(-1)
+  Mat gainT;
+  solve(yyCovL * yyCovL.t(), xyCov.t(), gainT, DECOMP_CHOLESKY);
+  gain = gainT.t();
+
+  // compute the corrected estimate of state
+  state = state + gain * (measurement - measurementEstimate);
+
+  // downdate S column by column with U = K*Sy, which is the factored form of
+  // P = P - K*Sxy.t
+  Mat U = gain * yyCovL;
+  for (int j = 0; j < MP; ++j)
+  {
+    applyRankUpdate(errorCovL, U.col(j).clone(), -1.);
+  }
+
+  return state.clone();
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::getProcessNoiseCov() const
+{
+  return processNoiseL * processNoiseL.t();
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::getMeasurementNoiseCov() const
+{
+  return measurementNoiseL * measurementNoiseL.t();
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::getMeasurementCov() const
+{
+  return yyCovL * yyCovL.t();
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::getErrorCov() const
+{
+  return errorCovL * errorCovL.t();
+}
+
+Mat SquareRootUnscentedKalmanFilterMod::getState() const
+{
+  return state.clone();
+}
+
 } // tracking
 } // cv
 }
@@ -3,8 +3,21 @@
 
 #include <gtest/gtest.h>
 #include <chrono>
+#include <cstring>
 #include <iostream>
+#include <thread>
+#include <rv/tracking/CVModel.hpp>
+#include <rv/tracking/CameraUtils.hpp>
+#include <rv/tracking/TrackSerialization.hpp>
+#include <rv/tracking/GatedComponents.hpp>
+#include <rv/WorkerPool.hpp>
+#include <rv/apollo/secure_matrix.hpp>
+#include <rv/apollo/gated_hungarian_bigraph_matcher.hpp>
+#include <rv/tracking/LinearKalmanFilter.hpp>
+#include <rv/tracking/MotionModelsT.hpp>
 #include <rv/tracking/MultipleObjectTracker.hpp>
+#include <rv/tracking/TrackerPool.hpp>
+#include <rv/tracking/ShardedSceneTracker.hpp>
 #include <rv/tracking/Classification.hpp>
 #include <rv/tracking/TrackedObject.hpp>
 
@@ -700,3 +713,1412 @@ TEST(MultipleObjectTrackerTest, SingleJumpingDetectionTracking)
     }
   }
 }
+
+TEST(TrackStoreTest, SlotReuseAndLookup)
+{
+  // The slot-map must reuse freed slots, keep slot indices stable and stay consistent
+  // with the Id lookup across create/delete churn
+  rv::tracking::TrackStore store;
+
+  auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(0));
+
+  for (rv::tracking::Id id = 1; id <= 4; ++id)
+  {
+    rv::tracking::TrackedObject object;
+    object.id = id;
+    object.x = static_cast<double>(id);
+    store.emplace(id).initialize(object, timestamp);
+  }
+
+  ASSERT_EQ(store.size(), 4);
+  ASSERT_EQ(store.slotCount(), 4);
+
+  store.erase(2);
+  store.erase(3);
+
+  ASSERT_EQ(store.size(), 2);
+  ASSERT_EQ(store.slotCount(), 4);
+  ASSERT_FALSE(store.contains(2));
+  ASSERT_TRUE(store.contains(4));
+
+  // New tracks must reuse the freed slots instead of growing the array
+  rv::tracking::TrackedObject object;
+  object.id = 5;
+  store.emplace(5).initialize(object, timestamp);
+
+  ASSERT_EQ(store.size(), 3);
+  ASSERT_EQ(store.slotCount(), 4);
+  ASSERT_EQ(store.at(5).currentState().id, 5);
+
+  std::size_t occupiedSlots = 0;
+  store.forEach([&occupiedSlots](const rv::tracking::Id &, const rv::tracking::MultiModelKalmanEstimator &) {
+    ++occupiedSlots;
+  });
+  ASSERT_EQ(occupiedSlots, 3);
+}
+
+TEST(UnscentedKalmanFilterTTest, MatchesDynamicFilterForConstantVelocityModel)
+{
+  // The fixed-size filter must reproduce the cv::Mat based UnscentedKalmanFilterMod
+  // results for the same model, noise configuration and measurement sequence
+  const int stateSize = rv::tracking::TrackedObject::StateSize;
+  const int measurementSize = rv::tracking::TrackedObject::MeasurementSize;
+
+  rv::tracking::TrackedObject object01;
+  object01.x = 1.0;
+  object01.y = 2.0;
+  object01.vx = 2.0;
+  object01.vy = 1.5;
+  object01.length = 2.0;
+  object01.width = 1.0;
+  object01.height = 2.0;
+
+  auto dynamicModel = cv::makePtr<rv::tracking::CVModel>();
+  cv::detail::tracking::UnscentedKalmanFilterParams modelParams(stateSize, measurementSize, 1, 0, 0, dynamicModel);
+  modelParams.stateInit = object01.stateVector().clone();
+  modelParams.errorCovInit = cv::Mat::eye(stateSize, stateSize, CV_64F);
+  modelParams.measurementNoiseCov = cv::Mat::eye(measurementSize, measurementSize, CV_64F) * 1e-2;
+  modelParams.processNoiseCov = cv::Mat::eye(stateSize, stateSize, CV_64F) * 1e-3;
+  modelParams.alpha = 1.0;
+  modelParams.beta = 2.0;
+  modelParams.k = 3.0 - stateSize;
+  auto dynamicFilter = cv::detail::tracking::createUnscentedKalmanFilterMod(modelParams);
+
+  rv::tracking::CVModelT fixedModel;
+  rv::tracking::TrackedObjectFilterT::StateVector stateInit;
+  for (int i = 0; i < stateSize; ++i)
+  {
+    stateInit(i) = modelParams.stateInit.at<double>(i, 0);
+  }
+  rv::tracking::TrackedObjectFilterT fixedFilter(
+    fixedModel,
+    stateInit,
+    rv::tracking::TrackedObjectFilterT::StateCovariance::Identity(),
+    rv::tracking::TrackedObjectFilterT::StateCovariance::Identity() * 1e-3,
+    rv::tracking::TrackedObjectFilterT::MeasurementCovariance::Identity() * 1e-2);
+
+  double deltaT = 0.1;
+  cv::Mat deltaTVector = cv::Mat(1, 1, CV_64F, cv::Scalar(deltaT));
+
+  for (uint32_t k = 0; k < 10; ++k)
+  {
+    auto const dynamicPrediction = dynamicFilter->predict(deltaTVector);
+    auto const &fixedPrediction = fixedFilter.predict(deltaT);
+
+    for (int i = 0; i < stateSize; ++i)
+    {
+      ASSERT_NEAR(fixedPrediction(i), dynamicPrediction.at<double>(i, 0), 1e-9);
+    }
+
+    // simulate a measurement of an object moving with velocity {2 m/s, 1.5 m/s}
+    object01.x = 1.0 + 2.0 * deltaT * static_cast<double>(k + 1);
+    object01.y = 2.0 + 1.5 * deltaT * static_cast<double>(k + 1);
+
+    auto const measurementVector = object01.measurementVector();
+    rv::tracking::TrackedObjectFilterT::MeasurementVector fixedMeasurement;
+    for (int i = 0; i < measurementSize; ++i)
+    {
+      fixedMeasurement(i) = measurementVector.at<double>(i, 0);
+    }
+
+    auto const dynamicCorrection = dynamicFilter->correct(measurementVector);
+    auto const &fixedCorrection = fixedFilter.correct(fixedMeasurement);
+
+    for (int i = 0; i < stateSize; ++i)
+    {
+      ASSERT_NEAR(fixedCorrection(i), dynamicCorrection.at<double>(i, 0), 1e-7);
+    }
+  }
+}
+
+TEST(AttributeSetTest, CopyOnWriteAndInternedLookup)
+{
+  rv::tracking::AttributeSet attributes;
+  attributes.set("category", "person");
+  attributes.set("info", "uuid-1234");
+
+  ASSERT_EQ(attributes.size(), 2u);
+  ASSERT_TRUE(attributes.contains("category"));
+  ASSERT_EQ(*attributes.find("info"), "uuid-1234");
+  ASSERT_EQ(attributes.find("missing"), nullptr);
+
+  // Copies share storage; mutating the copy must not affect the original
+  rv::tracking::AttributeSet copy = attributes;
+  copy.set("info", "uuid-5678");
+
+  ASSERT_EQ(*attributes.find("info"), "uuid-1234");
+  ASSERT_EQ(*copy.find("info"), "uuid-5678");
+
+  auto const map = copy.toMap();
+  ASSERT_EQ(map.size(), 2u);
+  ASSERT_EQ(map.at("category"), "person");
+  ASSERT_EQ(map.at("info"), "uuid-5678");
+}
+
+TEST(MultiModelKalmanEstimatorTest, ModelPruningSuspendsAndReactivates)
+{
+  // With an impossible floor every model except the most probable one must be
+  // suspended after the configured frame count, and a measurement jump far
+  // outside the innovation gate must reactivate them
+  rv::tracking::TrackedObject object01;
+  object01.x = 0.0;
+  object01.y = 0.0;
+  object01.vx = 2.0;
+  object01.vy = 1.5;
+  object01.length = 2.0;
+  object01.width = 1.0;
+  object01.height = 2.0;
+
+  auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(0));
+
+  rv::tracking::MultiModelKalmanEstimator estimator;
+  estimator.initialize(object01, timestamp, 1e-4, 1e-5);
+  estimator.setModelPruning(0.99, 2);
+
+  double deltaT = 0.1;
+
+  for (uint32_t k = 0; k < 5; ++k)
+  {
+    estimator.predict(deltaT);
+
+    object01.x = 2.0 * deltaT * static_cast<double>(k + 1);
+    object01.y = 1.5 * deltaT * static_cast<double>(k + 1);
+    estimator.correct(object01);
+  }
+
+  std::size_t activeModels = 0;
+  for (std::size_t i = 0; i < estimator.modelCount(); ++i)
+  {
+    if (estimator.isModelActive(i))
+    {
+      ++activeModels;
+    }
+  }
+  ASSERT_EQ(activeModels, 1u);
+
+  // a 50 m jump is far outside the innovation gate
+  estimator.predict(deltaT);
+  object01.x += 50.0;
+  estimator.correct(object01);
+
+  for (std::size_t i = 0; i < estimator.modelCount(); ++i)
+  {
+    ASSERT_TRUE(estimator.isModelActive(i));
+  }
+}
+
+TEST(SquareRootUnscentedKalmanFilterTest, MatchesDenseFilterForConstantVelocityModel)
+{
+  // The square-root filter propagates the Cholesky factor of the covariance;
+  // its estimates must match the dense UnscentedKalmanFilterMod for the same
+  // model, noise configuration and measurement sequence
+  const int stateSize = rv::tracking::TrackedObject::StateSize;
+  const int measurementSize = rv::tracking::TrackedObject::MeasurementSize;
+
+  rv::tracking::TrackedObject object01;
+  object01.x = 1.0;
+  object01.y = 2.0;
+  object01.vx = 2.0;
+  object01.vy = 1.5;
+  object01.length = 2.0;
+  object01.width = 1.0;
+  object01.height = 2.0;
+
+  auto model = cv::makePtr<rv::tracking::CVModel>();
+  cv::detail::tracking::UnscentedKalmanFilterParams modelParams(stateSize, measurementSize, 1, 0, 0, model);
+  modelParams.stateInit = object01.stateVector().clone();
+  modelParams.errorCovInit = cv::Mat::eye(stateSize, stateSize, CV_64F);
+  modelParams.measurementNoiseCov = cv::Mat::eye(measurementSize, measurementSize, CV_64F) * 1e-2;
+  modelParams.processNoiseCov = cv::Mat::eye(stateSize, stateSize, CV_64F) * 1e-3;
+  modelParams.alpha = 1.0;
+  modelParams.beta = 2.0;
+  modelParams.k = 3.0 - stateSize;
+
+  auto denseFilter = cv::detail::tracking::createUnscentedKalmanFilterMod(modelParams);
+  auto squareRootFilter = cv::detail::tracking::createSquareRootUnscentedKalmanFilterMod(modelParams);
+
+  double deltaT = 0.1;
+  cv::Mat deltaTVector = cv::Mat(1, 1, CV_64F, cv::Scalar(deltaT));
+
+  for (uint32_t k = 0; k < 10; ++k)
+  {
+    auto const densePrediction = denseFilter->predict(deltaTVector);
+    auto const squareRootPrediction = squareRootFilter->predict(deltaTVector);
+
+    for (int i = 0; i < stateSize; ++i)
+    {
+      ASSERT_NEAR(squareRootPrediction.at<double>(i, 0), densePrediction.at<double>(i, 0), 1e-7);
+    }
+
+    // simulate a measurement of an object moving with velocity {2 m/s, 1.5 m/s}
+    object01.x = 1.0 + 2.0 * deltaT * static_cast<double>(k + 1);
+    object01.y = 2.0 + 1.5 * deltaT * static_cast<double>(k + 1);
+
+    auto const measurementVector = object01.measurementVector();
+    auto const denseCorrection = denseFilter->correct(measurementVector);
+    auto const squareRootCorrection = squareRootFilter->correct(measurementVector);
+
+    for (int i = 0; i < stateSize; ++i)
+    {
+      ASSERT_NEAR(squareRootCorrection.at<double>(i, 0), denseCorrection.at<double>(i, 0), 1e-7);
+    }
+  }
+
+  // the reconstructed covariance must track the dense one as well
+  auto const denseCovariance = denseFilter->getErrorCov();
+  auto const squareRootCovariance = squareRootFilter->getErrorCov();
+  for (int i = 0; i < stateSize; ++i)
+  {
+    for (int j = 0; j < stateSize; ++j)
+    {
+      ASSERT_NEAR(squareRootCovariance.at<double>(i, j), denseCovariance.at<double>(i, j), 1e-7);
+    }
+  }
+}
+
+TEST(TrackManagerTest, SnapshotPublishedAtFrameEnd)
+{
+  // Every correct() must publish a versioned snapshot; snapshots held by a
+  // reader stay unchanged while newer frames are published
+  rv::tracking::TrackManager trackManager;
+
+  ASSERT_EQ(trackManager.getTrackSnapshot(), nullptr);
+
+  rv::tracking::TrackedObject object01;
+  object01.x = 1.0;
+  object01.y = 2.0;
+  object01.length = 2.0;
+  object01.width = 1.0;
+  object01.height = 2.0;
+
+  auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(0));
+  auto const id = trackManager.createTrack(object01, timestamp);
+
+  trackManager.predict(0.1);
+  object01.x = 1.2;
+  trackManager.setMeasurement(id, object01);
+  trackManager.correct();
+
+  auto const firstSnapshot = trackManager.getTrackSnapshot();
+  ASSERT_NE(firstSnapshot, nullptr);
+  ASSERT_EQ(firstSnapshot->version, 1u);
+  ASSERT_EQ(firstSnapshot->tracks.size(), 1u);
+  ASSERT_EQ(firstSnapshot->tracks[0].id, id);
+
+  double const firstX = firstSnapshot->tracks[0].x;
+
+  for (uint32_t k = 0; k < 3; ++k)
+  {
+    trackManager.predict(0.1);
+    object01.x += 0.2;
+    trackManager.setMeasurement(id, object01);
+    trackManager.correct();
+  }
+
+  auto const latestSnapshot = trackManager.getTrackSnapshot();
+  ASSERT_EQ(latestSnapshot->version, 4u);
+
+  // the reader-held snapshot was not recycled while newer frames went out
+  ASSERT_EQ(firstSnapshot->version, 1u);
+  ASSERT_EQ(firstSnapshot->tracks[0].x, firstX);
+}
+
+TEST(TrackerPoolTest, ScenesTrackConcurrentlyAndPollConsistently)
+{
+  // Each scene must be tracked independently: frames submitted per scene are
+  // processed in order and poll() returns that scene's own snapshot
+  rv::tracking::TrackerPoolConfig poolConfig;
+  poolConfig.mSceneCount = 4;
+  poolConfig.mWorkerThreads = 2;
+  poolConfig.mTrackerConfig.mMaxNumberOfUnreliableFrames = 2;
+  poolConfig.mTrackerConfig.mDefaultProcessNoise = 1e-4;
+  poolConfig.mTrackerConfig.mDefaultMeasurementNoise = 1e-5;
+
+  rv::tracking::TrackerPool pool(poolConfig);
+  ASSERT_EQ(pool.sceneCount(), 4u);
+  ASSERT_EQ(pool.workerCount(), 2u);
+
+  uint32_t const frameCount = 20;
+  double const deltaT = 0.01;
+
+  for (uint32_t k = 0; k < frameCount; ++k)
+  {
+    auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(10 * (k + 1)));
+    for (std::size_t scene = 0; scene < pool.sceneCount(); ++scene)
+    {
+      rv::tracking::TrackedObject object01;
+      // each scene tracks its own object at a scene-specific offset
+      object01.x = 10.0 * static_cast<double>(scene) + 2.0 * deltaT * static_cast<double>(k + 1);
+      object01.y = 1.5 * deltaT * static_cast<double>(k + 1);
+      object01.length = 2.0;
+      object01.width = 1.0;
+      object01.height = 2.0;
+
+      while (!pool.submit(scene, {{object01}}, timestamp))
+      {
+        // bounded queue: wait for the scene to catch up
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  pool.drain();
+
+  for (std::size_t scene = 0; scene < pool.sceneCount(); ++scene)
+  {
+    ASSERT_EQ(pool.pendingFrames(scene), 0u);
+
+    auto const snapshot = pool.poll(scene);
+    ASSERT_NE(snapshot, nullptr);
+    ASSERT_EQ(snapshot->version, static_cast<uint64_t>(frameCount));
+    ASSERT_EQ(snapshot->tracks.size(), 1u);
+    ASSERT_NEAR(snapshot->tracks[0].x, 10.0 * static_cast<double>(scene) + 2.0 * deltaT * frameCount, 0.5);
+  }
+}
+
+TEST(ObjectMatchingTest, PartitionedMatchingNeverCrossesClasses)
+{
+  // With plain Euclidean costs the nearest measurement wins regardless of
+  // class; partitioned matching must keep every assignment inside its class
+  // bucket even when a cross-class measurement is closer
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Pedestrian"});
+
+  rv::tracking::TrackedObject carTrack;
+  carTrack.x = 0.0;
+  carTrack.y = 0.0;
+  carTrack.classification = classificationData.classification("Car", 1.0);
+
+  rv::tracking::TrackedObject pedestrianTrack;
+  pedestrianTrack.x = 1.0;
+  pedestrianTrack.y = 0.0;
+  pedestrianTrack.classification = classificationData.classification("Pedestrian", 1.0);
+
+  rv::tracking::TrackedObject pedestrianMeasurement;
+  pedestrianMeasurement.x = 0.2; // closer to the car track than to its own
+  pedestrianMeasurement.y = 0.0;
+  pedestrianMeasurement.classification = classificationData.classification("Pedestrian", 1.0);
+
+  rv::tracking::TrackedObject carMeasurement;
+  carMeasurement.x = 1.2;
+  carMeasurement.y = 0.0;
+  carMeasurement.classification = classificationData.classification("Car", 1.0);
+
+  std::vector<rv::tracking::TrackedObject> tracks{carTrack, pedestrianTrack};
+  std::vector<rv::tracking::TrackedObject> measurements{pedestrianMeasurement, carMeasurement};
+
+  rv::tracking::AssignmentVector assignments;
+  rv::tracking::IndexVector unassignedTracks;
+  rv::tracking::IndexVector unassignedMeasurements;
+
+  rv::tracking::matchByClass(rv::tracking::makeTrackView(tracks), rv::tracking::makeTrackView(measurements),
+                             assignments, unassignedTracks, unassignedMeasurements,
+                             rv::tracking::DistanceType::Euclidean, 5.0);
+
+  ASSERT_EQ(assignments.size(), 2u);
+  ASSERT_TRUE(unassignedTracks.empty());
+  ASSERT_TRUE(unassignedMeasurements.empty());
+
+  for (auto const &assignment : assignments)
+  {
+    if (assignment.first == 0)
+    {
+      ASSERT_EQ(assignment.second, 1u); // car track -> car measurement
+    }
+    else
+    {
+      ASSERT_EQ(assignment.second, 0u); // pedestrian track -> pedestrian measurement
+    }
+  }
+
+  // a class with no counterpart on the other side stays unassigned
+  std::vector<rv::tracking::TrackedObject> carOnlyTracks{carTrack};
+  rv::tracking::matchByClass(rv::tracking::makeTrackView(carOnlyTracks), rv::tracking::makeTrackView(measurements),
+                             assignments, unassignedTracks, unassignedMeasurements,
+                             rv::tracking::DistanceType::Euclidean, 5.0);
+
+  ASSERT_EQ(assignments.size(), 1u);
+  ASSERT_EQ(unassignedMeasurements.size(), 1u);
+  ASSERT_EQ(unassignedMeasurements[0], 0u);
+}
+
+TEST(MultipleObjectTrackerTest, SpanIngestionMatchesVectorIngestion)
+{
+  // The span entry point must drive the same pipeline as the vector overloads
+  rv::tracking::TrackManagerConfig trackerConfig;
+  trackerConfig.mMaxNumberOfUnreliableFrames = 2;
+  trackerConfig.mDefaultProcessNoise = 1e-4;
+  trackerConfig.mDefaultMeasurementNoise = 1e-5;
+
+  rv::tracking::MultipleObjectTracker vectorTracker(trackerConfig);
+  rv::tracking::MultipleObjectTracker spanTracker(trackerConfig);
+
+  double const deltaT = 0.01;
+  for (uint32_t k = 0; k < 10; ++k)
+  {
+    auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(10 * (k + 1)));
+
+    std::vector<rv::tracking::TrackedObject> detections(2);
+    detections[0].x = 2.0 * deltaT * static_cast<double>(k + 1);
+    detections[0].y = 0.0;
+    detections[1].x = 10.0 - 2.0 * deltaT * static_cast<double>(k + 1);
+    detections[1].y = 5.0;
+    for (auto &detection : detections)
+    {
+      detection.length = 2.0;
+      detection.width = 1.0;
+      detection.height = 2.0;
+    }
+
+    vectorTracker.track(detections, timestamp);
+    spanTracker.track(detections.data(), detections.size(), timestamp);
+  }
+
+  auto const vectorTracks = vectorTracker.getReliableTracks();
+  auto spanTracks = spanTracker.getReliableTracks();
+
+  ASSERT_EQ(spanTracks.size(), vectorTracks.size());
+  ASSERT_EQ(spanTracks.size(), 2u);
+  for (size_t i = 0; i < spanTracks.size(); ++i)
+  {
+    ASSERT_NEAR(spanTracks[i].x, vectorTracks[i].x, 1e-9);
+    ASSERT_NEAR(spanTracks[i].y, vectorTracks[i].y, 1e-9);
+  }
+}
+
+TEST(MultipleObjectTrackerTest, FrameStatsCountEveryStagePerFrame)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  trackerConfig.mDefaultProcessNoise = 1e-4;
+  trackerConfig.mDefaultMeasurementNoise = 1e-5;
+
+  rv::tracking::MultipleObjectTracker tracker(trackerConfig);
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  uint32_t const frames = 5;
+  for (uint32_t k = 0; k < frames; ++k)
+  {
+    auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(10 * (k + 1)));
+
+    std::vector<rv::tracking::TrackedObject> detections(1);
+    detections[0].x = 0.02 * static_cast<double>(k + 1);
+    detections[0].y = 0.0;
+    detections[0].length = 2.0;
+    detections[0].width = 1.0;
+    detections[0].height = 2.0;
+    detections[0].classification = classificationData.classification("Car", 1.0);
+
+    tracker.track(detections, timestamp);
+  }
+
+  auto const stats = tracker.getFrameStats();
+  for (std::size_t i = 0; i < static_cast<std::size_t>(rv::tracking::TrackingStage::Count); ++i)
+  {
+    auto const &stage = stats.stages[i];
+    ASSERT_EQ(stage.count, frames);
+    ASSERT_GE(stage.minMicroseconds, 0.);
+    ASSERT_GE(stage.maxMicroseconds, stage.minMicroseconds);
+    uint64_t histogramTotal = 0;
+    for (auto const bucketCount : stage.histogram)
+    {
+      histogramTotal += bucketCount;
+    }
+    ASSERT_EQ(histogramTotal, frames);
+  }
+
+  tracker.resetFrameStats();
+  ASSERT_EQ(tracker.getFrameStats().stage(rv::tracking::TrackingStage::Predict).count, 0u);
+}
+
+TEST(MultipleObjectTrackerTest, FrameStatsSampleMemoryFootprintPerSubsystem)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  trackerConfig.mDefaultProcessNoise = 1e-4;
+  trackerConfig.mDefaultMeasurementNoise = 1e-5;
+
+  rv::tracking::MultipleObjectTracker tracker(trackerConfig);
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  for (uint32_t k = 0; k < 5; ++k)
+  {
+    auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(10 * (k + 1)));
+
+    std::vector<rv::tracking::TrackedObject> detections(2);
+    for (size_t i = 0; i < detections.size(); ++i)
+    {
+      detections[i].x = 10.0 * static_cast<double>(i) + 0.02 * static_cast<double>(k + 1);
+      detections[i].y = 0.0;
+      detections[i].length = 2.0;
+      detections[i].width = 1.0;
+      detections[i].height = 2.0;
+      detections[i].classification = classificationData.classification("Car", 1.0);
+    }
+
+    tracker.track(detections, timestamp);
+  }
+
+  auto const stats = tracker.getFrameStats();
+
+  // two live tracks hold two filter banks; the footprint is fixed per track,
+  // so current and peak coincide while the track count is stable
+  auto const &estimators = stats.memoryUsage(rv::tracking::MemorySubsystem::Estimators);
+  ASSERT_GT(estimators.currentBytes, 0u);
+  ASSERT_GE(estimators.peakBytes, estimators.currentBytes);
+
+  // the tracking thread ran the serial association passes, so its matcher
+  // scratch is populated; the snapshot buffers hold the published tracks
+  ASSERT_GT(stats.memoryUsage(rv::tracking::MemorySubsystem::MatcherScratch).currentBytes, 0u);
+  ASSERT_GT(stats.memoryUsage(rv::tracking::MemorySubsystem::Snapshots).currentBytes, 0u);
+
+  // the high-water mark survives samples that shrink
+  rv::tracking::MemoryUsage usage;
+  usage.sample(100);
+  usage.sample(40);
+  ASSERT_EQ(usage.currentBytes, 40u);
+  ASSERT_EQ(usage.peakBytes, 100u);
+
+  tracker.resetFrameStats();
+  ASSERT_EQ(tracker.getFrameStats().memoryUsage(rv::tracking::MemorySubsystem::Estimators).peakBytes, 0u);
+}
+
+TEST(MultipleObjectTrackerTest, LatencyBudgetSkipsPassesAndDefersNewTracks)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  trackerConfig.mDefaultProcessNoise = 1e-4;
+  trackerConfig.mDefaultMeasurementNoise = 1e-5;
+
+  rv::tracking::MultipleObjectTracker tracker(trackerConfig);
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  std::vector<rv::tracking::TrackedObject> detections(1);
+  detections[0].x = 1.0;
+  detections[0].y = 2.0;
+  detections[0].length = 2.0;
+  detections[0].width = 1.0;
+  detections[0].height = 2.0;
+  detections[0].classification = classificationData.classification("Car", 1.0);
+
+  // a 1 ns budget is exceeded immediately: both degradable passes are
+  // skipped and the unmatched detection's track creation is deferred
+  tracker.setFrameLatencyBudget(0.001);
+  tracker.track(detections, std::chrono::system_clock::time_point(std::chrono::milliseconds(10)));
+
+  auto stats = tracker.getFrameStats();
+  ASSERT_EQ(stats.degradedFrames, 1u);
+  ASSERT_EQ(stats.skippedLowScorePasses, 1u);
+  ASSERT_EQ(stats.skippedSuspendedPasses, 1u);
+  ASSERT_EQ(stats.deferredDetections, 1u);
+  ASSERT_TRUE(tracker.getTracks().empty());
+
+  // with the budget lifted the next frame runs all stages and creates the
+  // track the degraded frame deferred
+  tracker.setFrameLatencyBudget(0.);
+  tracker.track(detections, std::chrono::system_clock::time_point(std::chrono::milliseconds(20)));
+
+  stats = tracker.getFrameStats();
+  ASSERT_EQ(stats.degradedFrames, 1u);
+  ASSERT_EQ(stats.deferredDetections, 1u);
+  ASSERT_EQ(tracker.getTracks().size(), 1u);
+
+  tracker.resetFrameStats();
+  ASSERT_EQ(tracker.getFrameStats().degradedFrames, 0u);
+}
+
+TEST(CameraUtilsTest, BatchUndistortionMatchesPerBoxResults)
+{
+  cv::Mat intrinsics = (cv::Mat_<double>(3, 3) << 900.0, 0.0, 640.0, 0.0, 900.0, 360.0, 0.0, 0.0, 1.0);
+  cv::Mat distortion = (cv::Mat_<double>(1, 5) << 0.1, -0.05, 0.001, 0.001, 0.0);
+  rv::CameraParams params{intrinsics, distortion};
+
+  std::vector<cv::Rect2f> boxes;
+  for (int i = 0; i < 10; ++i)
+  {
+    boxes.emplace_back(100.f + 80.f * static_cast<float>(i), 50.f + 40.f * static_cast<float>(i), 60.f, 120.f);
+  }
+
+  auto batched = rv::computePixelsToMeterPlane(boxes, params);
+  ASSERT_EQ(batched.size(), boxes.size());
+  for (size_t i = 0; i < boxes.size(); ++i)
+  {
+    auto single = rv::computePixelsToMeterPlane(boxes[i], params);
+    ASSERT_NEAR(batched[i].x, single.x, 1e-6);
+    ASSERT_NEAR(batched[i].y, single.y, 1e-6);
+    ASSERT_NEAR(batched[i].width, single.width, 1e-6);
+    ASSERT_NEAR(batched[i].height, single.height, 1e-6);
+  }
+
+  // With no distortion the result is the plain pinhole normalization
+  cv::Mat zeroDistortion = cv::Mat::zeros(1, 5, CV_64F);
+  rv::CameraParams linearParams{intrinsics, zeroDistortion};
+  auto linear = rv::computePixelsToMeterPlane(boxes[0], linearParams);
+  ASSERT_NEAR(linear.x, (boxes[0].x - 640.0) / 900.0, 1e-6);
+  ASSERT_NEAR(linear.y, (boxes[0].y - 360.0) / 900.0, 1e-6);
+}
+
+TEST(ClassificationTest, FixedClassificationKernelsMatchDynamicOnes)
+{
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+  auto dynamicA = classificationData.classification("Car", 0.8);
+  auto dynamicB = classificationData.classification("Pedestrian", 0.7);
+
+  rv::tracking::FixedClassification fixedA(dynamicA);
+  rv::tracking::FixedClassification fixedB(dynamicB);
+
+  ASSERT_NEAR(rv::tracking::classification::distance(fixedA, fixedB),
+              rv::tracking::classification::distance(dynamicA, dynamicB), 1e-12);
+  ASSERT_NEAR(rv::tracking::classification::similarity(fixedA, fixedB),
+              rv::tracking::classification::similarity(dynamicA, dynamicB), 1e-12);
+
+  auto dynamicCombined = rv::tracking::classification::combine(dynamicA, dynamicB);
+  auto fixedCombined = rv::tracking::classification::combine(fixedA, fixedB);
+  ASSERT_EQ(fixedCombined.size(), static_cast<std::size_t>(dynamicCombined.size()));
+  for (std::size_t i = 0; i < fixedCombined.size(); ++i)
+  {
+    ASSERT_NEAR(fixedCombined[i], dynamicCombined[static_cast<Eigen::Index>(i)], 1e-12);
+  }
+
+  // The cached dominant class matches the maxCoeff scan
+  ASSERT_EQ(fixedA.dominantClass(), 0);
+  ASSERT_NEAR(fixedA.dominantScore(), 0.8, 1e-12);
+
+  rv::tracking::TrackedObject object;
+  object.classification = dynamicB;
+  object.invalidateDominantClass();
+  ASSERT_EQ(object.dominantClass(), 2);
+  ASSERT_NEAR(object.dominantScore(), 0.7, 1e-12);
+}
+
+TEST(TrackManagerTest, TrackHistoryRingBufferKeepsMostRecentSamples)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  trackerConfig.mDefaultProcessNoise = 1e-4;
+  trackerConfig.mDefaultMeasurementNoise = 1e-5;
+  trackerConfig.mTrackHistoryCapacity = 4;
+
+  rv::tracking::MultipleObjectTracker tracker(trackerConfig);
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  rv::tracking::Id trackedId = 0;
+  for (uint32_t k = 0; k < 7; ++k)
+  {
+    auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(10 * (k + 1)));
+
+    std::vector<rv::tracking::TrackedObject> detections(1);
+    detections[0].x = 0.02 * static_cast<double>(k + 1);
+    detections[0].y = 1.0;
+    detections[0].length = 2.0;
+    detections[0].width = 1.0;
+    detections[0].height = 2.0;
+    detections[0].classification = classificationData.classification("Car", 1.0);
+
+    tracker.track(detections, timestamp);
+    trackedId = tracker.getTracks().front().id;
+  }
+
+  auto history = tracker.getTrackHistory(trackedId);
+  ASSERT_EQ(history.size(), 4u);
+  for (size_t i = 1; i < history.size(); ++i)
+  {
+    ASSERT_LT(history[i - 1].timestamp, history[i].timestamp);
+  }
+  // Only the most recent samples survive the wrap
+  ASSERT_EQ(history.back().timestamp, std::chrono::system_clock::time_point(std::chrono::milliseconds(70)));
+
+  ASSERT_TRUE(tracker.getTrackHistory(trackedId + 1000).empty());
+}
+
+TEST(TrackManagerTest, PredictToExtrapolatesSnapshotWithoutTouchingState)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  trackerConfig.mDefaultProcessNoise = 1e-4;
+  trackerConfig.mDefaultMeasurementNoise = 1e-5;
+
+  rv::tracking::MultipleObjectTracker tracker(trackerConfig);
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  for (uint32_t k = 0; k < 20; ++k)
+  {
+    auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(10 * (k + 1)));
+
+    std::vector<rv::tracking::TrackedObject> detections(1);
+    detections[0].x = 0.02 * static_cast<double>(k + 1);
+    detections[0].y = 0.0;
+    detections[0].length = 2.0;
+    detections[0].width = 1.0;
+    detections[0].height = 2.0;
+    detections[0].classification = classificationData.classification("Car", 1.0);
+
+    tracker.track(detections, timestamp);
+  }
+
+  auto snapshot = tracker.getTrackSnapshot();
+  ASSERT_NE(snapshot, nullptr);
+  ASSERT_EQ(snapshot->tracks.size(), 1u);
+  ASSERT_EQ(snapshot->timestamp, std::chrono::system_clock::time_point(std::chrono::milliseconds(200)));
+
+  auto const &track = snapshot->tracks.front();
+  auto extrapolated = tracker.predictTo(snapshot->timestamp + std::chrono::milliseconds(100));
+  ASSERT_NE(extrapolated, nullptr);
+  ASSERT_EQ(extrapolated->version, snapshot->version);
+
+  double const deltaT = 0.1;
+  auto const &future = extrapolated->tracks.front();
+  ASSERT_NEAR(future.x, track.x + track.vx * deltaT + 0.5 * track.ax * deltaT * deltaT, 1e-9);
+  ASSERT_NEAR(future.y, track.y + track.vy * deltaT + 0.5 * track.ay * deltaT * deltaT, 1e-9);
+
+  // The published snapshot and the estimator state are untouched
+  ASSERT_EQ(tracker.getTrackSnapshot(), snapshot);
+  ASSERT_NEAR(tracker.getTracks().front().x, track.x, 1e-12);
+
+  // Past timestamps return the snapshot as-is
+  ASSERT_EQ(tracker.predictTo(snapshot->timestamp - std::chrono::milliseconds(10)), snapshot);
+}
+
+TEST(LinearKalmanFilterTest, MatchesUnscentedFilterForConstantVelocityModel)
+{
+  // CV is linear, so the closed-form filter must reproduce the unscented
+  // filter's estimates for the same noise configuration and measurements
+  const int stateSize = rv::tracking::TrackedObject::StateSize;
+  const int measurementSize = rv::tracking::TrackedObject::MeasurementSize;
+
+  rv::tracking::TrackedObject object01;
+  object01.x = 1.0;
+  object01.y = 2.0;
+  object01.vx = 2.0;
+  object01.vy = 1.5;
+  object01.length = 2.0;
+  object01.width = 1.0;
+  object01.height = 2.0;
+
+  auto model = cv::makePtr<rv::tracking::CVModel>();
+  cv::detail::tracking::UnscentedKalmanFilterParams modelParams(stateSize, measurementSize, 1, 0, 0, model);
+  modelParams.stateInit = object01.stateVector().clone();
+  modelParams.errorCovInit = cv::Mat::eye(stateSize, stateSize, CV_64F);
+  modelParams.measurementNoiseCov = cv::Mat::eye(measurementSize, measurementSize, CV_64F) * 1e-2;
+  modelParams.processNoiseCov = cv::Mat::eye(stateSize, stateSize, CV_64F) * 1e-3;
+  modelParams.alpha = 1.0;
+  modelParams.beta = 2.0;
+  modelParams.k = 3.0 - stateSize;
+
+  auto unscentedFilter = cv::detail::tracking::createUnscentedKalmanFilterMod(modelParams);
+  auto linearFilter = cv::makePtr<rv::tracking::LinearKalmanFilterMod>(modelParams, rv::tracking::MotionModel::CV);
+
+  double deltaT = 0.1;
+  cv::Mat deltaTVector = cv::Mat(1, 1, CV_64F, cv::Scalar(deltaT));
+
+  for (uint32_t k = 0; k < 10; ++k)
+  {
+    auto const unscentedPrediction = unscentedFilter->predict(deltaTVector);
+    auto const linearPrediction = linearFilter->predict(deltaTVector);
+
+    for (int i = 0; i < stateSize; ++i)
+    {
+      ASSERT_NEAR(linearPrediction.at<double>(i, 0), unscentedPrediction.at<double>(i, 0), 1e-7);
+    }
+
+    // simulate a measurement of an object moving with velocity {2 m/s, 1.5 m/s}
+    object01.x = 1.0 + 2.0 * deltaT * static_cast<double>(k + 1);
+    object01.y = 2.0 + 1.5 * deltaT * static_cast<double>(k + 1);
+
+    auto const measurementVector = object01.measurementVector();
+    auto const unscentedCorrection = unscentedFilter->correct(measurementVector);
+    auto const linearCorrection = linearFilter->correct(measurementVector);
+
+    for (int i = 0; i < stateSize; ++i)
+    {
+      ASSERT_NEAR(linearCorrection.at<double>(i, 0), unscentedCorrection.at<double>(i, 0), 1e-7);
+    }
+  }
+
+  // covariance and predicted measurement statistics must agree as well
+  auto const unscentedCovariance = unscentedFilter->getErrorCov();
+  auto const linearCovariance = linearFilter->getErrorCov();
+  for (int i = 0; i < stateSize; ++i)
+  {
+    for (int j = 0; j < stateSize; ++j)
+    {
+      ASSERT_NEAR(linearCovariance.at<double>(i, j), unscentedCovariance.at<double>(i, j), 1e-7);
+    }
+  }
+}
+
+TEST(WorkerPoolTest, CostModelDispatchCoversRangeForSerialAndParallelPaths)
+{
+  auto &pool = rv::WorkerPool::instance();
+  auto const savedFloor = pool.serialCostFloor();
+
+  // Below the floor the loop runs serial; the whole range must still be hit
+  pool.setSerialCostFloor(rv::WorkerPool::kDefaultSerialCostFloorNs);
+  std::vector<std::atomic<int>> hits(64);
+  pool.parallelFor(0, hits.size(), 1.0, [&](std::size_t i) { hits[i].fetch_add(1); });
+  for (auto const &hit : hits)
+  {
+    ASSERT_EQ(hit.load(), 1);
+  }
+
+  // A floor of zero forces the parallel path; coverage must be identical
+  pool.setSerialCostFloor(0.0);
+  pool.parallelFor(0, hits.size(), 1.0, [&](std::size_t i) { hits[i].fetch_add(1); });
+  for (auto const &hit : hits)
+  {
+    ASSERT_EQ(hit.load(), 2);
+  }
+
+  pool.setSerialCostFloor(savedFloor);
+}
+
+TEST(TrackManagerTest, SetMeasurementsSplitsKnownAndNewObjectsInOnePass)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  rv::tracking::TrackManager manager(trackerConfig, false);
+
+  auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(0));
+  for (rv::tracking::Id id = 1; id <= 2; ++id)
+  {
+    rv::tracking::TrackedObject object;
+    object.id = id;
+    object.x = static_cast<double>(id);
+    object.y = 0.0;
+    manager.createTrack(object, timestamp);
+  }
+  manager.suspendTrack(2);
+
+  manager.predict(0.1);
+
+  // Batch mixing an active track, a suspended track and two unknown ids
+  std::vector<rv::tracking::TrackedObject> batch(4);
+  batch[0].id = 1;
+  batch[0].x = 1.2;
+  batch[1].id = 3;
+  batch[1].x = 30.0;
+  batch[2].id = 2;
+  batch[2].x = 2.0;
+  batch[3].id = 4;
+  batch[3].x = 40.0;
+
+  auto const unmatchedCount = manager.setMeasurements(batch);
+
+  // The unknown objects are compacted to the front in their original order
+  ASSERT_EQ(unmatchedCount, 2u);
+  ASSERT_EQ(batch[0].id, 3);
+  ASSERT_EQ(batch[1].id, 4);
+
+  manager.correct();
+
+  // The known tracks received their measurements; the unknown ids did not
+  // implicitly create tracks
+  ASSERT_NEAR(manager.getTrack(1).x, 1.2, 0.5);
+  ASSERT_FALSE(manager.hasId(3));
+  ASSERT_FALSE(manager.hasId(4));
+
+  for (std::size_t i = 0; i < unmatchedCount; ++i)
+  {
+    manager.createTrack(batch[i], timestamp);
+  }
+  ASSERT_TRUE(manager.hasId(3));
+  ASSERT_TRUE(manager.hasId(4));
+}
+
+TEST(TrackManagerTest, TryGetTrackReportsUnknownIdsWithoutThrowing)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  rv::tracking::TrackManager manager(trackerConfig, false);
+
+  auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(0));
+  rv::tracking::TrackedObject object;
+  object.id = 7;
+  object.x = 4.0;
+  object.y = -2.0;
+  manager.createTrack(object, timestamp);
+  manager.suspendTrack(7);
+
+  // found in the suspended store as well, state copied out
+  rv::tracking::TrackedObject state;
+  ASSERT_TRUE(manager.tryGetTrack(7, state));
+  ASSERT_NEAR(state.x, 4.0, 1e-9);
+  ASSERT_NEAR(state.y, -2.0, 1e-9);
+
+  ASSERT_FALSE(manager.tryGetTrack(8, state));
+
+  // the reference accessor serves the same estimator the copying one returns
+  ASSERT_NEAR(manager.kalmanEstimator(7).currentState().x, 4.0, 1e-9);
+  ASSERT_THROW(manager.kalmanEstimator(8), std::runtime_error);
+}
+
+TEST(TrackManagerTest, RecycledEstimatorSlotStartsFromFreshState)
+{
+  // deleteTrack returns the slot (and its pooled estimator) to the free list;
+  // a track created into the recycled slot must start from its own state with
+  // nothing carried over from the previous occupant
+  rv::tracking::TrackManagerConfig trackerConfig;
+  rv::tracking::TrackManager manager(trackerConfig, false);
+
+  auto timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(0));
+
+  rv::tracking::TrackedObject first;
+  first.id = 1;
+  first.x = 5.0;
+  first.y = -3.0;
+  manager.createTrack(first, timestamp);
+  for (uint32_t k = 0; k < 3; ++k)
+  {
+    manager.predict(0.1);
+    first.x += 1.0;
+    manager.setMeasurement(1, first);
+    manager.correct();
+  }
+  manager.deleteTrack(1);
+
+  rv::tracking::TrackedObject second;
+  second.id = 2;
+  second.x = 100.0;
+  second.y = 50.0;
+  manager.createTrack(second, timestamp);
+
+  ASSERT_FALSE(manager.hasId(1));
+  ASSERT_NEAR(manager.getTrack(2).x, 100.0, 1e-9);
+  ASSERT_NEAR(manager.getTrack(2).y, 50.0, 1e-9);
+
+  // the recycled estimator keeps tracking its new measurements
+  for (uint32_t k = 0; k < 5; ++k)
+  {
+    manager.predict(0.1);
+    second.x += 0.2;
+    manager.setMeasurement(2, second);
+    manager.correct();
+  }
+  ASSERT_NEAR(manager.getTrack(2).x, second.x, 0.5);
+}
+
+TEST(TrackManagerTest, BoundedCapacityScoresAdmissionsAndEvictsUnmatchedUnreliables)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  trackerConfig.mMaxTracks = 2;
+  trackerConfig.mMinAdmissionScore = 0.5;
+  rv::tracking::TrackManager manager(trackerConfig, false);
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(0));
+  rv::tracking::TrackedObject object;
+  object.classification = classificationData.classification("Car", 1.0);
+
+  // the score floor rejects low-confidence detections before any budget check
+  object.id = 9;
+  object.classification = classificationData.classification("Car", 0.3);
+  ASSERT_EQ(manager.createTrack(object, timestamp), rv::tracking::InvalidObjectId);
+  ASSERT_EQ(manager.admissionRejections(), 1u);
+
+  object.classification = classificationData.classification("Car", 1.0);
+  for (rv::tracking::Id id = 1; id <= 2; ++id)
+  {
+    object.id = id;
+    object.x = 10.0 * static_cast<double>(id);
+    ASSERT_EQ(manager.createTrack(object, timestamp), id);
+  }
+  ASSERT_EQ(manager.liveTrackCount(), 2u);
+
+  // at the budget with every track measured this frame nothing is evictable
+  object.id = 3;
+  object.x = 30.0;
+  ASSERT_EQ(manager.createTrack(object, timestamp), rv::tracking::InvalidObjectId);
+  ASSERT_EQ(manager.admissionRejections(), 2u);
+
+  // one frame where track 2 misses its measurement makes it the eviction
+  // candidate: unreliable and longest unmatched
+  manager.predict(0.1);
+  rv::tracking::TrackedObject measurement = object;
+  measurement.id = 1;
+  measurement.x = 10.0;
+  manager.setMeasurement(1, measurement);
+  manager.correct();
+
+  ASSERT_EQ(manager.createTrack(object, timestamp), 3);
+  ASSERT_EQ(manager.capacityEvictions(), 1u);
+  ASSERT_FALSE(manager.hasId(2));
+  ASSERT_TRUE(manager.hasId(1));
+  ASSERT_TRUE(manager.hasId(3));
+  ASSERT_EQ(manager.liveTrackCount(), 2u);
+
+  // a caller-provided score (camera agreement) clears the floor even when
+  // the confidence alone would not
+  manager.deleteTrack(3);
+  object.id = 4;
+  object.classification = classificationData.classification("Car", 0.3);
+  ASSERT_EQ(manager.createTrack(object, timestamp, 0.3 + 1.0), 4);
+}
+
+TEST(TrackManagerTest, SuspendedSpatialHashReturnsOnlyNearbyTracks)
+{
+  rv::tracking::TrackManagerConfig trackerConfig;
+  rv::tracking::TrackManager manager(trackerConfig, false);
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(10));
+  std::vector<double> const xPositions = {0.0, 3.0, 100.0};
+  for (size_t i = 0; i < xPositions.size(); ++i)
+  {
+    rv::tracking::TrackedObject object;
+    object.id = static_cast<rv::tracking::Id>(i + 1);
+    object.x = xPositions[i];
+    object.y = 0.0;
+    object.classification = classificationData.classification("Car", 1.0);
+    manager.createTrack(object, timestamp);
+    manager.suspendTrack(object.id);
+  }
+
+  std::vector<rv::tracking::TrackedObject> detections(1);
+  detections[0].x = 1.0;
+  detections[0].y = 0.0;
+  auto detectionView = rv::tracking::makeTrackView(detections);
+
+  auto nearby = manager.getSuspendedTrackViewNear(detectionView, 5.0);
+  ASSERT_EQ(nearby.size(), 2u);
+  for (auto const *track : nearby)
+  {
+    ASSERT_LT(track->x, 10.0);
+  }
+
+  // Reactivation removes the track from the hash
+  manager.reactivateTrack(1);
+  nearby = manager.getSuspendedTrackViewNear(detectionView, 5.0);
+  ASSERT_EQ(nearby.size(), 1u);
+  ASSERT_NEAR(nearby.front()->x, 3.0, 1e-9);
+}
+
+TEST(TrackSerializationTest, RoundTripPreservesTracksAndHeader)
+{
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  rv::tracking::TrackSnapshot snapshot;
+  snapshot.version = 42;
+  snapshot.timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(1500));
+  for (int i = 0; i < 3; ++i)
+  {
+    rv::tracking::TrackedObject track;
+    track.id = i + 1;
+    track.x = 1.5 * i;
+    track.y = -0.5 * i;
+    track.vx = 0.1 * i;
+    track.yaw = 0.25 * i;
+    track.length = 2.0;
+    track.width = 1.0;
+    track.height = 1.5;
+    track.corrected = (i % 2) == 0;
+    track.classification = classificationData.classification("Bike", 0.9);
+    track.attributes.set("color", "red");
+    track.attributes.set("zone", "dock" + std::to_string(i));
+    snapshot.tracks.push_back(std::move(track));
+  }
+
+  std::vector<uint8_t> buffer;
+  rv::tracking::serializeTracks(snapshot, buffer);
+
+  // The header carries the snapshot identity at fixed offsets
+  rv::tracking::TrackBlobHeader header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  ASSERT_EQ(header.magic, rv::tracking::kTrackBlobMagic);
+  ASSERT_EQ(header.snapshotVersion, 42u);
+  ASSERT_EQ(header.trackCount, 3u);
+
+  auto decoded = rv::tracking::deserializeTracks(buffer.data(), buffer.size());
+  ASSERT_EQ(decoded.size(), snapshot.tracks.size());
+  for (size_t i = 0; i < decoded.size(); ++i)
+  {
+    auto const &expected = snapshot.tracks[i];
+    ASSERT_EQ(decoded[i].id, expected.id);
+    ASSERT_NEAR(decoded[i].x, expected.x, 1e-12);
+    ASSERT_NEAR(decoded[i].yaw, expected.yaw, 1e-12);
+    ASSERT_EQ(decoded[i].corrected, expected.corrected);
+    ASSERT_EQ(decoded[i].classification.size(), expected.classification.size());
+    ASSERT_NEAR(decoded[i].classification[1], expected.classification[1], 1e-12);
+    ASSERT_EQ(decoded[i].attributes.toMap(), expected.attributes.toMap());
+  }
+
+  // Truncated input is rejected rather than read past the end
+  ASSERT_THROW(rv::tracking::deserializeTracks(buffer.data(), buffer.size() - 8), std::runtime_error);
+}
+
+TEST(SecureMatTest, RowsStartCacheLineAlignedAndStorageGrowsMonotonically)
+{
+  apollo::perception::common::SecureMat<double> matrix;
+  matrix.Reserve(7, 13);
+  matrix.Resize(7, 13);
+
+  // Row-padded storage: every row starts on a 64-byte boundary
+  ASSERT_EQ(matrix.stride() % (64 / sizeof(double)), 0u);
+  for (size_t row = 0; row < 7; ++row)
+  {
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(matrix.row_data(row)) % 64, 0u);
+  }
+
+  for (size_t row = 0; row < 7; ++row)
+  {
+    for (size_t col = 0; col < 13; ++col)
+    {
+      matrix(row, col) = static_cast<double>(row * 100 + col);
+    }
+  }
+
+  // Shrinking the logical size must not reallocate or disturb values
+  const double *before = matrix.row_data(0);
+  matrix.Resize(3, 5);
+  ASSERT_EQ(matrix.row_data(0), before);
+  ASSERT_NEAR(matrix(2, 4), 204.0, 1e-12);
+}
+
+TEST(GatedComponentsTest, LabelsClustersAndIsolatedNodesDeterministically)
+{
+  auto makeObject = [](double x, double y) {
+    rv::tracking::TrackedObject object;
+    object.x = x;
+    object.y = y;
+    return object;
+  };
+
+  // Two well-separated clusters, one track that gates out and one orphan
+  // measurement; the gate radius is 2 m
+  std::vector<rv::tracking::TrackedObject> tracks = {
+    makeObject(0.0, 0.0),   // cluster A
+    makeObject(1.0, 0.0),   // cluster A (shares a measurement with track 0)
+    makeObject(20.0, 20.0), // cluster B
+    makeObject(50.0, 50.0)  // isolated
+  };
+  std::vector<rv::tracking::TrackedObject> measurements = {
+    makeObject(0.5, 0.5),   // cluster A
+    makeObject(20.5, 20.0), // cluster B
+    makeObject(-30.0, 0.0)  // orphan
+  };
+
+  auto trackView = rv::tracking::makeTrackView(tracks);
+  auto measurementView = rv::tracking::makeTrackView(measurements);
+  auto components = rv::tracking::gatedConnectedComponents(trackView, measurementView, 2.0);
+
+  ASSERT_EQ(components.size(), 4u);
+
+  // Components come out ordered by their lowest node
+  ASSERT_EQ(components[0].trackIndices, (std::vector<size_t>{0, 1}));
+  ASSERT_EQ(components[0].measurementIndices, (std::vector<size_t>{0}));
+  ASSERT_EQ(components[1].trackIndices, (std::vector<size_t>{2}));
+  ASSERT_EQ(components[1].measurementIndices, (std::vector<size_t>{1}));
+  ASSERT_EQ(components[2].trackIndices, (std::vector<size_t>{3}));
+  ASSERT_TRUE(components[2].measurementIndices.empty());
+  ASSERT_TRUE(components[3].trackIndices.empty());
+  ASSERT_EQ(components[3].measurementIndices, (std::vector<size_t>{2}));
+}
+
+TEST(WorkerPoolTest, NumaShardedDispatchCoversRangeAndParsesTopology)
+{
+  // sysfs cpulist parsing feeds the node-to-CPU mapping
+  ASSERT_EQ(rv::NumaTopology::parseCpuList("0-3,8,10-11"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+  ASSERT_TRUE(rv::NumaTopology::parseCpuList("").empty());
+
+  auto const topology = rv::NumaTopology::detect();
+  ASSERT_GE(topology.nodeCount(), 1u);
+
+  // numa-aware dispatch must still cover the whole range exactly once, on
+  // single-node machines (one shard) as well as multi-node ones (stealing)
+  auto &pool = rv::WorkerPool::instance();
+  pool.configure(4, false, true);
+  ASSERT_GE(pool.shardCount(), 1u);
+
+  std::vector<std::atomic<int>> hits(1024);
+  pool.parallelFor(0, hits.size(), [&hits](std::size_t index) { hits[index].fetch_add(1); });
+  for (auto const &hit : hits)
+  {
+    ASSERT_EQ(hit.load(), 1);
+  }
+
+  pool.configure(0, false, false);
+}
+
+TEST(ShardedSceneTrackerTest, BoundaryCrossingHandsOffOnceWithHysteresis)
+{
+  rv::tracking::ShardedSceneTrackerConfig config;
+  config.mBoundaries = {50.0};
+  config.mHandoffHysteresis = 2.0;
+  config.mTrackerConfig.mDefaultProcessNoise = 1e-4;
+  config.mTrackerConfig.mDefaultMeasurementNoise = 1e-5;
+
+  rv::tracking::ShardedSceneTracker tracker(config);
+  ASSERT_EQ(tracker.shardCount(), 2u);
+
+  auto classificationData = rv::tracking::ClassificationData({"Car", "Bike", "Pedestrian"});
+
+  // one object crossing the boundary at 1 m/frame: within the hysteresis
+  // band it must stay with shard 0 and keep receiving its measurements, and
+  // it must hand off exactly once - never duplicating into both shards
+  rv::tracking::Id trackId = rv::tracking::InvalidObjectId;
+  for (uint32_t k = 0; k < 10; ++k)
+  {
+    auto const timestamp = std::chrono::system_clock::time_point(std::chrono::milliseconds(100 * (k + 1)));
+
+    std::vector<rv::tracking::TrackedObject> detections(1);
+    detections[0].x = 45.0 + static_cast<double>(k + 1);
+    detections[0].y = 1.0;
+    detections[0].length = 2.0;
+    detections[0].width = 1.0;
+    detections[0].height = 2.0;
+    detections[0].classification = classificationData.classification("Car", 1.0);
+
+    tracker.track(detections, timestamp);
+
+    auto const tracks = tracker.getTracks();
+    ASSERT_EQ(tracks.size(), 1u);
+    if (k == 0)
+    {
+      trackId = tracks[0].id;
+    }
+    ASSERT_EQ(tracks[0].id, trackId);
+  }
+
+  ASSERT_EQ(tracker.handoffCount(), 1u);
+  ASSERT_FALSE(tracker.shard(0).hasTrack(trackId));
+  ASSERT_TRUE(tracker.shard(1).hasTrack(trackId));
+
+  // detections far from any boundary route strictly by position
+  std::vector<rv::tracking::TrackedObject> detections(1);
+  detections[0].x = 10.0;
+  detections[0].y = 1.0;
+  detections[0].length = 2.0;
+  detections[0].width = 1.0;
+  detections[0].height = 2.0;
+  detections[0].classification = classificationData.classification("Car", 1.0);
+  tracker.track(detections, std::chrono::system_clock::time_point(std::chrono::milliseconds(1200)));
+
+  ASSERT_EQ(tracker.shard(0).getTracks().size(), 1u);
+  ASSERT_EQ(tracker.handoffCount(), 1u);
+}
+
+TEST(UnscentedKalmanFilterTTest, CorrectCachesInnovationCovarianceInverse)
+{
+  // The IMM likelihood update reuses S^-1 from the gain computation instead
+  // of decomposing S a second time; the cached inverse must actually invert
+  // the innovation covariance the filter reports
+  const int stateSize = rv::tracking::TrackedObject::StateSize;
+  const int measurementSize = rv::tracking::TrackedObject::MeasurementSize;
+
+  rv::tracking::TrackedObject object01;
+  object01.x = 1.0;
+  object01.y = 2.0;
+  object01.vx = 2.0;
+  object01.vy = 1.5;
+  object01.length = 2.0;
+  object01.width = 1.0;
+  object01.height = 2.0;
+
+  auto model = cv::makePtr<rv::tracking::CVModel>();
+  cv::detail::tracking::UnscentedKalmanFilterParams modelParams(stateSize, measurementSize, 1, 0, 0, model);
+  modelParams.stateInit = object01.stateVector().clone();
+  modelParams.errorCovInit = cv::Mat::eye(stateSize, stateSize, CV_64F);
+  modelParams.measurementNoiseCov = cv::Mat::eye(measurementSize, measurementSize, CV_64F) * 1e-2;
+  modelParams.processNoiseCov = cv::Mat::eye(stateSize, stateSize, CV_64F) * 1e-3;
+  modelParams.alpha = 1.0;
+  modelParams.beta = 2.0;
+  modelParams.k = 3.0 - stateSize;
+
+  auto unscentedFilter = cv::detail::tracking::createUnscentedKalmanFilterMod(modelParams);
+  auto linearFilter = cv::makePtr<rv::tracking::LinearKalmanFilterMod>(modelParams, rv::tracking::MotionModel::CV);
+
+  // empty before the first correction
+  ASSERT_TRUE(unscentedFilter->getMeasurementCovInv().empty());
+  ASSERT_TRUE(linearFilter->getMeasurementCovInv().empty());
+
+  double deltaT = 0.1;
+  cv::Mat deltaTVector = cv::Mat(1, 1, CV_64F, cv::Scalar(deltaT));
+
+  unscentedFilter->predict(deltaTVector);
+  linearFilter->predict(deltaTVector);
+
+  object01.x += 2.0 * deltaT;
+  object01.y += 1.5 * deltaT;
+  unscentedFilter->correct(object01.measurementVector());
+  linearFilter->correct(object01.measurementVector());
+
+  for (auto const &filter :
+       std::vector<cv::Ptr<cv::detail::tracking::UnscentedKalmanFilterMod>>{unscentedFilter, linearFilter})
+  {
+    cv::Mat product = filter->getMeasurementCov() * filter->getMeasurementCovInv();
+    for (int i = 0; i < measurementSize; ++i)
+    {
+      for (int j = 0; j < measurementSize; ++j)
+      {
+        ASSERT_NEAR(product.at<double>(i, j), i == j ? 1.0 : 0.0, 1e-9);
+      }
+    }
+  }
+}
+
+TEST(GatedHungarianMatcherTest, ReusedMatcherSolvesAcrossProblemSizes)
+{
+  // The matcher and its optimizer keep their scratch between calls; solving
+  // problems of different sizes back to back must reuse the buffers without
+  // leaking state from the previous solve into the next one
+  apollo::perception::common::GatedHungarianMatcher<double> matcher;
+  using OptimizeFlag = apollo::perception::common::GatedHungarianMatcher<double>::OptimizeFlag;
+
+  const double boundValue = 10000.;
+  std::vector<std::pair<size_t, size_t>> assignments;
+  std::vector<size_t> unassignedRows;
+  std::vector<size_t> unassignedCols;
+
+  auto solveDiagonal = [&](size_t rows, size_t cols) {
+    auto *costs = matcher.mutable_global_costs();
+    costs->Resize(rows, cols);
+    for (size_t i = 0; i < rows; ++i)
+    {
+      for (size_t j = 0; j < cols; ++j)
+      {
+        // cheapest on the diagonal, everything else gated out
+        (*costs)(i, j) = (i == j) ? 1.0 : boundValue;
+      }
+    }
+    matcher.Match(100., boundValue, OptimizeFlag::OPTMIN, &assignments, &unassignedRows, &unassignedCols);
+  };
+
+  // large problem first so the scratch reaches its steady-state size
+  solveDiagonal(6, 6);
+  ASSERT_EQ(assignments.size(), 6u);
+  ASSERT_TRUE(unassignedRows.empty());
+  ASSERT_TRUE(unassignedCols.empty());
+
+  // a smaller, rectangular problem must not see the sixth row of the last one
+  solveDiagonal(2, 4);
+  ASSERT_EQ(assignments.size(), 2u);
+  ASSERT_TRUE(unassignedRows.empty());
+  ASSERT_EQ(unassignedCols, (std::vector<size_t>{2, 3}));
+
+  // and the same problem again resolves identically
+  solveDiagonal(6, 6);
+  ASSERT_EQ(assignments.size(), 6u);
+  for (auto const &assignment : assignments)
+  {
+    ASSERT_EQ(assignment.first, assignment.second);
+  }
+}
+
+TEST(AttributeSetTest, GenerationTracksContentSnapshots)
+{
+  // The Python bindings key their conversion cache on the generation: copies
+  // must share it, and any mutation must draw a fresh one
+  rv::tracking::AttributeSet attributes;
+  ASSERT_EQ(attributes.generation(), 0u);
+
+  attributes.set("category", "person");
+  auto const afterFirstSet = attributes.generation();
+  ASSERT_NE(afterFirstSet, 0u);
+
+  // a copy is the same snapshot
+  rv::tracking::AttributeSet copy = attributes;
+  ASSERT_EQ(copy.generation(), afterFirstSet);
+
+  // mutating the copy detaches it; the original keeps its generation
+  copy.set("category", "vehicle");
+  ASSERT_NE(copy.generation(), afterFirstSet);
+  ASSERT_EQ(attributes.generation(), afterFirstSet);
+  ASSERT_EQ(*attributes.find("category"), "person");
+
+  // even a value-identical rebuild is a new snapshot: the generation tracks
+  // mutations, not content equality
+  rv::tracking::AttributeSet rebuilt;
+  rebuilt.set("category", "person");
+  ASSERT_NE(rebuilt.generation(), afterFirstSet);
+}
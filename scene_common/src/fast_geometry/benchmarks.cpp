@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+// Native microbenchmarks for the fast_geometry kernels, built by the
+// `benchmarks` Makefile target. Measuring at the C++ level keeps pybind
+// call overhead out of the numbers, so kernel regressions are visible.
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "line.h"
+#include "point.h"
+#include "polygon.h"
+#include "rectangle.h"
+
+namespace {
+
+Polygon makeRegularPolygon(int vertexCount, double radius) {
+    std::vector<std::pair<double, double>> vertices;
+    vertices.reserve(vertexCount);
+    for (int i = 0; i < vertexCount; i++) {
+        const double angle = 2.0 * M_PI * i / vertexCount;
+        vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    return Polygon(vertices);
+}
+
+Polygon makeStarPolygon(int spikeCount, double radius) {
+    // Concave: alternating outer and inner vertices defeat the convex path
+    std::vector<std::pair<double, double>> vertices;
+    vertices.reserve(2 * spikeCount);
+    for (int i = 0; i < 2 * spikeCount; i++) {
+        const double angle = M_PI * i / spikeCount;
+        const double r = (i % 2 == 0) ? radius : radius * 0.4;
+        vertices.emplace_back(r * std::cos(angle), r * std::sin(angle));
+    }
+    return Polygon(vertices);
+}
+
+std::vector<std::pair<double, double>> makeQueryPoints(size_t count, double extent) {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> coordinate(-extent, extent);
+    std::vector<std::pair<double, double>> points(count);
+    for (auto& point : points) {
+        point = {coordinate(generator), coordinate(generator)};
+    }
+    return points;
+}
+
+void BM_PolygonIsPointInsideConvex(benchmark::State& state) {
+    const Polygon polygon = makeRegularPolygon(state.range(0), 10.0);
+    const auto points = makeQueryPoints(1024, 12.0);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        const auto& point = points[index++ & 1023];
+        benchmark::DoNotOptimize(polygon.isPointInside(point.first, point.second));
+    }
+}
+BENCHMARK(BM_PolygonIsPointInsideConvex)->Arg(8)->Arg(64)->Arg(1024);
+
+void BM_PolygonIsPointInsideConcave(benchmark::State& state) {
+    const Polygon polygon = makeStarPolygon(state.range(0) / 2, 10.0);
+    const auto points = makeQueryPoints(1024, 12.0);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        const auto& point = points[index++ & 1023];
+        benchmark::DoNotOptimize(polygon.isPointInside(point.first, point.second));
+    }
+}
+BENCHMARK(BM_PolygonIsPointInsideConcave)->Arg(8)->Arg(64)->Arg(1024);
+
+void BM_PolygonIsPointInsideMasked(benchmark::State& state) {
+    Polygon polygon = makeStarPolygon(state.range(0) / 2, 10.0);
+    polygon.buildOccupancyMask(0.25);
+    const auto points = makeQueryPoints(1024, 12.0);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        const auto& point = points[index++ & 1023];
+        benchmark::DoNotOptimize(polygon.isPointInside(point.first, point.second));
+    }
+}
+BENCHMARK(BM_PolygonIsPointInsideMasked)->Arg(8)->Arg(64)->Arg(1024);
+
+void BM_RectangleIntersection(benchmark::State& state) {
+    std::mt19937 generator(99);
+    std::uniform_real_distribution<double> coordinate(0.0, 50.0);
+    std::uniform_real_distribution<double> extent(1.0, 10.0);
+    std::vector<Rectangle> boxes;
+    for (int i = 0; i < 256; i++) {
+        const Point origin(coordinate(generator), coordinate(generator));
+        boxes.emplace_back(origin, std::vector<double>{extent(generator), extent(generator)});
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        auto& a = boxes[index & 255];
+        auto& b = boxes[(index * 31 + 7) & 255];
+        index++;
+        benchmark::DoNotOptimize(a.intersection(b));
+    }
+}
+BENCHMARK(BM_RectangleIntersection);
+
+void BM_LineIntersection(benchmark::State& state) {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> coordinate(-25.0, 25.0);
+    std::vector<Line> lines;
+    for (int i = 0; i < 256; i++) {
+        lines.emplace_back(coordinate(generator), coordinate(generator),
+                           coordinate(generator), coordinate(generator));
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        auto& a = lines[index & 255];
+        auto& b = lines[(index * 17 + 3) & 255];
+        index++;
+        benchmark::DoNotOptimize(a.intersection(b));
+    }
+}
+BENCHMARK(BM_LineIntersection);
+
+void BM_LineIsPointOnLine(benchmark::State& state) {
+    Line line(0.0, 0.0, 100.0, 50.0);
+    const auto points = makeQueryPoints(1024, 100.0);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        const auto& point = points[index++ & 1023];
+        Point query(point.first, point.second);
+        benchmark::DoNotOptimize(line.isPointOnLine(query));
+    }
+}
+BENCHMARK(BM_LineIsPointOnLine);
+
+} // namespace
+
+BENCHMARK_MAIN();
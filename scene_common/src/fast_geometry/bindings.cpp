@@ -5,6 +5,8 @@
 #include "line.h"
 #include "rectangle.h"
 #include "polygon.h"
+#include "region_index.h"
+#include "point_array.h"
 
 
 namespace py = pybind11;
@@ -153,11 +155,68 @@ PYBIND11_MODULE( LIBRARY_NAME, m) {
         .def_property_readonly("is3D", &Size::is3D)
         .def_property_readonly("log", &Size::log)
         .def("__repr__", &Size::repr)
-        .def_property_readonly("asNumpy", &Size::asNumpy);
+        .def_property_readonly("asNumpy", &Size::asNumpy)
+        .def_property_readonly("asNumpyView", [](py::object self) {
+            return self.cast<const Size&>().asNumpyView(self);
+        });
 
     py::class_<Polygon>(m, "Polygon")
         .def(py::init<const std::vector<std::pair<double, double>>&>())
         .def("getVertices", &Polygon::getVertices)
-        .def("isPointInside", &Polygon::isPointInside);
+        .def_property_readonly("vertices", [](py::object self) {
+            return self.cast<const Polygon&>().verticesView(self);
+        })
+        .def("isPointInside", &Polygon::isPointInside)
+        .def("containsPoints", &Polygon::containsPoints,
+            py::arg("points"))
+        .def("buildOccupancyMask", &Polygon::buildOccupancyMask,
+            py::arg("cell_size"))
+        .def_property_readonly("area", &Polygon::area)
+        .def_property_readonly("is_convex", &Polygon::isConvex)
+        .def("clip", &Polygon::clip,
+            py::arg("clip_polygon"))
+        .def("intersectionArea", &Polygon::intersectionArea,
+            py::arg("other"));
+
+    m.def("iouMatrix", &iouMatrix,
+        py::arg("boxes_a"), py::arg("boxes_b"));
+
+    m.def("intersectionAreaMatrix", &intersectionAreaMatrix,
+        py::arg("polys_a"), py::arg("polys_b"));
+
+    m.def("tripwireCrossings", &tripwireCrossings,
+        py::arg("previous"), py::arg("current"), py::arg("segments"));
+
+    py::class_<PointArray>(m, "PointArray")
+        .def(py::init<const py::array_t<double>&, bool>(),
+            py::arg("points"), py::arg("polar") = false)
+        .def("__len__", &PointArray::size)
+        .def_property_readonly("is3D", &PointArray::is3D)
+        .def_property_readonly("x", [](py::object self) {
+            return self.cast<const PointArray&>().x(self);
+        })
+        .def_property_readonly("y", [](py::object self) {
+            return self.cast<const PointArray&>().y(self);
+        })
+        .def_property_readonly("z", [](py::object self) {
+            return self.cast<const PointArray&>().z(self);
+        })
+        .def_property_readonly("radius", &PointArray::radius)
+        .def_property_readonly("azimuth", &PointArray::azimuth)
+        .def_property_readonly("inclination", &PointArray::inclination)
+        .def("distance", &PointArray::distance)
+        .def("midpoint", &PointArray::midpoint)
+        .def("__getitem__", &PointArray::getPoint);
+
+    py::class_<RegionIndex>(m, "RegionIndex")
+        .def(py::init<double>(),
+            py::arg("cell_size") = 0.0)
+        .def("addRegion", &RegionIndex::addRegion,
+            py::arg("region_id"), py::arg("polygon"))
+        .def("regionsForPoint", &RegionIndex::regionsForPoint,
+            py::arg("px"), py::arg("py"))
+        .def("queryRegions", &RegionIndex::queryRegions,
+            py::arg("points"))
+        .def_property_readonly("regionCount", &RegionIndex::regionCount);
 
 }
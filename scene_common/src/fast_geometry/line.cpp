@@ -5,6 +5,8 @@
 #include <vector>
 #include <cmath>
 #include <sstream>
+#include <algorithm>
+#include <stdexcept>
 
 #include "utils.h"
 #include "line.h"
@@ -173,3 +175,78 @@ bool Line::is3D() const
 {
     return this->_origin.is3D();
 }
+
+py::array_t<long long> tripwireCrossings(const py::array_t<double>& previous,
+                                         const py::array_t<double>& current,
+                                         const py::array_t<double>& segments)
+{
+    auto prev = previous.unchecked<2>();
+    auto curr = current.unchecked<2>();
+    auto wires = segments.unchecked<2>();
+    if (prev.shape(1) != 2 || curr.shape(1) != 2)
+    {
+        throw std::invalid_argument("tripwireCrossings expects (N, 2) position arrays");
+    }
+    if (prev.shape(0) != curr.shape(0))
+    {
+        throw std::invalid_argument("previous and current position counts must match");
+    }
+    if (wires.shape(1) != 4)
+    {
+        throw std::invalid_argument("tripwireCrossings expects an (M, 4) array of x1/y1/x2/y2 segments");
+    }
+
+    const py::ssize_t points = prev.shape(0);
+    const py::ssize_t wireCount = wires.shape(0);
+    std::vector<long long> events;
+
+    {
+        py::gil_scoped_release release;
+
+        for (py::ssize_t w = 0; w < wireCount; w++)
+        {
+            const double ax = wires(w, 0);
+            const double ay = wires(w, 1);
+            const double bx = wires(w, 2);
+            const double by = wires(w, 3);
+            const double wx = bx - ax;
+            const double wy = by - ay;
+
+            for (py::ssize_t k = 0; k < points; k++)
+            {
+                const double px = prev(k, 0);
+                const double py_ = prev(k, 1);
+                const double cx = curr(k, 0);
+                const double cy = curr(k, 1);
+
+                // Proper crossing: the endpoints of each segment lie strictly
+                // on opposite sides of the other segment's line
+                const double side_prev = wx * (py_ - ay) - wy * (px - ax);
+                const double side_curr = wx * (cy - ay) - wy * (cx - ax);
+                if (side_prev * side_curr >= 0.0)
+                {
+                    continue;
+                }
+                const double mx = cx - px;
+                const double my = cy - py_;
+                const double side_a = mx * (ay - py_) - my * (ax - px);
+                const double side_b = mx * (by - py_) - my * (bx - px);
+                if (side_a * side_b >= 0.0)
+                {
+                    continue;
+                }
+
+                // side_prev > 0 means the movement started on the left of the
+                // wire's p1->p2 direction, so the crossing goes left-to-right
+                events.push_back(k);
+                events.push_back(w);
+                events.push_back(side_prev > 0.0 ? 1 : -1);
+            }
+        }
+    }
+
+    const py::ssize_t eventCount = events.size() / 3;
+    py::array_t<long long> result({eventCount, (py::ssize_t)3});
+    std::copy(events.begin(), events.end(), result.mutable_data());
+    return result;
+}
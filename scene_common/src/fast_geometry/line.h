@@ -11,6 +11,16 @@
 
 #include "point.h"
 
+// Batch tripwire-crossing kernel: previous and current positions as (N, 2)
+// arrays, tripwires as an (M, 4) array of x1/y1/x2/y2 segments. Returns a
+// (K, 3) int64 array of (point index, segment index, direction) for every
+// movement segment that properly crosses a tripwire; direction is +1 when the
+// movement goes left-to-right relative to the tripwire's p1->p2 orientation,
+// -1 otherwise. One call, GIL released, vectorized orientation tests.
+py::array_t<long long> tripwireCrossings(const py::array_t<double>& previous,
+                                         const py::array_t<double>& current,
+                                         const py::array_t<double>& segments);
+
 #define LINE_IS_CLOSE   (POINT_IS_CLOSE)
 
 class Line {
@@ -52,6 +52,10 @@ Point::Point(const Point & p)
     {
         this->_z = std::nan("2d");
     }
+    this->_derived_valid = p._derived_valid;
+    this->_derived_a = p._derived_a;
+    this->_derived_b = p._derived_b;
+    this->_derived_c = p._derived_c;
 }
 Point::Point(double x, double y, double z, bool polar)
 {
@@ -69,11 +73,32 @@ Point::Point(double x, double y, bool polar)
     this->_is3D = false;
     this->_polar = polar;
 }
+void Point::computeDerived() const
+{
+    if(this->_derived_valid)
+    {
+        return;
+    }
+    if(this->_polar)
+    {
+        this->_derived_a = this->xFromPolar();
+        this->_derived_b = this->yFromPolar();
+        this->_derived_c = this->_is3D ? this->zFromPolar() : std::nan("2d");
+    }
+    else
+    {
+        this->_derived_a = this->radiusFromCartesian();
+        this->_derived_b = this->azimuthFromCartesian();
+        this->_derived_c = this->_is3D ? this->inclinationFromCartesian() : std::nan("2d");
+    }
+    this->_derived_valid = true;
+}
 double Point::x() const
 {
     if(this->polar())
     {
-        return this->xFromPolar();
+        this->computeDerived();
+        return this->_derived_a;
     }
     return this->_x;
 }
@@ -81,7 +106,8 @@ double Point::y() const
 {
     if(this->polar())
     {
-        return this->yFromPolar();
+        this->computeDerived();
+        return this->_derived_b;
     }
     return this->_y;
 }
@@ -93,7 +119,8 @@ double Point::z() const
     }
     if(this->polar())
     {
-        return this->zFromPolar();
+        this->computeDerived();
+        return this->_derived_c;
     }
     return this->_z;
 }
@@ -136,7 +163,8 @@ double Point::radius() const
 {
     if(false == this->polar())
     {
-        return radiusFromCartesian();
+        this->computeDerived();
+        return this->_derived_a;
     }
     return this->_x;
 }
@@ -160,7 +188,8 @@ double Point::azimuth() const
     {
         return this->_y;
     }
-    return this->azimuthFromCartesian();
+    this->computeDerived();
+    return this->_derived_b;
 }
 double Point::angle() const
 {
@@ -185,7 +214,8 @@ double Point::inclination() const
     }
     if(false == this->polar())
     {
-        return inclinationFromCartesian();
+        this->computeDerived();
+        return this->_derived_c;
     }
     return this->_z;
 }
@@ -224,19 +254,31 @@ std::tuple<int, int> Point::cv() const
 }
 Point Point::asCartesian () const
 {
-    if(this->is3D())
+    Point converted = this->is3D() ? Point(this->x(), this->y(), this->z(), false)
+                                   : Point(this->x(), this->y(), false);
+    if(this->polar())
     {
-        return Point(this->x(), this->y(), this->z(), false);
+        // The source representation becomes the converted point's cache, so
+        // converting back costs no trig either
+        converted._derived_valid = true;
+        converted._derived_a = this->_x;
+        converted._derived_b = this->_y;
+        converted._derived_c = this->_z;
     }
-    return Point(this->x(), this->y(), false);
+    return converted;
 }
 Point Point::asPolar() const
 {
-    if(this->is3D())
+    Point converted = this->is3D() ? Point(this->radius(), this->azimuth(), this->inclination(), true)
+                                   : Point(this->length(), this->angle(), true);
+    if(false == this->polar())
     {
-        return Point(this->radius(), this->azimuth(), this->inclination(), true);
+        converted._derived_valid = true;
+        converted._derived_a = this->_x;
+        converted._derived_b = this->_y;
+        converted._derived_c = this->_z;
     }
-    return Point(this->length(), this->angle(), true);
+    return converted;
 }
 std::string Point::repr() const
 {
@@ -332,6 +374,7 @@ void Point::operator+=(const Point &p)
     {
         this->_z += p._z;
     }
+    this->_derived_valid = false;
 }
 Point Point::operator-(const Point &p) const
 {
@@ -391,6 +434,7 @@ void Point::operator-=(const Point &p)
     {
         this->_z -= p._z;
     }
+    this->_derived_valid = false;
 }
 bool Point::operator==(const Point &p) const
 {
@@ -414,6 +458,10 @@ Point & Point::operator=(const Point &other)
         this->_z = other._z;
         this->_polar = other._polar;
         this->_is3D = other._is3D;
+        this->_derived_valid = other._derived_valid;
+        this->_derived_a = other._derived_a;
+        this->_derived_b = other._derived_b;
+        this->_derived_c = other._derived_c;
     }
     return *this;
 }
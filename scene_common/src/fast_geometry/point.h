@@ -79,6 +79,16 @@ class Point {
     bool _polar;
     bool _is3D;
 
+    // Lazily cached opposite representation: (x, y, z) for polar points,
+    // (radius, azimuth, inclination) for cartesian ones. Computed on first
+    // access so repeated property reads pay the trig once; mutation
+    // invalidates.
+    mutable bool _derived_valid = false;
+    mutable double _derived_a = 0.0;
+    mutable double _derived_b = 0.0;
+    mutable double _derived_c = 0.0;
+    void computeDerived() const;
+
     // Helper functions, not exposed
     double xFromPolar() const;
     double yFromPolar() const;
@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+#include <stdexcept>
+
+#include "point_array.h"
+#include "utils.h"
+
+#define DEG_TO_RADIANS(deg)   ((deg) * M_PI / 180.0f)
+#define RADIANS_TO_DEG(rad)   ((rad) * 180.0f / M_PI)
+
+PointArray::PointArray(const py::array_t<double>& points, bool polar)
+{
+    auto buffer = points.unchecked<2>();
+    if (buffer.shape(1) != 2 && buffer.shape(1) != 3)
+    {
+        throw std::invalid_argument("PointArray expects an (N, 2) or (N, 3) array");
+    }
+
+    const size_t count = buffer.shape(0);
+    this->_is3D = buffer.shape(1) == 3;
+    this->xs.resize(count);
+    this->ys.resize(count);
+    this->zs.resize(this->_is3D ? count : 0);
+
+    if (!polar)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            this->xs[i] = buffer(i, 0);
+            this->ys[i] = buffer(i, 1);
+        }
+        if (this->_is3D)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                this->zs[i] = buffer(i, 2);
+            }
+        }
+        return;
+    }
+
+    // Bulk polar-to-cartesian, same math as the scalar Point conversion
+    if (this->_is3D)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const double radius = buffer(i, 0);
+            const double azimuth = DEG_TO_RADIANS(buffer(i, 1));
+            const double inclination = DEG_TO_RADIANS(buffer(i, 2));
+            this->xs[i] = radius * cos(azimuth);
+            this->ys[i] = radius * cos(inclination) * sin(azimuth);
+            this->zs[i] = radius * sin(inclination) * cos(azimuth);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const double radius = buffer(i, 0);
+            const double azimuth = DEG_TO_RADIANS(buffer(i, 1));
+            this->xs[i] = radius * cos(azimuth);
+            this->ys[i] = radius * sin(azimuth);
+        }
+    }
+}
+
+PointArray::PointArray(size_t count, bool is_3d)
+    : xs(count), ys(count), zs(is_3d ? count : 0), _is3D(is_3d)
+{
+}
+
+size_t PointArray::size() const
+{
+    return this->xs.size();
+}
+
+bool PointArray::is3D() const
+{
+    return this->_is3D;
+}
+
+static py::array_t<double> columnView(const std::vector<double>& column, py::handle base)
+{
+    // Wrapping the column with the owning PointArray as base makes the view
+    // zero-copy; NumPy keeps the container alive through the reference
+    return py::array_t<double>({(py::ssize_t)column.size()}, {(py::ssize_t)sizeof(double)},
+                               column.data(), base);
+}
+
+py::array_t<double> PointArray::x(py::handle base) const
+{
+    return columnView(this->xs, base);
+}
+
+py::array_t<double> PointArray::y(py::handle base) const
+{
+    return columnView(this->ys, base);
+}
+
+py::array_t<double> PointArray::z(py::handle base) const
+{
+    if (!this->_is3D)
+    {
+        throw std::runtime_error("PointArray is 2D; no z column");
+    }
+    return columnView(this->zs, base);
+}
+
+py::array_t<double> PointArray::radius() const
+{
+    const size_t count = this->size();
+    py::array_t<double> result(count);
+    double* out = result.mutable_data();
+    if (this->_is3D)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = magnitude(this->xs[i], this->ys[i], this->zs[i]);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = magnitude(this->xs[i], this->ys[i]);
+        }
+    }
+    return result;
+}
+
+py::array_t<double> PointArray::azimuth() const
+{
+    const size_t count = this->size();
+    py::array_t<double> result(count);
+    double* out = result.mutable_data();
+    for (size_t i = 0; i < count; i++)
+    {
+        double angle = RADIANS_TO_DEG(atan2(this->ys[i], this->xs[i]));
+        angle = std::fmod(angle, 360.0f);
+        if (angle < 0)
+        {
+            angle += 360;
+        }
+        out[i] = angle;
+    }
+    return result;
+}
+
+py::array_t<double> PointArray::inclination() const
+{
+    if (!this->_is3D)
+    {
+        throw std::runtime_error("PointArray is 2D; no inclination");
+    }
+    const size_t count = this->size();
+    py::array_t<double> result(count);
+    double* out = result.mutable_data();
+    for (size_t i = 0; i < count; i++)
+    {
+        const double mag_xy = magnitude(this->xs[i], this->ys[i]);
+        double angle = RADIANS_TO_DEG(atan2(mag_xy, this->zs[i]));
+        angle = std::fmod(90 - angle, 360);
+        if (angle < 0)
+        {
+            angle += 360;
+        }
+        out[i] = angle;
+    }
+    return result;
+}
+
+void PointArray::checkArraysMatch(const PointArray& other) const
+{
+    if (this->size() != other.size() || this->_is3D != other._is3D)
+    {
+        throw std::invalid_argument("PointArray operands must match in size and dimensionality");
+    }
+}
+
+py::array_t<double> PointArray::distance(const PointArray& other) const
+{
+    checkArraysMatch(other);
+    const size_t count = this->size();
+    py::array_t<double> result(count);
+    double* out = result.mutable_data();
+    if (this->_is3D)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = magnitude(this->xs[i] - other.xs[i], this->ys[i] - other.ys[i],
+                               this->zs[i] - other.zs[i]);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = magnitude(this->xs[i] - other.xs[i], this->ys[i] - other.ys[i]);
+        }
+    }
+    return result;
+}
+
+PointArray PointArray::midpoint(const PointArray& other) const
+{
+    checkArraysMatch(other);
+    const size_t count = this->size();
+    PointArray result(count, this->_is3D);
+    for (size_t i = 0; i < count; i++)
+    {
+        result.xs[i] = this->xs[i] + (other.xs[i] - this->xs[i]) / 2;
+        result.ys[i] = this->ys[i] + (other.ys[i] - this->ys[i]) / 2;
+    }
+    if (this->_is3D)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            result.zs[i] = this->zs[i] + (other.zs[i] - this->zs[i]) / 2;
+        }
+    }
+    return result;
+}
+
+Point PointArray::getPoint(size_t index) const
+{
+    if (index >= this->size())
+    {
+        throw std::out_of_range("PointArray index out of range");
+    }
+    if (this->_is3D)
+    {
+        return Point(this->xs[index], this->ys[index], this->zs[index]);
+    }
+    return Point(this->xs[index], this->ys[index]);
+}
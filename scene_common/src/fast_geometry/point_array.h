@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef POINT_ARRAY_H
+#define POINT_ARRAY_H
+
+#include <vector>
+
+#include "point.h"
+
+// Structure-of-arrays companion to Point: contiguous x/y/z columns for whole
+// measurement sets, so Python builds one container per frame instead of
+// thousands of Point objects. Column accessors are zero-copy NumPy views;
+// conversions and pairwise operations run vectorized over the columns with
+// the same degree conventions as Point.
+class PointArray
+{
+  public:
+    // From an (N, 2) or (N, 3) array of cartesian (or polar, matching the
+    // Point constructor convention of radius/azimuth[/inclination]) rows
+    PointArray(const py::array_t<double>& points, bool polar = false);
+
+    size_t size() const;
+    bool is3D() const;
+
+    // Zero-copy column views; base keeps the PointArray alive
+    py::array_t<double> x(py::handle base) const;
+    py::array_t<double> y(py::handle base) const;
+    py::array_t<double> z(py::handle base) const;
+
+    // Bulk polar coordinates, degree conventions matching Point
+    py::array_t<double> radius() const;
+    py::array_t<double> azimuth() const;
+    py::array_t<double> inclination() const;
+
+    // Vectorized pairwise operations; sizes must match
+    py::array_t<double> distance(const PointArray& other) const;
+    PointArray midpoint(const PointArray& other) const;
+
+    // Element interop with the scalar class
+    Point getPoint(size_t index) const;
+
+  private:
+    PointArray(size_t count, bool is_3d);
+
+    void checkArraysMatch(const PointArray& other) const;
+
+    std::vector<double> xs;
+    std::vector<double> ys;
+    std::vector<double> zs;
+    bool _is3D;
+};
+
+#endif
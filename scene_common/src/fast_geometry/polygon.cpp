@@ -3,31 +3,123 @@
 
 #include <stdexcept>
 #include <sstream>
+#include <limits>
+#include <algorithm>
+#include <cmath>
 
 #include "polygon.h"
+#include "simd_dispatch.h"
 
 Polygon::Polygon(const std::vector<std::pair<double, double>>& vertices)
     : vertices(vertices)
 {
+    min_x = min_y = std::numeric_limits<double>::infinity();
+    max_x = max_y = -std::numeric_limits<double>::infinity();
+    for (const auto& vertex : this->vertices)
+    {
+        min_x = std::min(min_x, vertex.first);
+        max_x = std::max(max_x, vertex.first);
+        min_y = std::min(min_y, vertex.second);
+        max_y = std::max(max_y, vertex.second);
+    }
+
+    const int n = this->vertices.size();
+    this->edges.reserve(n);
+    for (int i = 0, j = n - 1; i < n; j = i++)
+    {
+        Edge edge;
+        edge.xi = this->vertices[i].first;
+        edge.yi = this->vertices[i].second;
+        edge.yj = this->vertices[j].second;
+        edge.dx = this->vertices[j].first - edge.xi;
+        edge.dy = edge.yj - edge.yi;
+        edge.inv_slope = edge.dy != 0.0 ? edge.dx / edge.dy : 0.0;
+        this->edges.push_back(edge);
+    }
+
+    // Convexity: every turn along the boundary has the same orientation
+    // (collinear vertices are tolerated); the signed area gives the winding,
+    // which the binary-search containment test needs counter-clockwise
+    bool has_left_turn = false;
+    bool has_right_turn = false;
+    double signed_area = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        const auto& a = this->vertices[i];
+        const auto& b = this->vertices[(i + 1) % n];
+        const auto& c = this->vertices[(i + 2) % n];
+        const double cross = (b.first - a.first) * (c.second - b.second)
+                              - (b.second - a.second) * (c.first - b.first);
+        if (cross > 0.0)
+        {
+            has_left_turn = true;
+        }
+        else if (cross < 0.0)
+        {
+            has_right_turn = true;
+        }
+        signed_area += a.first * b.second - b.first * a.second;
+    }
+    this->is_convex = n >= 3 && !(has_left_turn && has_right_turn);
+    this->polygon_area = std::fabs(signed_area) / 2.0;
+
+    if (this->is_convex)
+    {
+        this->ccw_vertices = this->vertices;
+        if (signed_area < 0.0)
+        {
+            std::reverse(this->ccw_vertices.begin(), this->ccw_vertices.end());
+        }
+    }
 }
 std::vector<std::pair<double, double>> Polygon::getVertices() const
 {
     return this->vertices;
 }
+py::array_t<double> Polygon::verticesView(py::handle base) const
+{
+    // std::pair<double, double> is two contiguous doubles, so the vertex
+    // vector already has (N, 2) row-major layout
+    static_assert(sizeof(std::pair<double, double>) == 2 * sizeof(double),
+                  "vertex pairs must pack as two doubles");
+    return py::array_t<double>({(py::ssize_t)this->vertices.size(), (py::ssize_t)2},
+                               {(py::ssize_t)sizeof(std::pair<double, double>), (py::ssize_t)sizeof(double)},
+                               &this->vertices.data()->first, base);
+}
 bool Polygon::isPointInside(double px, double py) const
 {
-    int n = this->vertices.size();
-    bool inside = false;
+    if (px < min_x || px > max_x || py < min_y || py > max_y)
+    {
+        return false;
+    }
 
-    for (int i = 0, j = n - 1; i < n; j = i++)
+    if (this->mask_enabled)
     {
-        double xi = this->vertices[i].first;
-        double yi = this->vertices[i].second;
-        double xj = this->vertices[j].first;
-        double yj = this->vertices[j].second;
+        const int col = std::min(this->mask_cols - 1, (int)((px - min_x) / this->mask_cell_size));
+        const int row = std::min(this->mask_rows - 1, (int)((py - min_y) / this->mask_cell_size));
+        const unsigned char cell = this->mask[row * this->mask_cols + col];
+        if (cell != MASK_MIXED)
+        {
+            return cell == MASK_INSIDE;
+        }
+    }
+
+    return exactContains(px, py);
+}
+
+// Containment without the mask shortcut; also the fallback for mixed cells
+bool Polygon::exactContains(double px, double py) const
+{
+    if (this->is_convex)
+    {
+        return convexContains(px, py);
+    }
 
-        bool intersect = ((yi > py) != (yj > py))
-                          && px < ((xj - xi) * (py - yi) / (yj - yi) + xi);
+    bool inside = false;
+    for (const auto& edge : this->edges)
+    {
+        bool intersect = ((edge.yi > py) != (edge.yj > py))
+                          && px < ((py - edge.yi) * edge.inv_slope + edge.xi);
         if (intersect)
         {
             inside = !inside;
@@ -36,3 +128,393 @@ bool Polygon::isPointInside(double px, double py) const
     return inside;
 }
 
+// O(log n) containment for convex polygons: binary-search the fan of
+// triangles around vertex 0 for the wedge containing the point, then a single
+// orientation test against the far edge decides. Boundary points count as
+// inside.
+bool Polygon::convexContains(double px, double py) const
+{
+    const auto& v = this->ccw_vertices;
+    const int n = v.size();
+
+    auto orientation = [px, py](const std::pair<double, double>& a, const std::pair<double, double>& b) {
+        return (b.first - a.first) * (py - a.second) - (b.second - a.second) * (px - a.first);
+    };
+
+    if (orientation(v[0], v[1]) < 0.0 || orientation(v[0], v[n - 1]) > 0.0)
+    {
+        return false;
+    }
+
+    int low = 1;
+    int high = n - 1;
+    while (high - low > 1)
+    {
+        const int mid = (low + high) / 2;
+        if (orientation(v[0], v[mid]) >= 0.0)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return orientation(v[low], v[high]) >= 0.0;
+}
+
+
+// One precomputed edge against all candidate points: the branch-free inner
+// loop of the batch crossing-number test. Compiled once per ISA level and
+// dispatched at load (see simd_dispatch.h), so the same shared object runs
+// AVX-512 lanes where the CPU has them.
+FG_TARGET_CLONES
+static void crossingParityKernel(double xi, double yi, double yj, double dx, double dy,
+                                 double edge_sign, const double* px, const double* py,
+                                 unsigned char* parity, size_t count)
+{
+    for (size_t c = 0; c < count; c++)
+    {
+        const bool straddles = (yi > py[c]) != (yj > py[c]);
+        const double cross = dx * (py[c] - yi) - (px[c] - xi) * dy;
+        parity[c] ^= static_cast<unsigned char>(straddles && edge_sign * cross > 0.0);
+    }
+}
+
+py::array_t<bool> Polygon::containsPoints(const py::array_t<double>& points) const
+{
+    auto buffer = points.unchecked<2>();
+    if (buffer.shape(1) != 2)
+    {
+        throw std::invalid_argument("containsPoints expects an (N, 2) array of x/y coordinates");
+    }
+
+    const py::ssize_t count = buffer.shape(0);
+    py::array_t<bool> result(count);
+    bool* inside = result.mutable_data();
+
+    {
+        py::gil_scoped_release release;
+
+        // Bounding-box prefilter: points outside the box are settled without
+        // any edge tests; survivors are gathered into compact SoA buffers so
+        // the edge loops below run over contiguous memory
+        std::vector<double> candidate_x;
+        std::vector<double> candidate_y;
+        std::vector<py::ssize_t> candidate_index;
+        candidate_x.reserve(count);
+        candidate_y.reserve(count);
+        candidate_index.reserve(count);
+
+        for (py::ssize_t k = 0; k < count; k++)
+        {
+            const double px = buffer(k, 0);
+            const double py_ = buffer(k, 1);
+            inside[k] = false;
+            if (px < min_x || px > max_x || py_ < min_y || py_ > max_y)
+            {
+                continue;
+            }
+            if (this->mask_enabled)
+            {
+                const int col = std::min(this->mask_cols - 1, (int)((px - min_x) / this->mask_cell_size));
+                const int row = std::min(this->mask_rows - 1, (int)((py_ - min_y) / this->mask_cell_size));
+                const unsigned char cell = this->mask[row * this->mask_cols + col];
+                if (cell != MASK_MIXED)
+                {
+                    inside[k] = cell == MASK_INSIDE;
+                    continue;
+                }
+            }
+            candidate_x.push_back(px);
+            candidate_y.push_back(py_);
+            candidate_index.push_back(k);
+        }
+
+        // Crossing-number test with the loops swapped: one edge at a time over
+        // all candidate points. The test is rearranged to avoid the division
+        // (px < (xj - xi) * (py - yi) / (yj - yi) + xi becomes a sign test on
+        // the cross product, which is exact since yj != yi whenever the edge
+        // straddles py), leaving a branch-free inner loop the compiler can
+        // vectorize. The loop body lives in crossingParityKernel so it gets
+        // per-ISA clones.
+        const size_t candidates = candidate_index.size();
+        std::vector<unsigned char> parity(candidates, 0);
+
+        for (const auto& edge : this->edges)
+        {
+            const double edge_sign = (edge.dy > 0.0) ? 1.0 : -1.0;
+            crossingParityKernel(edge.xi, edge.yi, edge.yj, edge.dx, edge.dy, edge_sign,
+                                 candidate_x.data(), candidate_y.data(), parity.data(), candidates);
+        }
+
+        for (size_t c = 0; c < candidates; c++)
+        {
+            inside[candidate_index[c]] = parity[c] != 0;
+        }
+    }
+
+    return result;
+}
+
+// Liang-Barsky style test: does the segment (x1,y1)-(x2,y2) pass through the
+// axis-aligned cell rectangle?
+static bool segmentIntersectsCell(double x1, double y1, double x2, double y2,
+                                  double cx_min, double cy_min, double cx_max, double cy_max)
+{
+    double t0 = 0.0;
+    double t1 = 1.0;
+    const double dx = x2 - x1;
+    const double dy = y2 - y1;
+    const double p[4] = { -dx, dx, -dy, dy };
+    const double q[4] = { x1 - cx_min, cx_max - x1, y1 - cy_min, cy_max - y1 };
+
+    for (int side = 0; side < 4; side++)
+    {
+        if (p[side] == 0.0)
+        {
+            if (q[side] < 0.0)
+            {
+                return false;
+            }
+            continue;
+        }
+        const double t = q[side] / p[side];
+        if (p[side] < 0.0)
+        {
+            t0 = std::max(t0, t);
+        }
+        else
+        {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Polygon::buildOccupancyMask(double cell_size)
+{
+    if (cell_size <= 0.0)
+    {
+        throw std::invalid_argument("buildOccupancyMask requires a positive cell size");
+    }
+    const int n = this->vertices.size();
+    if (n < 3)
+    {
+        throw std::invalid_argument("buildOccupancyMask requires at least three vertices");
+    }
+
+    this->mask_cell_size = cell_size;
+    this->mask_cols = std::max(1, (int)std::ceil((max_x - min_x) / cell_size));
+    this->mask_rows = std::max(1, (int)std::ceil((max_y - min_y) / cell_size));
+    this->mask.assign((size_t)this->mask_rows * this->mask_cols, MASK_OUTSIDE);
+
+    // Mark every cell a boundary edge passes through as mixed; those keep the
+    // exact crossing test, which is what makes the mask lossless
+    for (int i = 0, j = n - 1; i < n; j = i++)
+    {
+        const double x1 = this->vertices[i].first;
+        const double y1 = this->vertices[i].second;
+        const double x2 = this->vertices[j].first;
+        const double y2 = this->vertices[j].second;
+
+        const int col_lo = std::max(0, (int)((std::min(x1, x2) - min_x) / cell_size));
+        const int col_hi = std::min(this->mask_cols - 1, (int)((std::max(x1, x2) - min_x) / cell_size));
+        const int row_lo = std::max(0, (int)((std::min(y1, y2) - min_y) / cell_size));
+        const int row_hi = std::min(this->mask_rows - 1, (int)((std::max(y1, y2) - min_y) / cell_size));
+
+        for (int row = row_lo; row <= row_hi; row++)
+        {
+            for (int col = col_lo; col <= col_hi; col++)
+            {
+                const double cx_min = min_x + col * cell_size;
+                const double cy_min = min_y + row * cell_size;
+                if (segmentIntersectsCell(x1, y1, x2, y2,
+                                          cx_min, cy_min, cx_min + cell_size, cy_min + cell_size))
+                {
+                    this->mask[(size_t)row * this->mask_cols + col] = MASK_MIXED;
+                }
+            }
+        }
+    }
+
+    // A cell no edge passes through lies entirely on one side of the
+    // boundary, so its centre decides the whole cell
+    for (int row = 0; row < this->mask_rows; row++)
+    {
+        for (int col = 0; col < this->mask_cols; col++)
+        {
+            auto& cell = this->mask[(size_t)row * this->mask_cols + col];
+            if (cell == MASK_MIXED)
+            {
+                continue;
+            }
+            const double center_x = min_x + (col + 0.5) * cell_size;
+            const double center_y = min_y + (row + 0.5) * cell_size;
+            cell = exactContains(center_x, center_y) ? MASK_INSIDE : MASK_OUTSIDE;
+        }
+    }
+
+    this->mask_enabled = true;
+}
+
+namespace
+{
+
+// Shoelace area of a vertex ring; rings with fewer than 3 vertices enclose
+// nothing
+double ringArea(const std::vector<std::pair<double, double>>& ring)
+{
+    const int n = ring.size();
+    if (n < 3)
+    {
+        return 0.0;
+    }
+    double signed_area = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        const auto& a = ring[i];
+        const auto& b = ring[(i + 1) % n];
+        signed_area += a.first * b.second - b.first * a.second;
+    }
+    return std::fabs(signed_area) / 2.0;
+}
+
+// One Sutherland-Hodgman pass: keep the part of the subject ring on the left
+// of the directed clip edge (a, b); the clipper winds counter-clockwise
+void clipAgainstEdge(const std::vector<std::pair<double, double>>& subject,
+                     const std::pair<double, double>& a,
+                     const std::pair<double, double>& b,
+                     std::vector<std::pair<double, double>>& output)
+{
+    output.clear();
+    if (subject.empty())
+    {
+        return;
+    }
+
+    auto side = [&a, &b](const std::pair<double, double>& p) {
+        return (b.first - a.first) * (p.second - a.second) - (b.second - a.second) * (p.first - a.first);
+    };
+    auto intersection = [](const std::pair<double, double>& p, const std::pair<double, double>& q,
+                           double side_p, double side_q) {
+        const double t = side_p / (side_p - side_q);
+        return std::make_pair(p.first + t * (q.first - p.first), p.second + t * (q.second - p.second));
+    };
+
+    auto prev = subject.back();
+    double side_prev = side(prev);
+    for (const auto& current : subject)
+    {
+        const double side_current = side(current);
+        if (side_current >= 0.0)
+        {
+            if (side_prev < 0.0)
+            {
+                output.push_back(intersection(prev, current, side_prev, side_current));
+            }
+            output.push_back(current);
+        }
+        else if (side_prev >= 0.0)
+        {
+            output.push_back(intersection(prev, current, side_prev, side_current));
+        }
+        prev = current;
+        side_prev = side_current;
+    }
+}
+
+// Clip a subject ring against every edge of a counter-clockwise convex
+// clipper. The subject may be concave: the result can then carry zero-width
+// bridge edges, which enclose no area, so the area of the result is exact.
+std::vector<std::pair<double, double>> clipRing(const std::vector<std::pair<double, double>>& subject,
+                                                const std::vector<std::pair<double, double>>& clipper_ccw)
+{
+    std::vector<std::pair<double, double>> ring = subject;
+    std::vector<std::pair<double, double>> scratch;
+    const int n = clipper_ccw.size();
+    for (int i = 0; i < n && !ring.empty(); i++)
+    {
+        clipAgainstEdge(ring, clipper_ccw[i], clipper_ccw[(i + 1) % n], scratch);
+        ring.swap(scratch);
+    }
+    return ring;
+}
+
+} // namespace
+
+double Polygon::area() const
+{
+    return this->polygon_area;
+}
+
+bool Polygon::isConvex() const
+{
+    return this->is_convex;
+}
+
+Polygon Polygon::clip(const Polygon& clip_polygon) const
+{
+    if (!clip_polygon.is_convex)
+    {
+        throw std::invalid_argument("clip requires a convex clip polygon");
+    }
+
+    auto ring = clipRing(this->vertices, clip_polygon.ccw_vertices);
+    if (ring.size() < 3)
+    {
+        ring.clear();
+    }
+    return Polygon(ring);
+}
+
+double Polygon::intersectionArea(const Polygon& other) const
+{
+    // disjoint bounding boxes cannot intersect; this is the cheap reject the
+    // batch kernel relies on
+    if (min_x > other.max_x || other.min_x > max_x || min_y > other.max_y || other.min_y > max_y)
+    {
+        return 0.0;
+    }
+
+    const Polygon* subject = this;
+    const Polygon* clipper = &other;
+    if (!clipper->is_convex)
+    {
+        std::swap(subject, clipper);
+    }
+    if (!clipper->is_convex)
+    {
+        throw std::invalid_argument("intersectionArea requires at least one convex polygon");
+    }
+
+    return ringArea(clipRing(subject->vertices, clipper->ccw_vertices));
+}
+
+py::array_t<double> intersectionAreaMatrix(const std::vector<const Polygon*>& polys_a,
+                                           const std::vector<const Polygon*>& polys_b)
+{
+    const py::ssize_t countA = polys_a.size();
+    const py::ssize_t countB = polys_b.size();
+    py::array_t<double> result({countA, countB});
+    double* out = result.mutable_data();
+
+    {
+        py::gil_scoped_release release;
+
+        for (py::ssize_t i = 0; i < countA; i++)
+        {
+            double* row = out + i * countB;
+            for (py::ssize_t j = 0; j < countB; j++)
+            {
+                row[j] = polys_a[i]->intersectionArea(*polys_b[j]);
+            }
+        }
+    }
+
+    return result;
+}
@@ -10,6 +10,10 @@
 #include <map>
 #include <vector>
 
+#include <pybind11/numpy.h>
+
+namespace py = pybind11;
+
 class Polygon
 {
   public:
@@ -18,13 +22,94 @@ class Polygon
 
     std::vector<std::pair<double, double>> getVertices() const ;
 
+    // (N, 2) NumPy view aliasing the vertex storage; base keeps the Polygon
+    // alive. Vertices never change after construction, so the view is safe
+    // to hold. CAD-imported polygons can carry thousands of vertices, which
+    // getVertices() would copy on every access.
+    py::array_t<double> verticesView(py::handle base) const ;
+
     // Method to check if a point is inside the region
     bool isPointInside(double px, double py) const ;
 
+    // Batch variant over an (N, 2) array of x/y coordinates; prefilters
+    // against the cached bounding box and releases the GIL for the edge tests
+    py::array_t<bool> containsPoints(const py::array_t<double>& points) const ;
+
+    // Enclosed area, cached at construction
+    double area() const ;
+
+    bool isConvex() const ;
+
+    // Sutherland-Hodgman clipping of this polygon against a convex clip
+    // polygon; the result may be empty. Throws when clip_polygon is concave,
+    // as Sutherland-Hodgman is only exact for convex clippers.
+    Polygon clip(const Polygon& clip_polygon) const ;
+
+    // Area of the intersection with another polygon. One of the two polygons
+    // must be convex (it acts as the Sutherland-Hodgman clipper); region and
+    // camera-coverage polygons in practice are.
+    double intersectionArea(const Polygon& other) const ;
+
+    // Opt-in rasterized containment: precompute an occupancy mask over the
+    // bounding box at the given cell size. Cells a polygon edge passes
+    // through stay "mixed" and fall back to the exact crossing test, so
+    // results are identical to the unrasterized path; everything else becomes
+    // an O(1) table lookup. Intended for static region polygons that are
+    // queried for hours after being authored once.
+    void buildOccupancyMask(double cell_size) ;
+
   private:
+    // One precomputed crossing-number edge: everything the containment tests
+    // need, so queries never recompute differences or divisions
+    struct Edge
+    {
+        double xi;
+        double yi;
+        double yj;
+        double dx;        // xj - xi
+        double dy;        // yj - yi
+        double inv_slope; // dx / dy, 0 for horizontal edges
+    };
+
+    bool convexContains(double px, double py) const ;
+    bool exactContains(double px, double py) const ;
+
     std::vector<std::pair<double, double>> vertices;
     int region_type;
+
+    // Bounding box cached at construction for the batch prefilter
+    double min_x;
+    double min_y;
+    double max_x;
+    double max_y;
+
+    // Edge table, convexity flag and counter-clockwise vertex order, all
+    // cached at construction; region polygons are built once and queried
+    // millions of times
+    std::vector<Edge> edges;
+    bool is_convex;
+    std::vector<std::pair<double, double>> ccw_vertices;
+
+    // Enclosed area, cached at construction alongside the winding
+    double polygon_area = 0.0;
+
+    // Occupancy mask state (buildOccupancyMask); one byte per cell holding
+    // MASK_OUTSIDE, MASK_INSIDE or MASK_MIXED
+    static const unsigned char MASK_OUTSIDE = 0;
+    static const unsigned char MASK_INSIDE = 1;
+    static const unsigned char MASK_MIXED = 2;
+    bool mask_enabled = false;
+    double mask_cell_size = 0.0;
+    int mask_cols = 0;
+    int mask_rows = 0;
+    std::vector<unsigned char> mask;
 };
 
+// (N, M) matrix of pairwise intersection areas between two sets of polygons,
+// computed with the GIL released; pairs whose bounding boxes do not overlap
+// never run the clipping. Backs camera-coverage and region-overlap analytics
+// that previously clipped polygon pairs one by one in Python.
+py::array_t<double> intersectionAreaMatrix(const std::vector<const Polygon*>& polys_a,
+                                           const std::vector<const Polygon*>& polys_b);
 
 #endif
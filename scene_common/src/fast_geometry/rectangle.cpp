@@ -5,10 +5,13 @@
 #include <sstream>
 #include <iomanip>
 #include <cstdio>
+#include <algorithm>
+#include <stdexcept>
 
 #include "utils.h"
 #include "rectangle.h"
 #include "point.h"
+#include "simd_dispatch.h"
 
 Size::Size(double x, double y)
   :_x(x),
@@ -50,6 +53,12 @@ py::array_t<double> Size::asNumpy() const
     result[1] = this->height();
     return py::array_t<double>(result.size(), result.data());
 }
+py::array_t<double> Size::asNumpyView(py::handle base) const
+{
+    // _x/_y/_z are declared contiguously; the view spans two or three of them
+    return py::array_t<double>({(py::ssize_t)(this->is3D() ? 3 : 2)},
+                               {(py::ssize_t)sizeof(double)}, &this->_x, base);
+}
 bool Size::is3D() const
 {
     return ! std::isnan(this->_z);
@@ -338,3 +347,70 @@ Rectangle Rectangle::intersection(const Rectangle & r)
     }
     return Rectangle( Point(0,0), Point(0,0) );
 }
+
+// One A box against all B boxes: the hot loop of iouMatrix over contiguous
+// column buffers. Compiled once per ISA level and dispatched at load (see
+// simd_dispatch.h).
+FG_TARGET_CLONES
+static void iouRowKernel(double ax1, double ay1, double ax2, double ay2, double areaA,
+                         const double* bx1, const double* by1, const double* bx2, const double* by2,
+                         const double* areaB, double* row, size_t count)
+{
+    for (size_t j = 0; j < count; j++)
+    {
+        const double ix = std::min(ax2, bx2[j]) - std::max(ax1, bx1[j]);
+        const double iy = std::min(ay2, by2[j]) - std::max(ay1, by1[j]);
+        const double intersection = std::max(0.0, ix) * std::max(0.0, iy);
+        const double union_area = areaA + areaB[j] - intersection;
+        row[j] = union_area > 0.0 ? intersection / union_area : 0.0;
+    }
+}
+
+py::array_t<double> iouMatrix(const py::array_t<double>& boxes_a, const py::array_t<double>& boxes_b)
+{
+    auto a = boxes_a.unchecked<2>();
+    auto b = boxes_b.unchecked<2>();
+    if (a.shape(1) != 4 || b.shape(1) != 4)
+    {
+        throw std::invalid_argument("iouMatrix expects (N, 4) arrays of x1/y1/x2/y2 rows");
+    }
+
+    const py::ssize_t countA = a.shape(0);
+    const py::ssize_t countB = b.shape(0);
+    py::array_t<double> result({countA, countB});
+    double* out = result.mutable_data();
+
+    {
+        py::gil_scoped_release release;
+
+        // B coordinates and areas are gathered into contiguous columns once,
+        // so the row kernel streams plain buffers instead of strided NumPy
+        // accesses
+        std::vector<double> bx1(countB);
+        std::vector<double> by1(countB);
+        std::vector<double> bx2(countB);
+        std::vector<double> by2(countB);
+        std::vector<double> areaB(countB);
+        for (py::ssize_t j = 0; j < countB; j++)
+        {
+            bx1[j] = b(j, 0);
+            by1[j] = b(j, 1);
+            bx2[j] = b(j, 2);
+            by2[j] = b(j, 3);
+            areaB[j] = std::max(0.0, bx2[j] - bx1[j]) * std::max(0.0, by2[j] - by1[j]);
+        }
+
+        for (py::ssize_t i = 0; i < countA; i++)
+        {
+            const double ax1 = a(i, 0);
+            const double ay1 = a(i, 1);
+            const double ax2 = a(i, 2);
+            const double ay2 = a(i, 3);
+            const double areaA = std::max(0.0, ax2 - ax1) * std::max(0.0, ay2 - ay1);
+            iouRowKernel(ax1, ay1, ax2, ay2, areaA, bx1.data(), by1.data(), bx2.data(),
+                         by2.data(), areaB.data(), out + i * countB, countB);
+        }
+    }
+
+    return result;
+}
@@ -14,6 +14,11 @@
 
 #include "point.h"
 
+// Full IoU matrix between two box sets given as (N, 4) arrays of
+// (x1, y1, x2, y2) corner rows; no Rectangle objects are constructed and the
+// GIL is released for the kernel. Degenerate boxes contribute zero overlap.
+py::array_t<double> iouMatrix(const py::array_t<double>& boxes_a, const py::array_t<double>& boxes_b);
+
 namespace py = pybind11;
 
 class Size {
@@ -25,6 +30,8 @@ public:
     double width() const;
     double depth() const;
     py::array_t<double> asNumpy() const;
+    // Zero-copy variant of asNumpy aliasing the width/height[/depth] storage
+    py::array_t<double> asNumpyView(py::handle base) const;
     std::string log() const;
     std::string repr() const;
     bool is3D() const;
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "region_index.h"
+
+RegionIndex::RegionIndex(double cell_size)
+    : requested_cell_size(cell_size)
+{
+    if (cell_size < 0.0)
+    {
+        throw std::invalid_argument("RegionIndex cell size must not be negative");
+    }
+}
+
+void RegionIndex::addRegion(int region_id, const Polygon& polygon)
+{
+    IndexedRegion region{region_id, polygon,
+                         std::numeric_limits<double>::infinity(),
+                         std::numeric_limits<double>::infinity(),
+                         -std::numeric_limits<double>::infinity(),
+                         -std::numeric_limits<double>::infinity()};
+    for (const auto& vertex : polygon.getVertices())
+    {
+        region.min_x = std::min(region.min_x, vertex.first);
+        region.max_x = std::max(region.max_x, vertex.first);
+        region.min_y = std::min(region.min_y, vertex.second);
+        region.max_y = std::max(region.max_y, vertex.second);
+    }
+    this->regions.push_back(std::move(region));
+    this->built = false;
+}
+
+size_t RegionIndex::regionCount() const
+{
+    return this->regions.size();
+}
+
+void RegionIndex::build() const
+{
+    double min_x = std::numeric_limits<double>::infinity();
+    double min_y = std::numeric_limits<double>::infinity();
+    double max_x = -std::numeric_limits<double>::infinity();
+    double max_y = -std::numeric_limits<double>::infinity();
+    double extent_sum = 0.0;
+    for (const auto& region : this->regions)
+    {
+        min_x = std::min(min_x, region.min_x);
+        min_y = std::min(min_y, region.min_y);
+        max_x = std::max(max_x, region.max_x);
+        max_y = std::max(max_y, region.max_y);
+        extent_sum += std::max(region.max_x - region.min_x, region.max_y - region.min_y);
+    }
+
+    // Auto cell size: the average region extent keeps each region in O(1)
+    // cells while cells stay small enough to separate distant regions
+    this->cell_size = this->requested_cell_size > 0.0
+                          ? this->requested_cell_size
+                          : std::max(extent_sum / this->regions.size(), 1e-9);
+    this->grid_min_x = min_x;
+    this->grid_min_y = min_y;
+    this->grid_cols = std::max(1, (int)std::ceil((max_x - min_x) / this->cell_size));
+    this->grid_rows = std::max(1, (int)std::ceil((max_y - min_y) / this->cell_size));
+
+    this->cells.assign((size_t)this->grid_rows * this->grid_cols, {});
+    for (size_t r = 0; r < this->regions.size(); r++)
+    {
+        const auto& region = this->regions[r];
+        int col_lo, col_hi, row_lo, row_hi;
+        cellRange(region.min_x, region.max_x, this->grid_min_x, this->grid_cols, col_lo, col_hi);
+        cellRange(region.min_y, region.max_y, this->grid_min_y, this->grid_rows, row_lo, row_hi);
+        for (int row = row_lo; row <= row_hi; row++)
+        {
+            for (int col = col_lo; col <= col_hi; col++)
+            {
+                this->cells[(size_t)row * this->grid_cols + col].push_back((int)r);
+            }
+        }
+    }
+
+    this->built = true;
+}
+
+void RegionIndex::cellRange(double lo, double hi, double origin, int cells_in_axis,
+                            int& first, int& last) const
+{
+    first = std::max(0, (int)((lo - origin) / this->cell_size));
+    last = std::min(cells_in_axis - 1, (int)((hi - origin) / this->cell_size));
+}
+
+void RegionIndex::collectRegions(double px, double py, std::vector<int>& ids) const
+{
+    ids.clear();
+    const int col = (int)std::floor((px - this->grid_min_x) / this->cell_size);
+    const int row = (int)std::floor((py - this->grid_min_y) / this->cell_size);
+    if (col < 0 || col >= this->grid_cols || row < 0 || row >= this->grid_rows)
+    {
+        return;
+    }
+
+    for (const int r : this->cells[(size_t)row * this->grid_cols + col])
+    {
+        const auto& region = this->regions[r];
+        if (px >= region.min_x && px <= region.max_x
+            && py >= region.min_y && py <= region.max_y
+            && region.polygon.isPointInside(px, py))
+        {
+            ids.push_back(region.id);
+        }
+    }
+}
+
+std::vector<int> RegionIndex::regionsForPoint(double px, double py) const
+{
+    if (this->regions.empty())
+    {
+        return {};
+    }
+    if (!this->built)
+    {
+        build();
+    }
+    std::vector<int> ids;
+    collectRegions(px, py, ids);
+    return ids;
+}
+
+py::list RegionIndex::queryRegions(const py::array_t<double>& points) const
+{
+    auto buffer = points.unchecked<2>();
+    if (buffer.shape(1) != 2)
+    {
+        throw std::invalid_argument("queryRegions expects an (N, 2) array of x/y coordinates");
+    }
+
+    const py::ssize_t count = buffer.shape(0);
+    std::vector<std::vector<int>> hits(count);
+
+    if (!this->regions.empty())
+    {
+        // Build while still holding the GIL so concurrent callers cannot race
+        // on the lazy grid construction (matches regionsForPoint)
+        if (!this->built)
+        {
+            build();
+        }
+        py::gil_scoped_release release;
+        for (py::ssize_t k = 0; k < count; k++)
+        {
+            collectRegions(buffer(k, 0), buffer(k, 1), hits[k]);
+        }
+    }
+
+    py::list result;
+    for (py::ssize_t k = 0; k < count; k++)
+    {
+        py::list ids;
+        for (const int id : hits[k])
+        {
+            ids.append(id);
+        }
+        result.append(ids);
+    }
+    return result;
+}
@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef REGION_INDEX_H
+#define REGION_INDEX_H
+
+#include <vector>
+
+#include "polygon.h"
+
+// Spatial index over many region polygons. Regions are bucketed into a
+// uniform grid by bounding box, so a containment query only tests the
+// handful of regions whose boxes cover the query point instead of every
+// region in the scene. Built once per scene authoring, queried every frame.
+class RegionIndex
+{
+  public:
+    // cell_size 0 picks a size automatically from the average region extent
+    RegionIndex(double cell_size = 0.0);
+
+    // Regions are copied in; masks or precomputed state on the polygon are
+    // preserved. Ids are caller-defined and may repeat across calls.
+    void addRegion(int region_id, const Polygon& polygon);
+
+    size_t regionCount() const;
+
+    // Region ids containing a single point
+    std::vector<int> regionsForPoint(double px, double py) const;
+
+    // Batch variant over an (N, 2) array of x/y coordinates; returns one
+    // list of region ids per point. Containment tests run without the GIL.
+    py::list queryRegions(const py::array_t<double>& points) const;
+
+  private:
+    struct IndexedRegion
+    {
+        int id;
+        Polygon polygon;
+        double min_x;
+        double min_y;
+        double max_x;
+        double max_y;
+    };
+
+    void build() const;
+    void cellRange(double lo, double hi, double origin, int cells,
+                   int& first, int& last) const;
+    void collectRegions(double px, double py, std::vector<int>& ids) const;
+
+    double requested_cell_size;
+    std::vector<IndexedRegion> regions;
+
+    // Grid state, rebuilt lazily after addRegion
+    mutable bool built = false;
+    mutable double cell_size = 0.0;
+    mutable double grid_min_x = 0.0;
+    mutable double grid_min_y = 0.0;
+    mutable int grid_cols = 0;
+    mutable int grid_rows = 0;
+    mutable std::vector<std::vector<int>> cells;
+};
+
+#endif
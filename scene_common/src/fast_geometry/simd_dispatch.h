@@ -0,0 +1,29 @@
+/*
+ * SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SIMD_DISPATCH_H
+#define SIMD_DISPATCH_H
+
+// Runtime CPU dispatch for the batch kernels. target_clones makes the
+// compiler emit one body per listed ISA level plus the baseline, and the
+// loader picks the best one via cpuid through the ifunc resolver — so the
+// single shared object the Makefile builds uses AVX-512 servers and
+// AVX2-only edge boxes fully. Compilers or architectures without the
+// attribute fall back to a single baseline body.
+//
+// Annotated functions are dispatched through the resolver and can never be
+// inlined, so keep the annotation on standalone loop kernels, not on small
+// helpers.
+#if defined(__x86_64__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define FG_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#endif
+#endif
+
+#ifndef FG_TARGET_CLONES
+#define FG_TARGET_CLONES
+#endif
+
+#endif
@@ -106,10 +106,38 @@ def testLines2DCross(start_range, stop_range, step):
   log.log("Lines cross points: ok")
   return True
 
+
+def testTripwireCrossings():
+  import numpy as np
+  from fast_geometry import tripwireCrossings
+
+  # Vertical tripwire on x=1 from y=0..4 and a horizontal one on y=3
+  segments = np.array([[1.0, 0.0, 1.0, 4.0], [-2.0, 3.0, 4.0, 3.0]])
+  previous = np.array([[0.0, 1.0], [2.0, 1.0], [0.0, 5.0], [0.5, 2.0]])
+  current = np.array([[2.0, 1.0], [0.0, 1.0], [0.0, 2.0], [0.9, 2.5]])
+
+  events = tripwireCrossings(previous, current, segments)
+  found = {(int(row[0]), int(row[1])): int(row[2]) for row in events}
+
+  # Point 0 crosses the vertical wire rightwards, point 1 leftwards with the
+  # opposite sign; point 2 crosses the horizontal wire; point 3 crosses nothing
+  if len(found) != 3:
+    print("Unexpected events:", found)
+    return False
+  if found.get((0, 0), 0) + found.get((1, 0), 0) != 0 or (0, 0) not in found:
+    print("Vertical wire directions wrong:", found)
+    return False
+  if (2, 1) not in found or (3, 0) in found or (3, 1) in found:
+    print("Horizontal wire events wrong:", found)
+    return False
+  print("Tripwire crossings ok")
+  return True
+
 def test():
   assert testLines2D(-50, 50, 2)
   assert testLines3D(-50, 50, 2)
   assert testLines2DCross(-50, 50, 2)
+  assert testTripwireCrossings()
 
   return 0
 
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+
+from scene_common import log
+from fast_geometry import Point, PointArray
+
+def testColumnsAreZeroCopyViews():
+  points = np.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+  array = PointArray(points)
+
+  x = array.x
+  if x.base is None:
+    print("Column view copied instead of aliasing")
+    return False
+  if list(x) != [1.0, 4.0] or list(array.y) != [2.0, 5.0] or list(array.z) != [3.0, 6.0]:
+    print("Column contents wrong")
+    return False
+  log.log("Zero-copy column views ok")
+  return True
+
+def testBulkOperationsMatchScalarPoint():
+  rng = np.random.default_rng(5)
+  a = rng.uniform(-10.0, 10.0, size=(500, 3))
+  b = rng.uniform(-10.0, 10.0, size=(500, 3))
+
+  array_a = PointArray(a)
+  array_b = PointArray(b)
+  distances = array_a.distance(array_b)
+  midpoints = array_a.midpoint(array_b)
+  radii = array_a.radius
+  azimuths = array_a.azimuth
+  inclinations = array_a.inclination
+
+  for idx in range(a.shape[0]):
+    point_a = Point(a[idx][0], a[idx][1], a[idx][2])
+    point_b = Point(b[idx][0], b[idx][1], b[idx][2])
+    if abs(distances[idx] - point_a.distance(point_b)) > 1e-9:
+      print("Distance mismatch at", idx)
+      return False
+    mid = point_a.midpoint(point_b)
+    if midpoints[idx].distance(mid) > 1e-9:
+      print("Midpoint mismatch at", idx)
+      return False
+    if abs(radii[idx] - point_a.radius) > 1e-9 \
+        or abs(azimuths[idx] - point_a.azimuth) > 1e-9 \
+        or abs(inclinations[idx] - point_a.inclination) > 1e-9:
+      print("Polar attribute mismatch at", idx)
+      return False
+  log.log("Bulk operations match scalar Point ok")
+  return True
+
+def testPolarConstructionMatchesScalarPoint():
+  rng = np.random.default_rng(11)
+  polar = np.column_stack([rng.uniform(0.1, 10.0, 300),
+                           rng.uniform(0.0, 360.0, 300),
+                           rng.uniform(0.0, 360.0, 300)])
+
+  array = PointArray(polar, polar=True)
+  for idx in range(polar.shape[0]):
+    point = Point(polar[idx][0], polar[idx][1], polar[idx][2], polar=True)
+    if array[idx].distance(point.asCartesian) > 1e-9:
+      print("Polar construction mismatch at", idx)
+      return False
+  log.log("Bulk polar construction ok")
+  return True
+
+def test():
+  assert testColumnsAreZeroCopyViews()
+  assert testBulkOperationsMatchScalarPoint()
+  assert testPolarConstructionMatchesScalarPoint()
+
+  return 0
+
+if __name__ == '__main__':
+  exit(test() or 0)
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: (C) 2025 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+
+from scene_common import log
+from fast_geometry import Polygon
+
+def testContainsPointsMatchesScalar():
+  polygon = Polygon([(0.0, 0.0), (4.0, 0.0), (4.0, 3.0), (2.0, 5.0), (0.0, 3.0)])
+
+  rng = np.random.default_rng(1234)
+  points = rng.uniform(-2.0, 7.0, size=(5000, 2))
+
+  batch = polygon.containsPoints(points)
+  for idx in range(points.shape[0]):
+    scalar = polygon.isPointInside(points[idx][0], points[idx][1])
+    if bool(batch[idx]) != scalar:
+      print("Mismatch at", points[idx], "batch", bool(batch[idx]), "scalar", scalar)
+      return False
+  log.log("Batch point-in-polygon matches scalar ok")
+  return True
+
+def testConcavePolygonMatchesScalar():
+  # Concave arrow head: exercises the general edge-table path on both sides
+  polygon = Polygon([(0.0, 0.0), (4.0, 2.0), (0.0, 4.0), (1.5, 2.0)])
+
+  rng = np.random.default_rng(99)
+  points = rng.uniform(-1.0, 5.0, size=(5000, 2))
+
+  batch = polygon.containsPoints(points)
+  for idx in range(points.shape[0]):
+    scalar = polygon.isPointInside(points[idx][0], points[idx][1])
+    if bool(batch[idx]) != scalar:
+      print("Mismatch at", points[idx], "batch", bool(batch[idx]), "scalar", scalar)
+      return False
+  log.log("Concave batch/scalar agreement ok")
+  return True
+
+def testContainsPointsPrefilter():
+  polygon = Polygon([(0.0, 0.0), (1.0, 0.0), (1.0, 1.0), (0.0, 1.0)])
+
+  # Everything far outside the bounding box must come back False
+  points = np.array([[10.0, 10.0], [-5.0, 0.5], [0.5, 0.5], [0.5, -3.0]])
+  batch = polygon.containsPoints(points)
+  if bool(batch[0]) or bool(batch[1]) or bool(batch[3]) or not bool(batch[2]):
+    print("Prefilter mismatch:", list(batch))
+    return False
+  log.log("Bounding-box prefilter ok")
+  return True
+
+def testOccupancyMaskIsLossless():
+  # Mask lookups must agree with the exact test everywhere, including near
+  # edges where mixed cells fall back to the crossing test
+  masked = Polygon([(0.0, 0.0), (4.0, 2.0), (0.0, 4.0), (1.5, 2.0)])
+  exact = Polygon([(0.0, 0.0), (4.0, 2.0), (0.0, 4.0), (1.5, 2.0)])
+  masked.buildOccupancyMask(0.25)
+
+  rng = np.random.default_rng(7)
+  points = rng.uniform(-1.0, 5.0, size=(5000, 2))
+
+  masked_batch = masked.containsPoints(points)
+  exact_batch = exact.containsPoints(points)
+  for idx in range(points.shape[0]):
+    if bool(masked_batch[idx]) != bool(exact_batch[idx]):
+      print("Mask mismatch at", points[idx])
+      return False
+    if masked.isPointInside(points[idx][0], points[idx][1]) != bool(exact_batch[idx]):
+      print("Mask scalar mismatch at", points[idx])
+      return False
+  log.log("Occupancy mask lossless ok")
+  return True
+
+def testVertexViewAliasesPolygon():
+  vertices = [(0.0, 0.0), (4.0, 0.0), (4.0, 3.0), (0.0, 3.0)]
+  polygon = Polygon(vertices)
+
+  view = polygon.vertices
+  if view.base is None:
+    print("Vertex view copied instead of aliasing")
+    return False
+  if view.shape != (4, 2) or [tuple(row) for row in view] != vertices:
+    print("Vertex view contents wrong:", view)
+    return False
+  log.log("Zero-copy vertex view ok")
+  return True
+
+def test():
+  assert testContainsPointsMatchesScalar()
+  assert testConcavePolygonMatchesScalar()
+  assert testContainsPointsPrefilter()
+  assert testOccupancyMaskIsLossless()
+  assert testRegionIndexMatchesBruteForce()
+  assert testIouMatrixMatchesRectangle()
+  assert testVertexViewAliasesPolygon()
+
+  return 0
+
+def testRegionIndexMatchesBruteForce():
+  from fast_geometry import RegionIndex
+
+  rng = np.random.default_rng(21)
+  regions = []
+  index = RegionIndex()
+  for region_id in range(50):
+    cx, cy = rng.uniform(0.0, 100.0, size=2)
+    w, h = rng.uniform(1.0, 8.0, size=2)
+    polygon = Polygon([(cx - w, cy - h), (cx + w, cy - h), (cx + w, cy + h), (cx - w, cy + h)])
+    regions.append((region_id, polygon))
+    index.addRegion(region_id, polygon)
+
+  points = rng.uniform(-5.0, 105.0, size=(2000, 2))
+  batch = index.queryRegions(points)
+  for idx in range(points.shape[0]):
+    px, py = points[idx]
+    expected = sorted(rid for rid, poly in regions if poly.isPointInside(px, py))
+    if sorted(batch[idx]) != expected:
+      print("Region mismatch at", points[idx], batch[idx], "vs", expected)
+      return False
+    if sorted(index.regionsForPoint(px, py)) != expected:
+      print("Scalar region mismatch at", points[idx])
+      return False
+  log.log("Region index matches brute force ok")
+  return True
+
+def testIouMatrixMatchesRectangle():
+  from fast_geometry import Point, Rectangle, iouMatrix
+
+  rng = np.random.default_rng(31)
+  def randomBoxes(count):
+    origin = rng.uniform(0.0, 50.0, size=(count, 2))
+    size = rng.uniform(1.0, 10.0, size=(count, 2))
+    return np.hstack([origin, origin + size])
+
+  boxes_a = randomBoxes(20)
+  boxes_b = randomBoxes(30)
+  matrix = iouMatrix(boxes_a, boxes_b)
+
+  for i in range(boxes_a.shape[0]):
+    rect_a = Rectangle(Point(*boxes_a[i][:2]), Point(*boxes_a[i][2:]))
+    for j in range(boxes_b.shape[0]):
+      rect_b = Rectangle(Point(*boxes_b[j][:2]), Point(*boxes_b[j][2:]))
+      overlap = rect_a.intersection(rect_b).area
+      union = rect_a.area + rect_b.area - overlap
+      expected = overlap / union if union > 0 else 0.0
+      if abs(matrix[i][j] - expected) > 1e-9:
+        print("IoU mismatch at", i, j, matrix[i][j], "vs", expected)
+        return False
+  log.log("IoU matrix matches Rectangle ok")
+  return True
+
+if __name__ == '__main__':
+  exit(test() or 0)
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tracker {
+
+/**
+ * @brief Bounding box in pixel coordinates.
+ */
+struct BoundingBox {
+    double x;
+    double y;
+    double width;
+    double height;
+};
+
+/**
+ * @brief Single detection from camera message.
+ */
+struct Detection {
+    std::optional<int> id;
+    BoundingBox bounding_box_px;
+};
+
+/**
+ * @brief Per-message tracing context riding through the pipeline.
+ *
+ * The early stage durations are stamped where those stages run (they are gone
+ * from the call stack by publish time); the later stages are measured at the
+ * publish site directly. id is nonzero only for messages the 1-in-N trace
+ * sampler elected, which emit one correlated log line at publish carrying
+ * every stage boundary.
+ */
+struct TraceContext {
+    std::uint64_t id = 0;                        ///< Correlation id; 0 = not sampled
+    std::chrono::steady_clock::duration queue{}; ///< Receive to processing start
+    std::chrono::steady_clock::duration parse{}; ///< JSON parse and validation
+};
+
+/**
+ * @brief Parsed camera detection message.
+ *
+ * The frame timestamp is numeric from ingest onward: the ISO 8601 input is
+ * parsed once (falling back to arrival time if it does not parse) and only
+ * re-formatted at publish.
+ */
+struct CameraMessage {
+    std::string id;
+    std::chrono::system_clock::time_point timestamp;
+    std::map<std::string, std::vector<Detection>> objects; // category -> detections
+
+    /// Steady-clock arrival time (set at ingest), for latency accounting
+    std::chrono::steady_clock::time_point received_at;
+
+    /// Stage timings and sampling state for latency tracing
+    TraceContext trace;
+};
+
+} // namespace tracker
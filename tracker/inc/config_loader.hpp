@@ -6,6 +6,8 @@
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace tracker {
 
@@ -26,6 +28,24 @@ struct MqttConfig {
     std::string host;
     int port;
     bool insecure = false;
+    /// QoS for outbound publishes; 0 is the fire-and-forget fast path,
+    /// 1 at-least-once (subscriptions always use QoS 1)
+    int publish_qos = 1;
+    /// Outbound publish queue capacity; when the broker lags and the queue
+    /// fills, the oldest queued message is dropped and counted
+    int publish_queue_capacity = 1024;
+    /// Number of broker connections for ingest; above 1 the client shards
+    /// camera traffic across connections via MQTT shared subscriptions
+    int ingest_shards = 1;
+    /// Speak MQTT v5 to the broker: the publish path negotiates topic
+    /// aliases (repeat publishes to a topic carry a two-byte alias instead
+    /// of the topic string) and subscriptions batch into one SUBSCRIBE
+    /// packet. false keeps plain MQTT 3.1.1.
+    bool use_v5 = false;
+    /// Topic aliases the publish path may establish per connection; the
+    /// effective limit is further capped by the broker's advertised
+    /// maximum. Only meaningful with use_v5.
+    int topic_alias_maximum = 16;
     std::optional<TlsConfig> tls;
 };
 
@@ -36,12 +56,63 @@ struct HealthcheckConfig {
     int port = 8080;
 };
 
+/**
+ * @brief Message processing pipeline settings.
+ */
+struct PipelineConfig {
+    int workers = 0;          ///< Worker threads; 0 processes inline on the MQTT callback thread
+    int queue_capacity = 1024; ///< Maximum queued messages per worker
+};
+
+/**
+ * @brief Shared-memory ingest settings for co-located detection producers.
+ *
+ * Cameras listed here deliver detections through a per-camera shared-memory
+ * ring instead of the MQTT round trip; MQTT stays subscribed as the control
+ * and fallback path for every camera.
+ */
+struct ShmIngestConfig {
+    std::vector<std::string> cameras; ///< Cameras ingesting over shared memory
+    /// shm_open segment name prefix; the camera id is appended
+    std::string segment_prefix = "/scenescape_det_";
+};
+
+/**
+ * @brief Scene-boundary ingest filter settings.
+ *
+ * With a boundary polygon configured, detections whose foot point falls
+ * outside it are dropped at ingest, before parsing hands them to the
+ * tracking engine. An empty boundary disables the filter.
+ */
+struct RoiConfig {
+    /// Boundary polygon vertices as (x, y) pairs, in the camera frame
+    std::vector<std::pair<double, double>> boundary;
+    /// Occupancy-mask cell size for rasterized containment; 0 keeps the
+    /// exact test only
+    double mask_cell_size = 0.0;
+};
+
 /**
  * @brief Tracker service settings.
  */
 struct TrackerConfig {
     HealthcheckConfig healthcheck;
     bool schema_validation = true;
+    /// Validate 1-in-N camera messages per camera; 1 validates every message.
+    /// After any failure a camera is fully validated again until it recovers.
+    int validation_sample_rate = 1;
+    /// Coalesce camera frames within this window (ms) into one multi-camera
+    /// tracking update and one scene message; 0 publishes per camera message.
+    int batch_window_ms = 0;
+    /// Scene data wire format: "json", "binary" (compact layout on the /bin
+    /// topic suffix), or "both".
+    std::string scene_output_format = "json";
+    /// Emit a correlated per-message trace log line (stage-by-stage latency)
+    /// for 1-in-N messages; 0 disables trace sampling.
+    int trace_sample_rate = 0;
+    PipelineConfig pipeline;
+    ShmIngestConfig shm_ingest;
+    RoiConfig roi;
 };
 
 /**
@@ -83,9 +154,35 @@ constexpr char INFRASTRUCTURE_TRACKER_HEALTHCHECK_PORT[] =
     "/infrastructure/tracker/healthcheck/port";
 constexpr char INFRASTRUCTURE_TRACKER_SCHEMA_VALIDATION[] =
     "/infrastructure/tracker/schema_validation";
+constexpr char INFRASTRUCTURE_TRACKER_VALIDATION_SAMPLE_RATE[] =
+    "/infrastructure/tracker/validation_sample_rate";
+constexpr char INFRASTRUCTURE_TRACKER_BATCH_WINDOW_MS[] =
+    "/infrastructure/tracker/batch_window_ms";
+constexpr char INFRASTRUCTURE_TRACKER_SCENE_OUTPUT_FORMAT[] =
+    "/infrastructure/tracker/scene_output_format";
+constexpr char INFRASTRUCTURE_TRACKER_TRACE_SAMPLE_RATE[] =
+    "/infrastructure/tracker/trace_sample_rate";
+constexpr char INFRASTRUCTURE_TRACKER_PIPELINE_WORKERS[] =
+    "/infrastructure/tracker/pipeline/workers";
+constexpr char INFRASTRUCTURE_TRACKER_PIPELINE_QUEUE_CAPACITY[] =
+    "/infrastructure/tracker/pipeline/queue_capacity";
+constexpr char INFRASTRUCTURE_TRACKER_SHM_INGEST_CAMERAS[] =
+    "/infrastructure/tracker/shm_ingest/cameras";
+constexpr char INFRASTRUCTURE_TRACKER_SHM_INGEST_SEGMENT_PREFIX[] =
+    "/infrastructure/tracker/shm_ingest/segment_prefix";
+constexpr char INFRASTRUCTURE_TRACKER_ROI_BOUNDARY[] = "/infrastructure/tracker/roi/boundary";
+constexpr char INFRASTRUCTURE_TRACKER_ROI_MASK_CELL_SIZE[] =
+    "/infrastructure/tracker/roi/mask_cell_size";
 constexpr char INFRASTRUCTURE_MQTT_HOST[] = "/infrastructure/mqtt/host";
 constexpr char INFRASTRUCTURE_MQTT_PORT[] = "/infrastructure/mqtt/port";
 constexpr char INFRASTRUCTURE_MQTT_INSECURE[] = "/infrastructure/mqtt/insecure";
+constexpr char INFRASTRUCTURE_MQTT_PUBLISH_QOS[] = "/infrastructure/mqtt/publish_qos";
+constexpr char INFRASTRUCTURE_MQTT_PUBLISH_QUEUE_CAPACITY[] =
+    "/infrastructure/mqtt/publish_queue_capacity";
+constexpr char INFRASTRUCTURE_MQTT_INGEST_SHARDS[] = "/infrastructure/mqtt/ingest_shards";
+constexpr char INFRASTRUCTURE_MQTT_USE_V5[] = "/infrastructure/mqtt/use_v5";
+constexpr char INFRASTRUCTURE_MQTT_TOPIC_ALIAS_MAXIMUM[] =
+    "/infrastructure/mqtt/topic_alias_maximum";
 constexpr char INFRASTRUCTURE_MQTT_TLS[] = "/infrastructure/mqtt/tls";
 constexpr char INFRASTRUCTURE_MQTT_TLS_CA_CERT_PATH[] = "/infrastructure/mqtt/tls/ca_cert_path";
 constexpr char INFRASTRUCTURE_MQTT_TLS_CLIENT_CERT_PATH[] =
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "config_loader.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace tracker {
+
+/**
+ * @brief Lock-free handle to the current configuration snapshot.
+ *
+ * Snapshots are immutable: a reload builds a complete new ServiceConfig and
+ * swaps it in atomically, RCU-style. Readers load the shared pointer without
+ * taking a mutex and keep their snapshot coherent for as long as they hold
+ * it, so a reload mid-message can never show a reader a half-updated config.
+ */
+class ConfigStore {
+public:
+    explicit ConfigStore(ServiceConfig initial)
+        : current_(std::make_shared<const ServiceConfig>(std::move(initial))) {}
+
+    /// Get the current snapshot; cheap enough for per-message use
+    [[nodiscard]] std::shared_ptr<const ServiceConfig> snapshot() const {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    /// Publish a new snapshot; existing readers keep the one they hold
+    void update(ServiceConfig config) {
+        current_.store(std::make_shared<const ServiceConfig>(std::move(config)),
+                       std::memory_order_release);
+    }
+
+private:
+    std::atomic<std::shared_ptr<const ServiceConfig>> current_;
+};
+
+/**
+ * @brief Watches the config file and hot-reloads it into a ConfigStore.
+ *
+ * Polls the file's modification time (robust against editors and Kubernetes
+ * ConfigMap symlink swaps alike, with no platform-specific watch machinery)
+ * and on change re-runs the full load_config() path: JSON parse, schema
+ * validation and environment overrides. A snapshot only replaces the current
+ * one after it validated, so a bad edit can never take down a running
+ * service — the error is logged and the last good config stays active.
+ */
+class ConfigWatcher {
+public:
+    /// Invoked after a successful reload with the fresh and previous snapshots
+    using ReloadCallback =
+        std::function<void(const ServiceConfig& fresh, const ServiceConfig& previous)>;
+
+    /**
+     * @brief Construct watcher; call start() to begin polling.
+     *
+     * @param config_path Path to the JSON configuration file
+     * @param schema_path Path to the config schema file
+     * @param store Store receiving validated snapshots
+     * @param on_reload Callback applying runtime-tunable settings; may be null
+     * @param poll_interval How often to check the file for changes
+     */
+    ConfigWatcher(std::filesystem::path config_path, std::filesystem::path schema_path,
+                  ConfigStore& store, ReloadCallback on_reload,
+                  std::chrono::milliseconds poll_interval = std::chrono::seconds(2));
+
+    /// Stops the watcher if stop() was never called
+    ~ConfigWatcher();
+
+    ConfigWatcher(const ConfigWatcher&) = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    /**
+     * @brief Start the polling thread.
+     */
+    void start();
+
+    /**
+     * @brief Stop the polling thread.
+     */
+    void stop();
+
+    /**
+     * @brief Number of successful reloads since start.
+     */
+    [[nodiscard]] std::size_t getReloadCount() const { return reload_count_; }
+
+private:
+    void watchLoop();
+
+    /// Reload the file into the store; returns false when it did not validate
+    bool reload();
+
+    std::filesystem::path config_path_;
+    std::filesystem::path schema_path_;
+    ConfigStore& store_;
+    ReloadCallback on_reload_;
+    std::chrono::milliseconds poll_interval_;
+
+    std::filesystem::file_time_type last_write_time_;
+    std::atomic<std::size_t> reload_count_{0};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+} // namespace tracker
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string_view>
+
+namespace tracker {
+
+/**
+ * @brief Message schemas embedded into the binary at build time.
+ *
+ * Generated from tracker/schema/*.json by CMake (embedded_schemas.cpp.in) so
+ * startup does not depend on schema files being present on disk: the handler
+ * compiles validators from these copies when the corresponding file is not
+ * readable. A schema file on disk still takes precedence, so operators can
+ * override without a rebuild.
+ */
+namespace embedded_schemas {
+
+/// camera-data.schema.json as shipped in this build
+std::string_view cameraData();
+
+/// scene-data.schema.json as shipped in this build
+std::string_view sceneData();
+
+} // namespace embedded_schemas
+
+} // namespace tracker
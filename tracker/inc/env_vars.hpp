@@ -27,6 +27,22 @@ constexpr const char* MQTT_PORT = "TRACKER_MQTT_PORT";
 /// Environment variable for overriding MQTT insecure mode (true/false)
 constexpr const char* MQTT_INSECURE = "TRACKER_MQTT_INSECURE";
 
+/// QoS for outbound publishes (0 = fire-and-forget fast path, 1, or 2)
+constexpr const char* MQTT_PUBLISH_QOS = "TRACKER_MQTT_PUBLISH_QOS";
+
+/// Outbound publish queue capacity (oldest messages drop when full)
+constexpr const char* MQTT_PUBLISH_QUEUE_CAPACITY = "TRACKER_MQTT_PUBLISH_QUEUE_CAPACITY";
+
+/// Broker connections for ingest (1 = single connection; above 1 shards
+/// camera traffic via MQTT shared subscriptions)
+constexpr const char* MQTT_INGEST_SHARDS = "TRACKER_MQTT_INGEST_SHARDS";
+
+/// Speak MQTT v5 to the broker (true/false); enables publish topic aliases
+constexpr const char* MQTT_USE_V5 = "TRACKER_MQTT_USE_V5";
+
+/// Topic aliases the publish path may establish per connection (0-65535)
+constexpr const char* MQTT_TOPIC_ALIAS_MAXIMUM = "TRACKER_MQTT_TOPIC_ALIAS_MAXIMUM";
+
 /// Environment variable for overriding MQTT TLS CA certificate path
 constexpr const char* MQTT_TLS_CA_CERT = "TRACKER_MQTT_TLS_CA_CERT";
 
@@ -43,4 +59,24 @@ constexpr const char* MQTT_TLS_VERIFY_SERVER = "TRACKER_MQTT_TLS_VERIFY_SERVER";
 /// (true/false)
 constexpr const char* MQTT_SCHEMA_VALIDATION = "TRACKER_MQTT_SCHEMA_VALIDATION";
 
+/// Validate 1-in-N camera messages per camera (1 = validate every message)
+constexpr const char* VALIDATION_SAMPLE_RATE = "TRACKER_VALIDATION_SAMPLE_RATE";
+
+/// Scene data wire format: json, binary, or both
+constexpr const char* SCENE_OUTPUT_FORMAT = "TRACKER_SCENE_OUTPUT_FORMAT";
+
+/// Emit a correlated per-message trace log line for 1-in-N messages
+/// (0 = disabled)
+constexpr const char* TRACE_SAMPLE_RATE = "TRACKER_TRACE_SAMPLE_RATE";
+
+/// Coalesce camera frames within this window (ms) into one tracking update
+/// and one scene message (0 = publish per camera message)
+constexpr const char* BATCH_WINDOW_MS = "TRACKER_BATCH_WINDOW_MS";
+
+/// Message pipeline worker thread count (0 = process inline)
+constexpr const char* PIPELINE_WORKERS = "TRACKER_PIPELINE_WORKERS";
+
+/// Message pipeline queue capacity per worker
+constexpr const char* PIPELINE_QUEUE_CAPACITY = "TRACKER_PIPELINE_QUEUE_CAPACITY";
+
 } // namespace tracker::env
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
+#include <string>
 #include <thread>
 
 // Forward declaration
@@ -19,6 +21,7 @@ namespace tracker {
  * Runs a lightweight HTTP server on configurable port responding to:
  * - /healthz - Liveness probe (is process alive?)
  * - /readyz  - Readiness probe (is service ready to handle traffic?)
+ * - /metrics - Prometheus metrics (only when a provider is set)
  *
  * Responses:
  * - 200 OK with {"status":"healthy"} when respective flag is true
@@ -50,6 +53,17 @@ public:
      */
     HealthcheckServer(int port, std::atomic<bool>& liveness, std::atomic<bool>& readiness);
 
+    /**
+     * @brief Serve Prometheus metrics on /metrics.
+     *
+     * Call before start(). The provider runs on the HTTP server thread at
+     * each scrape and must stay valid until stop() returns; without a
+     * provider the endpoint is not registered.
+     *
+     * @param provider Callback rendering the metrics exposition text
+     */
+    void setMetricsProvider(std::function<std::string()> provider);
+
     /**
      * @brief Start healthcheck server in background thread.
      */
@@ -85,6 +99,7 @@ private:
     int port_;
     std::atomic<bool>& liveness_;
     std::atomic<bool>& readiness_;
+    std::function<std::string()> metrics_provider_;
     std::atomic<bool> shutdown_requested_{false};
     std::thread thread_;
     httplib::Server* server_{nullptr}; // For graceful shutdown
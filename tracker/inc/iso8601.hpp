@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace tracker {
+
+/**
+ * @brief Fast ISO 8601 UTC timestamp conversion.
+ *
+ * Camera messages arrive with one timestamp each at full frame rate, so both
+ * directions avoid the libc date machinery (strptime/timegm walk timezone
+ * state per call): parsing reads the fixed-layout digits directly and the
+ * formatter caches the per-second prefix, re-rendering only the millisecond
+ * suffix while the clock stays within one second.
+ */
+namespace iso8601 {
+
+/**
+ * @brief Parse "YYYY-MM-DDTHH:MM:SS[.fraction][Z]" as UTC.
+ *
+ * Field ranges are validated; anything after the seconds (fraction, zone
+ * designator) is optional and a trailing offset is ignored, matching the
+ * tolerance of the previous scanf-based parser.
+ *
+ * @return Timestamp, or nullopt if the layout or a field range is invalid
+ */
+std::optional<std::chrono::system_clock::time_point> parse(std::string_view text);
+
+/**
+ * @brief Formatter producing "YYYY-MM-DDTHH:MM:SS.mmmZ".
+ *
+ * Caches the date/time prefix for the current second. Not thread-safe; use
+ * one instance per thread (cheap: 32 bytes of state).
+ */
+class Formatter {
+public:
+    /**
+     * @brief Format a timestamp as UTC with millisecond precision.
+     */
+    std::string format(std::chrono::system_clock::time_point timestamp);
+
+private:
+    static constexpr std::size_t PREFIX_LENGTH = 19; ///< "YYYY-MM-DDTHH:MM:SS"
+
+    std::int64_t cached_second_ = std::numeric_limits<std::int64_t>::min();
+    char prefix_[PREFIX_LENGTH] = {};
+};
+
+/**
+ * @brief One-off formatting convenience; prefer a Formatter on hot paths.
+ */
+std::string format(std::chrono::system_clock::time_point timestamp);
+
+} // namespace iso8601
+
+} // namespace tracker
@@ -125,7 +125,12 @@ private:
 #include <quill/sinks/ConsoleSink.h>
 #include <quill/sinks/Sink.h>
 
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 
 namespace tracker {
 
@@ -190,6 +195,9 @@ public:
                      std::shared_ptr<quill::Sink> sink =
                          quill::Frontend::create_or_get_sink<quill::ConsoleSink>("console"));
 
+    // Change the log level at runtime (safe while logging is in progress)
+    static void set_level(std::string_view level);
+
     // Shutdown logger and flush all pending messages
     static void shutdown();
 
@@ -220,6 +228,91 @@ private:
     bool initialized_ = false;
 };
 
+// -----------------------------------------------------------------------------
+// Hot-path log throttling
+//
+// A camera flooding malformed payloads turns every rejection into log I/O and
+// the logger itself into the bottleneck. These helpers degrade pathological
+// input into cheap relaxed-atomic counters: declare one static limiter or
+// sampler per call site and use the LOG_*_LIMITED / LOG_*_SAMPLED macros
+// below, which fold the suppressed count into the next emitted line.
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Token bucket limiting how often one call site may log.
+ *
+ * Lock-free; tryAcquire() costs a couple of relaxed atomic operations when
+ * the bucket is empty. Suppressed calls are counted and reported with the
+ * next message that passes.
+ */
+class LogRateLimiter {
+public:
+    /**
+     * @brief Construct a limiter.
+     *
+     * @param tokens_per_second Sustained messages per second
+     * @param burst Messages allowed to pass back-to-back after a quiet period
+     */
+    LogRateLimiter(double tokens_per_second, double burst);
+
+    /**
+     * @brief Take a token; false means the message should be suppressed.
+     */
+    [[nodiscard]] bool tryAcquire();
+
+    /**
+     * @brief Return and reset the number of calls suppressed since the last
+     *        emitted message.
+     */
+    [[nodiscard]] std::uint64_t takeSuppressed() {
+        return suppressed_.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    /// Tokens are tracked in millionths so fractional rates refill smoothly
+    static constexpr std::int64_t TOKEN_SCALE = 1'000'000;
+
+    void refill();
+
+    double tokens_per_second_;
+    std::int64_t burst_scaled_;
+    std::atomic<std::int64_t> tokens_;
+    std::atomic<std::int64_t> last_refill_us_;
+    std::atomic<std::uint64_t> suppressed_{0};
+};
+
+/**
+ * @brief Per-key (typically per-camera) 1-in-N log sampling.
+ *
+ * Every key's first occurrence logs; afterwards every Nth does. Because the
+ * cadence is deterministic, each emitted message accounts for exactly N-1
+ * suppressed ones, which the macros fold into the line. Key lookup mirrors
+ * the metrics registry: an uncontended shared lock on the steady-state path.
+ */
+class LogSampler {
+public:
+    /// @param sample_rate Log 1-in-N occurrences per key; 1 logs everything
+    explicit LogSampler(std::uint32_t sample_rate)
+        : sample_rate_(sample_rate == 0 ? 1 : sample_rate) {}
+
+    /**
+     * @brief Count an occurrence for @p key.
+     *
+     * @return The number of occurrences suppressed since the last emitted
+     *         message when this one should log, nullopt when it should not
+     */
+    [[nodiscard]] std::optional<std::uint64_t> shouldLog(std::string_view key);
+
+private:
+    std::atomic<std::uint64_t>& counterFor(std::string_view key);
+
+    std::uint32_t sample_rate_;
+    std::shared_mutex mutex_;
+    /// Occurrence counters per key; pointer-stable so references survive
+    /// concurrent insertion of other keys
+    std::map<std::string, std::unique_ptr<std::atomic<std::uint64_t>>, std::less<>> keys_;
+};
+
 } // namespace tracker
 
 // -----------------------------------------------------------------------------
@@ -260,6 +353,43 @@ private:
 
 #define LOG_ERROR(fmt, ...) QUILL_LOG_ERROR(tracker::Logger::get(), fmt, ##__VA_ARGS__)
 
+// Rate-limited logging: declare one static tracker::LogRateLimiter per call
+// site. When the bucket is empty the call degrades to a counter increment;
+// the next message that passes reports how many were suppressed.
+//
+//   static tracker::LogRateLimiter limiter{1.0, 5.0};
+//   LOG_WARN_LIMITED(limiter, "Failed to parse message from {}", camera_id);
+#define LOG_WARN_LIMITED(limiter, fmt, ...)                                                        \
+    do {                                                                                           \
+        if ((limiter).tryAcquire()) {                                                              \
+            const auto log_suppressed_ = (limiter).takeSuppressed();                               \
+            if (log_suppressed_ > 0) {                                                             \
+                QUILL_LOG_WARNING(tracker::Logger::get(), fmt " ({} similar suppressed)",          \
+                                  ##__VA_ARGS__, log_suppressed_);                                 \
+            } else {                                                                               \
+                QUILL_LOG_WARNING(tracker::Logger::get(), fmt, ##__VA_ARGS__);                     \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
+// Sampled logging: declare one static tracker::LogSampler per call site and
+// key it by camera id. Each key's first occurrence logs, then every Nth;
+// emitted lines carry the per-key suppressed count.
+//
+//   static tracker::LogSampler sampler{100};
+//   LOG_WARN_SAMPLED(sampler, camera_id, "Failed to parse camera message from {}", camera_id);
+#define LOG_WARN_SAMPLED(sampler, key, fmt, ...)                                                   \
+    do {                                                                                           \
+        if (const auto log_suppressed_ = (sampler).shouldLog(key)) {                               \
+            if (*log_suppressed_ > 0) {                                                            \
+                QUILL_LOG_WARNING(tracker::Logger::get(), fmt " ({} similar suppressed)",          \
+                                  ##__VA_ARGS__, *log_suppressed_);                                \
+            } else {                                                                               \
+                QUILL_LOG_WARNING(tracker::Logger::get(), fmt, ##__VA_ARGS__);                     \
+            }                                                                                      \
+        }                                                                                          \
+    } while (0)
+
 // Structured logging macros (for LogEntry)
 #define LOG_TRACE_ENTRY(entry) tracker::Logger::log_trace(entry)
 #define LOG_DEBUG_ENTRY(entry) tracker::Logger::log_debug(entry)
@@ -3,15 +3,28 @@
 
 #pragma once
 
+#include "camera_message.hpp"
 #include "config_loader.hpp"
+#include "message_pipeline.hpp"
+#include "metrics.hpp"
 #include "mqtt_client.hpp"
+#include "roi_filter.hpp"
+#include "scene_binary.hpp"
+#include "tracking_engine.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <rapidjson/document.h>
@@ -20,43 +33,43 @@
 namespace tracker {
 
 /**
- * @brief Bounding box in pixel coordinates.
+ * @brief Pool of resettable SchemaValidators for one schema.
+ *
+ * Constructing a rapidjson::SchemaValidator allocates; the pool hands out a
+ * reset validator and takes it back after use, so steady-state validation
+ * reuses the same instances. Thread-safe: pipeline workers acquire
+ * concurrently.
  */
-struct BoundingBox {
-    double x;
-    double y;
-    double width;
-    double height;
-};
+class SchemaValidatorPool {
+public:
+    /// Set the schema validated against; must outlive the pool
+    void setSchema(const rapidjson::SchemaDocument* schema) { schema_ = schema; }
 
-/**
- * @brief Single detection from camera message.
- */
-struct Detection {
-    std::optional<int> id;
-    BoundingBox bounding_box_px;
-};
+    /// Get a reset validator, reusing a pooled one when available
+    std::unique_ptr<rapidjson::SchemaValidator> acquire();
 
-/**
- * @brief Parsed camera detection message.
- */
-struct CameraMessage {
-    std::string id;
-    std::string timestamp;
-    std::map<std::string, std::vector<Detection>> objects; // category -> detections
+    /// Return a validator to the pool for reuse
+    void release(std::unique_ptr<rapidjson::SchemaValidator> validator);
+
+private:
+    const rapidjson::SchemaDocument* schema_ = nullptr;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<rapidjson::SchemaValidator>> free_;
 };
 
 /**
  * @brief Handles MQTT message routing for the tracker service.
  *
- * Subscribes to camera detection topics and publishes track data.
- * Currently outputs dummy fixed data for MQTT infrastructure validation.
+ * Subscribes to camera detection topics, runs the native tracking engine on
+ * parsed detections and publishes the resulting scene tracks. Until scene
+ * configuration is wired into the service, every camera feeds the default
+ * scene.
  *
  * JSON Parsing Notes:
  * - Uses rapidjson for simplicity and schema validation support.
- * - simdjson could be used as a future optimization if profiling shows
- *   MQTT message parsing is a performance bottleneck. Until then, we
- *   prefer simplicity and built-in schema validation with rapidjson.
+ * - When schema validation is disabled, camera messages are parsed with a
+ *   single SAX scan that fills the output structs directly; the DOM is only
+ *   built when a validator needs it.
  */
 class MessageHandler {
 public:
@@ -66,14 +79,24 @@ public:
     /// Topic pattern for scene output (format with scene_id and thing_type)
     static constexpr const char* TOPIC_SCENE_DATA_PATTERN = "scenescape/data/scene/{}/{}";
 
-    /// Default scene ID for dummy output
-    static constexpr const char* DUMMY_SCENE_ID = "dummy-scene";
+    /// Scene every camera maps to until scene configuration is wired in
+    static constexpr const char* DEFAULT_SCENE_ID = "default-scene";
+
+    /// Name of the default scene
+    static constexpr const char* DEFAULT_SCENE_NAME = "Default Scene";
 
-    /// Default scene name for dummy output
-    static constexpr const char* DUMMY_SCENE_NAME = "Test Scene";
+    /// Generic thing type used in the output topic until per-category routing
+    static constexpr const char* DEFAULT_THING_TYPE = "thing";
 
-    /// Default thing type for dummy output
-    static constexpr const char* DUMMY_THING_TYPE = "thing";
+    /// Suffix appended to the scene topic for the binary payload
+    static constexpr const char* TOPIC_BINARY_SUFFIX = "/bin";
+
+    /// Wire format(s) for published scene data
+    enum class SceneOutputFormat {
+        Json,   ///< JSON on the scene topic (default)
+        Binary, ///< Binary only, on the scene topic + TOPIC_BINARY_SUFFIX
+        Both    ///< JSON on the scene topic and binary on the suffixed topic
+    };
 
     /**
      * @brief Construct message handler with MQTT client.
@@ -81,15 +104,81 @@ public:
      * @param mqtt_client Shared pointer to MQTT client interface
      * @param schema_validation Enable JSON schema validation for messages
      * @param schema_dir Directory containing schema files (for validation)
+     * @param pipeline_workers Worker threads for message processing; 0 runs
+     *        processing inline on the MQTT callback thread
+     * @param pipeline_queue_capacity Maximum queued messages per worker
+     * @param validation_sample_rate Validate 1-in-N camera messages per
+     *        camera; 1 validates every message. Any failure re-enables full
+     *        validation for that camera until it recovers.
+     * @param batch_window_ms Coalesce camera frames arriving within this
+     *        window into one multi-camera tracking update and one scene
+     *        message; 0 tracks and publishes per camera message
+     * @param scene_output_format Wire format for scene data: "json",
+     *        "binary", or "both"; unknown values fall back to JSON
+     * @param trace_sample_rate Emit a correlated per-message trace log line
+     *        for 1-in-N messages; 0 disables trace sampling. Stage latency
+     *        histograms are recorded regardless when a metrics registry is
+     *        attached.
      */
     explicit MessageHandler(std::shared_ptr<IMqttClient> mqtt_client, bool schema_validation = true,
-                            const std::filesystem::path& schema_dir = "/scenescape/schema");
+                            const std::filesystem::path& schema_dir = "/scenescape/schema",
+                            std::size_t pipeline_workers = 0,
+                            std::size_t pipeline_queue_capacity = 1024,
+                            int validation_sample_rate = 1, int batch_window_ms = 0,
+                            const std::string& scene_output_format = "json",
+                            int trace_sample_rate = 0);
+
+    /// Joins the batch flusher if stop() was never called
+    ~MessageHandler();
+
+    /**
+     * @brief Attach a metrics registry; call before start().
+     *
+     * Records per-camera message and parse-failure counts, receive-to-publish
+     * latency and (once started) the pipeline queue depth. Without a registry
+     * the hot path carries no instrumentation at all.
+     */
+    void setMetrics(std::shared_ptr<Metrics> metrics) { metrics_ = std::move(metrics); }
+
+    /**
+     * @brief Attach the scene-boundary detection filter; call before start().
+     *
+     * Both ingest paths (MQTT and shared memory) run every parsed detection's
+     * foot point through the filter and drop outsiders before tracking,
+     * counting drops per camera in the metrics registry. Without a filter all
+     * detections pass through. Like pipeline sizing, the boundary is fixed at
+     * start and not part of applyRuntimeConfig().
+     */
+    void setRoiFilter(std::shared_ptr<const RoiFilter> filter) { roi_filter_ = std::move(filter); }
+
+    /**
+     * @brief Apply runtime-tunable settings from a fresh config snapshot.
+     *
+     * Safe to call while messages are flowing: the tunables (schema
+     * validation on/off, validation sample rate, batch window, scene output
+     * format, trace sample rate) are atomics read per message. Pipeline sizing is fixed at
+     * start() and is not applied here; enabling schema validation only works
+     * when the schemas were loaded at startup.
+     */
+    void applyRuntimeConfig(const TrackerConfig& config);
 
     /**
      * @brief Start message handling (subscribe to topics).
      */
     void start();
 
+    /**
+     * @brief Ingest an already-parsed camera message, bypassing MQTT.
+     *
+     * Entry point for alternative transports (shared-memory ingest): the
+     * message joins the same batching/tracking/publish path as MQTT traffic,
+     * skipping only topic parsing, JSON parsing and schema validation.
+     * Thread-safe alongside MQTT ingest. The caller stamps received_at.
+     *
+     * @param message Parsed camera message with received_at set
+     */
+    void ingestCameraMessage(CameraMessage message);
+
     /**
      * @brief Stop message handling.
      */
@@ -110,14 +199,32 @@ public:
      */
     [[nodiscard]] int getRejectedCount() const { return rejected_count_; }
 
+    /**
+     * @brief Get count of messages dropped by a full pipeline queue.
+     */
+    [[nodiscard]] std::size_t getDroppedCount() const {
+        return pipeline_ ? pipeline_->getDroppedCount() : 0;
+    }
+
 private:
     /**
      * @brief Handle incoming camera detection message.
      *
      * @param topic MQTT topic (scenescape/data/camera/{camera_id})
-     * @param payload JSON message payload
+     * @param payload JSON message payload; owned and parsed in place
+     * @param received_at Steady-clock time the message was received, for
+     *        end-to-end latency accounting (includes pipeline queue wait)
+     */
+    void handleCameraMessage(const std::string& topic, std::string payload,
+                             std::chrono::steady_clock::time_point received_at);
+
+    /**
+     * @brief Post-parse path shared by MQTT and direct ingest: batch the
+     *        message or run the tracking update and publish.
+     *
+     * @param message Parsed camera message with received_at set
      */
-    void handleCameraMessage(const std::string& topic, const std::string& payload);
+    void dispatchCameraMessage(CameraMessage message);
 
     /**
      * @brief Extract camera_id from topic.
@@ -130,42 +237,185 @@ private:
     /**
      * @brief Parse camera message from JSON payload.
      *
-     * @param payload JSON payload
+     * Parses in situ: the buffer is mutated during parsing and must not be
+     * reused by the caller afterwards. All extracted fields are copied into
+     * the returned CameraMessage before the buffer goes away.
+     *
+     * @param payload Mutable JSON payload, clobbered by parsing
+     * @param camera_id Camera the payload came from (drives validation sampling)
      * @return Parsed message or nullopt if parsing fails
      */
-    std::optional<CameraMessage> parseCameraMessage(const std::string& payload);
+    std::optional<CameraMessage> parseCameraMessage(std::string& payload,
+                                                    std::string_view camera_id);
 
     /**
-     * @brief Build dummy scene output message using rapidjson.
+     * @brief Decide whether this camera message gets schema validation.
+     *
+     * With a sample rate of N, validates a camera's first message and then
+     * 1-in-N, except while the camera is in full-validation mode after a
+     * failure.
+     */
+    bool shouldValidate(std::string_view camera_id);
+
+    /**
+     * @brief Feed a validation outcome back into the per-camera sampling state.
+     *
+     * A failure switches the camera to full validation; N consecutive passes
+     * switch it back to sampling.
+     */
+    void recordValidationResult(std::string_view camera_id, bool valid);
+
+    /**
+     * @brief Add a parsed camera frame to the pending batch.
+     *
+     * Frames whose timestamps fall within one batch window form one
+     * multi-camera tracking update; a frame from the next epoch flushes the
+     * pending batch before starting a new one.
+     */
+    void enqueueForBatch(CameraMessage message);
+
+    /**
+     * @brief Run one batched tracking update and publish the scene message.
+     */
+    void flushBatch(std::vector<CameraMessage> messages,
+                    std::chrono::system_clock::time_point timestamp);
+
+    /**
+     * @brief Periodically flush a pending batch that no newer frame closed.
+     *
+     * Without this a scene's last frames before a quiet period would sit in
+     * the batch until the next message arrives.
+     */
+    void batchFlusherLoop();
+
+    /// Durations of the serialize and publish stages of one scene update
+    struct PublishTimings {
+        std::chrono::steady_clock::duration serialize{};
+        std::chrono::steady_clock::duration publish{};
+    };
+
+    /**
+     * @brief Publish one scene update in the configured format(s).
+     *
+     * The timestamp is formatted to ISO 8601 exactly once here; JSON goes to
+     * the scene topic, binary to the same topic with TOPIC_BINARY_SUFFIX
+     * appended. Observes the serialize and publish stage histograms and
+     * returns the durations for the trace line.
+     *
+     * @param timestamp Frame timestamp of the update
+     * @param tracks Reliable tracks after the tracking update
+     */
+    PublishTimings publishSceneUpdate(std::chrono::system_clock::time_point timestamp,
+                                      const std::vector<rv::tracking::TrackedObject>& tracks);
+
+    /**
+     * @brief Stamp the message's trace context, sampling 1-in-N messages.
+     *
+     * The id only controls whether the message emits the correlated trace
+     * line at publish; the stage histograms are fed for every message.
+     */
+    void assignTrace(CameraMessage& message);
+
+    /**
+     * @brief Emit the correlated trace log line for a sampled message.
+     *
+     * One line per sampled message at publish, carrying every stage boundary
+     * from receive to publish plus the batch size its scene update covered.
+     * No-op for unsampled messages.
+     */
+    void emitTraceLine(const CameraMessage& message,
+                       std::chrono::steady_clock::duration track_time,
+                       const PublishTimings& publish_timings,
+                       std::chrono::steady_clock::duration total, std::size_t batch_frames);
+
+    /**
+     * @brief Build scene output message from the scene's reliable tracks.
+     *
+     * Serializes straight into the returned payload buffer, which the caller
+     * moves into the outbound publish queue: the wire bytes are written once
+     * and never copied again on their way to the broker.
      *
      * @param timestamp ISO 8601 timestamp from input message
+     * @param tracks Reliable tracks after the tracking update
      * @return JSON string conforming to scene-data.schema.json
      */
-    std::string buildDummySceneMessage(const std::string& timestamp);
+    std::string buildSceneMessage(const std::string& timestamp,
+                                  const std::vector<rv::tracking::TrackedObject>& tracks);
 
     /**
-     * @brief Validate JSON against a schema.
+     * @brief Build the binary scene payload with the same field mapping as
+     *        the JSON output.
+     */
+    std::string buildSceneBinaryMessage(const std::string& timestamp,
+                                        const std::vector<rv::tracking::TrackedObject>& tracks);
+
+    /**
+     * @brief Validate JSON against a schema using a pooled validator.
      *
      * @param doc JSON document to validate
-     * @param schema Schema to validate against (must not be null)
+     * @param pool Validator pool for the target schema (must have a schema set)
      * @return true if valid, false otherwise
      */
-    bool validateJson(const rapidjson::Document& doc,
-                      const rapidjson::SchemaDocument* schema) const;
+    bool validateJson(const rapidjson::Document& doc, SchemaValidatorPool& pool);
 
     /**
-     * @brief Load JSON schema from file.
+     * @brief Load JSON schema from file, falling back to the embedded copy.
+     *
+     * A schema file on disk overrides without a rebuild; when it is absent
+     * the copy embedded at build time is compiled instead, so startup never
+     * blocks on (or fails over) schema file reads.
      *
      * @param schema_path Path to schema file
-     * @return Loaded schema or nullptr if loading fails
+     * @param embedded Build-time schema text used when the file is unreadable
+     * @return Loaded schema or nullptr if both sources fail to parse
      */
     static std::unique_ptr<rapidjson::SchemaDocument>
-    loadSchema(const std::filesystem::path& schema_path);
+    loadSchema(const std::filesystem::path& schema_path, std::string_view embedded);
 
     std::shared_ptr<IMqttClient> mqtt_client_;
-    bool schema_validation_;
+    std::shared_ptr<Metrics> metrics_;
+    std::shared_ptr<const RoiFilter> roi_filter_;
+    std::unique_ptr<TrackingEngine> tracking_engine_;
+    std::atomic<bool> schema_validation_;
+    std::size_t pipeline_workers_;
+    std::size_t pipeline_queue_capacity_;
+    std::unique_ptr<MessagePipeline> pipeline_;
     std::unique_ptr<rapidjson::SchemaDocument> camera_schema_;
     std::unique_ptr<rapidjson::SchemaDocument> scene_schema_;
+    SchemaValidatorPool camera_validator_pool_;
+    SchemaValidatorPool scene_validator_pool_;
+
+    /// Per-camera validation sampling state, guarded by validation_state_mutex_
+    struct CameraValidationState {
+        std::uint64_t message_count = 0; ///< Messages seen (drives 1-in-N sampling)
+        std::uint32_t success_streak = 0; ///< Consecutive passes while in full validation
+        bool force_full = false;          ///< Validate every message after a failure
+    };
+
+    std::atomic<int> validation_sample_rate_;
+    std::unordered_map<std::string, CameraValidationState> validation_state_;
+    std::mutex validation_state_mutex_;
+
+    std::atomic<SceneOutputFormat> scene_output_format_{SceneOutputFormat::Json};
+
+    /// Batching stage state, guarded by batch_mutex_ (the window itself is an
+    /// atomic so config reloads can retune it without the lock). One batch
+    /// suffices as long as every camera feeds the default scene; per-scene
+    /// batches come with scene configuration.
+    std::atomic<int> batch_window_ms_;
+    std::mutex batch_mutex_;
+    std::condition_variable batch_cv_;
+    std::vector<CameraMessage> batch_messages_;
+    std::chrono::system_clock::time_point batch_epoch_;    ///< Frame timestamp opening the window
+    std::chrono::system_clock::time_point batch_latest_;   ///< Newest frame timestamp in the batch
+    std::chrono::steady_clock::time_point batch_started_;  ///< Arrival time of the first frame
+    std::thread batch_flusher_;
+    bool batch_stop_ = false;
+
+    /// Trace sampling: every message bumps the sequence; 1-in-N of them gets
+    /// the sequence value as its correlation id
+    std::atomic<int> trace_sample_rate_;
+    std::atomic<std::uint64_t> trace_sequence_{0};
 
     std::atomic<int> received_count_{0};
     std::atomic<int> published_count_{0};
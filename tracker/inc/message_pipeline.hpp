@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tracker {
+
+/**
+ * @brief Bounded pipeline decoupling MQTT receive from message processing.
+ *
+ * The Paho callback thread only enqueues raw (topic, payload) pairs; a fixed
+ * pool of workers runs the processor. Messages are routed to workers by a
+ * hash of the topic, so everything from one camera lands on the same worker
+ * and per-camera ordering is preserved while different cameras are processed
+ * in parallel.
+ *
+ * Each worker's queue is bounded. When a queue is full the incoming message
+ * is dropped and counted rather than blocking the receive thread, favoring
+ * ingest liveness over completeness under overload.
+ */
+class MessagePipeline {
+public:
+    /// Processor invoked on a worker thread: (topic, payload, received_at) ->
+    /// void. The payload is handed over by value (moved out of the queue) so
+    /// the processor owns the buffer and may parse it in place; received_at is
+    /// the enqueue time, letting the processor account for queue wait in
+    /// end-to-end latency.
+    using Processor =
+        std::function<void(const std::string&, std::string, std::chrono::steady_clock::time_point)>;
+
+    /**
+     * @brief Construct pipeline; call start() before enqueueing.
+     *
+     * @param processor Callback run on worker threads for each message
+     * @param worker_count Number of worker threads (at least 1)
+     * @param queue_capacity Maximum queued messages per worker
+     */
+    MessagePipeline(Processor processor, std::size_t worker_count, std::size_t queue_capacity);
+
+    ~MessagePipeline();
+
+    MessagePipeline(const MessagePipeline&) = delete;
+    MessagePipeline& operator=(const MessagePipeline&) = delete;
+
+    /**
+     * @brief Start the worker threads.
+     */
+    void start();
+
+    /**
+     * @brief Stop workers after draining already-queued messages.
+     */
+    void stop();
+
+    /**
+     * @brief Enqueue a message for processing.
+     *
+     * @param topic MQTT topic (used for worker routing)
+     * @param payload Raw message payload
+     * @return true if queued, false if the target queue was full and the
+     *         message was dropped
+     */
+    bool enqueue(std::string topic, std::string payload);
+
+    /**
+     * @brief Get count of messages dropped because a queue was full.
+     */
+    [[nodiscard]] std::size_t getDroppedCount() const { return dropped_count_; }
+
+    /**
+     * @brief Get current total queued messages across all workers.
+     *
+     * Takes each worker's queue lock briefly; intended for metrics scrapes,
+     * not hot paths.
+     */
+    [[nodiscard]] std::size_t getQueueDepth() const;
+
+private:
+    struct QueuedMessage {
+        std::string topic;
+        std::string payload;
+        std::chrono::steady_clock::time_point received_at;
+    };
+
+    /// One worker: dedicated queue keeps per-camera ordering; the thread
+    /// drains it in FIFO order
+    struct Worker {
+        std::deque<QueuedMessage> queue;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread thread;
+    };
+
+    void workerLoop(Worker& worker);
+
+    Processor processor_;
+    std::size_t queue_capacity_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+    std::atomic<std::size_t> dropped_count_{0};
+};
+
+} // namespace tracker
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tracker {
+
+/**
+ * @brief Counter sharded across cache lines to keep increments contention-free.
+ *
+ * Each thread increments its own shard with a relaxed atomic add, so counting
+ * on the message hot path never bounces a cache line between workers. Reads
+ * sum the shards and are approximate while writers are active, which is fine
+ * for monitoring.
+ */
+class ShardedCounter {
+public:
+    /// Add to this thread's shard (relaxed; never contends with other threads)
+    void increment(std::uint64_t delta = 1) {
+        shards_[shardIndex()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    /// Sum of all shards
+    [[nodiscard]] std::uint64_t value() const {
+        std::uint64_t total = 0;
+        for (const auto& shard : shards_) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    static constexpr std::size_t SHARD_COUNT = 16;
+
+    struct alignas(64) Shard {
+        std::atomic<std::uint64_t> value{0};
+    };
+
+    /// Stable per-thread shard assignment (round-robin over thread creation)
+    static std::size_t shardIndex();
+
+    Shard shards_[SHARD_COUNT];
+};
+
+/**
+ * @brief Fixed-bucket latency histogram in Prometheus cumulative form.
+ *
+ * Buckets are log-spaced from 1 ms to 1 s plus +Inf, covering everything from
+ * healthy in-process latency to a badly backed-up pipeline. Observations are
+ * relaxed atomic increments; one observation happens per scene publish, so
+ * plain (unsharded) atomics suffice here.
+ */
+class LatencyHistogram {
+public:
+    /// Upper bounds in microseconds; +Inf is implicit as a final bucket
+    static constexpr std::int64_t BUCKET_BOUNDS_US[] = {
+        1000, 2000, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000};
+    static constexpr std::size_t BUCKET_COUNT = std::size(BUCKET_BOUNDS_US) + 1;
+
+    /// Record one latency observation
+    void observe(std::chrono::steady_clock::duration latency);
+
+    /// Per-bucket counts (not cumulative), +Inf last
+    [[nodiscard]] std::uint64_t bucketCount(std::size_t bucket) const {
+        return buckets_[bucket].load(std::memory_order_relaxed);
+    }
+
+    /// Total number of observations
+    [[nodiscard]] std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    /// Sum of all observations in microseconds
+    [[nodiscard]] std::uint64_t sumMicroseconds() const {
+        return sum_us_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint64_t> buckets_[BUCKET_COUNT] = {};
+    std::atomic<std::uint64_t> count_{0};
+    std::atomic<std::uint64_t> sum_us_{0};
+};
+
+/**
+ * @brief Pipeline stages timed per message for the stage latency histograms.
+ *
+ * Stages follow one camera message from receive to publish; each is observed
+ * only on the paths where it actually runs (shared-memory ingest skips Queue
+ * and Parse, batched updates observe Track/Serialize/Publish once per flush).
+ */
+enum class PipelineStage : std::size_t {
+    Queue = 0, ///< Receive to processing start (pipeline queue wait)
+    Parse,     ///< JSON parse and schema validation
+    Track,     ///< Tracking engine update
+    Serialize, ///< Scene message construction (JSON and/or binary)
+    Publish,   ///< Handing the payload(s) to the MQTT client
+    COUNT
+};
+
+/// Prometheus label value for a pipeline stage
+[[nodiscard]] std::string_view pipelineStageName(PipelineStage stage);
+
+/**
+ * @brief Per-camera counters, incremented on the message hot path.
+ */
+struct CameraStats {
+    ShardedCounter received;       ///< Messages received from this camera
+    ShardedCounter parse_failures; ///< Messages rejected during parse/validation
+    ShardedCounter roi_dropped;    ///< Detections dropped outside the scene boundary
+};
+
+/**
+ * @brief Registry backing the /metrics endpoint.
+ *
+ * Hot-path instrumentation goes through ShardedCounter and LatencyHistogram
+ * so it adds no lock contention; the only lock on the message path is the
+ * shared (read) lock locating a camera's stats, which is uncontended after
+ * each camera's first message. Gauges are sampled lazily at scrape time
+ * through registered callbacks, so queue depths cost nothing between scrapes.
+ */
+class Metrics {
+public:
+    /**
+     * @brief Get (or create) the stats slot for a camera.
+     *
+     * The returned reference stays valid for the registry's lifetime, so hot
+     * paths may hold it across increments without re-locking.
+     */
+    CameraStats& camera(std::string_view camera_id);
+
+    /// Receive-to-publish latency of scene updates
+    LatencyHistogram& publishLatency() { return publish_latency_; }
+
+    /// Latency of one pipeline stage (see PipelineStage)
+    LatencyHistogram& stageLatency(PipelineStage stage) {
+        return stage_latency_[static_cast<std::size_t>(stage)];
+    }
+
+    /**
+     * @brief Register a metric sampled via callback at scrape time.
+     *
+     * @param name Prometheus metric name
+     * @param help HELP text
+     * @param type Prometheus type ("gauge" or "counter")
+     * @param value Callback producing the current value; must stay valid
+     *        until the registry is destroyed or clearSampledMetrics() runs
+     */
+    void registerSampledMetric(std::string name, std::string help, std::string type,
+                               std::function<double()> value);
+
+    /// Drop all registered callbacks (before their referents are torn down)
+    void clearSampledMetrics();
+
+    /**
+     * @brief Render all metrics in the Prometheus text exposition format.
+     */
+    [[nodiscard]] std::string renderPrometheus();
+
+private:
+    struct SampledMetric {
+        std::string name;
+        std::string help;
+        std::string type;
+        std::function<double()> value;
+    };
+
+    /// Camera map is read-mostly: shared lock on lookup, unique lock only when
+    /// a camera is first seen. Values are pointer-stable across inserts.
+    std::shared_mutex camera_mutex_;
+    std::map<std::string, std::unique_ptr<CameraStats>, std::less<>> cameras_;
+
+    LatencyHistogram publish_latency_;
+    LatencyHistogram stage_latency_[static_cast<std::size_t>(PipelineStage::COUNT)];
+
+    std::mutex sampled_mutex_;
+    std::vector<SampledMetric> sampled_metrics_;
+};
+
+} // namespace tracker
@@ -4,15 +4,19 @@
 #pragma once
 
 #include "config_loader.hpp"
+#include "publish_queue.hpp"
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <mqtt/async_client.h>
 
@@ -26,8 +30,11 @@ namespace tracker {
  */
 class IMqttClient {
 public:
-    /// Callback type for received messages: (topic, payload) -> void
-    using MessageCallback = std::function<void(const std::string&, const std::string&)>;
+    /// Callback type for received messages: (topic, payload) -> void.
+    /// The payload is passed by value so ownership of the buffer transfers to
+    /// the callback: it is copied out of the Paho message exactly once and can
+    /// then be moved (and mutated, e.g. for in-situ JSON parsing) downstream.
+    using MessageCallback = std::function<void(const std::string&, std::string)>;
 
     virtual ~IMqttClient() = default;
 
@@ -51,6 +58,20 @@ public:
      */
     virtual void subscribe(const std::string& topic) = 0;
 
+    /**
+     * @brief Subscribe to several topics at once.
+     *
+     * Implementations that can batch the filters into a single SUBSCRIBE
+     * packet should; the default forwards one subscribe() per topic.
+     *
+     * @param topics Topic patterns (wildcards supported)
+     */
+    virtual void subscribe(const std::vector<std::string>& topics) {
+        for (const auto& topic : topics) {
+            subscribe(topic);
+        }
+    }
+
     /**
      * @brief Unsubscribe from a topic.
      *
@@ -66,6 +87,21 @@ public:
      */
     virtual void publish(const std::string& topic, const std::string& payload) = 0;
 
+    /**
+     * @brief Publish a message, transferring ownership of the payload buffer.
+     *
+     * Implementations with an outbound queue move the buffer through the
+     * queue into the broker message with no copies; the default forwards to
+     * the copying overload so mocks and simple implementations only override
+     * one method.
+     *
+     * @param topic Topic to publish to
+     * @param payload Message payload, moved from the caller
+     */
+    virtual void publish(const std::string& topic, std::string&& payload) {
+        publish(topic, payload);
+    }
+
     /**
      * @brief Set callback for received messages.
      *
@@ -82,6 +118,20 @@ public:
      * @brief Check if subscribed to topics.
      */
     [[nodiscard]] virtual bool isSubscribed() const = 0;
+
+    /**
+     * @brief Get count of outbound messages dropped by a full publish queue.
+     *
+     * Default 0 for implementations without an outbound queue (mocks).
+     */
+    [[nodiscard]] virtual std::size_t getPublishDroppedCount() const { return 0; }
+
+    /**
+     * @brief Get current depth of the outbound publish queue.
+     *
+     * Default 0 for implementations without an outbound queue (mocks).
+     */
+    [[nodiscard]] virtual std::size_t getPublishQueueDepth() const { return 0; }
 };
 
 /**
@@ -91,12 +141,18 @@ public:
  * - Automatic reconnection with exponential backoff (1s → 30s max)
  * - TLS/mTLS connection support
  * - Thread-safe connection state queries
- * - QoS 1 for all publish/subscribe operations
+ * - QoS 1 subscriptions; publish QoS configurable (0 = fire-and-forget)
+ * - Asynchronous publishing through a bounded drop-oldest queue drained by a
+ *   dedicated publisher thread, so a lagging broker never stalls callers
+ * - Optional MQTT v5 (use_v5): publishes establish topic aliases so repeat
+ *   publishes to a topic carry a two-byte alias instead of the topic string,
+ *   and subscriptions batch into one SUBSCRIBE packet
  */
 class MqttClient : public IMqttClient, public mqtt::callback, public mqtt::iaction_listener {
 public:
     // MQTT QoS: 0=at-most-once (can drop), 1=at-least-once (may duplicate), 2=exactly-once (highest
-    // overhead)
+    // overhead). Subscriptions always use this; publishes use the configured
+    // publish_qos (QoS 0 skips broker acknowledgement tracking entirely).
     static constexpr int MQTT_QOS = 1;
 
     /// Callback type for received messages: (topic, payload) -> void
@@ -107,8 +163,11 @@ public:
      *
      * @param config MQTT configuration with host, port, SSL settings
      * @param max_reconnect_delay_s Maximum reconnection delay in seconds (default: 30)
+     * @param client_id_suffix Appended to the generated client id; sharded
+     *        ingest uses it to keep each connection's id unique
      */
-    explicit MqttClient(const MqttConfig& config, int max_reconnect_delay_s = 30);
+    explicit MqttClient(const MqttConfig& config, int max_reconnect_delay_s = 30,
+                        const std::string& client_id_suffix = "");
 
     ~MqttClient() override;
 
@@ -141,6 +200,13 @@ public:
      */
     void subscribe(const std::string& topic) override;
 
+    /**
+     * @brief Subscribe to several topics with one SUBSCRIBE packet.
+     *
+     * @param topics Topic patterns (wildcards supported)
+     */
+    void subscribe(const std::vector<std::string>& topics) override;
+
     /**
      * @brief Unsubscribe from a topic.
      *
@@ -149,13 +215,30 @@ public:
     void unsubscribe(const std::string& topic) override;
 
     /**
-     * @brief Publish a message with QoS 1.
+     * @brief Queue a message for asynchronous publishing.
+     *
+     * Returns immediately: the payload moves into the outbound queue and the
+     * publisher thread performs the broker publish with the configured QoS.
+     * When the broker lags and the queue fills, the oldest queued message is
+     * dropped and counted (see getPublishDroppedCount()).
      *
      * @param topic Topic to publish to
      * @param payload Message payload (JSON string)
      */
     void publish(const std::string& topic, const std::string& payload) override;
 
+    /**
+     * @brief Queue a message for asynchronous publishing without copying.
+     *
+     * The payload buffer moves into the outbound queue and from there into
+     * the Paho message, so the bytes the serializer wrote are the bytes the
+     * wire sees: one buffer, owned by the queue until the broker send.
+     *
+     * @param topic Topic to publish to
+     * @param payload Message payload, moved from the caller
+     */
+    void publish(const std::string& topic, std::string&& payload) override;
+
     /**
      * @brief Set callback for received messages.
      *
@@ -177,6 +260,20 @@ public:
      */
     [[nodiscard]] bool isSubscribed() const override;
 
+    /**
+     * @brief Get count of outbound messages dropped by a full publish queue.
+     */
+    [[nodiscard]] std::size_t getPublishDroppedCount() const override {
+        return publish_queue_ ? publish_queue_->getDroppedCount() : 0;
+    }
+
+    /**
+     * @brief Get current depth of the outbound publish queue.
+     */
+    [[nodiscard]] std::size_t getPublishQueueDepth() const override {
+        return publish_queue_ ? publish_queue_->getDepth() : 0;
+    }
+
     /**
      * @brief Generate client ID in format tracker-{hostname}-{pid}.
      */
@@ -211,6 +308,21 @@ private:
      */
     mqtt::ssl_options buildTlsOptions() const;
 
+    /**
+     * @brief Perform the actual broker publish; runs on the publisher thread.
+     *
+     * With MQTT v5 and a broker that accepts topic aliases, the first
+     * publish to a topic establishes an alias and every later publish sends
+     * the two-byte alias with an empty topic name.
+     */
+    void publishNow(const std::string& topic, std::string payload);
+
+    /**
+     * @brief Send one SUBSCRIBE packet for the given filters; caller holds
+     *        subscriptions_mutex_ or passes a private copy.
+     */
+    void subscribeNow(const std::vector<std::string>& topics);
+
     /**
      * @brief Schedule reconnection with exponential backoff.
      */
@@ -231,6 +343,20 @@ private:
     // Paho client
     std::unique_ptr<mqtt::async_client> client_;
     mqtt::connect_options conn_opts_;
+    bool conn_opts_built_ = false; ///< Options (and TLS context) build lazily on first connect()
+
+    // Outbound publish queue drained by the publisher thread
+    std::unique_ptr<PublishQueue> publish_queue_;
+
+    // MQTT v5 topic-alias state. The map and counters belong to the
+    // publisher thread alone; the connection generation and the broker's
+    // advertised cap are the handshake with the connect callbacks. Aliases
+    // are per connection, so a generation bump discards the map.
+    std::atomic<std::uint32_t> connection_generation_{0};
+    std::atomic<std::uint16_t> broker_topic_alias_max_{0};
+    std::unordered_map<std::string, std::uint16_t> topic_aliases_;
+    std::uint16_t next_topic_alias_ = 1;
+    std::uint32_t alias_generation_ = 0;
 
     // State
     std::atomic<bool> connected_{false};
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace tracker {
+
+/**
+ * @brief Bounded outbound queue decoupling publishers from the broker.
+ *
+ * Processing threads only enqueue (topic, payload) pairs; a dedicated
+ * publisher thread drains the queue through the sink that performs the actual
+ * broker publish. A slow or unreachable broker therefore backs up this queue
+ * instead of stalling detection processing.
+ *
+ * The queue is bounded with drop-oldest semantics: when the broker lags far
+ * enough that the queue fills, the stalest scene update is discarded and
+ * counted, keeping the freshest state flowing. Payload buffers are moved from
+ * the caller through the queue into the sink without intermediate copies.
+ */
+class PublishQueue {
+public:
+    /// Sink invoked on the publisher thread for each message; owns the payload
+    using Sink = std::function<void(const std::string&, std::string)>;
+
+    /**
+     * @brief Construct queue; call start() before enqueueing.
+     *
+     * @param sink Callback performing the actual publish
+     * @param capacity Maximum queued messages before the oldest is dropped
+     */
+    PublishQueue(Sink sink, std::size_t capacity);
+
+    ~PublishQueue();
+
+    PublishQueue(const PublishQueue&) = delete;
+    PublishQueue& operator=(const PublishQueue&) = delete;
+
+    /**
+     * @brief Start the publisher thread.
+     */
+    void start();
+
+    /**
+     * @brief Stop the publisher after draining already-queued messages.
+     */
+    void stop();
+
+    /**
+     * @brief Enqueue a message for publishing.
+     *
+     * Never blocks: when the queue is full the oldest queued message is
+     * dropped (and counted) to make room.
+     *
+     * @param topic Topic to publish to
+     * @param payload Message payload, moved into the queue
+     */
+    void enqueue(std::string topic, std::string payload);
+
+    /**
+     * @brief Get count of messages dropped because the queue was full.
+     */
+    [[nodiscard]] std::size_t getDroppedCount() const { return dropped_count_; }
+
+    /**
+     * @brief Get current queued message count (for metrics scrapes).
+     */
+    [[nodiscard]] std::size_t getDepth() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
+private:
+    struct QueuedMessage {
+        std::string topic;
+        std::string payload;
+    };
+
+    void publisherLoop();
+
+    Sink sink_;
+    std::size_t capacity_;
+    std::deque<QueuedMessage> queue_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<std::size_t> dropped_count_{0};
+};
+
+} // namespace tracker
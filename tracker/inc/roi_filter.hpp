@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "camera_message.hpp"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace tracker {
+
+/**
+ * @brief Scene-boundary detection filter for the ingest path.
+ *
+ * Drops detections whose foot point falls outside the scene boundary polygon
+ * before they reach the tracking engine, so out-of-scene detections (parking
+ * lot edges, reflections) never pay the track-and-publish cost. The foot
+ * point is the bottom center of the detection's bounding box, in the same
+ * camera frame the service tracks in.
+ *
+ * Containment uses the crossing-number test against an edge table built at
+ * construction, prefiltered by the polygon's bounding box. With a positive
+ * mask cell size an occupancy mask is rasterized over the bounding box:
+ * cells no boundary edge passes through become O(1) lookups, cells an edge
+ * crosses keep the exact test, so masked results match the exact path.
+ *
+ * Immutable after construction and therefore safe to share across pipeline
+ * workers without locking.
+ */
+class RoiFilter {
+public:
+    /**
+     * @brief Build the filter for a boundary polygon.
+     *
+     * @param boundary Polygon vertices as (x, y) pairs; any winding order
+     * @param mask_cell_size Occupancy-mask cell size; 0 skips the mask and
+     *        every query runs the exact crossing-number test
+     *
+     * @throws std::invalid_argument if the boundary has fewer than three
+     *         vertices or the cell size is negative
+     */
+    explicit RoiFilter(std::vector<std::pair<double, double>> boundary,
+                       double mask_cell_size = 0.0);
+
+    /**
+     * @brief Whether the point lies inside the boundary polygon.
+     */
+    [[nodiscard]] bool contains(double x, double y) const;
+
+    /**
+     * @brief Drop the message's detections whose foot point is outside.
+     *
+     * The foot point is the bounding box's bottom center. Surviving
+     * detections keep their relative order; categories left without
+     * detections are removed.
+     *
+     * @param message Parsed camera message, filtered in place
+     * @return Number of detections dropped
+     */
+    std::size_t filterDetections(CameraMessage& message) const;
+
+private:
+    /// One precomputed crossing-number edge
+    struct Edge {
+        double yi;
+        double yj;
+        double xi;
+        double inv_slope; ///< (xj - xi) / (yj - yi), 0 for horizontal edges
+    };
+
+    /// Occupancy mask cell states
+    static constexpr unsigned char MASK_OUTSIDE = 0;
+    static constexpr unsigned char MASK_INSIDE = 1;
+    static constexpr unsigned char MASK_MIXED = 2; ///< Edge crosses the cell; exact test decides
+
+    [[nodiscard]] bool exactContains(double x, double y) const;
+    void buildOccupancyMask(double cell_size);
+
+    std::vector<std::pair<double, double>> boundary_;
+    std::vector<Edge> edges_;
+
+    // Bounding box of the boundary, the cheap first reject
+    double min_x_;
+    double min_y_;
+    double max_x_;
+    double max_y_;
+
+    bool mask_enabled_ = false;
+    double mask_cell_size_ = 0.0;
+    int mask_cols_ = 0;
+    int mask_rows_ = 0;
+    std::vector<unsigned char> mask_;
+};
+
+} // namespace tracker
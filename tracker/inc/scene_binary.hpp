@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tracker {
+
+/**
+ * @brief Compact binary wire format for scene data.
+ *
+ * Field-for-field equivalent of scene-data.schema.json, for deployments where
+ * both producer and consumers are ours and JSON serialization plus broker
+ * bandwidth dominate at high scene rates. Numbers go over the wire as raw
+ * little-endian doubles instead of decimal text, which is where most of the
+ * size and CPU savings come from.
+ *
+ * Layout (little-endian, no padding):
+ *   magic "SSCB" (4 bytes), version u8
+ *   scene id:    u16 length + bytes
+ *   scene name:  u16 length + bytes
+ *   timestamp:   u16 length + bytes
+ *   track count: u32
+ *   per track:   i64 id, u16 category length + bytes,
+ *                13 doubles (translation xyz, velocity xyz, size lwh,
+ *                rotation xyzw)
+ */
+namespace scene_binary {
+
+/// Format version emitted by serialize(); parsers reject other versions
+constexpr std::uint8_t FORMAT_VERSION = 1;
+
+/// One track in schema field order
+struct TrackRecord {
+    std::int64_t id = 0;
+    std::string category;
+    double translation[3] = {0.0, 0.0, 0.0};
+    double velocity[3] = {0.0, 0.0, 0.0};
+    double size[3] = {0.0, 0.0, 0.0};
+    double rotation[4] = {0.0, 0.0, 0.0, 1.0};
+};
+
+/// A decoded scene message
+struct SceneMessage {
+    std::string scene_id;
+    std::string scene_name;
+    std::string timestamp;
+    std::vector<TrackRecord> tracks;
+};
+
+/**
+ * @brief Serialize a scene update to the binary wire format.
+ */
+std::string serialize(std::string_view scene_id, std::string_view scene_name,
+                      std::string_view timestamp, const std::vector<TrackRecord>& tracks);
+
+/**
+ * @brief Parse a binary scene payload; nullopt if malformed or wrong version.
+ */
+std::optional<SceneMessage> parse(std::string_view payload);
+
+} // namespace scene_binary
+
+} // namespace tracker
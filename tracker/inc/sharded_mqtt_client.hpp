@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "config_loader.hpp"
+#include "mqtt_client.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tracker {
+
+/**
+ * @brief IMqttClient fanning ingest across multiple broker connections.
+ *
+ * A single Paho connection serializes all camera traffic through one socket
+ * and one callback dispatcher, which caps ingest around the throughput of
+ * that one thread. This client opens N independent connections and splits the
+ * load:
+ *
+ * - Subscriptions use MQTT shared subscriptions ($share/<group>/<topic>): all
+ *   shards join one group and the broker partitions camera topics across the
+ *   group's connections. With a hash-by-topic balancing strategy (EMQX
+ *   "hash_topic", HiveMQ equivalent) each camera sticks to one connection,
+ *   preserving per-camera ordering end to end; configure the broker
+ *   accordingly. Client-side partitioning by camera id is not expressible as
+ *   MQTT topic filters without enumerating every camera up front.
+ * - Publishes are routed to a shard by topic hash, so outbound traffic also
+ *   spreads across the sockets.
+ * - Each shard is a full MqttClient and keeps its own reconnect backoff and
+ *   publish queue; one broker hiccup only disturbs that shard.
+ *
+ * Run the message pipeline with worker threads when sharding: callbacks
+ * arrive on N dispatcher threads and the pipeline's topic-hash routing is
+ * what restores per-camera ordering downstream.
+ */
+class ShardedMqttClient : public IMqttClient {
+public:
+    /// Shared-subscription group joined by every shard
+    static constexpr const char* SHARE_GROUP = "tracker-ingest";
+
+    /**
+     * @brief Construct one MqttClient per shard.
+     *
+     * @param config MQTT configuration used by every shard
+     * @param shard_count Number of broker connections (at least 1)
+     * @param max_reconnect_delay_s Maximum reconnection delay per shard
+     */
+    explicit ShardedMqttClient(const MqttConfig& config, std::size_t shard_count,
+                               int max_reconnect_delay_s = 30);
+
+    void connect() override;
+    void
+    disconnect(std::chrono::milliseconds drain_timeout = std::chrono::milliseconds(2000)) override;
+
+    /// Subscribe every shard through the shared-subscription group
+    void subscribe(const std::string& topic) override;
+
+    /// Batched variant: one SUBSCRIBE packet per shard for all filters
+    void subscribe(const std::vector<std::string>& topics) override;
+
+    void unsubscribe(const std::string& topic) override;
+
+    /// Route the publish to a shard by topic hash
+    void publish(const std::string& topic, const std::string& payload) override;
+
+    /// Move-aware variant: the payload buffer moves into the shard's queue
+    void publish(const std::string& topic, std::string&& payload) override;
+
+    /// Set the (thread-safe) callback on every shard
+    void setMessageCallback(MessageCallback callback) override;
+
+    /// True only when every shard is connected
+    [[nodiscard]] bool isConnected() const override;
+
+    /// True only when every shard is subscribed
+    [[nodiscard]] bool isSubscribed() const override;
+
+    /// Sum of dropped outbound messages across the shards' publish queues
+    [[nodiscard]] std::size_t getPublishDroppedCount() const override;
+
+    /// Sum of outbound publish queue depths across shards
+    [[nodiscard]] std::size_t getPublishQueueDepth() const override;
+
+    /**
+     * @brief Shard index a topic's publishes are routed to.
+     *
+     * Pure function exposed for unit testing; stable for a given topic so one
+     * scene's output always leaves through the same connection.
+     */
+    static std::size_t shardForTopic(const std::string& topic, std::size_t shard_count);
+
+    /**
+     * @brief Wrap a topic filter in the shared-subscription group syntax.
+     *
+     * Pure function exposed for unit testing.
+     */
+    static std::string makeSharedTopic(const std::string& topic);
+
+private:
+    std::vector<std::unique_ptr<MqttClient>> shards_;
+};
+
+} // namespace tracker
@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "camera_message.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace tracker {
+
+/**
+ * @brief Single-producer single-consumer ring buffer in POSIX shared memory.
+ *
+ * Transport for co-located detection producers: when the pipeline server runs
+ * on the same host as the tracker, detections can skip the MQTT round trip
+ * (serialize -> TCP -> broker -> TCP -> parse) and move through a per-camera
+ * shared-memory segment instead.
+ *
+ * Layout: a RingHeader (magic "SDSM", version, slot geometry, cache-line
+ * separated head/tail counters) followed by slot_count fixed-size slots, each
+ * holding a u32 record length plus the record bytes. The producer advances
+ * head, the consumer advances tail; with one thread on each side the
+ * acquire/release pair on those counters is the only synchronization needed.
+ * When the ring is full tryPush() fails and the producer is expected to fall
+ * back to MQTT.
+ *
+ * The producer create()s the segment; the consumer open()s it and polls.
+ */
+class ShmRing {
+public:
+    /// Layout version stamped into the header; open() rejects other versions
+    static constexpr std::uint8_t FORMAT_VERSION = 1;
+
+    ~ShmRing();
+
+    // Non-copyable, non-movable (owns the mapping)
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+    ShmRing(ShmRing&&) = delete;
+    ShmRing& operator=(ShmRing&&) = delete;
+
+    /**
+     * @brief Create (or replace) a segment; producer side.
+     *
+     * @param name Segment name ("/..."), passed to shm_open
+     * @param slot_count Number of slots; rounded up to a power of two
+     * @param slot_size Bytes per slot, including the u32 length prefix
+     * @return Ring handle, or nullptr on failure (logged)
+     */
+    static std::unique_ptr<ShmRing> create(const std::string& name, std::uint32_t slot_count,
+                                           std::uint32_t slot_size);
+
+    /**
+     * @brief Open an existing segment; consumer side.
+     *
+     * @param name Segment name previously create()d by the producer
+     * @return Ring handle, or nullptr if the segment does not exist yet or
+     *         has an incompatible header (the consumer retries later)
+     */
+    static std::unique_ptr<ShmRing> open(const std::string& name);
+
+    /**
+     * @brief Copy one record into the ring; false when full or oversized.
+     */
+    bool tryPush(std::string_view record);
+
+    /**
+     * @brief Pop the oldest record into @p record; false when empty.
+     */
+    bool tryPop(std::string& record);
+
+    /// Records currently queued
+    [[nodiscard]] std::size_t size() const;
+
+    /// Remove the named segment from the system (producer teardown, tests)
+    static void unlink(const std::string& name);
+
+private:
+    struct RingHeader;
+
+    ShmRing(std::string name, void* mapping, std::size_t mapping_size);
+
+    RingHeader* header();
+    const RingHeader* header() const;
+    char* slot(std::uint64_t index);
+
+    std::string name_;
+    void* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+};
+
+/**
+ * @brief Compact binary record for one camera detection message.
+ *
+ * Shared-memory counterpart of the camera JSON payload, in the same
+ * little-endian memcpy style as scene_binary. Field order:
+ *   magic "SDET" (4 bytes), version u8
+ *   camera id:      u16 length + bytes
+ *   timestamp:      i64 microseconds since the Unix epoch
+ *   category count: u16
+ *   per category:   u16 name length + bytes, u32 detection count,
+ *                   per detection: u8 has_id, i32 id,
+ *                   4 doubles (bounding box x, y, width, height)
+ */
+namespace detection_record {
+
+/// Format version emitted by encode(); decode() rejects other versions
+constexpr std::uint8_t FORMAT_VERSION = 1;
+
+/**
+ * @brief Encode a camera message (producer side, and tests).
+ */
+std::string encode(const CameraMessage& message);
+
+/**
+ * @brief Decode a record; nullopt if malformed or wrong version.
+ *
+ * received_at is left default; the ingest path stamps it on arrival.
+ */
+std::optional<CameraMessage> decode(std::string_view record);
+
+} // namespace detection_record
+
+/**
+ * @brief Polls per-camera shared-memory rings and feeds decoded messages
+ *        into the ingest callback.
+ *
+ * One thread drains every configured camera's ring. Segments that do not
+ * exist yet (producer not up) are retried on an interval, so start order does
+ * not matter; MQTT stays subscribed throughout as the control and fallback
+ * path. The poll loop sleeps briefly when every ring is empty, keeping idle
+ * cost negligible while an active ring is drained without sleeping.
+ */
+class ShmDetectionReader {
+public:
+    /// Callback receiving each decoded message; must be thread-safe, as it
+    /// runs on the reader's poll thread concurrently with MQTT ingest
+    using MessageCallback = std::function<void(CameraMessage)>;
+
+    /**
+     * @brief Construct a reader for the given cameras.
+     *
+     * @param camera_ids Cameras ingesting over shared memory
+     * @param segment_prefix Segment name prefix; camera id is appended
+     * @param callback Invoked with each decoded message
+     */
+    ShmDetectionReader(std::vector<std::string> camera_ids, std::string segment_prefix,
+                       MessageCallback callback);
+
+    ~ShmDetectionReader();
+
+    // Non-copyable, non-movable (owns the poll thread)
+    ShmDetectionReader(const ShmDetectionReader&) = delete;
+    ShmDetectionReader& operator=(const ShmDetectionReader&) = delete;
+    ShmDetectionReader(ShmDetectionReader&&) = delete;
+    ShmDetectionReader& operator=(ShmDetectionReader&&) = delete;
+
+    /**
+     * @brief Start the poll thread.
+     */
+    void start();
+
+    /**
+     * @brief Stop and join the poll thread.
+     */
+    void stop();
+
+    /// Messages delivered to the callback so far
+    [[nodiscard]] std::size_t getDeliveredCount() const { return delivered_count_.load(); }
+
+    /// Records that failed to decode (counted and dropped)
+    [[nodiscard]] std::size_t getDecodeFailureCount() const {
+        return decode_failure_count_.load();
+    }
+
+private:
+    struct CameraRing {
+        std::string camera_id;
+        std::string segment_name;
+        std::unique_ptr<ShmRing> ring; ///< null until the segment appears
+    };
+
+    void pollLoop();
+
+    /// Drain one camera's ring; returns the number of records delivered
+    std::size_t drainRing(CameraRing& camera);
+
+    std::vector<CameraRing> cameras_;
+    MessageCallback callback_;
+
+    std::thread poll_thread_;
+    std::atomic<bool> stop_requested_{false};
+    std::atomic<std::size_t> delivered_count_{0};
+    std::atomic<std::size_t> decode_failure_count_{0};
+};
+
+} // namespace tracker
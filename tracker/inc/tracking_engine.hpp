@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "camera_message.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <rv/tracking/MultipleObjectTracker.hpp>
+
+namespace tracker {
+
+/**
+ * @brief Native tracking stage wrapping rv::tracking::MultipleObjectTracker.
+ *
+ * Owns one tracker per scene, created on demand, and converts parsed camera
+ * detections into rv::tracking::TrackedObject measurements. Categories are
+ * registered on first sight and mapped to fixed classification slots so
+ * measurements and tracks always carry same-size classification vectors.
+ *
+ * Coordinates pass through in the camera's pixel frame: the bounding-box
+ * center becomes the measurement position. Projecting into scene world
+ * coordinates needs the camera calibration from the scenes config, which is
+ * not wired into the service yet; the tracker itself is frame-agnostic.
+ *
+ * Thread-safe: concurrent calls for different scenes run in parallel, calls
+ * for the same scene serialize on that scene's tracker.
+ */
+class TrackingEngine {
+public:
+    /**
+     * @brief Tracking parameters, mirroring the config schema's tracking section.
+     */
+    struct Config {
+        double non_measurement_time_dynamic_s = 0.8;
+        double non_measurement_time_static_s = 1.6;
+        double max_unreliable_time_s = 1.0;
+        double distance_threshold = 5.0;
+    };
+
+    explicit TrackingEngine(Config config = {});
+
+    /**
+     * @brief Run one tracking step for a scene with one camera frame.
+     *
+     * Creates the scene's tracker on first use.
+     *
+     * @param scene_id Scene the camera belongs to
+     * @param message Parsed detections for one camera frame
+     * @param timestamp Frame timestamp
+     * @return The scene's reliable tracks after the update
+     */
+    std::vector<rv::tracking::TrackedObject>
+    trackFrame(const std::string& scene_id, const CameraMessage& message,
+               std::chrono::system_clock::time_point timestamp);
+
+    /**
+     * @brief Run one tracking step for a scene with frames from several cameras.
+     *
+     * Feeds the multi-camera track() overload so detections of the same
+     * object from different cameras reinforce one track in a single update
+     * instead of producing one update per camera.
+     *
+     * @param scene_id Scene the cameras belong to
+     * @param messages One parsed frame per camera, coalesced by the caller
+     * @param timestamp Timestamp for the batched update
+     * @return The scene's reliable tracks after the update
+     */
+    std::vector<rv::tracking::TrackedObject>
+    trackBatch(const std::string& scene_id, const std::vector<CameraMessage>& messages,
+               std::chrono::system_clock::time_point timestamp);
+
+    /**
+     * @brief Category name for a track's dominant class; "unknown" if unset.
+     */
+    std::string categoryForTrack(const rv::tracking::TrackedObject& track) const;
+
+private:
+    /// One scene's tracker plus the lock serializing its track() calls
+    struct SceneTracker {
+        explicit SceneTracker(const rv::tracking::TrackManagerConfig& config)
+            : tracker(config) {}
+
+        std::mutex mutex;
+        rv::tracking::MultipleObjectTracker tracker;
+    };
+
+    /**
+     * @brief Convert one detection to a measurement.
+     *
+     * Position is the bounding-box center, size the box extent; the
+     * classification is one-hot at the category's slot.
+     */
+    rv::tracking::TrackedObject makeMeasurement(const Detection& detection,
+                                                std::size_t category_slot) const;
+
+    /// Slot for a category, registering it on first sight (callers hold no lock)
+    std::size_t categorySlot(const std::string& category);
+
+    /// All of one camera frame's detections as measurements
+    std::vector<rv::tracking::TrackedObject> makeMeasurements(const CameraMessage& message);
+
+    SceneTracker& sceneTracker(const std::string& scene_id);
+
+    Config config_;
+    rv::tracking::TrackManagerConfig tracker_config_;
+
+    std::mutex scenes_mutex_;
+    std::map<std::string, std::unique_ptr<SceneTracker>> scene_trackers_;
+
+    /// Category names by classification slot, guarded by categories_mutex_
+    mutable std::mutex categories_mutex_;
+    std::vector<std::string> categories_;
+};
+
+} // namespace tracker
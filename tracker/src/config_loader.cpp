@@ -107,6 +107,25 @@ int parse_port(const std::string& port_str, const std::string& source, int min_p
     }
 }
 
+/**
+ * @brief Parse and validate a non-negative integer from string.
+ * @throws std::runtime_error if invalid or below the minimum
+ */
+int parse_non_negative_int(const std::string& value, const std::string& source, int minimum = 0) {
+    try {
+        int parsed = std::stoi(value);
+        if (parsed < minimum) {
+            throw std::runtime_error(source + " out of range: " + value + " (must be >= " +
+                                     std::to_string(minimum) + ")");
+        }
+        return parsed;
+    } catch (const std::invalid_argument&) {
+        throw std::runtime_error("Invalid " + source + ": " + value);
+    } catch (const std::out_of_range&) {
+        throw std::runtime_error(source + " out of range: " + value);
+    }
+}
+
 /**
  * @brief Parse and validate boolean from string.
  * @throws std::runtime_error if invalid boolean value
@@ -189,6 +208,24 @@ ServiceConfig load_config(const std::filesystem::path& config_path,
         GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_MQTT_INSECURE, false)
             .GetBool();
 
+    // Infrastructure - MQTT publish path (optional)
+    config.infrastructure.mqtt.publish_qos =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_MQTT_PUBLISH_QOS, 1)
+            .GetInt();
+    config.infrastructure.mqtt.publish_queue_capacity =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_MQTT_PUBLISH_QUEUE_CAPACITY,
+                                     1024)
+            .GetInt();
+    config.infrastructure.mqtt.ingest_shards =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_MQTT_INGEST_SHARDS, 1)
+            .GetInt();
+    config.infrastructure.mqtt.use_v5 =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_MQTT_USE_V5, false)
+            .GetBool();
+    config.infrastructure.mqtt.topic_alias_maximum =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_MQTT_TOPIC_ALIAS_MAXIMUM, 16)
+            .GetInt();
+
     // Infrastructure - MQTT TLS (optional)
     if (GetValueByPointer(config_doc, json::INFRASTRUCTURE_MQTT_TLS)) {
         TlsConfig tls_config;
@@ -222,6 +259,70 @@ ServiceConfig load_config(const std::filesystem::path& config_path,
                                      true)
             .GetBool();
 
+    // Infrastructure - Tracker Validation sampling (optional, default validates every message)
+    config.infrastructure.tracker.validation_sample_rate =
+        GetValueByPointerWithDefault(config_doc,
+                                     json::INFRASTRUCTURE_TRACKER_VALIDATION_SAMPLE_RATE, 1)
+            .GetInt();
+
+    // Infrastructure - Tracker Batching (optional, default publishes per camera message)
+    config.infrastructure.tracker.batch_window_ms =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_TRACKER_BATCH_WINDOW_MS, 0)
+            .GetInt();
+
+    // Infrastructure - Tracker Scene output format (optional, default JSON)
+    config.infrastructure.tracker.scene_output_format =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_TRACKER_SCENE_OUTPUT_FORMAT,
+                                     "json")
+            .GetString();
+
+    // Infrastructure - Tracker Trace sampling (optional, default disabled)
+    config.infrastructure.tracker.trace_sample_rate =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_TRACKER_TRACE_SAMPLE_RATE, 0)
+            .GetInt();
+
+    // Infrastructure - Tracker Pipeline (optional; 0 workers = inline processing)
+    config.infrastructure.tracker.pipeline.workers =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_TRACKER_PIPELINE_WORKERS, 0)
+            .GetInt();
+    config.infrastructure.tracker.pipeline.queue_capacity =
+        GetValueByPointerWithDefault(config_doc,
+                                     json::INFRASTRUCTURE_TRACKER_PIPELINE_QUEUE_CAPACITY, 1024)
+            .GetInt();
+
+    // Infrastructure - Tracker Shared-memory ingest (optional; empty camera
+    // list keeps every camera on MQTT)
+    if (auto* cameras = GetValueByPointer(config_doc, json::INFRASTRUCTURE_TRACKER_SHM_INGEST_CAMERAS);
+        cameras && cameras->IsArray()) {
+        for (const auto& camera : cameras->GetArray()) {
+            if (camera.IsString()) {
+                config.infrastructure.tracker.shm_ingest.cameras.emplace_back(camera.GetString());
+            }
+        }
+    }
+    config.infrastructure.tracker.shm_ingest.segment_prefix =
+        GetValueByPointerWithDefault(config_doc,
+                                     json::INFRASTRUCTURE_TRACKER_SHM_INGEST_SEGMENT_PREFIX,
+                                     "/scenescape_det_")
+            .GetString();
+
+    // Infrastructure - Tracker Scene-boundary ROI filter (optional; no
+    // boundary keeps every detection)
+    if (auto* boundary = GetValueByPointer(config_doc, json::INFRASTRUCTURE_TRACKER_ROI_BOUNDARY);
+        boundary && boundary->IsArray()) {
+        for (const auto& vertex : boundary->GetArray()) {
+            if (vertex.IsArray() && vertex.Size() == 2 && vertex[0].IsNumber() &&
+                vertex[1].IsNumber()) {
+                config.infrastructure.tracker.roi.boundary.emplace_back(vertex[0].GetDouble(),
+                                                                        vertex[1].GetDouble());
+            }
+        }
+    }
+    config.infrastructure.tracker.roi.mask_cell_size =
+        GetValueByPointerWithDefault(config_doc, json::INFRASTRUCTURE_TRACKER_ROI_MASK_CELL_SIZE,
+                                     0.0)
+            .GetDouble();
+
     // Observability - Logging (optional)
     config.observability.logging.level =
         GetValueByPointerWithDefault(config_doc, json::OBSERVABILITY_LOGGING_LEVEL, "info")
@@ -237,10 +338,68 @@ ServiceConfig load_config(const std::filesystem::path& config_path,
     apply_env(config.infrastructure.mqtt.port, tracker::env::MQTT_PORT,
               [](const std::string& v, const std::string& s) { return parse_port(v, s); });
     apply_env(config.infrastructure.mqtt.insecure, tracker::env::MQTT_INSECURE, parse_bool);
+    apply_env(config.infrastructure.mqtt.publish_qos, tracker::env::MQTT_PUBLISH_QOS,
+              [](const std::string& v, const std::string& s) {
+                  int qos = parse_non_negative_int(v, s);
+                  if (qos > 2) {
+                      throw std::runtime_error(s + " out of range: " + v + " (must be 0-2)");
+                  }
+                  return qos;
+              });
+    apply_env(config.infrastructure.mqtt.publish_queue_capacity,
+              tracker::env::MQTT_PUBLISH_QUEUE_CAPACITY,
+              [](const std::string& v, const std::string& s) {
+                  return parse_non_negative_int(v, s, 1);
+              });
+    apply_env(config.infrastructure.mqtt.ingest_shards, tracker::env::MQTT_INGEST_SHARDS,
+              [](const std::string& v, const std::string& s) {
+                  return parse_non_negative_int(v, s, 1);
+              });
+    apply_env(config.infrastructure.mqtt.use_v5, tracker::env::MQTT_USE_V5, parse_bool);
+    apply_env(config.infrastructure.mqtt.topic_alias_maximum,
+              tracker::env::MQTT_TOPIC_ALIAS_MAXIMUM,
+              [](const std::string& v, const std::string& s) {
+                  int aliases = parse_non_negative_int(v, s);
+                  if (aliases > 65535) {
+                      throw std::runtime_error(s + " out of range: " + v + " (must be 0-65535)");
+                  }
+                  return aliases;
+              });
 
     // Tracker overrides
     apply_env(config.infrastructure.tracker.schema_validation, tracker::env::MQTT_SCHEMA_VALIDATION,
               parse_bool);
+    apply_env(config.infrastructure.tracker.validation_sample_rate,
+              tracker::env::VALIDATION_SAMPLE_RATE,
+              [](const std::string& v, const std::string& s) {
+                  return parse_non_negative_int(v, s, 1);
+              });
+    apply_env(config.infrastructure.tracker.batch_window_ms, tracker::env::BATCH_WINDOW_MS,
+              [](const std::string& v, const std::string& s) {
+                  return parse_non_negative_int(v, s);
+              });
+    apply_env(config.infrastructure.tracker.trace_sample_rate, tracker::env::TRACE_SAMPLE_RATE,
+              [](const std::string& v, const std::string& s) {
+                  return parse_non_negative_int(v, s);
+              });
+    apply_env(config.infrastructure.tracker.scene_output_format,
+              tracker::env::SCENE_OUTPUT_FORMAT,
+              [](const std::string& v, const std::string& s) {
+                  if (v == "json" || v == "binary" || v == "both") {
+                      return v;
+                  }
+                  throw std::runtime_error("Invalid " + s + ": " + v +
+                                           " (must be json|binary|both)");
+              });
+    apply_env(config.infrastructure.tracker.pipeline.workers, tracker::env::PIPELINE_WORKERS,
+              [](const std::string& v, const std::string& s) {
+                  return parse_non_negative_int(v, s);
+              });
+    apply_env(config.infrastructure.tracker.pipeline.queue_capacity,
+              tracker::env::PIPELINE_QUEUE_CAPACITY,
+              [](const std::string& v, const std::string& s) {
+                  return parse_non_negative_int(v, s, 1);
+              });
 
     // TLS overrides - create tls config if any TLS env var is set
     auto env_tls_ca = get_env(tracker::env::MQTT_TLS_CA_CERT);
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_watcher.hpp"
+#include "logger.hpp"
+
+#include <exception>
+#include <system_error>
+#include <utility>
+
+namespace tracker {
+
+ConfigWatcher::ConfigWatcher(std::filesystem::path config_path, std::filesystem::path schema_path,
+                             ConfigStore& store, ReloadCallback on_reload,
+                             std::chrono::milliseconds poll_interval)
+    : config_path_(std::move(config_path)), schema_path_(std::move(schema_path)), store_(store),
+      on_reload_(std::move(on_reload)), poll_interval_(poll_interval) {
+    std::error_code ec;
+    last_write_time_ = std::filesystem::last_write_time(config_path_, ec);
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    stop();
+}
+
+void ConfigWatcher::start() {
+    if (thread_.joinable()) {
+        return;
+    }
+    stop_ = false;
+    thread_ = std::thread([this] { watchLoop(); });
+    LOG_INFO("Config watcher started for {} (poll interval {} ms)", config_path_.string(),
+             poll_interval_.count());
+}
+
+void ConfigWatcher::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) {
+            return;
+        }
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void ConfigWatcher::watchLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        cv_.wait_for(lock, poll_interval_, [this] { return stop_; });
+        if (stop_) {
+            return;
+        }
+
+        // A missing file (mid ConfigMap swap, editor rename) is transient;
+        // keep the current snapshot and check again next interval
+        std::error_code ec;
+        const auto write_time = std::filesystem::last_write_time(config_path_, ec);
+        if (ec || write_time == last_write_time_) {
+            continue;
+        }
+        last_write_time_ = write_time;
+
+        lock.unlock();
+        reload();
+        lock.lock();
+    }
+}
+
+bool ConfigWatcher::reload() {
+    try {
+        ServiceConfig fresh = load_config(config_path_, schema_path_);
+        const auto previous = store_.snapshot();
+        store_.update(std::move(fresh));
+        reload_count_++;
+        LOG_INFO("Configuration reloaded from {}", config_path_.string());
+
+        if (on_reload_) {
+            on_reload_(*store_.snapshot(), *previous);
+        }
+        return true;
+    } catch (const std::exception& e) {
+        LOG_ERROR("Configuration reload failed, keeping last good config: {}", e.what());
+        return false;
+    }
+}
+
+} // namespace tracker
@@ -39,6 +39,10 @@ HealthcheckServer::HealthcheckServer(int port, std::atomic<bool>& liveness,
                                      std::atomic<bool>& readiness)
     : port_(port), liveness_(liveness), readiness_(readiness) {}
 
+void HealthcheckServer::setMetricsProvider(std::function<std::string()> provider) {
+    metrics_provider_ = std::move(provider);
+}
+
 void HealthcheckServer::start() {
     if (thread_.joinable()) {
         std::cerr << "HealthcheckServer already running" << std::endl;
@@ -82,6 +86,14 @@ void HealthcheckServer::server_thread() {
         res.status = status_code;
     });
 
+    // Handler for /metrics (Prometheus scrape), only when a provider is wired
+    if (metrics_provider_) {
+        server.Get("/metrics", [this](const httplib::Request&, httplib::Response& res) {
+            res.set_content(metrics_provider_(), "text/plain; version=0.0.4; charset=utf-8");
+            res.status = 200;
+        });
+    }
+
     std::cerr << "Healthcheck server listening on port " << port_ << std::endl;
 
     // Start server and listen (blocks until stopped)
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iso8601.hpp"
+
+#include <cstring>
+
+namespace tracker {
+namespace iso8601 {
+
+namespace {
+
+using std::chrono::microseconds;
+using std::chrono::system_clock;
+
+/// Parse exactly `count` ASCII digits at `p` into `out`; false on non-digits
+bool parseDigits(const char* p, int count, int& out) {
+    int value = 0;
+    for (int i = 0; i < count; ++i) {
+        const unsigned digit = static_cast<unsigned>(p[i]) - '0';
+        if (digit > 9) {
+            return false;
+        }
+        value = value * 10 + static_cast<int>(digit);
+    }
+    out = value;
+    return true;
+}
+
+/// Days since 1970-01-01 for a civil date (Gregorian, proleptic)
+std::int64_t daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(year - era * 400);
+    const unsigned doy =
+        static_cast<unsigned>((153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1);
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+}
+
+/// Civil date for days since 1970-01-01 (inverse of daysFromCivil)
+void civilFromDays(std::int64_t days, int& year, int& month, int& day) {
+    days += 719468;
+    const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const std::int64_t y = static_cast<std::int64_t>(yoe) + era * 400;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    year = static_cast<int>(y + (month <= 2));
+}
+
+/// Write `value` as `width` zero-padded digits at `out`
+void writeDigits(char* out, int width, int value) {
+    for (int i = width - 1; i >= 0; --i) {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+} // namespace
+
+std::optional<system_clock::time_point> parse(std::string_view text) {
+    // Fixed layout: "YYYY-MM-DDTHH:MM:SS" is 19 characters
+    if (text.size() < 19 || text[4] != '-' || text[7] != '-' || text[10] != 'T' ||
+        text[13] != ':' || text[16] != ':') {
+        return std::nullopt;
+    }
+
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    const char* p = text.data();
+    if (!parseDigits(p, 4, year) || !parseDigits(p + 5, 2, month) ||
+        !parseDigits(p + 8, 2, day) || !parseDigits(p + 11, 2, hour) ||
+        !parseDigits(p + 14, 2, minute) || !parseDigits(p + 17, 2, second)) {
+        return std::nullopt;
+    }
+
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 ||
+        second > 60) { // 60 tolerates leap seconds
+        return std::nullopt;
+    }
+
+    // Optional fraction; digits beyond microseconds are truncated
+    std::int64_t fraction_us = 0;
+    if (text.size() > 19 && text[19] == '.') {
+        std::int64_t scale = 100000;
+        std::size_t i = 20;
+        if (i >= text.size() || static_cast<unsigned>(text[i]) - '0' > 9) {
+            return std::nullopt; // "SS." without digits
+        }
+        for (; i < text.size(); ++i) {
+            const unsigned digit = static_cast<unsigned>(text[i]) - '0';
+            if (digit > 9) {
+                break;
+            }
+            fraction_us += digit * scale;
+            scale /= 10;
+        }
+    }
+    // Any trailing zone designator ("Z" or an offset) is ignored; inputs are
+    // UTC by contract
+
+    const std::int64_t seconds =
+        daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    return system_clock::time_point(std::chrono::seconds(seconds) + microseconds(fraction_us));
+}
+
+std::string Formatter::format(system_clock::time_point timestamp) {
+    const std::int64_t total_us =
+        std::chrono::duration_cast<microseconds>(timestamp.time_since_epoch()).count();
+    std::int64_t seconds = total_us / 1000000;
+    std::int64_t us = total_us % 1000000;
+    if (us < 0) {
+        seconds -= 1;
+        us += 1000000;
+    }
+
+    if (seconds != cached_second_) {
+        // New second: re-render the date/time prefix once
+        const std::int64_t days =
+            (seconds >= 0 ? seconds : seconds - 86399) / 86400; // floor division
+        const std::int64_t second_of_day = seconds - days * 86400;
+
+        int year = 0;
+        int month = 0;
+        int day = 0;
+        civilFromDays(days, year, month, day);
+
+        writeDigits(prefix_, 4, year);
+        prefix_[4] = '-';
+        writeDigits(prefix_ + 5, 2, month);
+        prefix_[7] = '-';
+        writeDigits(prefix_ + 8, 2, day);
+        prefix_[10] = 'T';
+        writeDigits(prefix_ + 11, 2, static_cast<int>(second_of_day / 3600));
+        prefix_[13] = ':';
+        writeDigits(prefix_ + 14, 2, static_cast<int>(second_of_day / 60 % 60));
+        prefix_[16] = ':';
+        writeDigits(prefix_ + 17, 2, static_cast<int>(second_of_day % 60));
+        cached_second_ = seconds;
+    }
+
+    char out[PREFIX_LENGTH + 5];
+    std::memcpy(out, prefix_, PREFIX_LENGTH);
+    out[PREFIX_LENGTH] = '.';
+    writeDigits(out + PREFIX_LENGTH + 1, 3, static_cast<int>(us / 1000));
+    out[PREFIX_LENGTH + 4] = 'Z';
+    return std::string(out, sizeof(out));
+}
+
+std::string format(system_clock::time_point timestamp) {
+    Formatter formatter;
+    return formatter.format(timestamp);
+}
+
+} // namespace iso8601
+} // namespace tracker
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdlib>
 #include <sstream>
 
@@ -104,6 +105,12 @@ void Logger::init(std::string_view level, std::shared_ptr<quill::Sink> sink) {
     inst.initialized_ = true;
 }
 
+void Logger::set_level(std::string_view level) {
+    if (auto* l = instance().logger_) {
+        l->set_log_level(to_quill_level(level));
+    }
+}
+
 void Logger::shutdown() {
     auto& inst = instance();
     if (inst.logger_) {
@@ -231,4 +238,86 @@ std::string LogEntry::build() const {
     return json_escape(msg_) + "\"" + extra_str + ",\"_\":\"";
 }
 
+// -----------------------------------------------------------------------------
+// LogRateLimiter
+// -----------------------------------------------------------------------------
+
+namespace {
+
+std::int64_t steadyNowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+LogRateLimiter::LogRateLimiter(double tokens_per_second, double burst)
+    : tokens_per_second_(tokens_per_second),
+      burst_scaled_(static_cast<std::int64_t>(burst * TOKEN_SCALE)),
+      // Start full so the first occurrences of a fault always log
+      tokens_(burst_scaled_), last_refill_us_(steadyNowMicros()) {}
+
+void LogRateLimiter::refill() {
+    const std::int64_t now_us = steadyNowMicros();
+    std::int64_t last_us = last_refill_us_.load(std::memory_order_relaxed);
+    if (now_us <= last_us ||
+        !last_refill_us_.compare_exchange_strong(last_us, now_us, std::memory_order_relaxed)) {
+        return; // another thread claimed this refill window
+    }
+
+    // tokens/s in millionth-tokens per microsecond cancels to tokens/s
+    const auto earned =
+        static_cast<std::int64_t>(static_cast<double>(now_us - last_us) * tokens_per_second_);
+    std::int64_t current = tokens_.load(std::memory_order_relaxed);
+    std::int64_t desired = 0;
+    do {
+        desired = std::min(current + earned, burst_scaled_);
+    } while (!tokens_.compare_exchange_weak(current, desired, std::memory_order_relaxed));
+}
+
+bool LogRateLimiter::tryAcquire() {
+    refill();
+
+    std::int64_t available = tokens_.load(std::memory_order_relaxed);
+    while (available >= TOKEN_SCALE) {
+        if (tokens_.compare_exchange_weak(available, available - TOKEN_SCALE,
+                                          std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+// LogSampler
+// -----------------------------------------------------------------------------
+
+std::atomic<std::uint64_t>& LogSampler::counterFor(std::string_view key) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (auto it = keys_.find(key); it != keys_.end()) {
+            return *it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto [it, inserted] = keys_.try_emplace(std::string(key), nullptr);
+    if (inserted) {
+        it->second = std::make_unique<std::atomic<std::uint64_t>>(0);
+    }
+    return *it->second;
+}
+
+std::optional<std::uint64_t> LogSampler::shouldLog(std::string_view key) {
+    const std::uint64_t occurrence = counterFor(key).fetch_add(1, std::memory_order_relaxed);
+    if (occurrence % sample_rate_ != 0) {
+        return std::nullopt;
+    }
+    // Deterministic cadence: each emitted message stands in for exactly the
+    // N-1 occurrences since the previous one (none before the first)
+    return occurrence == 0 ? 0 : sample_rate_ - 1;
+}
+
 } // namespace tracker
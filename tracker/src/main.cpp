@@ -11,11 +11,16 @@
 
 #include "cli.hpp"
 #include "config_loader.hpp"
+#include "config_watcher.hpp"
 #include "healthcheck_command.hpp"
 #include "healthcheck_server.hpp"
 #include "logger.hpp"
 #include "message_handler.hpp"
+#include "metrics.hpp"
 #include "mqtt_client.hpp"
+#include "roi_filter.hpp"
+#include "sharded_mqtt_client.hpp"
+#include "shm_transport.hpp"
 
 #include <rv/tracking/TrackedObject.hpp>
 
@@ -23,7 +28,7 @@ namespace {
 volatile std::sig_atomic_t g_shutdown_requested = 0;
 std::atomic<bool> g_liveness{false};
 std::atomic<bool> g_readiness{false};
-std::shared_ptr<tracker::MqttClient> g_mqtt_client;
+std::shared_ptr<tracker::IMqttClient> g_mqtt_client;
 
 void signal_handler(int signal) {
     g_shutdown_requested = 1;
@@ -70,34 +75,120 @@ int main(int argc, char* argv[]) {
     rv::tracking::TrackedObject obj;
     LOG_INFO("RobotVision TrackedObject size: {}", sizeof(obj));
 
-    // Start healthcheck server
+    // Start healthcheck server; /metrics serves the shared registry
+    auto metrics = std::make_shared<tracker::Metrics>();
     tracker::HealthcheckServer health_server(config.infrastructure.tracker.healthcheck.port,
                                              g_liveness, g_readiness);
+    health_server.setMetricsProvider([metrics] { return metrics->renderPrometheus(); });
     health_server.start();
 
     // Mark service as live (process is running)
     g_liveness = true;
 
-    // Initialize MQTT client
-    g_mqtt_client = std::make_shared<tracker::MqttClient>(config.infrastructure.mqtt);
+    // Initialize MQTT client; above one ingest shard, camera traffic is
+    // spread across multiple broker connections via shared subscriptions
+    if (config.infrastructure.mqtt.ingest_shards > 1) {
+        g_mqtt_client = std::make_shared<tracker::ShardedMqttClient>(
+            config.infrastructure.mqtt,
+            static_cast<std::size_t>(config.infrastructure.mqtt.ingest_shards));
+    } else {
+        g_mqtt_client = std::make_shared<tracker::MqttClient>(config.infrastructure.mqtt);
+    }
 
-    // Initialize message handler with schema validation config
+    // Start the broker connection (asynchronous) before constructing the
+    // message handler, so schema compilation overlaps the TCP/TLS handshake
+    // instead of serializing in front of it
+    g_mqtt_client->connect();
+
+    // Initialize message handler with schema validation config; schema
+    // compilation now runs while the connection comes up
     auto message_handler = std::make_unique<tracker::MessageHandler>(
         g_mqtt_client, config.infrastructure.tracker.schema_validation,
-        cli_config.schema_path.parent_path());
-
-    // Connect to MQTT broker
-    g_mqtt_client->connect();
+        cli_config.schema_path.parent_path(),
+        static_cast<std::size_t>(config.infrastructure.tracker.pipeline.workers),
+        static_cast<std::size_t>(config.infrastructure.tracker.pipeline.queue_capacity),
+        config.infrastructure.tracker.validation_sample_rate,
+        config.infrastructure.tracker.batch_window_ms,
+        config.infrastructure.tracker.scene_output_format,
+        config.infrastructure.tracker.trace_sample_rate);
+    message_handler->setMetrics(metrics);
+
+    // Scene-boundary ingest filter: with a boundary configured, out-of-scene
+    // detections are dropped (and counted per camera) before tracking
+    if (!config.infrastructure.tracker.roi.boundary.empty()) {
+        message_handler->setRoiFilter(std::make_shared<const tracker::RoiFilter>(
+            config.infrastructure.tracker.roi.boundary,
+            config.infrastructure.tracker.roi.mask_cell_size));
+    }
 
-    // Start message handler (subscribes to topics)
+    // Global counters and queue depths, sampled at scrape time. The callbacks
+    // reference the handler and client, so the healthcheck server is stopped
+    // before either is torn down below.
+    metrics->registerSampledMetric(
+        "tracker_messages_received_total", "Camera messages received", "counter",
+        [handler = message_handler.get()] { return static_cast<double>(handler->getReceivedCount()); });
+    metrics->registerSampledMetric(
+        "tracker_messages_published_total", "Scene updates published", "counter",
+        [handler = message_handler.get()] { return static_cast<double>(handler->getPublishedCount()); });
+    metrics->registerSampledMetric(
+        "tracker_messages_rejected_total", "Camera messages rejected", "counter",
+        [handler = message_handler.get()] { return static_cast<double>(handler->getRejectedCount()); });
+    metrics->registerSampledMetric(
+        "tracker_publish_queue_depth", "Messages waiting in the outbound publish queue", "gauge",
+        [client = g_mqtt_client.get()] { return static_cast<double>(client->getPublishQueueDepth()); });
+    metrics->registerSampledMetric(
+        "tracker_publish_dropped_messages_total",
+        "Outbound messages dropped by a full publish queue", "counter",
+        [client = g_mqtt_client.get()] { return static_cast<double>(client->getPublishDroppedCount()); });
+
+    // Start message handler (subscribes to topics; connect was initiated
+    // before handler construction)
     message_handler->start();
 
+    // Shared-memory ingest for co-located producers: configured cameras skip
+    // the MQTT round trip, MQTT stays subscribed as the fallback path
+    std::unique_ptr<tracker::ShmDetectionReader> shm_reader;
+    if (!config.infrastructure.tracker.shm_ingest.cameras.empty()) {
+        shm_reader = std::make_unique<tracker::ShmDetectionReader>(
+            config.infrastructure.tracker.shm_ingest.cameras,
+            config.infrastructure.tracker.shm_ingest.segment_prefix,
+            [handler = message_handler.get()](tracker::CameraMessage message) {
+                handler->ingestCameraMessage(std::move(message));
+            });
+        shm_reader->start();
+    }
+
+    // Hot configuration reload: validated snapshots swap in atomically and
+    // runtime-tunable settings apply without a restart (connection and
+    // pipeline sizing still require one)
+    tracker::ConfigStore config_store(config);
+    tracker::ConfigWatcher config_watcher(
+        cli_config.config_path, cli_config.schema_path, config_store,
+        [&message_handler](const tracker::ServiceConfig& fresh,
+                           const tracker::ServiceConfig& previous) {
+            if (fresh.observability.logging.level != previous.observability.logging.level) {
+                tracker::Logger::set_level(fresh.observability.logging.level);
+                LOG_INFO("Log level changed to {}", fresh.observability.logging.level);
+            }
+            message_handler->applyRuntimeConfig(fresh.infrastructure.tracker);
+            if (fresh.infrastructure.mqtt.host != previous.infrastructure.mqtt.host ||
+                fresh.infrastructure.mqtt.port != previous.infrastructure.mqtt.port) {
+                LOG_WARN("MQTT connection settings changed; a restart is required to apply "
+                         "them");
+            }
+        });
+    config_watcher.start();
+
     LOG_INFO("Tracker service running, waiting for messages...");
 
-    // Main loop - update readiness based on MQTT state
+    // Main loop - update readiness based on MQTT state. Poll tightly until
+    // the subscription is live so readiness flips within milliseconds of it
+    // (rollouts gate on this), then relax to the steady-state cadence.
+    bool became_ready = false;
     while (!g_shutdown_requested) {
         update_readiness();
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        became_ready = became_ready || g_readiness;
+        std::this_thread::sleep_for(std::chrono::milliseconds(became_ready ? 100 : 5));
     }
 
     LOG_INFO("Tracker service shutting down gracefully");
@@ -105,17 +196,26 @@ int main(int argc, char* argv[]) {
     // Stop accepting new messages
     g_readiness = false;
 
-    // Stop message handler first (uses MQTT client)
+    // Stop the config watcher before the handler its callback references
+    config_watcher.stop();
+
+    // Stop the healthcheck server before the handler and MQTT client its
+    // metrics callbacks sample
+    g_liveness = false;
+    health_server.stop();
+
+    // Stop shared-memory ingest before the handler it feeds
+    if (shm_reader) {
+        shm_reader->stop();
+    }
+
+    // Stop message handler (uses MQTT client)
     message_handler->stop();
     message_handler.reset();
 
     // Reset MQTT client BEFORE logger shutdown to ensure disconnect logs work
     g_mqtt_client.reset();
 
-    // Stop healthcheck server
-    g_liveness = false;
-    health_server.stop();
-
     // Shutdown logger last
     tracker::Logger::shutdown();
     return 0;
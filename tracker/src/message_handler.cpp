@@ -2,18 +2,23 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "message_handler.hpp"
+#include "embedded_schemas.hpp"
+#include "iso8601.hpp"
 #include "logger.hpp"
 
+#include <algorithm>
 #include <chrono>
-#include <ctime>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <format>
 #include <fstream>
-#include <iomanip>
 #include <string_view>
 
 #include <rapidjson/document.h>
 #include <rapidjson/istreamwrapper.h>
 #include <rapidjson/pointer.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/schema.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -40,17 +45,350 @@ static const rapidjson::Pointer PTR_BBOX_Y("/bounding_box_px/y");
 static const rapidjson::Pointer PTR_BBOX_WIDTH("/bounding_box_px/width");
 static const rapidjson::Pointer PTR_BBOX_HEIGHT("/bounding_box_px/height");
 
+// How often the batch flusher wakes while batching is disabled, so a config
+// reload enabling it takes effect promptly
+constexpr std::chrono::milliseconds BATCH_DISABLED_POLL{500};
+
+/// Per-thread ISO 8601 formatter; its per-second prefix cache makes repeated
+/// publishes within one second prefix-copy plus three millisecond digits
+iso8601::Formatter& threadFormatter() {
+    static thread_local iso8601::Formatter formatter;
+    return formatter;
+}
+
+// First pool chunk for document values; typical detection messages fit here,
+// larger ones spill into malloc'd chunks that Clear() releases again
+constexpr std::size_t VALUE_BUFFER_SIZE = 64 * 1024;
+
+// Parse/writer stack capacity passed to rapidjson::Document
+constexpr std::size_t PARSE_STACK_SIZE = 4 * 1024;
+
+/**
+ * @brief Per-thread rapidjson scratch reused across messages.
+ *
+ * A fresh Document mallocs new allocator chunks on every message. Reusing one
+ * MemoryPoolAllocator (cleared between messages, retaining its first chunk)
+ * per worker thread removes steady-state allocation from the parse and
+ * publish paths. Safe because each pipeline worker (or the inline callback
+ * thread) processes one message at a time. The payload size of the thread's
+ * last scene message sizes the next payload's reservation, so steady-state
+ * serialization fills its buffer in one allocation.
+ */
+struct JsonScratch {
+    char value_buffer[VALUE_BUFFER_SIZE];
+    rapidjson::MemoryPoolAllocator<> value_allocator{value_buffer, sizeof(value_buffer)};
+    std::size_t last_payload_size = 256;
+};
+
+JsonScratch& threadScratch() {
+    static thread_local JsonScratch scratch;
+    return scratch;
+}
+
+/**
+ * @brief rapidjson output stream writing straight into the payload string.
+ *
+ * The string it fills is the buffer handed (moved) to the MQTT publish queue
+ * and from there into the Paho message, so serialization writes the wire
+ * bytes exactly once instead of filling a StringBuffer that is copied out.
+ */
+struct StringPayloadStream {
+    using Ch = char;
+
+    std::string& out;
+
+    void Put(char c) { out.push_back(c); }
+    void Flush() {}
+};
+
+/// Map the config string to a wire format, warning once on unknown values
+MessageHandler::SceneOutputFormat parseSceneOutputFormat(const std::string& format) {
+    if (format == "binary") {
+        return MessageHandler::SceneOutputFormat::Binary;
+    }
+    if (format == "both") {
+        return MessageHandler::SceneOutputFormat::Both;
+    }
+    if (format != "json") {
+        LOG_WARN("Unknown scene output format '{}', using json", format);
+    }
+    return MessageHandler::SceneOutputFormat::Json;
+}
+
+/// Frame timestamp from the message text, falling back to arrival time
+std::chrono::system_clock::time_point resolveTimestamp(const std::string& text,
+                                                       std::string_view camera_id) {
+    if (auto parsed = iso8601::parse(text)) {
+        return *parsed;
+    }
+    LOG_DEBUG("Unparseable timestamp '{}' from camera {}, using arrival time", text, camera_id);
+    return std::chrono::system_clock::now();
+}
+
+/**
+ * @brief SAX handler filling CameraMessage directly during a single scan.
+ *
+ * The camera payload layout is flat and known, so when schema validation is
+ * disabled there is no need to materialize a DOM and then walk it with
+ * Pointer lookups: this handler writes /id, /timestamp and the per-category
+ * bounding boxes into the output structs as the tokens stream past. Unknown
+ * keys and malformed detections are skipped with the same tolerance as the
+ * DOM path (a detection lacking valid bounding_box_px fields is dropped, the
+ * rest of the message survives).
+ */
+class CameraMessageSaxHandler
+    : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, CameraMessageSaxHandler> {
+public:
+    bool Null() { return true; }
+    bool Bool(bool) { return true; }
+    bool Int(int value) { return handleNumber(static_cast<double>(value), true, value); }
+    bool Uint(unsigned value) {
+        return handleNumber(static_cast<double>(value), value <= static_cast<unsigned>(INT32_MAX),
+                            static_cast<int>(value));
+    }
+    bool Int64(int64_t value) { return handleNumber(static_cast<double>(value), false, 0); }
+    bool Uint64(uint64_t value) { return handleNumber(static_cast<double>(value), false, 0); }
+    bool Double(double value) { return handleNumber(value, false, 0); }
+
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        if (skip_depth_ > 0) {
+            return true;
+        }
+        if (scope_ == Scope::Root) {
+            if (current_key_ == "id") {
+                message_.id.assign(str, length);
+                has_id_ = true;
+            } else if (current_key_ == "timestamp") {
+                timestamp_text_.assign(str, length);
+                has_timestamp_ = true;
+            }
+        }
+        return true;
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        if (skip_depth_ > 0) {
+            return true;
+        }
+        current_key_.assign(str, length);
+        if (scope_ == Scope::Objects) {
+            current_category_ = current_key_;
+        }
+        return true;
+    }
+
+    bool StartObject() {
+        if (skip_depth_ > 0) {
+            skip_depth_++;
+            return true;
+        }
+        switch (scope_) {
+        case Scope::Document:
+            scope_ = Scope::Root;
+            break;
+        case Scope::Root:
+            if (current_key_ == "objects") {
+                scope_ = Scope::Objects;
+                has_objects_ = true;
+            } else {
+                skip_depth_ = 1;
+            }
+            break;
+        case Scope::Objects: {
+            // Category value must be an array of detections
+            static LogRateLimiter category_limiter{1.0, 5.0};
+            LOG_WARN_LIMITED(category_limiter, "Invalid detections array for category: {}",
+                             current_category_);
+            skip_depth_ = 1;
+            break;
+        }
+        case Scope::CategoryArray:
+            scope_ = Scope::Detection;
+            current_detection_ = Detection{};
+            bbox_fields_ = 0;
+            break;
+        case Scope::Detection:
+            if (current_key_ == "bounding_box_px") {
+                scope_ = Scope::BoundingBox;
+            } else {
+                skip_depth_ = 1;
+            }
+            break;
+        case Scope::BoundingBox:
+            skip_depth_ = 1;
+            break;
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        if (skip_depth_ > 0) {
+            skip_depth_--;
+            return true;
+        }
+        switch (scope_) {
+        case Scope::Root:
+            scope_ = Scope::Document;
+            break;
+        case Scope::Objects:
+            scope_ = Scope::Root;
+            break;
+        case Scope::Detection:
+            if (bbox_fields_ == ALL_BBOX_FIELDS) {
+                detections_.push_back(current_detection_);
+            } else {
+                static LogRateLimiter bbox_limiter{1.0, 5.0};
+                LOG_WARN_LIMITED(bbox_limiter, "Missing bounding_box_px fields in detection");
+            }
+            scope_ = Scope::CategoryArray;
+            break;
+        case Scope::BoundingBox:
+            scope_ = Scope::Detection;
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    bool StartArray() {
+        if (skip_depth_ > 0) {
+            skip_depth_++;
+            return true;
+        }
+        if (scope_ == Scope::Objects) {
+            scope_ = Scope::CategoryArray;
+            detections_.clear();
+        } else {
+            // Array where none belongs (root value, detection element, bbox
+            // field, unknown root key): skip it wholesale
+            skip_depth_ = 1;
+        }
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        if (skip_depth_ > 0) {
+            skip_depth_--;
+            return true;
+        }
+        if (scope_ == Scope::CategoryArray) {
+            if (!detections_.empty()) {
+                message_.objects[current_category_] = std::move(detections_);
+                detections_ = {};
+            }
+            scope_ = Scope::Objects;
+        }
+        return true;
+    }
+
+    /// Required fields present with the right types (matches the DOM path's
+    /// '/id', '/timestamp', '/objects' checks)
+    [[nodiscard]] bool hasId() const { return has_id_; }
+    [[nodiscard]] bool hasTimestamp() const { return has_timestamp_; }
+    [[nodiscard]] bool hasObjects() const { return has_objects_; }
+
+    /// Raw timestamp text; the caller converts it to numeric time once
+    [[nodiscard]] const std::string& timestampText() const { return timestamp_text_; }
+
+    CameraMessage takeMessage() { return std::move(message_); }
+
+private:
+    enum class Scope { Document, Root, Objects, CategoryArray, Detection, BoundingBox };
+
+    static constexpr unsigned BBOX_X = 1u << 0;
+    static constexpr unsigned BBOX_Y = 1u << 1;
+    static constexpr unsigned BBOX_WIDTH = 1u << 2;
+    static constexpr unsigned BBOX_HEIGHT = 1u << 3;
+    static constexpr unsigned ALL_BBOX_FIELDS = BBOX_X | BBOX_Y | BBOX_WIDTH | BBOX_HEIGHT;
+
+    bool handleNumber(double value, bool fits_int, int int_value) {
+        if (skip_depth_ > 0) {
+            return true;
+        }
+        if (scope_ == Scope::BoundingBox) {
+            if (current_key_ == "x") {
+                current_detection_.bounding_box_px.x = value;
+                bbox_fields_ |= BBOX_X;
+            } else if (current_key_ == "y") {
+                current_detection_.bounding_box_px.y = value;
+                bbox_fields_ |= BBOX_Y;
+            } else if (current_key_ == "width") {
+                current_detection_.bounding_box_px.width = value;
+                bbox_fields_ |= BBOX_WIDTH;
+            } else if (current_key_ == "height") {
+                current_detection_.bounding_box_px.height = value;
+                bbox_fields_ |= BBOX_HEIGHT;
+            }
+        } else if (scope_ == Scope::Detection) {
+            if (current_key_ == "id" && fits_int) {
+                current_detection_.id = int_value;
+            }
+        }
+        return true;
+    }
+
+    CameraMessage message_;
+    std::string timestamp_text_;
+    Scope scope_ = Scope::Document;
+    int skip_depth_ = 0;
+    std::string current_key_;
+    std::string current_category_;
+    std::vector<Detection> detections_;
+    Detection current_detection_;
+    unsigned bbox_fields_ = 0;
+    bool has_id_ = false;
+    bool has_timestamp_ = false;
+    bool has_objects_ = false;
+};
+
 } // namespace
 
+std::unique_ptr<rapidjson::SchemaValidator> SchemaValidatorPool::acquire() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+            auto validator = std::move(free_.back());
+            free_.pop_back();
+            validator->Reset();
+            return validator;
+        }
+    }
+    return std::make_unique<rapidjson::SchemaValidator>(*schema_);
+}
+
+void SchemaValidatorPool::release(std::unique_ptr<rapidjson::SchemaValidator> validator) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(std::move(validator));
+}
+
 MessageHandler::MessageHandler(std::shared_ptr<IMqttClient> mqtt_client, bool schema_validation,
-                               const std::filesystem::path& schema_dir)
-    : mqtt_client_(std::move(mqtt_client)), schema_validation_(schema_validation) {
+                               const std::filesystem::path& schema_dir,
+                               std::size_t pipeline_workers, std::size_t pipeline_queue_capacity,
+                               int validation_sample_rate, int batch_window_ms,
+                               const std::string& scene_output_format, int trace_sample_rate)
+    : mqtt_client_(std::move(mqtt_client)), tracking_engine_(std::make_unique<TrackingEngine>()),
+      schema_validation_(schema_validation), pipeline_workers_(pipeline_workers),
+      pipeline_queue_capacity_(pipeline_queue_capacity),
+      validation_sample_rate_(validation_sample_rate), batch_window_ms_(batch_window_ms),
+      trace_sample_rate_(trace_sample_rate) {
+    scene_output_format_ = parseSceneOutputFormat(scene_output_format);
+    if (scene_output_format_ != SceneOutputFormat::Json) {
+        LOG_INFO("Binary scene output enabled ({}), topic suffix: {}", scene_output_format,
+                 TOPIC_BINARY_SUFFIX);
+    }
+    if (batch_window_ms > 0) {
+        LOG_INFO("Batching camera frames within {} ms into one tracking update", batch_window_ms);
+    }
+    if (trace_sample_rate > 0) {
+        LOG_INFO("Pipeline trace sampling enabled: 1-in-{} messages", trace_sample_rate);
+    }
     if (schema_validation_) {
         auto camera_schema_path = schema_dir / CAMERA_SCHEMA_FILE;
         auto scene_schema_path = schema_dir / SCENE_SCHEMA_FILE;
 
-        camera_schema_ = loadSchema(camera_schema_path);
-        scene_schema_ = loadSchema(scene_schema_path);
+        camera_schema_ = loadSchema(camera_schema_path, embedded_schemas::cameraData());
+        scene_schema_ = loadSchema(scene_schema_path, embedded_schemas::sceneData());
 
         if (!camera_schema_) {
             LOG_WARN("Failed to load camera schema from {}, validation disabled for input",
@@ -61,30 +399,97 @@ MessageHandler::MessageHandler(std::shared_ptr<IMqttClient> mqtt_client, bool sc
                      scene_schema_path.string());
         }
 
+        camera_validator_pool_.setSchema(camera_schema_.get());
+        scene_validator_pool_.setSchema(scene_schema_.get());
+
         if (camera_schema_ && scene_schema_) {
             LOG_INFO("Schema validation enabled for MQTT messages");
         }
+        if (validation_sample_rate > 1) {
+            LOG_INFO("Validation sampling enabled: 1-in-{} messages per camera",
+                     validation_sample_rate);
+        }
     } else {
         LOG_INFO("Schema validation disabled for MQTT messages");
     }
 }
 
-std::unique_ptr<rapidjson::SchemaDocument>
-MessageHandler::loadSchema(const std::filesystem::path& schema_path) {
-    std::ifstream ifs(schema_path);
-    if (!ifs.is_open()) {
-        LOG_ERROR("Failed to open schema file: {}", schema_path.string());
-        return nullptr;
+MessageHandler::~MessageHandler() {
+    if (batch_flusher_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(batch_mutex_);
+            batch_stop_ = true;
+        }
+        batch_cv_.notify_all();
+        batch_flusher_.join();
+    }
+}
+
+void MessageHandler::applyRuntimeConfig(const TrackerConfig& config) {
+    if (config.schema_validation != schema_validation_.load()) {
+        if (config.schema_validation && !camera_schema_) {
+            LOG_WARN("Cannot enable schema validation at runtime: schemas were not loaded at "
+                     "startup");
+        } else {
+            schema_validation_ = config.schema_validation;
+            LOG_INFO("Schema validation {} by config reload",
+                     config.schema_validation ? "enabled" : "disabled");
+        }
     }
 
-    rapidjson::IStreamWrapper isw(ifs);
+    if (config.validation_sample_rate != validation_sample_rate_.load()) {
+        validation_sample_rate_ = config.validation_sample_rate;
+        LOG_INFO("Validation sampling retuned to 1-in-{} messages per camera",
+                 config.validation_sample_rate);
+    }
+
+    if (config.batch_window_ms != batch_window_ms_.load()) {
+        batch_window_ms_ = config.batch_window_ms;
+        // Wake the flusher so the new window (or a disable) applies now, not
+        // after the old wait expires
+        batch_cv_.notify_all();
+        LOG_INFO("Batch window retuned to {} ms", config.batch_window_ms);
+    }
+
+    const auto format = parseSceneOutputFormat(config.scene_output_format);
+    if (format != scene_output_format_.load()) {
+        scene_output_format_ = format;
+        LOG_INFO("Scene output format changed to {}", config.scene_output_format);
+    }
+
+    if (config.trace_sample_rate != trace_sample_rate_.load()) {
+        trace_sample_rate_ = config.trace_sample_rate;
+        if (config.trace_sample_rate > 0) {
+            LOG_INFO("Pipeline trace sampling retuned to 1-in-{} messages",
+                     config.trace_sample_rate);
+        } else {
+            LOG_INFO("Pipeline trace sampling disabled by config reload");
+        }
+    }
+}
+
+std::unique_ptr<rapidjson::SchemaDocument>
+MessageHandler::loadSchema(const std::filesystem::path& schema_path, std::string_view embedded) {
     rapidjson::Document schema_doc;
-    schema_doc.ParseStream(isw);
 
-    if (schema_doc.HasParseError()) {
-        LOG_ERROR("Failed to parse schema file: {} at offset {}", schema_path.string(),
-                  schema_doc.GetErrorOffset());
-        return nullptr;
+    std::ifstream ifs(schema_path);
+    if (ifs.is_open()) {
+        rapidjson::IStreamWrapper isw(ifs);
+        schema_doc.ParseStream(isw);
+        if (schema_doc.HasParseError()) {
+            LOG_ERROR("Failed to parse schema file: {} at offset {}", schema_path.string(),
+                      schema_doc.GetErrorOffset());
+            return nullptr;
+        }
+    } else {
+        // No file on disk: compile the copy embedded at build time
+        LOG_DEBUG("Schema file {} not readable, using embedded copy", schema_path.string());
+        schema_doc.Parse(embedded.data(), embedded.size());
+        if (schema_doc.HasParseError()) {
+            LOG_ERROR("Failed to parse embedded schema for {} at offset {}",
+                      schema_path.string(), schema_doc.GetErrorOffset());
+            return nullptr;
+        }
     }
 
     return std::make_unique<rapidjson::SchemaDocument>(schema_doc);
@@ -93,10 +498,48 @@ MessageHandler::loadSchema(const std::filesystem::path& schema_path) {
 void MessageHandler::start() {
     LOG_INFO("MessageHandler starting, subscribing to: {}", TOPIC_CAMERA_DATA);
 
-    // Set up message callback
-    mqtt_client_->setMessageCallback([this](const std::string& topic, const std::string& payload) {
-        handleCameraMessage(topic, payload);
-    });
+    if (pipeline_workers_ > 0) {
+        // Decouple the Paho callback thread from processing: the callback
+        // only copies the payload into the pipeline, workers do the parse,
+        // validation and publish. One slow message no longer stalls ingest
+        // for every camera.
+        pipeline_ = std::make_unique<MessagePipeline>(
+            [this](const std::string& topic, std::string payload,
+                   std::chrono::steady_clock::time_point received_at) {
+                handleCameraMessage(topic, std::move(payload), received_at);
+            },
+            pipeline_workers_, pipeline_queue_capacity_);
+        pipeline_->start();
+
+        if (metrics_) {
+            metrics_->registerSampledMetric(
+                "tracker_pipeline_queue_depth", "Messages waiting in the processing pipeline",
+                "gauge",
+                [this] { return static_cast<double>(pipeline_->getQueueDepth()); });
+            metrics_->registerSampledMetric(
+                "tracker_pipeline_dropped_messages_total",
+                "Messages dropped by a full pipeline queue", "counter",
+                [this] { return static_cast<double>(pipeline_->getDroppedCount()); });
+        }
+
+        mqtt_client_->setMessageCallback([this](const std::string& topic, std::string payload) {
+            if (!pipeline_->enqueue(topic, std::move(payload))) {
+                static LogRateLimiter drop_limiter{1.0, 5.0};
+                LOG_WARN_LIMITED(drop_limiter, "Pipeline queue full, dropped message from topic: {}",
+                                 topic);
+            }
+        });
+    } else {
+        // Process inline on the callback thread
+        mqtt_client_->setMessageCallback([this](const std::string& topic, std::string payload) {
+            handleCameraMessage(topic, std::move(payload), std::chrono::steady_clock::now());
+        });
+    }
+
+    // The flusher runs even with batching disabled (it just idles), so a
+    // config reload can enable batching without restarting the handler
+    batch_stop_ = false;
+    batch_flusher_ = std::thread([this] { batchFlusherLoop(); });
 
     // Subscribe to camera topics
     mqtt_client_->subscribe(TOPIC_CAMERA_DATA);
@@ -108,49 +551,315 @@ void MessageHandler::stop() {
 
     mqtt_client_->unsubscribe(TOPIC_CAMERA_DATA);
     mqtt_client_->setMessageCallback(nullptr);
+
+    // Drain and join workers after the callback is detached, so every
+    // accepted message is still processed
+    if (pipeline_) {
+        pipeline_->stop();
+        pipeline_.reset();
+    }
+
+    // With the pipeline drained no new frames can arrive; flush whatever the
+    // batching stage still holds so the last frames are not lost
+    if (batch_flusher_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(batch_mutex_);
+            batch_stop_ = true;
+        }
+        batch_cv_.notify_all();
+        batch_flusher_.join();
+    }
+    std::vector<CameraMessage> pending;
+    std::chrono::system_clock::time_point pending_latest;
+    {
+        std::lock_guard<std::mutex> lock(batch_mutex_);
+        pending.swap(batch_messages_);
+        pending_latest = batch_latest_;
+    }
+    if (!pending.empty()) {
+        flushBatch(std::move(pending), pending_latest);
+    }
 }
 
-void MessageHandler::handleCameraMessage(const std::string& topic, const std::string& payload) {
+void MessageHandler::handleCameraMessage(const std::string& topic, std::string payload,
+                                         std::chrono::steady_clock::time_point received_at) {
     received_count_++;
 
+    // Queue stage: receive to processing start. Inline processing makes this
+    // ~0; with pipeline workers it is the queue wait the message just paid.
+    const auto processing_start = std::chrono::steady_clock::now();
+    const auto queue_wait = processing_start - received_at;
+    if (metrics_) {
+        metrics_->stageLatency(PipelineStage::Queue).observe(queue_wait);
+    }
+
     std::string_view camera_id = extractCameraId(topic);
     if (camera_id.empty()) {
-        LOG_WARN("Failed to extract camera_id from topic: {}", topic);
+        static LogRateLimiter topic_limiter{1.0, 5.0};
+        LOG_WARN_LIMITED(topic_limiter, "Failed to extract camera_id from topic: {}", topic);
         rejected_count_++;
         return;
     }
 
+    CameraStats* camera_stats = metrics_ ? &metrics_->camera(camera_id) : nullptr;
+    if (camera_stats) {
+        camera_stats->received.increment();
+    }
+
     LOG_DEBUG("Received detection from camera: {} ({} bytes)", camera_id, payload.size());
 
     // Parse and optionally validate the camera message
-    auto message = parseCameraMessage(payload);
+    auto message = parseCameraMessage(payload, camera_id);
+    const auto parse_time = std::chrono::steady_clock::now() - processing_start;
+    if (metrics_) {
+        metrics_->stageLatency(PipelineStage::Parse).observe(parse_time);
+    }
     if (!message) {
-        LOG_WARN("Failed to parse camera message from {}", camera_id);
+        // Sampled per camera: a flooding camera degrades into counters while
+        // occasional failures elsewhere still log immediately
+        static LogSampler parse_failure_sampler{100};
+        LOG_WARN_SAMPLED(parse_failure_sampler, camera_id, "Failed to parse camera message from {}",
+                         camera_id);
         rejected_count_++;
+        if (camera_stats) {
+            camera_stats->parse_failures.increment();
+        }
         return;
     }
+    message->received_at = received_at;
+    message->trace.queue = queue_wait;
+    message->trace.parse = parse_time;
+    assignTrace(*message);
+    dispatchCameraMessage(std::move(*message));
+}
+
+void MessageHandler::ingestCameraMessage(CameraMessage message) {
+    received_count_++;
+    if (metrics_) {
+        metrics_->camera(message.id).received.increment();
+    }
+    // No queue or parse stage on this path: the caller hands over a parsed
+    // message directly. Sampled messages still emit the trace line with the
+    // stages they did run.
+    assignTrace(message);
+    dispatchCameraMessage(std::move(message));
+}
+
+void MessageHandler::assignTrace(CameraMessage& message) {
+    const int rate = trace_sample_rate_.load(std::memory_order_relaxed);
+    if (rate <= 0) {
+        return;
+    }
+    // The sequence doubles as the correlation id (offset so 0 keeps meaning
+    // "not sampled"); every message bumps it, 1-in-rate keep the id
+    const auto sequence = trace_sequence_.fetch_add(1, std::memory_order_relaxed);
+    if (sequence % static_cast<std::uint64_t>(rate) == 0) {
+        message.trace.id = sequence + 1;
+    }
+}
+
+void MessageHandler::emitTraceLine(const CameraMessage& message,
+                                   std::chrono::steady_clock::duration track_time,
+                                   const PublishTimings& publish_timings,
+                                   std::chrono::steady_clock::duration total,
+                                   std::size_t batch_frames) {
+    if (message.trace.id == 0) {
+        return;
+    }
+    const auto us = [](std::chrono::steady_clock::duration d) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    };
+    LOG_INFO("trace id={} camera={} queue_us={} parse_us={} track_us={} serialize_us={} "
+             "publish_us={} total_us={} batch_frames={}",
+             message.trace.id, message.id, us(message.trace.queue), us(message.trace.parse),
+             us(track_time), us(publish_timings.serialize), us(publish_timings.publish), us(total),
+             batch_frames);
+}
+
+void MessageHandler::dispatchCameraMessage(CameraMessage message) {
+    // Scene-boundary load shedding: detections whose foot point falls outside
+    // the boundary never reach the tracker
+    if (roi_filter_) {
+        const std::size_t dropped = roi_filter_->filterDetections(message);
+        if (dropped > 0 && metrics_) {
+            metrics_->camera(message.id).roi_dropped.increment(dropped);
+        }
+    }
 
     // Log parsed message details (only compute total_detections if debug logging is enabled)
     if (Logger::should_log_debug()) {
         size_t total_detections = 0;
-        for (const auto& [category, detections] : message->objects) {
+        for (const auto& [category, detections] : message.objects) {
             total_detections += detections.size();
         }
-        LOG_DEBUG("Parsed message: camera={}, timestamp={}, detections={}", message->id,
-                  message->timestamp, total_detections);
+        LOG_DEBUG("Parsed message: camera={}, timestamp={}, detections={}", message.id,
+                  threadFormatter().format(message.timestamp), total_detections);
     }
 
-    // Build and publish dummy scene message
-    std::string scene_message = buildDummySceneMessage(message->timestamp);
+    // With batching enabled the frame joins the pending window instead of
+    // producing its own tracking update and scene message
+    if (batch_window_ms_.load(std::memory_order_relaxed) > 0) {
+        enqueueForBatch(std::move(message));
+        return;
+    }
 
-    // Format output topic: scenescape/data/scene/{scene_id}/{thing_type}
+    // Run the tracking update for this frame. Without scene configuration
+    // every camera feeds the default scene.
+    const auto timestamp = message.timestamp;
+    const auto received_at = message.received_at;
+    const auto track_start = std::chrono::steady_clock::now();
+    auto tracks = tracking_engine_->trackFrame(DEFAULT_SCENE_ID, message, timestamp);
+    const auto track_time = std::chrono::steady_clock::now() - track_start;
+    if (metrics_) {
+        metrics_->stageLatency(PipelineStage::Track).observe(track_time);
+    }
+
+    // Publish the scene update with the current reliable tracks
+    const auto publish_timings = publishSceneUpdate(timestamp, tracks);
+
+    const auto total = std::chrono::steady_clock::now() - received_at;
+    if (metrics_) {
+        metrics_->publishLatency().observe(total);
+    }
+    emitTraceLine(message, track_time, publish_timings, total, 1);
+}
+
+MessageHandler::PublishTimings
+MessageHandler::publishSceneUpdate(std::chrono::system_clock::time_point timestamp,
+                                   const std::vector<rv::tracking::TrackedObject>& tracks) {
+    // Format the timestamp exactly once per update; time stays numeric
+    // everywhere upstream of here
+    const std::string timestamp_iso = threadFormatter().format(timestamp);
+
+    // Output topic: scenescape/data/scene/{scene_id}/{thing_type}
     std::string output_topic =
-        std::format(TOPIC_SCENE_DATA_PATTERN, DUMMY_SCENE_ID, DUMMY_THING_TYPE);
+        std::format(TOPIC_SCENE_DATA_PATTERN, DEFAULT_SCENE_ID, DEFAULT_THING_TYPE);
+
+    const auto output_format = scene_output_format_.load(std::memory_order_relaxed);
+
+    PublishTimings timings;
+    auto stage_start = std::chrono::steady_clock::now();
+
+    if (output_format != SceneOutputFormat::Binary) {
+        std::string scene_message = buildSceneMessage(timestamp_iso, tracks);
+        const std::size_t message_size = scene_message.size();
+        timings.serialize += std::chrono::steady_clock::now() - stage_start;
+
+        // Moved, not copied: the serialized buffer travels through the
+        // outbound queue into the broker message untouched
+        stage_start = std::chrono::steady_clock::now();
+        mqtt_client_->publish(output_topic, std::move(scene_message));
+        timings.publish += std::chrono::steady_clock::now() - stage_start;
+        LOG_DEBUG("Published track to: {} ({} bytes)", output_topic, message_size);
+        stage_start = std::chrono::steady_clock::now();
+    }
+
+    if (output_format != SceneOutputFormat::Json) {
+        std::string binary_message = buildSceneBinaryMessage(timestamp_iso, tracks);
+        const std::size_t message_size = binary_message.size();
+        timings.serialize += std::chrono::steady_clock::now() - stage_start;
+
+        std::string binary_topic = output_topic + TOPIC_BINARY_SUFFIX;
+        stage_start = std::chrono::steady_clock::now();
+        mqtt_client_->publish(binary_topic, std::move(binary_message));
+        timings.publish += std::chrono::steady_clock::now() - stage_start;
+        LOG_DEBUG("Published binary track to: {} ({} bytes)", binary_topic, message_size);
+    }
+
+    if (metrics_) {
+        metrics_->stageLatency(PipelineStage::Serialize).observe(timings.serialize);
+        metrics_->stageLatency(PipelineStage::Publish).observe(timings.publish);
+    }
 
-    mqtt_client_->publish(output_topic, scene_message);
     published_count_++;
+    return timings;
+}
+
+void MessageHandler::enqueueForBatch(CameraMessage message) {
+    const auto window = std::chrono::milliseconds(batch_window_ms_.load(std::memory_order_relaxed));
+    const auto timestamp = message.timestamp;
+
+    std::vector<CameraMessage> flush_messages;
+    std::chrono::system_clock::time_point flush_latest;
+    {
+        std::lock_guard<std::mutex> lock(batch_mutex_);
+
+        // A frame from the next epoch closes the pending window
+        if (!batch_messages_.empty() && timestamp - batch_epoch_ >= window) {
+            flush_messages.swap(batch_messages_);
+            flush_latest = batch_latest_;
+        }
 
-    LOG_DEBUG("Published track to: {} ({} bytes)", output_topic, scene_message.size());
+        if (batch_messages_.empty()) {
+            batch_epoch_ = timestamp;
+            batch_latest_ = timestamp;
+            batch_started_ = std::chrono::steady_clock::now();
+        } else if (timestamp > batch_latest_) {
+            batch_latest_ = timestamp;
+        }
+        batch_messages_.push_back(std::move(message));
+    }
+
+    // Track and publish outside the batch lock so slow downstream work never
+    // blocks frames joining the next window
+    if (!flush_messages.empty()) {
+        flushBatch(std::move(flush_messages), flush_latest);
+    }
+}
+
+void MessageHandler::flushBatch(std::vector<CameraMessage> messages,
+                                std::chrono::system_clock::time_point timestamp) {
+    LOG_DEBUG("Flushing batch of {} camera frames", messages.size());
+
+    const auto track_start = std::chrono::steady_clock::now();
+    auto tracks = tracking_engine_->trackBatch(DEFAULT_SCENE_ID, messages, timestamp);
+    const auto track_time = std::chrono::steady_clock::now() - track_start;
+    if (metrics_) {
+        metrics_->stageLatency(PipelineStage::Track).observe(track_time);
+    }
+
+    const auto publish_timings = publishSceneUpdate(timestamp, tracks);
+
+    // The update's track/serialize/publish stages are shared across the
+    // batch; each sampled message still gets its own trace line with its own
+    // queue/parse timings and end-to-end total
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& message : messages) {
+        const auto total = now - message.received_at;
+        if (metrics_) {
+            metrics_->publishLatency().observe(total);
+        }
+        emitTraceLine(message, track_time, publish_timings, total, messages.size());
+    }
+}
+
+void MessageHandler::batchFlusherLoop() {
+    std::unique_lock<std::mutex> lock(batch_mutex_);
+    while (!batch_stop_) {
+        // Re-read the window each pass so a config reload retunes (or
+        // enables/disables) batching without restarting this thread
+        const int window_ms = batch_window_ms_.load(std::memory_order_relaxed);
+        const auto window = std::chrono::milliseconds(window_ms);
+
+        batch_cv_.wait_for(lock, window_ms > 0 ? window : BATCH_DISABLED_POLL,
+                           [this] { return batch_stop_; });
+        if (batch_stop_) {
+            return;
+        }
+        // Flush a window no newer frame closed once it has aged past the
+        // window on the wall clock; with batching just disabled, flush
+        // whatever is still pending immediately
+        if (!batch_messages_.empty() &&
+            (window_ms <= 0 || std::chrono::steady_clock::now() - batch_started_ >= window)) {
+            std::vector<CameraMessage> flush_messages;
+            flush_messages.swap(batch_messages_);
+            const auto flush_latest = batch_latest_;
+
+            lock.unlock();
+            flushBatch(std::move(flush_messages), flush_latest);
+            lock.lock();
+        }
+    }
 }
 
 std::string_view MessageHandler::extractCameraId(const std::string& topic) {
@@ -166,43 +875,101 @@ std::string_view MessageHandler::extractCameraId(const std::string& topic) {
     return std::string_view(topic).substr(CAMERA_TOPIC_PREFIX.size());
 }
 
-std::optional<CameraMessage> MessageHandler::parseCameraMessage(const std::string& payload) {
-    rapidjson::Document doc;
-    doc.Parse(payload.c_str());
+std::optional<CameraMessage> MessageHandler::parseCameraMessage(std::string& payload,
+                                                                std::string_view camera_id) {
+    // Fast path: without schema validation (or for messages the sampler
+    // elects not to validate) there is no need for a DOM at all. A single
+    // SAX scan fills the CameraMessage directly, skipping DOM construction
+    // and the Pointer lookups entirely.
+    if (!schema_validation_ || !camera_schema_ || !shouldValidate(camera_id)) {
+        CameraMessageSaxHandler handler;
+        rapidjson::Reader reader;
+        rapidjson::InsituStringStream stream(payload.data());
+        reader.Parse<rapidjson::kParseInsituFlag>(stream, handler);
+
+        if (reader.HasParseError()) {
+            static LogRateLimiter parse_limiter{1.0, 5.0};
+            LOG_WARN_LIMITED(parse_limiter, "JSON parse error at offset {}: error code {}",
+                             reader.GetErrorOffset(),
+                             static_cast<int>(reader.GetParseErrorCode()));
+            return std::nullopt;
+        }
+        if (!handler.hasId()) {
+            static LogRateLimiter id_limiter{1.0, 5.0};
+            LOG_WARN_LIMITED(id_limiter, "Missing or invalid '/id' field in camera message");
+            return std::nullopt;
+        }
+        if (!handler.hasTimestamp()) {
+            static LogRateLimiter timestamp_limiter{1.0, 5.0};
+            LOG_WARN_LIMITED(timestamp_limiter,
+                             "Missing or invalid '/timestamp' field in camera message");
+            return std::nullopt;
+        }
+        if (!handler.hasObjects()) {
+            static LogRateLimiter objects_limiter{1.0, 5.0};
+            LOG_WARN_LIMITED(objects_limiter,
+                             "Missing or invalid '/objects' field in camera message");
+            return std::nullopt;
+        }
+        CameraMessage message = handler.takeMessage();
+        message.timestamp = resolveTimestamp(handler.timestampText(), camera_id);
+        return message;
+    }
+
+    // Validation path: the SchemaValidator needs a full document, so build
+    // the DOM and walk it as before.
+    //
+    // In-situ parse: string values in the DOM point into the payload buffer
+    // instead of being copied into the document allocator. The payload
+    // outlives the document within this function, and everything kept beyond
+    // it is copied into the CameraMessage below.
+    //
+    // Clearing the thread's pool allocator here is safe: the only documents
+    // built on it are local to parseCameraMessage and buildDummySceneMessage,
+    // both destroyed before this thread touches the pool again.
+    auto& scratch = threadScratch();
+    scratch.value_allocator.Clear();
+    rapidjson::Document doc(&scratch.value_allocator, PARSE_STACK_SIZE);
+    doc.ParseInsitu(payload.data());
 
     if (doc.HasParseError()) {
-        LOG_WARN("JSON parse error at offset {}: error code {}", doc.GetErrorOffset(),
-                 static_cast<int>(doc.GetParseError()));
+        static LogRateLimiter parse_limiter{1.0, 5.0};
+        LOG_WARN_LIMITED(parse_limiter, "JSON parse error at offset {}: error code {}",
+                         doc.GetErrorOffset(), static_cast<int>(doc.GetParseError()));
         return std::nullopt;
     }
 
-    // Validate against schema if enabled
-    if (schema_validation_ && camera_schema_) {
-        if (!validateJson(doc, camera_schema_.get())) {
-            return std::nullopt;
-        }
+    // This branch is only reached when validation is enabled and sampled in
+    if (!validateJson(doc, camera_validator_pool_)) {
+        recordValidationResult(camera_id, false);
+        return std::nullopt;
     }
+    recordValidationResult(camera_id, true);
 
     // Extract required fields using JSON Pointers (thread-safe static const pointers)
     CameraMessage message;
 
     const auto* id_val = PTR_ID.Get(doc);
     if (!id_val || !id_val->IsString()) {
-        LOG_WARN("Missing or invalid '/id' field in camera message");
+        static LogRateLimiter id_limiter{1.0, 5.0};
+        LOG_WARN_LIMITED(id_limiter, "Missing or invalid '/id' field in camera message");
         return std::nullopt;
     }
     message.id = id_val->GetString();
 
     const auto* timestamp_val = PTR_TIMESTAMP.Get(doc);
     if (!timestamp_val || !timestamp_val->IsString()) {
-        LOG_WARN("Missing or invalid '/timestamp' field in camera message");
+        static LogRateLimiter timestamp_limiter{1.0, 5.0};
+        LOG_WARN_LIMITED(timestamp_limiter,
+                         "Missing or invalid '/timestamp' field in camera message");
         return std::nullopt;
     }
-    message.timestamp = timestamp_val->GetString();
+    message.timestamp = resolveTimestamp(timestamp_val->GetString(), camera_id);
 
     const auto* objects_val = PTR_OBJECTS.Get(doc);
     if (!objects_val || !objects_val->IsObject()) {
-        LOG_WARN("Missing or invalid '/objects' field in camera message");
+        static LogRateLimiter objects_limiter{1.0, 5.0};
+        LOG_WARN_LIMITED(objects_limiter, "Missing or invalid '/objects' field in camera message");
         return std::nullopt;
     }
 
@@ -211,7 +978,9 @@ std::optional<CameraMessage> MessageHandler::parseCameraMessage(const std::strin
         std::string category = it->name.GetString();
 
         if (!it->value.IsArray()) {
-            LOG_WARN("Invalid detections array for category: {}", category);
+            static LogRateLimiter category_limiter{1.0, 5.0};
+            LOG_WARN_LIMITED(category_limiter, "Invalid detections array for category: {}",
+                             category);
             continue;
         }
 
@@ -237,13 +1006,16 @@ std::optional<CameraMessage> MessageHandler::parseCameraMessage(const std::strin
             const auto* bbox_height = PTR_BBOX_HEIGHT.Get(det);
 
             if (!bbox_x || !bbox_y || !bbox_width || !bbox_height) {
-                LOG_WARN("Missing bounding_box_px fields in detection");
+                static LogRateLimiter bbox_limiter{1.0, 5.0};
+                LOG_WARN_LIMITED(bbox_limiter, "Missing bounding_box_px fields in detection");
                 continue;
             }
 
             if (!bbox_x->IsNumber() || !bbox_y->IsNumber() || !bbox_width->IsNumber() ||
                 !bbox_height->IsNumber()) {
-                LOG_WARN("Invalid bounding_box_px field types in detection");
+                static LogRateLimiter bbox_type_limiter{1.0, 5.0};
+                LOG_WARN_LIMITED(bbox_type_limiter,
+                                 "Invalid bounding_box_px field types in detection");
                 continue;
             }
 
@@ -263,85 +1035,172 @@ std::optional<CameraMessage> MessageHandler::parseCameraMessage(const std::strin
     return message;
 }
 
-bool MessageHandler::validateJson(const rapidjson::Document& doc,
-                                  const rapidjson::SchemaDocument* schema) const {
-    rapidjson::SchemaValidator validator(*schema);
-    if (!doc.Accept(validator)) {
+bool MessageHandler::shouldValidate(std::string_view camera_id) {
+    const int sample_rate = validation_sample_rate_.load(std::memory_order_relaxed);
+    if (sample_rate <= 1) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(validation_state_mutex_);
+    auto& state = validation_state_[std::string(camera_id)];
+    const auto count = state.message_count++;
+    if (state.force_full) {
+        return true;
+    }
+    // Validate the camera's first message, then 1-in-N
+    return count % static_cast<std::uint64_t>(sample_rate) == 0;
+}
+
+void MessageHandler::recordValidationResult(std::string_view camera_id, bool valid) {
+    const int sample_rate = validation_sample_rate_.load(std::memory_order_relaxed);
+    if (sample_rate <= 1) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(validation_state_mutex_);
+    auto& state = validation_state_[std::string(camera_id)];
+    if (!valid) {
+        if (!state.force_full) {
+            LOG_WARN("Validation failure from camera {}, switching to full validation",
+                     camera_id);
+        }
+        state.force_full = true;
+        state.success_streak = 0;
+    } else if (state.force_full) {
+        if (++state.success_streak >= static_cast<std::uint32_t>(sample_rate)) {
+            LOG_INFO("Camera {} recovered, resuming 1-in-{} validation sampling", camera_id,
+                     sample_rate);
+            state.force_full = false;
+            state.success_streak = 0;
+        }
+    }
+}
+
+bool MessageHandler::validateJson(const rapidjson::Document& doc, SchemaValidatorPool& pool) {
+    auto validator = pool.acquire();
+    const bool valid = doc.Accept(*validator);
+    if (!valid) {
         rapidjson::StringBuffer schema_sb;
         rapidjson::StringBuffer doc_sb;
-        validator.GetInvalidSchemaPointer().StringifyUriFragment(schema_sb);
-        validator.GetInvalidDocumentPointer().StringifyUriFragment(doc_sb);
-        LOG_WARN(
+        validator->GetInvalidSchemaPointer().StringifyUriFragment(schema_sb);
+        validator->GetInvalidDocumentPointer().StringifyUriFragment(doc_sb);
+        static LogRateLimiter validation_limiter{1.0, 5.0};
+        LOG_WARN_LIMITED(
+            validation_limiter,
             "Schema validation failed: document path '{}' violated schema at '{}', keyword: {}",
-            doc_sb.GetString(), schema_sb.GetString(), validator.GetInvalidSchemaKeyword());
-        return false;
+            doc_sb.GetString(), schema_sb.GetString(), validator->GetInvalidSchemaKeyword());
     }
-    return true;
+    pool.release(std::move(validator));
+    return valid;
 }
 
-std::string MessageHandler::buildDummySceneMessage(const std::string& timestamp) {
-    // Build JSON using rapidjson for type safety and schema compliance
-    rapidjson::Document doc;
+std::string MessageHandler::buildSceneMessage(const std::string& timestamp,
+                                              const std::vector<rv::tracking::TrackedObject>& tracks) {
+    // Build JSON using rapidjson for type safety and schema compliance,
+    // reusing the thread's pool allocator instead of malloc'ing fresh chunks
+    auto& scratch = threadScratch();
+    scratch.value_allocator.Clear();
+    rapidjson::Document doc(&scratch.value_allocator, PARSE_STACK_SIZE);
     doc.SetObject();
     auto& allocator = doc.GetAllocator();
 
     // Add top-level fields
-    doc.AddMember("id", rapidjson::Value(DUMMY_SCENE_ID, allocator), allocator);
-    doc.AddMember("name", rapidjson::Value(DUMMY_SCENE_NAME, allocator), allocator);
+    doc.AddMember("id", rapidjson::Value(DEFAULT_SCENE_ID, allocator), allocator);
+    doc.AddMember("name", rapidjson::Value(DEFAULT_SCENE_NAME, allocator), allocator);
     doc.AddMember("timestamp", rapidjson::Value(timestamp.c_str(), allocator), allocator);
 
-    // Build objects array with a single dummy track
+    // One entry per reliable track
     rapidjson::Value objects(rapidjson::kArrayType);
-
-    rapidjson::Value track(rapidjson::kObjectType);
-    track.AddMember("id", "dummy-track-001", allocator);
-    track.AddMember("category", rapidjson::Value(DUMMY_THING_TYPE, allocator), allocator);
-
-    // Translation [x, y, z]
-    rapidjson::Value translation(rapidjson::kArrayType);
-    translation.PushBack(1.0, allocator);
-    translation.PushBack(2.0, allocator);
-    translation.PushBack(0.0, allocator);
-    track.AddMember("translation", translation, allocator);
-
-    // Velocity [vx, vy, vz]
-    rapidjson::Value velocity(rapidjson::kArrayType);
-    velocity.PushBack(0.1, allocator);
-    velocity.PushBack(0.2, allocator);
-    velocity.PushBack(0.0, allocator);
-    track.AddMember("velocity", velocity, allocator);
-
-    // Size [length, width, height]
-    rapidjson::Value size(rapidjson::kArrayType);
-    size.PushBack(0.5, allocator);
-    size.PushBack(0.5, allocator);
-    size.PushBack(1.8, allocator);
-    track.AddMember("size", size, allocator);
-
-    // Rotation quaternion [x, y, z, w]
-    rapidjson::Value rotation(rapidjson::kArrayType);
-    rotation.PushBack(0, allocator);
-    rotation.PushBack(0, allocator);
-    rotation.PushBack(0, allocator);
-    rotation.PushBack(1, allocator);
-    track.AddMember("rotation", rotation, allocator);
-
-    objects.PushBack(track, allocator);
+    for (const auto& tracked : tracks) {
+        rapidjson::Value track(rapidjson::kObjectType);
+
+        const std::string track_id = std::to_string(tracked.id);
+        track.AddMember("id", rapidjson::Value(track_id.c_str(), allocator), allocator);
+
+        const std::string category = tracking_engine_->categoryForTrack(tracked);
+        track.AddMember("category", rapidjson::Value(category.c_str(), allocator), allocator);
+
+        // Translation [x, y, z]
+        rapidjson::Value translation(rapidjson::kArrayType);
+        translation.PushBack(tracked.x, allocator);
+        translation.PushBack(tracked.y, allocator);
+        translation.PushBack(tracked.z, allocator);
+        track.AddMember("translation", translation, allocator);
+
+        // Velocity [vx, vy, vz]
+        rapidjson::Value velocity(rapidjson::kArrayType);
+        velocity.PushBack(tracked.vx, allocator);
+        velocity.PushBack(tracked.vy, allocator);
+        velocity.PushBack(0.0, allocator);
+        track.AddMember("velocity", velocity, allocator);
+
+        // Size [length, width, height]; the schema requires non-negative sizes
+        rapidjson::Value size(rapidjson::kArrayType);
+        size.PushBack(std::max(tracked.length, 0.0), allocator);
+        size.PushBack(std::max(tracked.width, 0.0), allocator);
+        size.PushBack(std::max(tracked.height, 0.0), allocator);
+        track.AddMember("size", size, allocator);
+
+        // Rotation: yaw about Z as a quaternion [x, y, z, w]
+        rapidjson::Value rotation(rapidjson::kArrayType);
+        rotation.PushBack(0.0, allocator);
+        rotation.PushBack(0.0, allocator);
+        rotation.PushBack(std::sin(tracked.yaw / 2.0), allocator);
+        rotation.PushBack(std::cos(tracked.yaw / 2.0), allocator);
+        track.AddMember("rotation", rotation, allocator);
+
+        objects.PushBack(track, allocator);
+    }
     doc.AddMember("objects", objects, allocator);
 
     // Validate output against schema if enabled
     if (schema_validation_ && scene_schema_) {
-        if (!validateJson(doc, scene_schema_.get())) {
+        if (!validateJson(doc, scene_validator_pool_)) {
             LOG_ERROR("Output message failed schema validation - this is a bug!");
         }
     }
 
-    // Serialize to string
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    // Serialize straight into the payload buffer the publish queue will own;
+    // the last payload's size reserves enough capacity that steady state
+    // fills it with a single allocation
+    std::string payload;
+    payload.reserve(scratch.last_payload_size + scratch.last_payload_size / 4);
+    StringPayloadStream stream{payload};
+    rapidjson::Writer<StringPayloadStream> writer(stream);
     doc.Accept(writer);
+    scratch.last_payload_size = payload.size();
+
+    return payload;
+}
+
+std::string
+MessageHandler::buildSceneBinaryMessage(const std::string& timestamp,
+                                        const std::vector<rv::tracking::TrackedObject>& tracks) {
+    // Same field mapping and clamping as the JSON output, so consumers can
+    // switch formats without changing their interpretation of the data
+    std::vector<scene_binary::TrackRecord> records;
+    records.reserve(tracks.size());
+    for (const auto& tracked : tracks) {
+        scene_binary::TrackRecord record;
+        record.id = tracked.id;
+        record.category = tracking_engine_->categoryForTrack(tracked);
+        record.translation[0] = tracked.x;
+        record.translation[1] = tracked.y;
+        record.translation[2] = tracked.z;
+        record.velocity[0] = tracked.vx;
+        record.velocity[1] = tracked.vy;
+        record.velocity[2] = 0.0;
+        record.size[0] = std::max(tracked.length, 0.0);
+        record.size[1] = std::max(tracked.width, 0.0);
+        record.size[2] = std::max(tracked.height, 0.0);
+        record.rotation[0] = 0.0;
+        record.rotation[1] = 0.0;
+        record.rotation[2] = std::sin(tracked.yaw / 2.0);
+        record.rotation[3] = std::cos(tracked.yaw / 2.0);
+        records.push_back(std::move(record));
+    }
 
-    return buffer.GetString();
+    return scene_binary::serialize(DEFAULT_SCENE_ID, DEFAULT_SCENE_NAME, timestamp, records);
 }
 
 } // namespace tracker
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "message_pipeline.hpp"
+#include "logger.hpp"
+
+#include <chrono>
+#include <functional>
+#include <utility>
+
+namespace tracker {
+
+MessagePipeline::MessagePipeline(Processor processor, std::size_t worker_count,
+                                 std::size_t queue_capacity)
+    : processor_(std::move(processor)), queue_capacity_(queue_capacity) {
+    if (worker_count == 0) {
+        worker_count = 1;
+    }
+    workers_.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+}
+
+MessagePipeline::~MessagePipeline() {
+    stop();
+}
+
+void MessagePipeline::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    for (auto& worker : workers_) {
+        worker->thread = std::thread([this, &worker]() { workerLoop(*worker); });
+    }
+    LOG_INFO("Message pipeline started ({} workers, queue capacity {} each)", workers_.size(),
+             queue_capacity_);
+}
+
+void MessagePipeline::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    for (auto& worker : workers_) {
+        worker->cv.notify_all();
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+    LOG_INFO("Message pipeline stopped (dropped: {})", dropped_count_.load());
+}
+
+bool MessagePipeline::enqueue(std::string topic, std::string payload) {
+    // Stable topic -> worker routing: one camera's messages always hit the
+    // same worker, which is what preserves per-camera ordering
+    auto& worker = *workers_[std::hash<std::string>{}(topic) % workers_.size()];
+
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.queue.size() >= queue_capacity_) {
+            dropped_count_++;
+            return false;
+        }
+        worker.queue.push_back(
+            {std::move(topic), std::move(payload), std::chrono::steady_clock::now()});
+    }
+    worker.cv.notify_one();
+    return true;
+}
+
+std::size_t MessagePipeline::getQueueDepth() const {
+    std::size_t depth = 0;
+    for (const auto& worker : workers_) {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        depth += worker->queue.size();
+    }
+    return depth;
+}
+
+void MessagePipeline::workerLoop(Worker& worker) {
+    while (true) {
+        QueuedMessage message;
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.cv.wait(lock, [this, &worker]() {
+                return !worker.queue.empty() || !running_.load();
+            });
+            if (worker.queue.empty()) {
+                // Stopping and drained; queued messages are always processed
+                // before exit
+                return;
+            }
+            message = std::move(worker.queue.front());
+            worker.queue.pop_front();
+        }
+        processor_(message.topic, std::move(message.payload), message.received_at);
+    }
+}
+
+} // namespace tracker
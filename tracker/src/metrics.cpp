@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "metrics.hpp"
+
+#include <format>
+
+namespace tracker {
+
+std::size_t ShardedCounter::shardIndex() {
+    // Assign shards round-robin as threads first touch a counter; the
+    // assignment is per thread, not per counter, which keeps the index a
+    // plain thread_local read on the hot path
+    static std::atomic<std::size_t> next_shard{0};
+    static thread_local std::size_t index =
+        next_shard.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+    return index;
+}
+
+std::string_view pipelineStageName(PipelineStage stage) {
+    switch (stage) {
+    case PipelineStage::Queue:
+        return "queue";
+    case PipelineStage::Parse:
+        return "parse";
+    case PipelineStage::Track:
+        return "track";
+    case PipelineStage::Serialize:
+        return "serialize";
+    case PipelineStage::Publish:
+        return "publish";
+    case PipelineStage::COUNT:
+        break;
+    }
+    return "unknown";
+}
+
+void LatencyHistogram::observe(std::chrono::steady_clock::duration latency) {
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+
+    std::size_t bucket = 0;
+    while (bucket < std::size(BUCKET_BOUNDS_US) && us > BUCKET_BOUNDS_US[bucket]) {
+        ++bucket;
+    }
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_us_.fetch_add(static_cast<std::uint64_t>(us < 0 ? 0 : us), std::memory_order_relaxed);
+}
+
+CameraStats& Metrics::camera(std::string_view camera_id) {
+    {
+        std::shared_lock<std::shared_mutex> lock(camera_mutex_);
+        auto it = cameras_.find(camera_id);
+        if (it != cameras_.end()) {
+            return *it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(camera_mutex_);
+    auto& slot = cameras_[std::string(camera_id)];
+    if (!slot) {
+        slot = std::make_unique<CameraStats>();
+    }
+    return *slot;
+}
+
+void Metrics::registerSampledMetric(std::string name, std::string help, std::string type,
+                                    std::function<double()> value) {
+    std::lock_guard<std::mutex> lock(sampled_mutex_);
+    sampled_metrics_.push_back(
+        {std::move(name), std::move(help), std::move(type), std::move(value)});
+}
+
+void Metrics::clearSampledMetrics() {
+    std::lock_guard<std::mutex> lock(sampled_mutex_);
+    sampled_metrics_.clear();
+}
+
+std::string Metrics::renderPrometheus() {
+    std::string out;
+    out.reserve(2048);
+
+    // Per-camera counters
+    out += "# HELP tracker_camera_messages_received_total Camera messages received\n";
+    out += "# TYPE tracker_camera_messages_received_total counter\n";
+    {
+        std::shared_lock<std::shared_mutex> lock(camera_mutex_);
+        for (const auto& [camera_id, stats] : cameras_) {
+            out += std::format("tracker_camera_messages_received_total{{camera=\"{}\"}} {}\n",
+                               camera_id, stats->received.value());
+        }
+    }
+    out += "# HELP tracker_camera_parse_failures_total Camera messages rejected during "
+           "parsing or validation\n";
+    out += "# TYPE tracker_camera_parse_failures_total counter\n";
+    {
+        std::shared_lock<std::shared_mutex> lock(camera_mutex_);
+        for (const auto& [camera_id, stats] : cameras_) {
+            out += std::format("tracker_camera_parse_failures_total{{camera=\"{}\"}} {}\n",
+                               camera_id, stats->parse_failures.value());
+        }
+    }
+    out += "# HELP tracker_camera_roi_dropped_detections_total Detections dropped outside the "
+           "scene boundary\n";
+    out += "# TYPE tracker_camera_roi_dropped_detections_total counter\n";
+    {
+        std::shared_lock<std::shared_mutex> lock(camera_mutex_);
+        for (const auto& [camera_id, stats] : cameras_) {
+            out += std::format("tracker_camera_roi_dropped_detections_total{{camera=\"{}\"}} {}\n",
+                               camera_id, stats->roi_dropped.value());
+        }
+    }
+
+    // Receive-to-publish latency histogram (cumulative buckets, seconds)
+    out += "# HELP tracker_publish_latency_seconds Camera message receive to scene publish "
+           "latency\n";
+    out += "# TYPE tracker_publish_latency_seconds histogram\n";
+    std::uint64_t cumulative = 0;
+    for (std::size_t bucket = 0; bucket < std::size(LatencyHistogram::BUCKET_BOUNDS_US);
+         ++bucket) {
+        cumulative += publish_latency_.bucketCount(bucket);
+        out += std::format("tracker_publish_latency_seconds_bucket{{le=\"{}\"}} {}\n",
+                           static_cast<double>(LatencyHistogram::BUCKET_BOUNDS_US[bucket]) / 1e6,
+                           cumulative);
+    }
+    out += std::format("tracker_publish_latency_seconds_bucket{{le=\"+Inf\"}} {}\n",
+                       publish_latency_.count());
+    out += std::format("tracker_publish_latency_seconds_sum {}\n",
+                       static_cast<double>(publish_latency_.sumMicroseconds()) / 1e6);
+    out += std::format("tracker_publish_latency_seconds_count {}\n", publish_latency_.count());
+
+    // Per-stage latency histograms, one labelled series per pipeline stage
+    out += "# HELP tracker_stage_latency_seconds Per-message latency of one pipeline stage\n";
+    out += "# TYPE tracker_stage_latency_seconds histogram\n";
+    for (std::size_t stage = 0; stage < static_cast<std::size_t>(PipelineStage::COUNT); ++stage) {
+        const auto name = pipelineStageName(static_cast<PipelineStage>(stage));
+        const auto& histogram = stage_latency_[stage];
+        std::uint64_t stage_cumulative = 0;
+        for (std::size_t bucket = 0; bucket < std::size(LatencyHistogram::BUCKET_BOUNDS_US);
+             ++bucket) {
+            stage_cumulative += histogram.bucketCount(bucket);
+            out += std::format(
+                "tracker_stage_latency_seconds_bucket{{stage=\"{}\",le=\"{}\"}} {}\n", name,
+                static_cast<double>(LatencyHistogram::BUCKET_BOUNDS_US[bucket]) / 1e6,
+                stage_cumulative);
+        }
+        out += std::format("tracker_stage_latency_seconds_bucket{{stage=\"{}\",le=\"+Inf\"}} {}\n",
+                           name, histogram.count());
+        out += std::format("tracker_stage_latency_seconds_sum{{stage=\"{}\"}} {}\n", name,
+                           static_cast<double>(histogram.sumMicroseconds()) / 1e6);
+        out += std::format("tracker_stage_latency_seconds_count{{stage=\"{}\"}} {}\n", name,
+                           histogram.count());
+    }
+
+    // Callback-sampled metrics (queue depths, global counters)
+    {
+        std::lock_guard<std::mutex> lock(sampled_mutex_);
+        for (const auto& metric : sampled_metrics_) {
+            out += std::format("# HELP {} {}\n", metric.name, metric.help);
+            out += std::format("# TYPE {} {}\n", metric.name, metric.type);
+            out += std::format("{} {}\n", metric.name, metric.value());
+        }
+    }
+
+    return out;
+}
+
+} // namespace tracker
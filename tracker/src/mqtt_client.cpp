@@ -36,9 +36,10 @@ std::string MqttClient::generateClientId() {
     return "tracker-" + getHostname() + "-" + std::to_string(getpid());
 }
 
-MqttClient::MqttClient(const MqttConfig& config, int max_reconnect_delay_s)
+MqttClient::MqttClient(const MqttConfig& config, int max_reconnect_delay_s,
+                       const std::string& client_id_suffix)
     : config_(config), max_reconnect_delay_s_(max_reconnect_delay_s),
-      client_id_(generateClientId()) {
+      client_id_(generateClientId() + client_id_suffix) {
     clearEmptyProxyEnvVars();
 
     std::string server_uri;
@@ -50,21 +51,23 @@ MqttClient::MqttClient(const MqttConfig& config, int max_reconnect_delay_s)
 
     LOG_INFO("MQTT client initializing: {} (client_id: {})", server_uri, client_id_);
 
-    client_ = std::make_unique<mqtt::async_client>(server_uri, client_id_);
+    if (config_.use_v5) {
+        client_ = std::make_unique<mqtt::async_client>(server_uri, client_id_,
+                                                       mqtt::create_options(MQTTVERSION_5));
+    } else {
+        client_ = std::make_unique<mqtt::async_client>(server_uri, client_id_);
+    }
     client_->set_callback(*this);
 
-    // Build connection options
-    auto conn_opts_builder = mqtt::connect_options_builder()
-                                 .clean_session(true)
-                                 .automatic_reconnect(false) // We handle reconnection ourselves
-                                 .keep_alive_interval(std::chrono::seconds(KEEPALIVE_SECONDS))
-                                 .connect_timeout(std::chrono::seconds(CONNECT_TIMEOUT_SECONDS));
-
-    if (!config_.insecure) {
-        conn_opts_builder.ssl(buildTlsOptions());
-    }
+    // Connection options (and the TLS context) are built lazily on the first
+    // connect() so constructing a client stays cheap on the startup path
 
-    conn_opts_ = conn_opts_builder.finalize();
+    publish_queue_ = std::make_unique<PublishQueue>(
+        [this](const std::string& topic, std::string payload) {
+            publishNow(topic, std::move(payload));
+        },
+        static_cast<std::size_t>(config_.publish_queue_capacity));
+    publish_queue_->start();
 }
 
 MqttClient::~MqttClient() {
@@ -115,6 +118,31 @@ void MqttClient::connect() {
     LOG_INFO("MQTT connecting to {}:{} (insecure={})", config_.host, config_.port,
              config_.insecure);
 
+    if (!conn_opts_built_) {
+        // First connect pays for TLS context construction (cert file checks,
+        // SSL setup); missing cert files still throw, as they did from the
+        // constructor before
+        // v5 connections use clean_start; 3.1.1 stays on clean_session
+        auto conn_opts_builder = config_.use_v5 ? mqtt::connect_options_builder::v5()
+                                                : mqtt::connect_options_builder();
+        if (config_.use_v5) {
+            conn_opts_builder.clean_start(true);
+        } else {
+            conn_opts_builder.clean_session(true);
+        }
+        conn_opts_builder
+            .automatic_reconnect(false) // We handle reconnection ourselves
+            .keep_alive_interval(std::chrono::seconds(KEEPALIVE_SECONDS))
+            .connect_timeout(std::chrono::seconds(CONNECT_TIMEOUT_SECONDS));
+
+        if (!config_.insecure) {
+            conn_opts_builder.ssl(buildTlsOptions());
+        }
+
+        conn_opts_ = conn_opts_builder.finalize();
+        conn_opts_built_ = true;
+    }
+
     try {
         auto tok = client_->connect(conn_opts_, nullptr, *this);
         LOG_DEBUG("MQTT connect initiated, token msg_id: {}", tok->get_message_id());
@@ -136,6 +164,12 @@ void MqttClient::disconnect(std::chrono::milliseconds drain_timeout) {
 
     LOG_INFO("MQTT disconnecting (drain timeout: {}ms)", drain_timeout.count());
 
+    // Drain and stop the publisher thread while still connected, so queued
+    // scene updates go out before the connection closes
+    if (publish_queue_) {
+        publish_queue_->stop();
+    }
+
     reconnect_cv_.notify_all();
 
     if (reconnect_thread_.joinable()) {
@@ -182,6 +216,39 @@ void MqttClient::subscribe(const std::string& topic) {
     }
 }
 
+void MqttClient::subscribe(const std::vector<std::string>& topics) {
+    if (topics.empty()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+        pending_subscriptions_.insert(topics.begin(), topics.end());
+    }
+
+    if (!connected_) {
+        LOG_DEBUG("MQTT batched subscribe deferred (not connected): {} topics", topics.size());
+        return;
+    }
+
+    subscribeNow(topics);
+}
+
+void MqttClient::subscribeNow(const std::vector<std::string>& topics) {
+    LOG_INFO("MQTT subscribing to {} topic filter(s) in one request (QoS {})", topics.size(),
+             MQTT_QOS);
+
+    try {
+        // One SUBSCRIBE packet with all filters; a single SUBACK confirms
+        // them (valid on both 3.1.1 and v5)
+        client_->subscribe(mqtt::string_collection::create(topics),
+                           std::vector<int>(topics.size(), MQTT_QOS), nullptr, *this);
+    } catch (const mqtt::exception& e) {
+        LOG_ERROR("MQTT batched subscribe failed: {}", e.what());
+        subscribed_ = false;
+    }
+}
+
 void MqttClient::unsubscribe(const std::string& topic) {
     {
         std::lock_guard<std::mutex> lock(subscriptions_mutex_);
@@ -209,15 +276,67 @@ void MqttClient::unsubscribe(const std::string& topic) {
 }
 
 void MqttClient::publish(const std::string& topic, const std::string& payload) {
+    publish(topic, std::string(payload));
+}
+
+void MqttClient::publish(const std::string& topic, std::string&& payload) {
+    // Hand off to the publisher thread; a lagging broker backs up the
+    // bounded queue (dropping the oldest entries) instead of stalling here.
+    // The buffer moves into the queue and later into the Paho message, so
+    // the bytes the serializer wrote are the bytes the wire sees.
+    publish_queue_->enqueue(topic, std::move(payload));
+}
+
+void MqttClient::publishNow(const std::string& topic, std::string payload) {
     if (!connected_) {
         LOG_WARN("MQTT publish dropped (not connected): {}", topic);
         return;
     }
 
+    const std::size_t payload_size = payload.size();
     try {
-        auto msg = mqtt::make_message(topic, payload, MQTT_QOS, false);
+        mqtt::message_ptr msg;
+
+        const auto alias_limit = std::min<int>(
+            config_.topic_alias_maximum, broker_topic_alias_max_.load(std::memory_order_acquire));
+        if (config_.use_v5 && alias_limit > 0) {
+            // Aliases are per connection: a reconnect bumps the generation
+            // and every established alias is forgotten
+            const auto generation = connection_generation_.load(std::memory_order_acquire);
+            if (generation != alias_generation_) {
+                topic_aliases_.clear();
+                next_topic_alias_ = 1;
+                alias_generation_ = generation;
+            }
+
+            const auto entry = topic_aliases_.find(topic);
+            if (entry != topic_aliases_.end()) {
+                // Established alias: the two-byte property stands in for the
+                // topic string
+                msg = mqtt::make_message("", std::move(payload), config_.publish_qos, false);
+                mqtt::properties props;
+                props.add({mqtt::property::TOPIC_ALIAS, entry->second});
+                msg->set_properties(props);
+            } else if (next_topic_alias_ <= alias_limit) {
+                // First publish carries topic and alias together, binding
+                // the alias at the broker for the rest of the connection
+                const std::uint16_t alias = next_topic_alias_++;
+                topic_aliases_.emplace(topic, alias);
+                msg = mqtt::make_message(topic, std::move(payload), config_.publish_qos, false);
+                mqtt::properties props;
+                props.add({mqtt::property::TOPIC_ALIAS, alias});
+                msg->set_properties(props);
+            }
+        }
+
+        if (!msg) {
+            // QoS 0 is the fast path: Paho hands the packet to the socket
+            // without tracking an acknowledgement. The payload buffer moves
+            // into the message, so the queued string is the one the wire sees.
+            msg = mqtt::make_message(topic, std::move(payload), config_.publish_qos, false);
+        }
         client_->publish(msg);
-        LOG_DEBUG("MQTT published to: {} ({} bytes)", topic, payload.size());
+        LOG_DEBUG("MQTT published to: {} ({} bytes)", topic, payload_size);
     } catch (const mqtt::exception& e) {
         LOG_ERROR("MQTT publish failed: {}", e.what());
     }
@@ -240,22 +359,24 @@ bool MqttClient::isSubscribed() const {
 
 void MqttClient::connected(const std::string& cause) {
     LOG_INFO("MQTT connected: {}", cause.empty() ? "initial connection" : cause);
+
+    // New connection, new topic-alias namespace: the publisher thread sees
+    // the generation move and drops its alias map
+    connection_generation_.fetch_add(1, std::memory_order_release);
+
     connected_ = true;
 
     // Wake up reconnect worker so it exits immediately
     reconnect_cv_.notify_all();
 
-    // Re-subscribe to all pending subscriptions
+    // Re-subscribe to all pending subscriptions with one SUBSCRIBE packet
+    std::vector<std::string> topics;
     {
         std::lock_guard<std::mutex> lock(subscriptions_mutex_);
-        for (const auto& topic : pending_subscriptions_) {
-            LOG_INFO("MQTT subscribing to: {} (QoS {})", topic, MQTT_QOS);
-            try {
-                client_->subscribe(topic, MQTT_QOS, nullptr, *this);
-            } catch (const mqtt::exception& e) {
-                LOG_ERROR("MQTT subscribe failed for {}: {}", topic, e.what());
-            }
-        }
+        topics.assign(pending_subscriptions_.begin(), pending_subscriptions_.end());
+    }
+    if (!topics.empty()) {
+        subscribeNow(topics);
     }
 }
 
@@ -275,6 +396,8 @@ void MqttClient::message_arrived(mqtt::const_message_ptr msg) {
 
     std::lock_guard<std::mutex> lock(callback_mutex_);
     if (message_callback_) {
+        // get_payload_str() materializes the single mutable copy of the Paho
+        // buffer; from here the payload is moved, never re-copied
         message_callback_(msg->get_topic(), msg->get_payload_str());
     }
 }
@@ -287,6 +410,20 @@ void MqttClient::on_success(const mqtt::token& tok) {
     if (tok.get_type() == mqtt::token::Type::CONNECT) {
         // Note: connected() callback is also called, but log here too
         LOG_INFO("MQTT connect action successful");
+
+        if (config_.use_v5) {
+            // The CONNACK advertises how many aliases this broker accepts;
+            // absent means none (per spec), and no alias is ever sent then
+            std::uint16_t broker_max = 0;
+            const auto& props = tok.get_connect_response().get_properties();
+            if (props.contains(mqtt::property::TOPIC_ALIAS_MAXIMUM)) {
+                broker_max =
+                    mqtt::get<std::uint16_t>(props, mqtt::property::TOPIC_ALIAS_MAXIMUM);
+            }
+            broker_topic_alias_max_.store(broker_max, std::memory_order_release);
+            LOG_INFO("MQTT v5 topic aliases: broker accepts {}, configured cap {}", broker_max,
+                     config_.topic_alias_maximum);
+        }
     } else if (tok.get_type() == mqtt::token::Type::SUBSCRIBE) {
         LOG_INFO("MQTT subscription successful");
         subscribed_ = true;
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "publish_queue.hpp"
+#include "logger.hpp"
+
+#include <utility>
+
+namespace tracker {
+
+PublishQueue::PublishQueue(Sink sink, std::size_t capacity)
+    : sink_(std::move(sink)), capacity_(capacity) {
+    if (capacity_ == 0) {
+        capacity_ = 1;
+    }
+}
+
+PublishQueue::~PublishQueue() {
+    stop();
+}
+
+void PublishQueue::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    thread_ = std::thread([this]() { publisherLoop(); });
+    LOG_INFO("Publish queue started (capacity {})", capacity_);
+}
+
+void PublishQueue::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    LOG_INFO("Publish queue stopped (dropped: {})", dropped_count_.load());
+}
+
+void PublishQueue::enqueue(std::string topic, std::string payload) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Drop-oldest: a lagging broker loses stale scene state, not the
+        // freshest update, and the enqueueing thread never blocks
+        if (queue_.size() >= capacity_) {
+            queue_.pop_front();
+            dropped_count_++;
+        }
+        queue_.push_back({std::move(topic), std::move(payload)});
+    }
+    cv_.notify_one();
+}
+
+void PublishQueue::publisherLoop() {
+    while (true) {
+        QueuedMessage message;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return !queue_.empty() || !running_.load(); });
+            if (queue_.empty()) {
+                // Stopping and drained; queued messages are always published
+                // before exit
+                return;
+            }
+            message = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        sink_(message.topic, std::move(message.payload));
+    }
+}
+
+} // namespace tracker
@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "roi_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace tracker {
+
+namespace {
+
+/**
+ * @brief Whether a segment intersects an axis-aligned cell (Liang-Barsky).
+ */
+bool segmentIntersectsCell(double x1, double y1, double x2, double y2, double cell_min_x,
+                           double cell_min_y, double cell_max_x, double cell_max_y) {
+    const double dx = x2 - x1;
+    const double dy = y2 - y1;
+    const double p[] = {-dx, dx, -dy, dy};
+    const double q[] = {x1 - cell_min_x, cell_max_x - x1, y1 - cell_min_y, cell_max_y - y1};
+
+    double t0 = 0.0;
+    double t1 = 1.0;
+    for (int side = 0; side < 4; ++side) {
+        if (p[side] == 0.0) {
+            if (q[side] < 0.0) {
+                return false; // Parallel and outside this cell side
+            }
+            continue;
+        }
+        const double t = q[side] / p[side];
+        if (p[side] < 0.0) {
+            t0 = std::max(t0, t);
+        } else {
+            t1 = std::min(t1, t);
+        }
+        if (t0 > t1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+RoiFilter::RoiFilter(std::vector<std::pair<double, double>> boundary, double mask_cell_size)
+    : boundary_(std::move(boundary)) {
+    if (boundary_.size() < 3) {
+        throw std::invalid_argument("ROI boundary requires at least three vertices");
+    }
+    if (mask_cell_size < 0.0) {
+        throw std::invalid_argument("ROI mask cell size must not be negative");
+    }
+
+    min_x_ = max_x_ = boundary_.front().first;
+    min_y_ = max_y_ = boundary_.front().second;
+    for (const auto& [x, y] : boundary_) {
+        min_x_ = std::min(min_x_, x);
+        max_x_ = std::max(max_x_, x);
+        min_y_ = std::min(min_y_, y);
+        max_y_ = std::max(max_y_, y);
+    }
+
+    // Precompute the crossing-number edge table; horizontal edges never
+    // straddle a query's y and get a harmless zero slope
+    const std::size_t n = boundary_.size();
+    edges_.reserve(n);
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++) {
+        const auto& vi = boundary_[i];
+        const auto& vj = boundary_[j];
+        const double dy = vj.second - vi.second;
+        edges_.push_back(Edge{vi.second, vj.second, vi.first,
+                              dy != 0.0 ? (vj.first - vi.first) / dy : 0.0});
+    }
+
+    if (mask_cell_size > 0.0) {
+        buildOccupancyMask(mask_cell_size);
+    }
+}
+
+bool RoiFilter::contains(double x, double y) const {
+    if (x < min_x_ || x > max_x_ || y < min_y_ || y > max_y_) {
+        return false;
+    }
+
+    if (mask_enabled_) {
+        const int col = std::min(mask_cols_ - 1, static_cast<int>((x - min_x_) / mask_cell_size_));
+        const int row = std::min(mask_rows_ - 1, static_cast<int>((y - min_y_) / mask_cell_size_));
+        const unsigned char cell =
+            mask_[static_cast<std::size_t>(row) * mask_cols_ + col];
+        if (cell != MASK_MIXED) {
+            return cell == MASK_INSIDE;
+        }
+    }
+
+    return exactContains(x, y);
+}
+
+std::size_t RoiFilter::filterDetections(CameraMessage& message) const {
+    std::size_t dropped = 0;
+
+    for (auto category = message.objects.begin(); category != message.objects.end();) {
+        auto& detections = category->second;
+        const auto outside = std::remove_if(
+            detections.begin(), detections.end(), [this](const Detection& detection) {
+                const auto& box = detection.bounding_box_px;
+                return !contains(box.x + box.width / 2.0, box.y + box.height);
+            });
+        dropped += static_cast<std::size_t>(detections.end() - outside);
+        detections.erase(outside, detections.end());
+
+        category = detections.empty() ? message.objects.erase(category) : std::next(category);
+    }
+
+    return dropped;
+}
+
+bool RoiFilter::exactContains(double x, double y) const {
+    bool inside = false;
+    for (const Edge& edge : edges_) {
+        if ((edge.yi > y) != (edge.yj > y)) {
+            if (x < edge.xi + (y - edge.yi) * edge.inv_slope) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+void RoiFilter::buildOccupancyMask(double cell_size) {
+    mask_cell_size_ = cell_size;
+    mask_cols_ = std::max(1, static_cast<int>(std::ceil((max_x_ - min_x_) / cell_size)));
+    mask_rows_ = std::max(1, static_cast<int>(std::ceil((max_y_ - min_y_) / cell_size)));
+    mask_.assign(static_cast<std::size_t>(mask_rows_) * mask_cols_, MASK_OUTSIDE);
+
+    // Cells a boundary edge passes through stay mixed and keep the exact
+    // test; that is what makes the mask lossless
+    const std::size_t n = boundary_.size();
+    for (std::size_t i = 0, j = n - 1; i < n; j = i++) {
+        const double x1 = boundary_[i].first;
+        const double y1 = boundary_[i].second;
+        const double x2 = boundary_[j].first;
+        const double y2 = boundary_[j].second;
+
+        const int col_lo = std::max(0, static_cast<int>((std::min(x1, x2) - min_x_) / cell_size));
+        const int col_hi =
+            std::min(mask_cols_ - 1, static_cast<int>((std::max(x1, x2) - min_x_) / cell_size));
+        const int row_lo = std::max(0, static_cast<int>((std::min(y1, y2) - min_y_) / cell_size));
+        const int row_hi =
+            std::min(mask_rows_ - 1, static_cast<int>((std::max(y1, y2) - min_y_) / cell_size));
+
+        for (int row = row_lo; row <= row_hi; ++row) {
+            for (int col = col_lo; col <= col_hi; ++col) {
+                const double cell_min_x = min_x_ + col * cell_size;
+                const double cell_min_y = min_y_ + row * cell_size;
+                if (segmentIntersectsCell(x1, y1, x2, y2, cell_min_x, cell_min_y,
+                                          cell_min_x + cell_size, cell_min_y + cell_size)) {
+                    mask_[static_cast<std::size_t>(row) * mask_cols_ + col] = MASK_MIXED;
+                }
+            }
+        }
+    }
+
+    // A cell no edge crosses lies entirely on one side of the boundary, so
+    // its center decides the whole cell
+    for (int row = 0; row < mask_rows_; ++row) {
+        for (int col = 0; col < mask_cols_; ++col) {
+            auto& cell = mask_[static_cast<std::size_t>(row) * mask_cols_ + col];
+            if (cell == MASK_MIXED) {
+                continue;
+            }
+            const double center_x = min_x_ + (col + 0.5) * cell_size;
+            const double center_y = min_y_ + (row + 0.5) * cell_size;
+            cell = exactContains(center_x, center_y) ? MASK_INSIDE : MASK_OUTSIDE;
+        }
+    }
+
+    mask_enabled_ = true;
+}
+
+} // namespace tracker
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "scene_binary.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace tracker {
+namespace scene_binary {
+
+namespace {
+
+constexpr char MAGIC[4] = {'S', 'S', 'C', 'B'};
+constexpr std::size_t DOUBLES_PER_TRACK = 13;
+
+// The layout is defined as little-endian; this implementation memcpy's host
+// values directly, which is correct on every platform we deploy to
+static_assert(std::numeric_limits<double>::is_iec559, "binary format requires IEEE 754 doubles");
+
+template <typename T> void append(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+void appendString(std::string& out, std::string_view text) {
+    const auto length = static_cast<std::uint16_t>(
+        text.size() > std::numeric_limits<std::uint16_t>::max()
+            ? std::numeric_limits<std::uint16_t>::max()
+            : text.size());
+    append(out, length);
+    out.append(text.data(), length);
+}
+
+/// Cursor over the payload; every read checks the remaining length
+class Reader {
+public:
+    explicit Reader(std::string_view payload) : payload_(payload) {}
+
+    template <typename T> bool read(T& value) {
+        if (payload_.size() - offset_ < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, payload_.data() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string& value) {
+        std::uint16_t length = 0;
+        if (!read(length) || payload_.size() - offset_ < length) {
+            return false;
+        }
+        value.assign(payload_.data() + offset_, length);
+        offset_ += length;
+        return true;
+    }
+
+private:
+    std::string_view payload_;
+    std::size_t offset_ = 0;
+};
+
+} // namespace
+
+std::string serialize(std::string_view scene_id, std::string_view scene_name,
+                      std::string_view timestamp, const std::vector<TrackRecord>& tracks) {
+    std::string out;
+    out.reserve(sizeof(MAGIC) + 1 + 6 + scene_id.size() + scene_name.size() + timestamp.size() +
+                sizeof(std::uint32_t) +
+                tracks.size() * (sizeof(std::int64_t) + sizeof(std::uint16_t) + 16 +
+                                 DOUBLES_PER_TRACK * sizeof(double)));
+
+    out.append(MAGIC, sizeof(MAGIC));
+    append(out, FORMAT_VERSION);
+    appendString(out, scene_id);
+    appendString(out, scene_name);
+    appendString(out, timestamp);
+    append(out, static_cast<std::uint32_t>(tracks.size()));
+
+    for (const auto& track : tracks) {
+        append(out, track.id);
+        appendString(out, track.category);
+        for (double value : track.translation) {
+            append(out, value);
+        }
+        for (double value : track.velocity) {
+            append(out, value);
+        }
+        for (double value : track.size) {
+            append(out, value);
+        }
+        for (double value : track.rotation) {
+            append(out, value);
+        }
+    }
+
+    return out;
+}
+
+std::optional<SceneMessage> parse(std::string_view payload) {
+    if (payload.size() < sizeof(MAGIC) + 1 ||
+        std::memcmp(payload.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        return std::nullopt;
+    }
+
+    Reader reader(payload.substr(sizeof(MAGIC)));
+    std::uint8_t version = 0;
+    if (!reader.read(version) || version != FORMAT_VERSION) {
+        return std::nullopt;
+    }
+
+    SceneMessage message;
+    std::uint32_t track_count = 0;
+    if (!reader.readString(message.scene_id) || !reader.readString(message.scene_name) ||
+        !reader.readString(message.timestamp) || !reader.read(track_count)) {
+        return std::nullopt;
+    }
+
+    message.tracks.reserve(track_count);
+    for (std::uint32_t i = 0; i < track_count; ++i) {
+        TrackRecord track;
+        if (!reader.read(track.id) || !reader.readString(track.category)) {
+            return std::nullopt;
+        }
+        for (double& value : track.translation) {
+            if (!reader.read(value)) {
+                return std::nullopt;
+            }
+        }
+        for (double& value : track.velocity) {
+            if (!reader.read(value)) {
+                return std::nullopt;
+            }
+        }
+        for (double& value : track.size) {
+            if (!reader.read(value)) {
+                return std::nullopt;
+            }
+        }
+        for (double& value : track.rotation) {
+            if (!reader.read(value)) {
+                return std::nullopt;
+            }
+        }
+        message.tracks.push_back(std::move(track));
+    }
+
+    return message;
+}
+
+} // namespace scene_binary
+} // namespace tracker
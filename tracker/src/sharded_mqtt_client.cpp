@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sharded_mqtt_client.hpp"
+#include "logger.hpp"
+
+#include <functional>
+#include <utility>
+
+namespace tracker {
+
+ShardedMqttClient::ShardedMqttClient(const MqttConfig& config, std::size_t shard_count,
+                                     int max_reconnect_delay_s) {
+    if (shard_count == 0) {
+        shard_count = 1;
+    }
+
+    LOG_INFO("Sharded MQTT ingest: {} connections, shared subscription group '{}'", shard_count,
+             SHARE_GROUP);
+
+    shards_.reserve(shard_count);
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        shards_.push_back(std::make_unique<MqttClient>(config, max_reconnect_delay_s,
+                                                       "-s" + std::to_string(i)));
+    }
+}
+
+void ShardedMqttClient::connect() {
+    for (auto& shard : shards_) {
+        shard->connect();
+    }
+}
+
+void ShardedMqttClient::disconnect(std::chrono::milliseconds drain_timeout) {
+    for (auto& shard : shards_) {
+        shard->disconnect(drain_timeout);
+    }
+}
+
+void ShardedMqttClient::subscribe(const std::string& topic) {
+    // Every shard joins the same group; the broker partitions the matching
+    // topics across the group's connections
+    const std::string shared_topic = makeSharedTopic(topic);
+    for (auto& shard : shards_) {
+        shard->subscribe(shared_topic);
+    }
+}
+
+void ShardedMqttClient::subscribe(const std::vector<std::string>& topics) {
+    std::vector<std::string> shared_topics;
+    shared_topics.reserve(topics.size());
+    for (const auto& topic : topics) {
+        shared_topics.push_back(makeSharedTopic(topic));
+    }
+    for (auto& shard : shards_) {
+        shard->subscribe(shared_topics);
+    }
+}
+
+void ShardedMqttClient::unsubscribe(const std::string& topic) {
+    const std::string shared_topic = makeSharedTopic(topic);
+    for (auto& shard : shards_) {
+        shard->unsubscribe(shared_topic);
+    }
+}
+
+void ShardedMqttClient::publish(const std::string& topic, const std::string& payload) {
+    shards_[shardForTopic(topic, shards_.size())]->publish(topic, payload);
+}
+
+void ShardedMqttClient::publish(const std::string& topic, std::string&& payload) {
+    shards_[shardForTopic(topic, shards_.size())]->publish(topic, std::move(payload));
+}
+
+void ShardedMqttClient::setMessageCallback(MessageCallback callback) {
+    // One shared callback: shards deliver concurrently, so downstream must be
+    // thread-safe (the message pipeline's enqueue is)
+    for (auto& shard : shards_) {
+        shard->setMessageCallback(callback);
+    }
+}
+
+bool ShardedMqttClient::isConnected() const {
+    for (const auto& shard : shards_) {
+        if (!shard->isConnected()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ShardedMqttClient::isSubscribed() const {
+    for (const auto& shard : shards_) {
+        if (!shard->isSubscribed()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t ShardedMqttClient::getPublishDroppedCount() const {
+    std::size_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard->getPublishDroppedCount();
+    }
+    return total;
+}
+
+std::size_t ShardedMqttClient::getPublishQueueDepth() const {
+    std::size_t total = 0;
+    for (const auto& shard : shards_) {
+        total += shard->getPublishQueueDepth();
+    }
+    return total;
+}
+
+std::size_t ShardedMqttClient::shardForTopic(const std::string& topic, std::size_t shard_count) {
+    return shard_count > 1 ? std::hash<std::string>{}(topic) % shard_count : 0;
+}
+
+std::string ShardedMqttClient::makeSharedTopic(const std::string& topic) {
+    return std::string("$share/") + SHARE_GROUP + "/" + topic;
+}
+
+} // namespace tracker
@@ -0,0 +1,437 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "shm_transport.hpp"
+
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace tracker {
+
+namespace {
+
+constexpr char RING_MAGIC[4] = {'S', 'D', 'S', 'M'};
+constexpr char RECORD_MAGIC[4] = {'S', 'D', 'E', 'T'};
+
+/// Sleep between polls once every ring came up empty
+constexpr auto IDLE_POLL = std::chrono::microseconds(200);
+/// How often missing segments are retried while the producer is down
+constexpr auto SEGMENT_RETRY = std::chrono::seconds(1);
+
+static_assert(std::numeric_limits<double>::is_iec559, "binary format requires IEEE 754 doubles");
+
+std::uint32_t roundUpToPowerOfTwo(std::uint32_t value) {
+    std::uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+template <typename T> void append(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+void appendString(std::string& out, std::string_view text) {
+    const auto length = static_cast<std::uint16_t>(
+        text.size() > std::numeric_limits<std::uint16_t>::max()
+            ? std::numeric_limits<std::uint16_t>::max()
+            : text.size());
+    append(out, length);
+    out.append(text.data(), length);
+}
+
+/// Cursor over the record; every read checks the remaining length
+class Reader {
+public:
+    explicit Reader(std::string_view payload) : payload_(payload) {}
+
+    template <typename T> bool read(T& value) {
+        if (payload_.size() - offset_ < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, payload_.data() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string& value) {
+        std::uint16_t length = 0;
+        if (!read(length) || payload_.size() - offset_ < length) {
+            return false;
+        }
+        value.assign(payload_.data() + offset_, length);
+        offset_ += length;
+        return true;
+    }
+
+private:
+    std::string_view payload_;
+    std::size_t offset_ = 0;
+};
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// ShmRing
+// ---------------------------------------------------------------------------
+
+struct ShmRing::RingHeader {
+    char magic[4];
+    std::uint8_t version;
+    std::uint8_t pad[3];
+    std::uint32_t slot_size;
+    std::uint32_t slot_count; ///< Power of two, so index = counter & (count - 1)
+    // Head and tail on separate cache lines: the producer only writes head,
+    // the consumer only writes tail
+    alignas(64) std::atomic<std::uint64_t> head;
+    alignas(64) std::atomic<std::uint64_t> tail;
+};
+
+ShmRing::ShmRing(std::string name, void* mapping, std::size_t mapping_size)
+    : name_(std::move(name)), mapping_(mapping), mapping_size_(mapping_size) {}
+
+ShmRing::~ShmRing() {
+    if (mapping_) {
+        munmap(mapping_, mapping_size_);
+    }
+}
+
+ShmRing::RingHeader* ShmRing::header() { return static_cast<RingHeader*>(mapping_); }
+
+const ShmRing::RingHeader* ShmRing::header() const {
+    return static_cast<const RingHeader*>(mapping_);
+}
+
+char* ShmRing::slot(std::uint64_t index) {
+    auto* hdr = header();
+    char* slots = static_cast<char*>(mapping_) + sizeof(RingHeader);
+    return slots + (index & (hdr->slot_count - 1)) * hdr->slot_size;
+}
+
+std::unique_ptr<ShmRing> ShmRing::create(const std::string& name, std::uint32_t slot_count,
+                                         std::uint32_t slot_size) {
+    slot_count = roundUpToPowerOfTwo(slot_count);
+    if (slot_size <= sizeof(std::uint32_t)) {
+        LOG_ERROR("Shared-memory ring {}: slot size {} too small", name, slot_size);
+        return nullptr;
+    }
+
+    // Replace any stale segment so head/tail never start from leftover state
+    shm_unlink(name.c_str());
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (fd < 0) {
+        LOG_ERROR("Shared-memory ring {}: shm_open failed: {}", name, std::strerror(errno));
+        return nullptr;
+    }
+
+    const std::size_t mapping_size =
+        sizeof(RingHeader) + static_cast<std::size_t>(slot_count) * slot_size;
+    if (ftruncate(fd, static_cast<off_t>(mapping_size)) != 0) {
+        LOG_ERROR("Shared-memory ring {}: ftruncate failed: {}", name, std::strerror(errno));
+        ::close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    void* mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        LOG_ERROR("Shared-memory ring {}: mmap failed: {}", name, std::strerror(errno));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    auto* hdr = new (mapping) RingHeader{};
+    std::memcpy(hdr->magic, RING_MAGIC, sizeof(RING_MAGIC));
+    hdr->version = FORMAT_VERSION;
+    hdr->slot_size = slot_size;
+    hdr->slot_count = slot_count;
+    hdr->head.store(0, std::memory_order_relaxed);
+    hdr->tail.store(0, std::memory_order_relaxed);
+
+    return std::unique_ptr<ShmRing>(new ShmRing(name, mapping, mapping_size));
+}
+
+std::unique_ptr<ShmRing> ShmRing::open(const std::string& name) {
+    // The consumer maps read-write because it advances the tail counter
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        return nullptr; // producer not up yet; caller retries
+    }
+
+    struct stat segment_stat {};
+    if (fstat(fd, &segment_stat) != 0 ||
+        static_cast<std::size_t>(segment_stat.st_size) < sizeof(RingHeader)) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const auto mapping_size = static_cast<std::size_t>(segment_stat.st_size);
+    void* mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        LOG_ERROR("Shared-memory ring {}: mmap failed: {}", name, std::strerror(errno));
+        return nullptr;
+    }
+
+    const auto* hdr = static_cast<const RingHeader*>(mapping);
+    if (std::memcmp(hdr->magic, RING_MAGIC, sizeof(RING_MAGIC)) != 0 ||
+        hdr->version != FORMAT_VERSION || hdr->slot_count == 0 ||
+        (hdr->slot_count & (hdr->slot_count - 1)) != 0 ||
+        hdr->slot_size <= sizeof(std::uint32_t) ||
+        mapping_size <
+            sizeof(RingHeader) + static_cast<std::size_t>(hdr->slot_count) * hdr->slot_size) {
+        LOG_WARN("Shared-memory ring {}: incompatible header, ignoring segment", name);
+        munmap(mapping, mapping_size);
+        return nullptr;
+    }
+
+    return std::unique_ptr<ShmRing>(new ShmRing(name, mapping, mapping_size));
+}
+
+bool ShmRing::tryPush(std::string_view record) {
+    auto* hdr = header();
+    if (record.size() > hdr->slot_size - sizeof(std::uint32_t)) {
+        return false;
+    }
+
+    const std::uint64_t head = hdr->head.load(std::memory_order_relaxed);
+    if (head - hdr->tail.load(std::memory_order_acquire) >= hdr->slot_count) {
+        return false; // full; producer falls back to MQTT
+    }
+
+    char* dst = slot(head);
+    const auto length = static_cast<std::uint32_t>(record.size());
+    std::memcpy(dst, &length, sizeof(length));
+    std::memcpy(dst + sizeof(length), record.data(), record.size());
+    hdr->head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool ShmRing::tryPop(std::string& record) {
+    auto* hdr = header();
+    const std::uint64_t tail = hdr->tail.load(std::memory_order_relaxed);
+    if (tail == hdr->head.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    const char* src = slot(tail);
+    std::uint32_t length = 0;
+    std::memcpy(&length, src, sizeof(length));
+    if (length > hdr->slot_size - sizeof(std::uint32_t)) {
+        // Corrupt slot (misbehaving producer); skip it rather than crash
+        record.clear();
+    } else {
+        record.assign(src + sizeof(length), length);
+    }
+    hdr->tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+std::size_t ShmRing::size() const {
+    const auto* hdr = header();
+    return static_cast<std::size_t>(hdr->head.load(std::memory_order_acquire) -
+                                    hdr->tail.load(std::memory_order_acquire));
+}
+
+void ShmRing::unlink(const std::string& name) { shm_unlink(name.c_str()); }
+
+// ---------------------------------------------------------------------------
+// detection_record
+// ---------------------------------------------------------------------------
+
+namespace detection_record {
+
+std::string encode(const CameraMessage& message) {
+    std::string out;
+    std::size_t detection_count = 0;
+    for (const auto& [category, detections] : message.objects) {
+        detection_count += detections.size();
+    }
+    out.reserve(sizeof(RECORD_MAGIC) + 1 + 2 + message.id.size() + sizeof(std::int64_t) +
+                sizeof(std::uint16_t) + message.objects.size() * 24 +
+                detection_count * (1 + sizeof(std::int32_t) + 4 * sizeof(double)));
+
+    out.append(RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    append(out, FORMAT_VERSION);
+    appendString(out, message.id);
+    const auto epoch_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                              message.timestamp.time_since_epoch())
+                              .count();
+    append(out, static_cast<std::int64_t>(epoch_us));
+    append(out, static_cast<std::uint16_t>(message.objects.size()));
+
+    for (const auto& [category, detections] : message.objects) {
+        appendString(out, category);
+        append(out, static_cast<std::uint32_t>(detections.size()));
+        for (const auto& detection : detections) {
+            append(out, static_cast<std::uint8_t>(detection.id.has_value() ? 1 : 0));
+            append(out, static_cast<std::int32_t>(detection.id.value_or(0)));
+            append(out, detection.bounding_box_px.x);
+            append(out, detection.bounding_box_px.y);
+            append(out, detection.bounding_box_px.width);
+            append(out, detection.bounding_box_px.height);
+        }
+    }
+
+    return out;
+}
+
+std::optional<CameraMessage> decode(std::string_view record) {
+    if (record.size() < sizeof(RECORD_MAGIC) + 1 ||
+        std::memcmp(record.data(), RECORD_MAGIC, sizeof(RECORD_MAGIC)) != 0) {
+        return std::nullopt;
+    }
+
+    Reader reader(record.substr(sizeof(RECORD_MAGIC)));
+    std::uint8_t version = 0;
+    if (!reader.read(version) || version != FORMAT_VERSION) {
+        return std::nullopt;
+    }
+
+    CameraMessage message;
+    std::int64_t epoch_us = 0;
+    std::uint16_t category_count = 0;
+    if (!reader.readString(message.id) || message.id.empty() || !reader.read(epoch_us) ||
+        !reader.read(category_count)) {
+        return std::nullopt;
+    }
+    message.timestamp =
+        std::chrono::system_clock::time_point(std::chrono::microseconds(epoch_us));
+
+    for (std::uint16_t i = 0; i < category_count; ++i) {
+        std::string category;
+        std::uint32_t count = 0;
+        if (!reader.readString(category) || !reader.read(count)) {
+            return std::nullopt;
+        }
+        auto& detections = message.objects[category];
+        detections.reserve(count);
+        for (std::uint32_t j = 0; j < count; ++j) {
+            std::uint8_t has_id = 0;
+            std::int32_t id = 0;
+            Detection detection;
+            if (!reader.read(has_id) || !reader.read(id) ||
+                !reader.read(detection.bounding_box_px.x) ||
+                !reader.read(detection.bounding_box_px.y) ||
+                !reader.read(detection.bounding_box_px.width) ||
+                !reader.read(detection.bounding_box_px.height)) {
+                return std::nullopt;
+            }
+            if (has_id != 0) {
+                detection.id = id;
+            }
+            detections.push_back(detection);
+        }
+    }
+
+    return message;
+}
+
+} // namespace detection_record
+
+// ---------------------------------------------------------------------------
+// ShmDetectionReader
+// ---------------------------------------------------------------------------
+
+ShmDetectionReader::ShmDetectionReader(std::vector<std::string> camera_ids,
+                                       std::string segment_prefix, MessageCallback callback)
+    : callback_(std::move(callback)) {
+    cameras_.reserve(camera_ids.size());
+    for (auto& camera_id : camera_ids) {
+        CameraRing camera;
+        camera.segment_name = segment_prefix + camera_id;
+        camera.camera_id = std::move(camera_id);
+        cameras_.push_back(std::move(camera));
+    }
+}
+
+ShmDetectionReader::~ShmDetectionReader() { stop(); }
+
+void ShmDetectionReader::start() {
+    if (cameras_.empty() || poll_thread_.joinable()) {
+        return;
+    }
+    LOG_INFO("Shared-memory ingest: polling {} camera segment(s)", cameras_.size());
+    stop_requested_ = false;
+    poll_thread_ = std::thread(&ShmDetectionReader::pollLoop, this);
+}
+
+void ShmDetectionReader::stop() {
+    stop_requested_ = true;
+    if (poll_thread_.joinable()) {
+        poll_thread_.join();
+    }
+}
+
+void ShmDetectionReader::pollLoop() {
+    auto next_segment_retry = std::chrono::steady_clock::now();
+
+    while (!stop_requested_.load(std::memory_order_relaxed)) {
+        // Attach cameras whose segment has appeared since the last attempt
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= next_segment_retry) {
+            for (auto& camera : cameras_) {
+                if (!camera.ring) {
+                    camera.ring = ShmRing::open(camera.segment_name);
+                    if (camera.ring) {
+                        LOG_INFO("Shared-memory ingest: attached segment {} for camera {}",
+                                 camera.segment_name, camera.camera_id);
+                    }
+                }
+            }
+            next_segment_retry = now + SEGMENT_RETRY;
+        }
+
+        std::size_t delivered = 0;
+        for (auto& camera : cameras_) {
+            if (camera.ring) {
+                delivered += drainRing(camera);
+            }
+        }
+
+        if (delivered == 0) {
+            std::this_thread::sleep_for(IDLE_POLL);
+        }
+    }
+}
+
+std::size_t ShmDetectionReader::drainRing(CameraRing& camera) {
+    std::size_t delivered = 0;
+    std::string record;
+    while (camera.ring->tryPop(record)) {
+        auto message = detection_record::decode(record);
+        if (!message) {
+            decode_failure_count_++;
+            static LogRateLimiter decode_limiter{1.0, 5.0};
+            LOG_WARN_LIMITED(decode_limiter,
+                             "Shared-memory ingest: undecodable record from segment {}",
+                             camera.segment_name);
+            continue;
+        }
+        message->received_at = std::chrono::steady_clock::now();
+        callback_(std::move(*message));
+        delivered_count_++;
+        ++delivered;
+        if (stop_requested_.load(std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    return delivered;
+}
+
+} // namespace tracker
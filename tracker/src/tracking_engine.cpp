@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tracking_engine.hpp"
+#include "logger.hpp"
+
+#include <algorithm>
+
+#include <rv/tracking/Classification.hpp>
+
+namespace tracker {
+
+namespace {
+
+// Classification slots are fixed-capacity so every measurement and track
+// carries a same-size vector regardless of when its category first appeared
+constexpr std::size_t MAX_CATEGORIES = rv::tracking::FixedClassification::kMaxClasses;
+
+} // namespace
+
+TrackingEngine::TrackingEngine(Config config) : config_(config) {
+    tracker_config_.mNonMeasurementTimeDynamic = config_.non_measurement_time_dynamic_s;
+    tracker_config_.mNonMeasurementTimeStatic = config_.non_measurement_time_static_s;
+    tracker_config_.mMaxUnreliableTime = config_.max_unreliable_time_s;
+
+    categories_.reserve(MAX_CATEGORIES);
+}
+
+TrackingEngine::SceneTracker& TrackingEngine::sceneTracker(const std::string& scene_id) {
+    std::lock_guard<std::mutex> lock(scenes_mutex_);
+    auto& slot = scene_trackers_[scene_id];
+    if (!slot) {
+        LOG_INFO("Creating tracker for scene: {}", scene_id);
+        slot = std::make_unique<SceneTracker>(tracker_config_);
+    }
+    return *slot;
+}
+
+std::size_t TrackingEngine::categorySlot(const std::string& category) {
+    std::lock_guard<std::mutex> lock(categories_mutex_);
+    auto it = std::find(categories_.begin(), categories_.end(), category);
+    if (it != categories_.end()) {
+        return static_cast<std::size_t>(it - categories_.begin());
+    }
+    if (categories_.size() >= MAX_CATEGORIES) {
+        // Overflow categories share the last slot rather than growing the
+        // classification vectors past their fixed capacity
+        LOG_WARN("Category limit ({}) reached, bucketing '{}' with '{}'", MAX_CATEGORIES, category,
+                 categories_.back());
+        return categories_.size() - 1;
+    }
+    categories_.push_back(category);
+    return categories_.size() - 1;
+}
+
+rv::tracking::TrackedObject TrackingEngine::makeMeasurement(const Detection& detection,
+                                                            std::size_t category_slot) const {
+    rv::tracking::TrackedObject measurement;
+    measurement.x = detection.bounding_box_px.x + detection.bounding_box_px.width / 2.0;
+    measurement.y = detection.bounding_box_px.y + detection.bounding_box_px.height / 2.0;
+    measurement.length = detection.bounding_box_px.width;
+    measurement.width = detection.bounding_box_px.height;
+
+    rv::tracking::Classification classification =
+        rv::tracking::Classification::Zero(static_cast<Eigen::Index>(MAX_CATEGORIES));
+    classification[static_cast<Eigen::Index>(category_slot)] = 1.0;
+    measurement.classification = std::move(classification);
+
+    return measurement;
+}
+
+std::vector<rv::tracking::TrackedObject>
+TrackingEngine::makeMeasurements(const CameraMessage& message) {
+    std::vector<rv::tracking::TrackedObject> measurements;
+    for (const auto& [category, detections] : message.objects) {
+        const std::size_t slot = categorySlot(category);
+        measurements.reserve(measurements.size() + detections.size());
+        for (const auto& detection : detections) {
+            measurements.push_back(makeMeasurement(detection, slot));
+        }
+    }
+    return measurements;
+}
+
+std::vector<rv::tracking::TrackedObject>
+TrackingEngine::trackFrame(const std::string& scene_id, const CameraMessage& message,
+                           std::chrono::system_clock::time_point timestamp) {
+    auto measurements = makeMeasurements(message);
+
+    auto& scene = sceneTracker(scene_id);
+    std::lock_guard<std::mutex> lock(scene.mutex);
+    scene.tracker.track(std::move(measurements), timestamp,
+                        rv::tracking::DistanceType::MultiClassEuclidean,
+                        config_.distance_threshold);
+    return scene.tracker.getReliableTracks();
+}
+
+std::vector<rv::tracking::TrackedObject>
+TrackingEngine::trackBatch(const std::string& scene_id,
+                           const std::vector<CameraMessage>& messages,
+                           std::chrono::system_clock::time_point timestamp) {
+    std::vector<std::vector<rv::tracking::TrackedObject>> objects_per_camera;
+    objects_per_camera.reserve(messages.size());
+    for (const auto& message : messages) {
+        objects_per_camera.push_back(makeMeasurements(message));
+    }
+
+    auto& scene = sceneTracker(scene_id);
+    std::lock_guard<std::mutex> lock(scene.mutex);
+    scene.tracker.track(std::move(objects_per_camera), timestamp,
+                        rv::tracking::DistanceType::MultiClassEuclidean,
+                        config_.distance_threshold);
+    return scene.tracker.getReliableTracks();
+}
+
+std::string TrackingEngine::categoryForTrack(const rv::tracking::TrackedObject& track) const {
+    const Eigen::Index dominant = track.dominantClass();
+
+    std::lock_guard<std::mutex> lock(categories_mutex_);
+    if (dominant < 0 || static_cast<std::size_t>(dominant) >= categories_.size()) {
+        return "unknown";
+    }
+    return categories_[static_cast<std::size_t>(dominant)];
+}
+
+} // namespace tracker
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "config_watcher.hpp"
+
+#include "logger.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+namespace tracker {
+namespace {
+
+/**
+ * @brief RAII helper for a rewritable temporary config file.
+ */
+class TempConfigFile {
+public:
+    explicit TempConfigFile(const std::string& content) {
+        path_ = std::filesystem::temp_directory_path() /
+                ("tracker_watcher_test_" + std::to_string(counter_++) + ".json");
+        write(content);
+    }
+
+    ~TempConfigFile() { std::filesystem::remove(path_); }
+
+    /// Rewrite the file and bump its mtime past filesystem timestamp granularity
+    void write(const std::string& content) {
+        {
+            std::ofstream ofs(path_, std::ios::trunc);
+            ofs << content;
+        }
+        const auto now = std::filesystem::file_time_type::clock::now();
+        std::filesystem::last_write_time(path_, now + std::chrono::seconds(counter_++));
+    }
+
+    const std::filesystem::path& path() const { return path_; }
+
+private:
+    std::filesystem::path path_;
+    static inline int counter_ = 0;
+};
+
+std::filesystem::path get_schema_path() {
+    const auto this_file = std::filesystem::weakly_canonical(std::filesystem::path(__FILE__));
+    const auto project_root = this_file.parent_path().parent_path().parent_path();
+    return project_root / "schema" / "config.schema.json";
+}
+
+std::string config_with_batch_window(int batch_window_ms) {
+    return R"({
+      "infrastructure": {
+        "mqtt": {"host": "localhost", "port": 1883, "insecure": true},
+        "tracker": {"batch_window_ms": )" +
+           std::to_string(batch_window_ms) + R"(}
+      }
+    })";
+}
+
+template <typename Predicate> bool waitFor(Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+class ConfigWatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override { Logger::init("error"); }
+    void TearDown() override { Logger::shutdown(); }
+
+    static constexpr auto POLL = std::chrono::milliseconds(20);
+};
+
+// A valid edit swaps in a new snapshot; readers holding the old one are
+// unaffected
+TEST_F(ConfigWatcherTest, ValidEditSwapsSnapshot) {
+    TempConfigFile file(config_with_batch_window(0));
+    ConfigStore store(load_config(file.path(), get_schema_path()));
+    const auto original = store.snapshot();
+
+    ConfigWatcher watcher(file.path(), get_schema_path(), store, nullptr, POLL);
+    watcher.start();
+
+    file.write(config_with_batch_window(50));
+
+    EXPECT_TRUE(waitFor([&] { return watcher.getReloadCount() >= 1; }));
+    EXPECT_EQ(store.snapshot()->infrastructure.tracker.batch_window_ms, 50);
+    // The snapshot captured before the edit is immutable
+    EXPECT_EQ(original->infrastructure.tracker.batch_window_ms, 0);
+
+    watcher.stop();
+}
+
+// An edit that fails validation keeps the last good snapshot active, and a
+// subsequent fix is picked up
+TEST_F(ConfigWatcherTest, InvalidEditKeepsLastGoodConfig) {
+    TempConfigFile file(config_with_batch_window(25));
+    ConfigStore store(load_config(file.path(), get_schema_path()));
+
+    ConfigWatcher watcher(file.path(), get_schema_path(), store, nullptr, POLL);
+    watcher.start();
+
+    file.write("{ not valid json");
+    // Give the watcher several polls to (not) act on the broken file
+    std::this_thread::sleep_for(POLL * 5);
+    EXPECT_EQ(watcher.getReloadCount(), 0u);
+    EXPECT_EQ(store.snapshot()->infrastructure.tracker.batch_window_ms, 25);
+
+    file.write(config_with_batch_window(75));
+    EXPECT_TRUE(waitFor([&] { return watcher.getReloadCount() >= 1; }));
+    EXPECT_EQ(store.snapshot()->infrastructure.tracker.batch_window_ms, 75);
+
+    watcher.stop();
+}
+
+// The reload callback sees both the fresh and the previous snapshot
+TEST_F(ConfigWatcherTest, ReloadCallbackGetsFreshAndPrevious) {
+    TempConfigFile file(config_with_batch_window(10));
+    ConfigStore store(load_config(file.path(), get_schema_path()));
+
+    std::atomic<int> fresh_window{-1};
+    std::atomic<int> previous_window{-1};
+    ConfigWatcher watcher(
+        file.path(), get_schema_path(), store,
+        [&](const ServiceConfig& fresh, const ServiceConfig& previous) {
+            fresh_window = fresh.infrastructure.tracker.batch_window_ms;
+            previous_window = previous.infrastructure.tracker.batch_window_ms;
+        },
+        POLL);
+    watcher.start();
+
+    file.write(config_with_batch_window(40));
+
+    EXPECT_TRUE(waitFor([&] { return fresh_window.load() == 40; }));
+    EXPECT_EQ(previous_window.load(), 10);
+
+    watcher.stop();
+}
+
+} // namespace
+} // namespace tracker
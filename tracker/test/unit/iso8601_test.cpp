@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iso8601.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+namespace tracker {
+namespace {
+
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::system_clock;
+
+// Parse followed by format returns the canonical millisecond form
+TEST(Iso8601Test, RoundTripCanonicalTimestamp) {
+    auto parsed = iso8601::parse("2026-01-27T15:45:30.123Z");
+
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(iso8601::format(*parsed), "2026-01-27T15:45:30.123Z");
+}
+
+// Parsed value matches one built from civil fields independently
+TEST(Iso8601Test, ParseMatchesKnownEpochSeconds) {
+    auto parsed = iso8601::parse("1970-01-02T00:00:00.000Z");
+
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->time_since_epoch(), std::chrono::seconds(86400));
+}
+
+// Fraction is optional and digits beyond milliseconds survive as microseconds
+TEST(Iso8601Test, FractionVariants) {
+    auto no_fraction = iso8601::parse("2026-01-27T12:00:00Z");
+    ASSERT_TRUE(no_fraction.has_value());
+    EXPECT_EQ(iso8601::format(*no_fraction), "2026-01-27T12:00:00.000Z");
+
+    auto short_fraction = iso8601::parse("2026-01-27T12:00:00.5Z");
+    ASSERT_TRUE(short_fraction.has_value());
+    EXPECT_EQ(iso8601::format(*short_fraction), "2026-01-27T12:00:00.500Z");
+
+    auto long_fraction = iso8601::parse("2026-01-27T12:00:00.123456789Z");
+    ASSERT_TRUE(long_fraction.has_value());
+    EXPECT_EQ(std::chrono::duration_cast<microseconds>(long_fraction->time_since_epoch()).count() %
+                  1000000,
+              123456);
+}
+
+// Missing zone designator is tolerated (inputs are UTC by contract)
+TEST(Iso8601Test, MissingZoneDesignatorAccepted) {
+    auto parsed = iso8601::parse("2026-01-27T12:00:00.250");
+
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(iso8601::format(*parsed), "2026-01-27T12:00:00.250Z");
+}
+
+TEST(Iso8601Test, RejectsBadLayouts) {
+    EXPECT_FALSE(iso8601::parse("").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27 12:00:00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27T12.00.00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("not a timestamp at all").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27T12:00:0aZ").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27T12:00:00.Z").has_value());
+}
+
+TEST(Iso8601Test, RejectsOutOfRangeFields) {
+    EXPECT_FALSE(iso8601::parse("2026-00-27T12:00:00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-13-27T12:00:00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-00T12:00:00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-32T12:00:00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27T24:00:00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27T12:60:00Z").has_value());
+    EXPECT_FALSE(iso8601::parse("2026-01-27T12:00:61Z").has_value());
+}
+
+// Leap day in a leap year round-trips; Feb 29 in a non-leap year maps to a
+// different civil date, so the formatter must never reproduce it
+TEST(Iso8601Test, HandlesLeapDay) {
+    auto parsed = iso8601::parse("2024-02-29T23:59:59.999Z");
+
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(iso8601::format(*parsed), "2024-02-29T23:59:59.999Z");
+}
+
+// The Formatter's cached per-second prefix must not leak across boundaries:
+// consecutive calls in the same second and across seconds both format
+// correctly from one instance
+TEST(Iso8601Test, FormatterCacheCorrectAcrossCalls) {
+    iso8601::Formatter formatter;
+    const auto base = *iso8601::parse("2026-01-27T23:59:59.000Z");
+
+    EXPECT_EQ(formatter.format(base + milliseconds(100)), "2026-01-27T23:59:59.100Z");
+    EXPECT_EQ(formatter.format(base + milliseconds(900)), "2026-01-27T23:59:59.900Z");
+    // Crossing the second also crosses the day boundary here
+    EXPECT_EQ(formatter.format(base + milliseconds(1500)), "2026-01-28T00:00:00.500Z");
+    // Going backwards invalidates the cache too
+    EXPECT_EQ(formatter.format(base), "2026-01-27T23:59:59.000Z");
+}
+
+} // namespace
+} // namespace tracker
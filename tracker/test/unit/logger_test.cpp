@@ -9,6 +9,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
 #include <vector>
 
 namespace tracker {
@@ -236,5 +238,74 @@ TEST(LoggerJsonTest, ValidJsonOutput) {
     Logger::shutdown();
 }
 
+// =============================================================================
+// Hot-path log throttling tests
+// =============================================================================
+
+// With no refill, the burst passes and everything after it is counted
+TEST(LogRateLimiterTest, AllowsBurstThenSuppressesAndCounts) {
+    LogRateLimiter limiter{0.0, 3.0};
+
+    EXPECT_TRUE(limiter.tryAcquire());
+    EXPECT_TRUE(limiter.tryAcquire());
+    EXPECT_TRUE(limiter.tryAcquire());
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FALSE(limiter.tryAcquire());
+    }
+
+    EXPECT_EQ(limiter.takeSuppressed(), 5u);
+    // The count resets once reported
+    EXPECT_EQ(limiter.takeSuppressed(), 0u);
+}
+
+// Tokens come back over time at the configured rate
+TEST(LogRateLimiterTest, RefillsOverTime) {
+    LogRateLimiter limiter{1000.0, 1.0};
+
+    EXPECT_TRUE(limiter.tryAcquire());
+    // The bucket may already have refilled on a slow machine; drain until empty
+    while (limiter.tryAcquire()) {
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    bool reacquired = false;
+    while (!reacquired && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        reacquired = limiter.tryAcquire();
+    }
+    EXPECT_TRUE(reacquired);
+}
+
+// Per key: the first occurrence logs, then every Nth, carrying the count of
+// the N-1 in between
+TEST(LogSamplerTest, FirstAndEveryNthOccurrenceLogs) {
+    LogSampler sampler{5};
+
+    auto first = sampler.shouldLog("camera1");
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(*first, 0u);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_FALSE(sampler.shouldLog("camera1").has_value());
+    }
+
+    auto sixth = sampler.shouldLog("camera1");
+    ASSERT_TRUE(sixth.has_value());
+    EXPECT_EQ(*sixth, 4u);
+}
+
+// A flooding camera does not eat another camera's log budget
+TEST(LogSamplerTest, KeysSampleIndependently) {
+    LogSampler sampler{100};
+
+    for (int i = 0; i < 50; ++i) {
+        (void)sampler.shouldLog("noisy");
+    }
+
+    auto quiet_first = sampler.shouldLog("quiet");
+    ASSERT_TRUE(quiet_first.has_value());
+    EXPECT_EQ(*quiet_first, 0u);
+}
+
 } // namespace
 } // namespace tracker
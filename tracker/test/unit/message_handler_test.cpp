@@ -13,6 +13,7 @@
 #include <rapidjson/writer.h>
 
 #include <filesystem>
+#include <format>
 #include <fstream>
 #include <memory>
 #include <sstream>
@@ -141,10 +142,36 @@ TEST_F(MessageHandlerTest, HandleMessage_PublishesOutput) {
     mock_client_->simulateMessage("scenescape/data/camera/cam1", payload);
 
     ASSERT_EQ(published_messages.size(), 1);
-    EXPECT_EQ(published_messages[0].first, "scenescape/data/scene/dummy-scene/thing");
+    EXPECT_EQ(published_messages[0].first, "scenescape/data/scene/default-scene/thing");
     EXPECT_EQ(handler.getPublishedCount(), 1);
 }
 
+// Processing a message feeds every pipeline stage histogram once; trace
+// sampling at 1-in-1 exercises the correlated trace-line path alongside
+TEST_F(MessageHandlerTest, HandleMessage_ObservesStageLatencies) {
+    auto metrics = std::make_shared<Metrics>();
+    MessageHandler handler(mock_client_, false, "/scenescape/schema", 0, 1024, 1, 0, "json", 1);
+    handler.setMetrics(metrics);
+    handler.start();
+
+    std::string payload = R"({
+        "id": "cam1",
+        "timestamp": "2026-01-27T12:00:00.000Z",
+        "objects": {
+            "person": [{"id": 1, "bounding_box_px": {"x": 10, "y": 20, "width": 50, "height": 100}}]
+        }
+    })";
+
+    mock_client_->simulateMessage("scenescape/data/camera/cam1", payload);
+
+    EXPECT_EQ(metrics->stageLatency(PipelineStage::Queue).count(), 1u);
+    EXPECT_EQ(metrics->stageLatency(PipelineStage::Parse).count(), 1u);
+    EXPECT_EQ(metrics->stageLatency(PipelineStage::Track).count(), 1u);
+    EXPECT_EQ(metrics->stageLatency(PipelineStage::Serialize).count(), 1u);
+    EXPECT_EQ(metrics->stageLatency(PipelineStage::Publish).count(), 1u);
+    EXPECT_EQ(metrics->publishLatency().count(), 1u);
+}
+
 // Test published output contains required fields
 TEST_F(MessageHandlerTest, PublishedOutput_ContainsRequiredFields) {
     std::string published_payload;
@@ -178,8 +205,8 @@ TEST_F(MessageHandlerTest, PublishedOutput_ContainsRequiredFields) {
     EXPECT_TRUE(doc.HasMember("timestamp"));
     EXPECT_TRUE(doc.HasMember("objects"));
 
-    EXPECT_STREQ(doc["id"].GetString(), MessageHandler::DUMMY_SCENE_ID);
-    EXPECT_STREQ(doc["name"].GetString(), MessageHandler::DUMMY_SCENE_NAME);
+    EXPECT_STREQ(doc["id"].GetString(), MessageHandler::DEFAULT_SCENE_ID);
+    EXPECT_STREQ(doc["name"].GetString(), MessageHandler::DEFAULT_SCENE_NAME);
     EXPECT_TRUE(doc["objects"].IsArray());
 }
 
@@ -315,8 +342,9 @@ TEST_F(MessageHandlerTest, SchemaValidationDisabled_AcceptsValidJson) {
     EXPECT_EQ(handler.getRejectedCount(), 0);
 }
 
-// Test that dummy output contains objects array with expected structure
-TEST_F(MessageHandlerTest, DummyOutput_HasExpectedObjectStructure) {
+// Test that a repeatedly observed detection produces a real track in the
+// output with the expected structure
+TEST_F(MessageHandlerTest, TrackedOutput_HasExpectedObjectStructure) {
     std::string published_payload;
 
     ON_CALL(*mock_client_, publish(_, _))
@@ -327,13 +355,15 @@ TEST_F(MessageHandlerTest, DummyOutput_HasExpectedObjectStructure) {
     MessageHandler handler(mock_client_, false);
     handler.start();
 
-    std::string input_payload = R"({
-        "id": "cam1",
-        "timestamp": "2026-01-27T12:00:00.000Z",
-        "objects": {"person": [{"id": 1, "bounding_box_px": {"x": 0, "y": 0, "width": 10, "height": 20}}]}
-    })";
-
-    mock_client_->simulateMessage("scenescape/data/camera/cam1", input_payload);
+    // A new track stays unreliable (and unpublished) for the first frames, so
+    // feed the same detection across several frames with advancing timestamps
+    for (int frame = 0; frame < 10; ++frame) {
+        std::string input_payload = std::format(
+            R"({{"id": "cam1", "timestamp": "2026-01-27T12:00:{:02d}.000Z",)"
+            R"( "objects": {{"person": [{{"id": 1, "bounding_box_px": {{"x": 0, "y": 0, "width": 10, "height": 20}}}}]}}}})",
+            frame);
+        mock_client_->simulateMessage("scenescape/data/camera/cam1", input_payload);
+    }
 
     rapidjson::Document doc;
     doc.Parse(published_payload.c_str());
@@ -349,7 +379,106 @@ TEST_F(MessageHandlerTest, DummyOutput_HasExpectedObjectStructure) {
     EXPECT_TRUE(obj.HasMember("velocity"));
     EXPECT_TRUE(obj.HasMember("size"));
     EXPECT_TRUE(obj.HasMember("rotation"));
-    EXPECT_STREQ(obj["category"].GetString(), MessageHandler::DUMMY_THING_TYPE);
+    EXPECT_STREQ(obj["category"].GetString(), "person");
+
+    // Track position is the bounding-box center
+    ASSERT_TRUE(obj["translation"].IsArray());
+    EXPECT_NEAR(obj["translation"][0].GetDouble(), 5.0, 1.0);
+    EXPECT_NEAR(obj["translation"][1].GetDouble(), 10.0, 1.0);
+}
+
+// Test that frames within one batch window coalesce into a single scene
+// message, flushed when a frame from the next epoch arrives
+TEST_F(MessageHandlerTest, Batching_CoalescesFramesIntoOnePublish) {
+    std::vector<std::string> published_payloads;
+
+    ON_CALL(*mock_client_, publish(_, _))
+        .WillByDefault(Invoke([&](const std::string& /*topic*/, const std::string& payload) {
+            published_payloads.push_back(payload);
+        }));
+
+    // A 10 s window keeps the timer flusher out of the test; flushing is
+    // driven purely by the frame timestamps below
+    MessageHandler handler(mock_client_, false, "/scenescape/schema", 0, 1024, 1, 10000);
+    handler.start();
+
+    std::string frame_cam1 =
+        R"({"id": "cam1", "timestamp": "2026-01-27T12:00:00.000Z", "objects": {"person": [{"bounding_box_px": {"x": 10, "y": 20, "width": 50, "height": 100}}]}})";
+    std::string frame_cam2 =
+        R"({"id": "cam2", "timestamp": "2026-01-27T12:00:00.000Z", "objects": {"person": [{"bounding_box_px": {"x": 12, "y": 22, "width": 50, "height": 100}}]}})";
+
+    mock_client_->simulateMessage("scenescape/data/camera/cam1", frame_cam1);
+    mock_client_->simulateMessage("scenescape/data/camera/cam2", frame_cam2);
+
+    // Same epoch: both frames are pending, nothing published yet
+    EXPECT_EQ(published_payloads.size(), 0u);
+
+    // A frame from the next epoch closes the window
+    std::string next_epoch =
+        R"({"id": "cam1", "timestamp": "2026-01-27T12:00:20.000Z", "objects": {}})";
+    mock_client_->simulateMessage("scenescape/data/camera/cam1", next_epoch);
+
+    ASSERT_EQ(published_payloads.size(), 1u);
+    EXPECT_EQ(handler.getPublishedCount(), 1);
+
+    rapidjson::Document doc;
+    doc.Parse(published_payloads[0].c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    EXPECT_STREQ(doc["timestamp"].GetString(), "2026-01-27T12:00:00.000Z");
+
+    handler.stop();
+}
+
+// Test that stop() flushes a pending batch instead of dropping it
+TEST_F(MessageHandlerTest, Batching_StopFlushesPendingBatch) {
+    MessageHandler handler(mock_client_, false, "/scenescape/schema", 0, 1024, 1, 10000);
+    handler.start();
+
+    std::string payload =
+        R"({"id": "cam1", "timestamp": "2026-01-27T12:00:00.000Z", "objects": {}})";
+    mock_client_->simulateMessage("scenescape/data/camera/cam1", payload);
+
+    EXPECT_EQ(handler.getPublishedCount(), 0);
+
+    handler.stop();
+
+    EXPECT_EQ(handler.getPublishedCount(), 1);
+}
+
+// Test that the "both" output format publishes JSON on the scene topic and a
+// parseable binary payload on the /bin suffix with the same content
+TEST_F(MessageHandlerTest, BinaryOutput_PublishedOnSuffixedTopic) {
+    std::vector<std::pair<std::string, std::string>> published_messages;
+
+    ON_CALL(*mock_client_, publish(_, _))
+        .WillByDefault(Invoke([&](const std::string& topic, const std::string& payload) {
+            published_messages.emplace_back(topic, payload);
+        }));
+
+    MessageHandler handler(mock_client_, false, "/scenescape/schema", 0, 1024, 1, 0, "both");
+    handler.start();
+
+    for (int frame = 0; frame < 10; ++frame) {
+        std::string input_payload = std::format(
+            R"({{"id": "cam1", "timestamp": "2026-01-27T12:00:{:02d}.000Z",)"
+            R"( "objects": {{"person": [{{"bounding_box_px": {{"x": 0, "y": 0, "width": 10, "height": 20}}}}]}}}})",
+            frame);
+        mock_client_->simulateMessage("scenescape/data/camera/cam1", input_payload);
+    }
+
+    // One JSON and one binary publish per frame
+    ASSERT_EQ(published_messages.size(), 20u);
+    EXPECT_EQ(published_messages[0].first, "scenescape/data/scene/default-scene/thing");
+    EXPECT_EQ(published_messages[1].first, "scenescape/data/scene/default-scene/thing/bin");
+
+    const auto parsed = scene_binary::parse(published_messages.back().second);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->scene_id, MessageHandler::DEFAULT_SCENE_ID);
+    EXPECT_EQ(parsed->timestamp, "2026-01-27T12:00:09.000Z");
+    ASSERT_EQ(parsed->tracks.size(), 1u);
+    EXPECT_EQ(parsed->tracks[0].category, "person");
+    EXPECT_NEAR(parsed->tracks[0].translation[0], 5.0, 1.0);
+    EXPECT_NEAR(parsed->tracks[0].translation[1], 10.0, 1.0);
 }
 
 //
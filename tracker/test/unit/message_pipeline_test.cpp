@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "message_pipeline.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tracker {
+namespace {
+
+/**
+ * @brief Wait until the predicate holds or a timeout expires.
+ */
+template <typename Predicate> bool waitFor(Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+// All messages enqueued before stop() must be processed
+TEST(MessagePipelineTest, ProcessesEveryEnqueuedMessage) {
+    std::atomic<int> processed{0};
+    MessagePipeline pipeline(
+        [&](const std::string&, const std::string&, std::chrono::steady_clock::time_point) {
+            processed++;
+        },
+        4, 256);
+    pipeline.start();
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(pipeline.enqueue("scenescape/data/camera/cam" + std::to_string(i % 8),
+                                     "payload"));
+    }
+    pipeline.stop();
+
+    EXPECT_EQ(processed.load(), 100);
+    EXPECT_EQ(pipeline.getDroppedCount(), 0u);
+}
+
+// Messages from one topic must be processed in the order they arrived, even
+// with many workers
+TEST(MessagePipelineTest, PreservesPerTopicOrdering) {
+    std::mutex mutex;
+    std::map<std::string, std::vector<int>> sequences;
+    MessagePipeline pipeline(
+        [&](const std::string& topic, const std::string& payload,
+            std::chrono::steady_clock::time_point) {
+            std::lock_guard<std::mutex> lock(mutex);
+            sequences[topic].push_back(std::stoi(payload));
+        },
+        8, 4096);
+    pipeline.start();
+
+    for (int i = 0; i < 200; ++i) {
+        for (int cam = 0; cam < 5; ++cam) {
+            pipeline.enqueue("scenescape/data/camera/cam" + std::to_string(cam),
+                             std::to_string(i));
+        }
+    }
+    pipeline.stop();
+
+    ASSERT_EQ(sequences.size(), 5u);
+    for (const auto& [topic, sequence] : sequences) {
+        ASSERT_EQ(sequence.size(), 200u) << topic;
+        for (int i = 0; i < 200; ++i) {
+            EXPECT_EQ(sequence[i], i) << topic;
+        }
+    }
+}
+
+// A full queue drops the incoming message instead of blocking the enqueuer
+TEST(MessagePipelineTest, DropsWhenQueueIsFull) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool release = false;
+
+    MessagePipeline pipeline(
+        [&](const std::string&, const std::string&, std::chrono::steady_clock::time_point) {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&]() { return release; });
+        },
+        1, 2);
+    pipeline.start();
+
+    // First message occupies the worker; two more fill the queue
+    EXPECT_TRUE(pipeline.enqueue("topic", "0"));
+    EXPECT_TRUE(waitFor([&]() { return pipeline.enqueue("topic", "1"); }));
+    EXPECT_TRUE(pipeline.enqueue("topic", "2"));
+    EXPECT_TRUE(waitFor([&]() { return !pipeline.enqueue("topic", "3"); }));
+    EXPECT_GE(pipeline.getDroppedCount(), 1u);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    pipeline.stop();
+}
+
+} // namespace
+} // namespace tracker
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "metrics.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tracker {
+namespace {
+
+using std::chrono::milliseconds;
+
+// Concurrent increments from many threads must never lose a count
+TEST(ShardedCounterTest, CountsAcrossThreads) {
+    ShardedCounter counter;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < 10000; ++i) {
+                counter.increment();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.value(), 80000u);
+}
+
+// Observations land in the right buckets, including the +Inf overflow
+TEST(LatencyHistogramTest, BucketsObservations) {
+    LatencyHistogram histogram;
+
+    histogram.observe(milliseconds(0));  // first bucket (le 1ms)
+    histogram.observe(milliseconds(3));  // le 5ms bucket
+    histogram.observe(milliseconds(3));  // le 5ms bucket
+    histogram.observe(milliseconds(70)); // le 100ms bucket
+    histogram.observe(milliseconds(5000)); // +Inf
+
+    EXPECT_EQ(histogram.count(), 5u);
+    EXPECT_EQ(histogram.bucketCount(0), 1u); // le 1ms
+    EXPECT_EQ(histogram.bucketCount(2), 2u); // le 5ms
+    EXPECT_EQ(histogram.bucketCount(6), 1u); // le 100ms
+    EXPECT_EQ(histogram.bucketCount(LatencyHistogram::BUCKET_COUNT - 1), 1u); // +Inf
+    EXPECT_EQ(histogram.sumMicroseconds(), (3 + 3 + 70 + 5000) * 1000u);
+}
+
+// The same camera id must always resolve to the same stats slot, and the
+// reference must survive other cameras being added
+TEST(MetricsTest, CameraStatsAreStable) {
+    Metrics metrics;
+
+    CameraStats& cam1 = metrics.camera("cam1");
+    cam1.received.increment();
+    metrics.camera("cam2").received.increment();
+    metrics.camera("cam1").received.increment();
+
+    EXPECT_EQ(&cam1, &metrics.camera("cam1"));
+    EXPECT_EQ(cam1.received.value(), 2u);
+    EXPECT_EQ(metrics.camera("cam2").received.value(), 1u);
+}
+
+// Rendered exposition carries per-camera series, the histogram and sampled
+// metrics in Prometheus text format
+TEST(MetricsTest, RendersPrometheusExposition) {
+    Metrics metrics;
+
+    auto& cam = metrics.camera("cam1");
+    cam.received.increment(3);
+    cam.parse_failures.increment();
+    metrics.publishLatency().observe(milliseconds(3));
+    metrics.registerSampledMetric("tracker_pipeline_queue_depth", "Queued messages", "gauge",
+                                  [] { return 7.0; });
+
+    const std::string out = metrics.renderPrometheus();
+
+    EXPECT_NE(out.find("# TYPE tracker_camera_messages_received_total counter"),
+              std::string::npos);
+    EXPECT_NE(out.find("tracker_camera_messages_received_total{camera=\"cam1\"} 3"),
+              std::string::npos);
+    EXPECT_NE(out.find("tracker_camera_parse_failures_total{camera=\"cam1\"} 1"),
+              std::string::npos);
+    EXPECT_NE(out.find("# TYPE tracker_publish_latency_seconds histogram"), std::string::npos);
+    EXPECT_NE(out.find("tracker_publish_latency_seconds_bucket{le=\"+Inf\"} 1"),
+              std::string::npos);
+    EXPECT_NE(out.find("tracker_publish_latency_seconds_count 1"), std::string::npos);
+    EXPECT_NE(out.find("# TYPE tracker_pipeline_queue_depth gauge"), std::string::npos);
+    EXPECT_NE(out.find("tracker_pipeline_queue_depth 7"), std::string::npos);
+}
+
+// Stage latency histograms render as one labelled series per pipeline stage
+TEST(MetricsTest, RendersStageLatencyHistograms) {
+    Metrics metrics;
+    metrics.stageLatency(PipelineStage::Parse).observe(milliseconds(1));
+    metrics.stageLatency(PipelineStage::Track).observe(milliseconds(30));
+    metrics.stageLatency(PipelineStage::Track).observe(milliseconds(2));
+
+    const std::string out = metrics.renderPrometheus();
+
+    EXPECT_NE(out.find("# TYPE tracker_stage_latency_seconds histogram"), std::string::npos);
+    EXPECT_NE(out.find("tracker_stage_latency_seconds_bucket{stage=\"parse\",le=\"+Inf\"} 1"),
+              std::string::npos);
+    EXPECT_NE(out.find("tracker_stage_latency_seconds_bucket{stage=\"track\",le=\"0.002\"} 1"),
+              std::string::npos);
+    EXPECT_NE(out.find("tracker_stage_latency_seconds_count{stage=\"track\"} 2"),
+              std::string::npos);
+    // Unobserved stages still render (empty) series so dashboards see them
+    EXPECT_NE(out.find("tracker_stage_latency_seconds_count{stage=\"publish\"} 0"),
+              std::string::npos);
+}
+
+// Cumulative histogram buckets must be monotonically non-decreasing
+TEST(MetricsTest, HistogramBucketsAreCumulative) {
+    Metrics metrics;
+    metrics.publishLatency().observe(milliseconds(1));
+    metrics.publishLatency().observe(milliseconds(30));
+
+    const std::string out = metrics.renderPrometheus();
+
+    // 1ms lands in the first bucket; 30ms in le=0.05; everything above
+    // accumulates both observations
+    EXPECT_NE(out.find("tracker_publish_latency_seconds_bucket{le=\"0.001\"} 1"),
+              std::string::npos);
+    EXPECT_NE(out.find("tracker_publish_latency_seconds_bucket{le=\"0.05\"} 2"),
+              std::string::npos);
+    EXPECT_NE(out.find("tracker_publish_latency_seconds_bucket{le=\"1\"} 2"), std::string::npos);
+}
+
+} // namespace
+} // namespace tracker
@@ -116,5 +116,36 @@ TEST_F(MqttClientTest, MqttQos_IsAtLeastOnce) {
     EXPECT_EQ(MqttClient::MQTT_QOS, 1);
 }
 
+// =============================================================================
+// IMqttClient default move-publish forwarding
+// =============================================================================
+
+// Implementations (and mocks) that only override the copying publish still
+// receive payloads handed to the move-aware overload
+TEST(IMqttClientTest, MovePublishDefaultsToCopyingOverride) {
+    struct RecordingClient : IMqttClient {
+        void connect() override {}
+        void disconnect(std::chrono::milliseconds) override {}
+        void subscribe(const std::string&) override {}
+        void unsubscribe(const std::string&) override {}
+        void publish(const std::string& topic, const std::string& payload) override {
+            published.emplace_back(topic, payload);
+        }
+        void setMessageCallback(MessageCallback) override {}
+        [[nodiscard]] bool isConnected() const override { return true; }
+        [[nodiscard]] bool isSubscribed() const override { return true; }
+
+        std::vector<std::pair<std::string, std::string>> published;
+    };
+
+    RecordingClient client;
+    IMqttClient& base = client;
+    base.publish("topic/a", std::string("payload"));
+
+    ASSERT_EQ(client.published.size(), 1u);
+    EXPECT_EQ(client.published[0].first, "topic/a");
+    EXPECT_EQ(client.published[0].second, "payload");
+}
+
 } // namespace
 } // namespace tracker
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "publish_queue.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tracker {
+namespace {
+
+// All messages enqueued before stop() must be published, in order
+TEST(PublishQueueTest, PublishesEveryEnqueuedMessageInOrder) {
+    std::mutex mutex;
+    std::vector<std::string> published;
+    PublishQueue queue(
+        [&](const std::string&, std::string payload) {
+            std::lock_guard<std::mutex> lock(mutex);
+            published.push_back(std::move(payload));
+        },
+        256);
+    queue.start();
+
+    for (int i = 0; i < 100; ++i) {
+        queue.enqueue("scenescape/data/scene/default-scene/thing", std::to_string(i));
+    }
+    queue.stop();
+
+    ASSERT_EQ(published.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(published[static_cast<std::size_t>(i)], std::to_string(i));
+    }
+    EXPECT_EQ(queue.getDroppedCount(), 0u);
+}
+
+// A full queue drops the oldest queued message, never blocking the enqueuer
+TEST(PublishQueueTest, DropsOldestWhenFull) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool sink_entered = false;
+    bool release = false;
+    std::vector<std::string> published;
+
+    PublishQueue queue(
+        [&](const std::string&, std::string payload) {
+            std::unique_lock<std::mutex> lock(mutex);
+            sink_entered = true;
+            cv.notify_all();
+            cv.wait(lock, [&]() { return release; });
+            published.push_back(std::move(payload));
+        },
+        2);
+    queue.start();
+
+    // First message occupies the publisher thread
+    queue.enqueue("topic", "0");
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]() { return sink_entered; }));
+    }
+
+    // Two more fill the queue; the next one evicts the oldest ("1")
+    queue.enqueue("topic", "1");
+    queue.enqueue("topic", "2");
+    queue.enqueue("topic", "3");
+    EXPECT_EQ(queue.getDroppedCount(), 1u);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    queue.stop();
+
+    ASSERT_EQ(published.size(), 3u);
+    EXPECT_EQ(published[0], "0");
+    EXPECT_EQ(published[1], "2");
+    EXPECT_EQ(published[2], "3");
+}
+
+} // namespace
+} // namespace tracker
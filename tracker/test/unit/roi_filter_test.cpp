@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "roi_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace tracker {
+namespace {
+
+// Unit square boundary; points inside, outside and beyond the bounding box
+// must all classify correctly
+TEST(RoiFilterTest, ContainsPointsAgainstBoundary) {
+    RoiFilter filter({{0.0, 0.0}, {100.0, 0.0}, {100.0, 100.0}, {0.0, 100.0}});
+
+    EXPECT_TRUE(filter.contains(50.0, 50.0));
+    EXPECT_TRUE(filter.contains(1.0, 99.0));
+    EXPECT_FALSE(filter.contains(150.0, 50.0));  // Outside the bounding box
+    EXPECT_FALSE(filter.contains(-10.0, -10.0)); // Outside the bounding box
+}
+
+// The rasterized occupancy mask is an accelerator, not an approximation: a
+// masked filter must classify every point exactly like the unmasked one,
+// including near the edges of a concave boundary
+TEST(RoiFilterTest, MaskMatchesExactContainment) {
+    const std::vector<std::pair<double, double>> boundary = {
+        {0.0, 0.0}, {100.0, 0.0}, {100.0, 100.0}, {50.0, 40.0}, {0.0, 100.0}};
+    RoiFilter exact(boundary);
+    RoiFilter masked(boundary, 7.0);
+
+    for (double y = -5.0; y <= 105.0; y += 1.3) {
+        for (double x = -5.0; x <= 105.0; x += 1.3) {
+            EXPECT_EQ(masked.contains(x, y), exact.contains(x, y)) << "at (" << x << ", " << y
+                                                                   << ")";
+        }
+    }
+}
+
+// Detections whose foot point (bounding box bottom center) is outside the
+// boundary are dropped; survivors keep their order and emptied categories
+// disappear
+TEST(RoiFilterTest, FilterDropsOutOfBoundaryFootPoints) {
+    RoiFilter filter({{0.0, 0.0}, {100.0, 0.0}, {100.0, 100.0}, {0.0, 100.0}});
+
+    CameraMessage message;
+    message.id = "camera1";
+    // Foot points: (50, 50) inside, (200, 60) outside, (30, 90) inside
+    message.objects["person"] = {{1, {40.0, 30.0, 20.0, 20.0}},
+                                 {2, {190.0, 40.0, 20.0, 20.0}},
+                                 {3, {20.0, 70.0, 20.0, 20.0}}};
+    // Foot point (150, 150) outside; the category empties out
+    message.objects["vehicle"] = {{4, {130.0, 110.0, 40.0, 40.0}}};
+
+    EXPECT_EQ(filter.filterDetections(message), 2u);
+    ASSERT_EQ(message.objects.count("person"), 1u);
+    ASSERT_EQ(message.objects["person"].size(), 2u);
+    EXPECT_EQ(message.objects["person"][0].id, 1);
+    EXPECT_EQ(message.objects["person"][1].id, 3);
+    EXPECT_EQ(message.objects.count("vehicle"), 0u);
+
+    // A second pass over the already-filtered message drops nothing
+    EXPECT_EQ(filter.filterDetections(message), 0u);
+}
+
+// Degenerate boundaries and negative cell sizes are configuration errors
+TEST(RoiFilterTest, RejectsInvalidConfiguration) {
+    EXPECT_THROW(RoiFilter({{0.0, 0.0}, {1.0, 1.0}}), std::invalid_argument);
+    EXPECT_THROW(RoiFilter({{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}}, -1.0), std::invalid_argument);
+}
+
+} // namespace
+} // namespace tracker
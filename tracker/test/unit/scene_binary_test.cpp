@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "scene_binary.hpp"
+
+#include <string>
+#include <vector>
+
+namespace tracker {
+namespace {
+
+scene_binary::TrackRecord makeTrack(std::int64_t id, const std::string& category) {
+    scene_binary::TrackRecord track;
+    track.id = id;
+    track.category = category;
+    track.translation[0] = 1.5;
+    track.translation[1] = -2.25;
+    track.translation[2] = 0.0;
+    track.velocity[0] = 0.5;
+    track.velocity[1] = -0.75;
+    track.velocity[2] = 0.0;
+    track.size[0] = 0.6;
+    track.size[1] = 0.4;
+    track.size[2] = 1.8;
+    track.rotation[0] = 0.0;
+    track.rotation[1] = 0.0;
+    track.rotation[2] = 0.1;
+    track.rotation[3] = 0.99;
+    return track;
+}
+
+// Serialized payloads must parse back to the exact same content
+TEST(SceneBinaryTest, RoundTripPreservesAllFields) {
+    std::vector<scene_binary::TrackRecord> tracks;
+    tracks.push_back(makeTrack(7, "person"));
+    tracks.push_back(makeTrack(42, "vehicle"));
+
+    const std::string payload = scene_binary::serialize(
+        "default-scene", "Default Scene", "2026-01-27T12:00:00.000Z", tracks);
+
+    const auto parsed = scene_binary::parse(payload);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->scene_id, "default-scene");
+    EXPECT_EQ(parsed->scene_name, "Default Scene");
+    EXPECT_EQ(parsed->timestamp, "2026-01-27T12:00:00.000Z");
+    ASSERT_EQ(parsed->tracks.size(), 2u);
+
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+        EXPECT_EQ(parsed->tracks[i].id, tracks[i].id);
+        EXPECT_EQ(parsed->tracks[i].category, tracks[i].category);
+        for (int axis = 0; axis < 3; ++axis) {
+            EXPECT_EQ(parsed->tracks[i].translation[axis], tracks[i].translation[axis]);
+            EXPECT_EQ(parsed->tracks[i].velocity[axis], tracks[i].velocity[axis]);
+            EXPECT_EQ(parsed->tracks[i].size[axis], tracks[i].size[axis]);
+        }
+        for (int axis = 0; axis < 4; ++axis) {
+            EXPECT_EQ(parsed->tracks[i].rotation[axis], tracks[i].rotation[axis]);
+        }
+    }
+}
+
+// A scene without tracks is a valid (and common) payload
+TEST(SceneBinaryTest, RoundTripEmptyScene) {
+    const std::string payload =
+        scene_binary::serialize("scene-a", "Scene A", "2026-01-27T12:00:00.000Z", {});
+
+    const auto parsed = scene_binary::parse(payload);
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ(parsed->scene_id, "scene-a");
+    EXPECT_TRUE(parsed->tracks.empty());
+}
+
+// Truncated payloads must fail to parse, not read out of bounds
+TEST(SceneBinaryTest, RejectsTruncatedPayload) {
+    const std::string payload = scene_binary::serialize(
+        "default-scene", "Default Scene", "2026-01-27T12:00:00.000Z", {makeTrack(1, "person")});
+
+    for (std::size_t length = 0; length < payload.size(); ++length) {
+        EXPECT_FALSE(scene_binary::parse(std::string_view(payload).substr(0, length)).has_value())
+            << "truncation at byte " << length;
+    }
+}
+
+// Payloads without the magic or with an unknown version are rejected
+TEST(SceneBinaryTest, RejectsWrongMagicOrVersion) {
+    std::string payload =
+        scene_binary::serialize("scene-a", "Scene A", "2026-01-27T12:00:00.000Z", {});
+
+    std::string bad_magic = payload;
+    bad_magic[0] = 'X';
+    EXPECT_FALSE(scene_binary::parse(bad_magic).has_value());
+
+    std::string bad_version = payload;
+    bad_version[4] = static_cast<char>(scene_binary::FORMAT_VERSION + 1);
+    EXPECT_FALSE(scene_binary::parse(bad_version).has_value());
+
+    EXPECT_FALSE(scene_binary::parse("not binary at all").has_value());
+}
+
+} // namespace
+} // namespace tracker
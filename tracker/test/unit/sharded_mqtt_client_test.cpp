@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file sharded_mqtt_client_test.cpp
+ * @brief Unit tests for ShardedMqttClient pure/static functions.
+ *
+ * Coverage Strategy:
+ * ------------------
+ * ShardedMqttClient owns real MqttClient shards, which cannot be instantiated
+ * in unit tests (Paho requires a broker endpoint; see mqtt_client_test.cpp).
+ * Only the pure routing helpers are tested here:
+ *   - shardForTopic(): publish routing stability and range
+ *   - makeSharedTopic(): shared-subscription filter syntax
+ *
+ * Connection fan-out and shared-subscription delivery are exercised against a
+ * real broker in the service tests.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sharded_mqtt_client.hpp"
+
+#include <set>
+#include <string>
+
+namespace tracker {
+namespace {
+
+TEST(ShardedMqttClientTest, MakeSharedTopicWrapsFilterInGroupSyntax) {
+    EXPECT_EQ(ShardedMqttClient::makeSharedTopic("scenescape/data/camera/+"),
+              "$share/tracker-ingest/scenescape/data/camera/+");
+}
+
+TEST(ShardedMqttClientTest, ShardForTopicIsStableAndInRange) {
+    const std::string topic = "scenescape/data/scene/warehouse";
+    const std::size_t shard_count = 4;
+
+    const std::size_t first = ShardedMqttClient::shardForTopic(topic, shard_count);
+    EXPECT_LT(first, shard_count);
+    // Repeated lookups for one topic must keep routing to the same shard so
+    // a scene's output stays ordered on one connection
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(ShardedMqttClient::shardForTopic(topic, shard_count), first);
+    }
+}
+
+TEST(ShardedMqttClientTest, SingleShardAlwaysRoutesToZero) {
+    EXPECT_EQ(ShardedMqttClient::shardForTopic("scenescape/data/scene/a", 1), 0u);
+    EXPECT_EQ(ShardedMqttClient::shardForTopic("scenescape/data/scene/b", 0), 0u);
+}
+
+TEST(ShardedMqttClientTest, DistinctTopicsSpreadAcrossShards) {
+    const std::size_t shard_count = 8;
+    std::set<std::size_t> used;
+    for (int i = 0; i < 64; ++i) {
+        used.insert(ShardedMqttClient::shardForTopic("scenescape/data/scene/" + std::to_string(i),
+                                                     shard_count));
+    }
+    // std::hash will not be perfectly uniform, but 64 distinct topics should
+    // land on more than one of 8 shards
+    EXPECT_GT(used.size(), 1u);
+}
+
+} // namespace
+} // namespace tracker
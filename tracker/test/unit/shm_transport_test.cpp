@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "shm_transport.hpp"
+
+#include "logger.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace tracker {
+namespace {
+
+/// Unique segment name per test so parallel runs cannot collide
+std::string uniqueSegmentName() {
+    static std::atomic<int> counter{0};
+    return "/tracker_shm_test_" + std::to_string(getpid()) + "_" + std::to_string(counter++);
+}
+
+template <typename Predicate> bool waitFor(Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+CameraMessage makeMessage(const std::string& camera_id) {
+    CameraMessage message;
+    message.id = camera_id;
+    message.timestamp = std::chrono::system_clock::time_point(std::chrono::microseconds(
+        1700000000123456LL));
+    Detection person;
+    person.id = 7;
+    person.bounding_box_px = {10.5, 20.25, 100.0, 200.0};
+    Detection anonymous;
+    anonymous.bounding_box_px = {1.0, 2.0, 3.0, 4.0};
+    message.objects["person"] = {person, anonymous};
+    message.objects["vehicle"] = {anonymous};
+    return message;
+}
+
+class ShmTransportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Logger::init("error");
+        segment_ = uniqueSegmentName();
+    }
+
+    void TearDown() override {
+        ShmRing::unlink(segment_);
+        ShmRing::unlink(segment_ + "camera1");
+        Logger::shutdown();
+    }
+
+    std::string segment_;
+};
+
+TEST_F(ShmTransportTest, RingRoundTripsRecordsInOrder) {
+    auto producer = ShmRing::create(segment_, 8, 64);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = ShmRing::open(segment_);
+    ASSERT_NE(consumer, nullptr);
+
+    EXPECT_TRUE(producer->tryPush("first"));
+    EXPECT_TRUE(producer->tryPush("second"));
+    EXPECT_EQ(consumer->size(), 2u);
+
+    std::string record;
+    EXPECT_TRUE(consumer->tryPop(record));
+    EXPECT_EQ(record, "first");
+    EXPECT_TRUE(consumer->tryPop(record));
+    EXPECT_EQ(record, "second");
+    EXPECT_FALSE(consumer->tryPop(record));
+}
+
+TEST_F(ShmTransportTest, RingRejectsPushWhenFullAndOversizedRecords) {
+    auto producer = ShmRing::create(segment_, 4, 16);
+    ASSERT_NE(producer, nullptr);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(producer->tryPush("r" + std::to_string(i)));
+    }
+    EXPECT_FALSE(producer->tryPush("overflow"));
+    // Larger than slot_size minus the length prefix
+    EXPECT_FALSE(producer->tryPush(std::string(13, 'x')));
+
+    // Popping one frees a slot again
+    auto consumer = ShmRing::open(segment_);
+    ASSERT_NE(consumer, nullptr);
+    std::string record;
+    EXPECT_TRUE(consumer->tryPop(record));
+    EXPECT_TRUE(producer->tryPush("again"));
+}
+
+TEST_F(ShmTransportTest, RingWrapsAroundPastCapacity) {
+    auto producer = ShmRing::create(segment_, 4, 32);
+    ASSERT_NE(producer, nullptr);
+    auto consumer = ShmRing::open(segment_);
+    ASSERT_NE(consumer, nullptr);
+
+    std::string record;
+    for (int i = 0; i < 25; ++i) {
+        ASSERT_TRUE(producer->tryPush("record-" + std::to_string(i)));
+        ASSERT_TRUE(consumer->tryPop(record));
+        EXPECT_EQ(record, "record-" + std::to_string(i));
+    }
+}
+
+TEST_F(ShmTransportTest, OpenFailsForMissingSegment) {
+    EXPECT_EQ(ShmRing::open(segment_), nullptr);
+}
+
+TEST(DetectionRecordTest, EncodeDecodeRoundTrip) {
+    const auto original = makeMessage("camera1");
+    const auto decoded = detection_record::decode(detection_record::encode(original));
+
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->id, "camera1");
+    EXPECT_EQ(decoded->timestamp, original.timestamp);
+    ASSERT_EQ(decoded->objects.size(), 2u);
+    const auto& people = decoded->objects.at("person");
+    ASSERT_EQ(people.size(), 2u);
+    ASSERT_TRUE(people[0].id.has_value());
+    EXPECT_EQ(*people[0].id, 7);
+    EXPECT_DOUBLE_EQ(people[0].bounding_box_px.x, 10.5);
+    EXPECT_DOUBLE_EQ(people[0].bounding_box_px.height, 200.0);
+    EXPECT_FALSE(people[1].id.has_value());
+    EXPECT_EQ(decoded->objects.at("vehicle").size(), 1u);
+}
+
+TEST(DetectionRecordTest, DecodeRejectsMalformedRecords) {
+    EXPECT_FALSE(detection_record::decode("").has_value());
+    EXPECT_FALSE(detection_record::decode("not a record").has_value());
+
+    auto encoded = detection_record::encode(makeMessage("camera1"));
+    // Truncation anywhere must fail cleanly, never read past the buffer
+    EXPECT_FALSE(
+        detection_record::decode(std::string_view(encoded).substr(0, encoded.size() - 9))
+            .has_value());
+    // Wrong version byte
+    encoded[4] = char(0x7f);
+    EXPECT_FALSE(detection_record::decode(encoded).has_value());
+}
+
+TEST_F(ShmTransportTest, ReaderDeliversDecodedMessages) {
+    // The reader opens segment_prefix + camera id
+    auto producer = ShmRing::create(segment_ + "camera1", 16, 1024);
+    ASSERT_NE(producer, nullptr);
+
+    std::mutex mutex;
+    std::vector<CameraMessage> delivered;
+    ShmDetectionReader reader({"camera1"}, segment_, [&](CameraMessage message) {
+        std::lock_guard<std::mutex> lock(mutex);
+        delivered.push_back(std::move(message));
+    });
+    reader.start();
+
+    ASSERT_TRUE(producer->tryPush(detection_record::encode(makeMessage("camera1"))));
+    ASSERT_TRUE(producer->tryPush("garbage record"));
+    ASSERT_TRUE(producer->tryPush(detection_record::encode(makeMessage("camera1"))));
+
+    EXPECT_TRUE(waitFor([&] { return reader.getDeliveredCount() >= 2; }));
+    EXPECT_TRUE(waitFor([&] { return reader.getDecodeFailureCount() >= 1; }));
+    reader.stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(delivered.size(), 2u);
+    EXPECT_EQ(delivered[0].id, "camera1");
+    EXPECT_NE(delivered[0].received_at.time_since_epoch().count(), 0);
+}
+
+} // namespace
+} // namespace tracker
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "logger.hpp"
+#include "tracking_engine.hpp"
+
+#include <chrono>
+#include <string>
+
+namespace tracker {
+namespace {
+
+using std::chrono::milliseconds;
+
+class TrackingEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override { Logger::init("warn"); }
+    void TearDown() override { Logger::shutdown(); }
+
+    static CameraMessage makeMessage(const std::string& category, double x, double y) {
+        CameraMessage message;
+        message.id = "cam1";
+        Detection detection;
+        detection.bounding_box_px = {x, y, 50.0, 100.0};
+        message.objects[category].push_back(detection);
+        return message;
+    }
+
+    std::chrono::system_clock::time_point start_ = std::chrono::system_clock::now();
+};
+
+// A repeatedly observed object becomes a reliable track at its bbox center
+TEST_F(TrackingEngineTest, RepeatedDetectionBecomesReliableTrack) {
+    TrackingEngine engine;
+
+    std::vector<rv::tracking::TrackedObject> tracks;
+    for (int frame = 0; frame < 10; ++frame) {
+        tracks = engine.trackFrame("scene-a", makeMessage("person", 10.0, 20.0),
+                                   start_ + milliseconds(frame * 66));
+    }
+
+    ASSERT_EQ(tracks.size(), 1u);
+    EXPECT_NEAR(tracks[0].x, 35.0, 1.0); // bbox center x = 10 + 50/2
+    EXPECT_NEAR(tracks[0].y, 70.0, 1.0); // bbox center y = 20 + 100/2
+    EXPECT_EQ(engine.categoryForTrack(tracks[0]), "person");
+}
+
+// A single spurious detection must not produce a reliable track
+TEST_F(TrackingEngineTest, SingleDetectionStaysUnreliable) {
+    TrackingEngine engine;
+
+    auto tracks = engine.trackFrame("scene-a", makeMessage("person", 10.0, 20.0), start_);
+
+    EXPECT_TRUE(tracks.empty());
+}
+
+// Scenes get independent trackers: detections in one scene never show up in
+// another scene's tracks
+TEST_F(TrackingEngineTest, ScenesTrackIndependently) {
+    TrackingEngine engine;
+
+    std::vector<rv::tracking::TrackedObject> tracks_a;
+    std::vector<rv::tracking::TrackedObject> tracks_b;
+    for (int frame = 0; frame < 10; ++frame) {
+        const auto timestamp = start_ + milliseconds(frame * 66);
+        tracks_a = engine.trackFrame("scene-a", makeMessage("person", 10.0, 20.0), timestamp);
+        tracks_b = engine.trackFrame("scene-b", CameraMessage{}, timestamp);
+    }
+
+    EXPECT_EQ(tracks_a.size(), 1u);
+    EXPECT_TRUE(tracks_b.empty());
+}
+
+// Categories keep their classification slots across frames and scenes
+TEST_F(TrackingEngineTest, CategoriesMapBackToNames) {
+    TrackingEngine engine;
+
+    std::vector<rv::tracking::TrackedObject> tracks;
+    for (int frame = 0; frame < 10; ++frame) {
+        CameraMessage message;
+        message.id = "cam1";
+        Detection person;
+        person.bounding_box_px = {0.0, 0.0, 40.0, 80.0};
+        message.objects["person"].push_back(person);
+        Detection vehicle;
+        vehicle.bounding_box_px = {500.0, 500.0, 200.0, 100.0};
+        message.objects["vehicle"].push_back(vehicle);
+        tracks = engine.trackFrame("scene-a", message, start_ + milliseconds(frame * 66));
+    }
+
+    ASSERT_EQ(tracks.size(), 2u);
+    int persons = 0;
+    int vehicles = 0;
+    for (const auto& track : tracks) {
+        const auto category = engine.categoryForTrack(track);
+        persons += category == "person" ? 1 : 0;
+        vehicles += category == "vehicle" ? 1 : 0;
+    }
+    EXPECT_EQ(persons, 1);
+    EXPECT_EQ(vehicles, 1);
+}
+
+} // namespace
+} // namespace tracker
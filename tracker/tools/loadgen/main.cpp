@@ -0,0 +1,417 @@
+// SPDX-FileCopyrightText: 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * @file main.cpp
+ * @brief MQTT replay and load-generation harness for the tracker service.
+ *
+ * Replays a capture of camera JSON messages (one payload per line) against a
+ * running tracker, fanned out over N simulated cameras at a configurable
+ * speed multiplier or fixed rate, and measures receive-to-publish latency by
+ * correlating scene updates back to the messages that caused them.
+ *
+ * Correlation uses the frame timestamp: the tracker carries the camera
+ * message timestamp through to the published scene update verbatim, so the
+ * harness rewrites every outgoing message with a globally unique
+ * millisecond timestamp and matches scene updates on it. With batching
+ * enabled on the tracker only the latest frame of each window surfaces in
+ * the output, which the report shows as a lower match rate.
+ *
+ * The harness publishes and subscribes through the production MqttClient so
+ * queueing, QoS and reconnect behavior match the service.
+ *
+ * Typical run:
+ *   tracker_loadgen --host localhost --port 1883 --capture frames.jsonl \
+ *       --cameras 8 --rate 120 --duration 30
+ */
+
+#include "config_loader.hpp"
+#include "iso8601.hpp"
+#include "logger.hpp"
+#include "mqtt_client.hpp"
+
+#include <CLI/CLI.hpp>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using std::chrono::steady_clock;
+
+constexpr const char* SCENE_TOPIC_FILTER = "scenescape/data/scene/+/+";
+
+struct LoadgenOptions {
+    std::string host = "localhost";
+    int port = 1883;
+    std::string capture_path;
+    std::string topic_prefix = "scenescape/data/camera/";
+    std::string camera_prefix = "loadgen-cam-";
+    int cameras = 1;
+    double speed = 1.0;   ///< Multiplier on capture pacing; ignored when rate > 0
+    double rate = 0.0;    ///< Messages/s per camera; 0 paces from capture timestamps
+    double duration = 0.0; ///< Seconds to run; 0 replays the capture once
+    int drain_ms = 2000;  ///< Grace period for trailing scene updates
+    int publish_qos = 1;
+};
+
+/**
+ * @brief One capture entry: the parsed payload plus its original timestamp
+ *        for pacing.
+ */
+struct CaptureFrame {
+    std::string payload;
+    std::chrono::system_clock::time_point timestamp;
+    bool has_timestamp = false;
+};
+
+/**
+ * @brief Matches scene updates back to sent messages and collects latency.
+ *
+ * Thread-safe: sender threads record, the MQTT callback thread matches.
+ */
+class LatencyRecorder {
+public:
+    void recordSent(const std::string& correlation_id, steady_clock::time_point sent_at) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_[correlation_id].push_back(sent_at);
+    }
+
+    void onSceneMessage(const std::string& payload) {
+        rapidjson::Document doc;
+        doc.Parse(payload.c_str(), payload.size());
+        if (doc.HasParseError() || !doc.IsObject() || !doc.HasMember("timestamp") ||
+            !doc["timestamp"].IsString()) {
+            return; // binary topic or unrelated traffic
+        }
+        const auto received_at = steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        scene_messages_++;
+        auto it = pending_.find(doc["timestamp"].GetString());
+        if (it == pending_.end() || it->second.empty()) {
+            unmatched_++;
+            return;
+        }
+        samples_.push_back(received_at - it->second.front());
+        it->second.pop_front();
+        if (it->second.empty()) {
+            pending_.erase(it);
+        }
+    }
+
+    [[nodiscard]] std::vector<steady_clock::duration> takeSamples() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::move(samples_);
+    }
+
+    [[nodiscard]] std::size_t getSceneMessageCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return scene_messages_;
+    }
+
+    [[nodiscard]] std::size_t getUnmatchedCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return unmatched_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    /// Send times per correlation id, FIFO when ids repeat
+    std::unordered_map<std::string, std::deque<steady_clock::time_point>> pending_;
+    std::vector<steady_clock::duration> samples_;
+    std::size_t scene_messages_ = 0;
+    std::size_t unmatched_ = 0;
+};
+
+/// Globally unique millisecond timestamps used as correlation ids
+class CorrelationClock {
+public:
+    CorrelationClock() : base_(std::chrono::system_clock::now()) {}
+
+    std::chrono::system_clock::time_point next() {
+        return base_ + std::chrono::milliseconds(sequence_.fetch_add(1));
+    }
+
+private:
+    std::chrono::system_clock::time_point base_;
+    std::atomic<std::int64_t> sequence_{0};
+};
+
+std::vector<CaptureFrame> loadCapture(const std::string& path) {
+    std::ifstream input(path);
+    if (!input) {
+        throw std::runtime_error("Cannot open capture file: " + path);
+    }
+
+    std::vector<CaptureFrame> frames;
+    std::string line;
+    std::size_t line_number = 0;
+    while (std::getline(input, line)) {
+        ++line_number;
+        if (line.empty()) {
+            continue;
+        }
+        rapidjson::Document doc;
+        doc.Parse(line.c_str(), line.size());
+        if (doc.HasParseError() || !doc.IsObject()) {
+            std::cerr << "Skipping unparseable capture line " << line_number << "\n";
+            continue;
+        }
+        CaptureFrame frame;
+        frame.payload = line;
+        if (doc.HasMember("timestamp") && doc["timestamp"].IsString()) {
+            if (auto parsed = tracker::iso8601::parse(doc["timestamp"].GetString())) {
+                frame.timestamp = *parsed;
+                frame.has_timestamp = true;
+            }
+        }
+        frames.push_back(std::move(frame));
+    }
+    if (frames.empty()) {
+        throw std::runtime_error("Capture file holds no usable messages: " + path);
+    }
+    return frames;
+}
+
+/// Rewrite a capture payload with the simulated camera id and the
+/// correlation timestamp
+std::string rewritePayload(const std::string& payload, const std::string& camera_id,
+                           const std::string& timestamp_iso) {
+    rapidjson::Document doc;
+    doc.Parse(payload.c_str(), payload.size());
+    rapidjson::Value id_value(camera_id.c_str(), doc.GetAllocator());
+    if (doc.HasMember("id")) {
+        doc["id"] = id_value;
+    } else {
+        doc.AddMember("id", id_value, doc.GetAllocator());
+    }
+    rapidjson::Value ts_value(timestamp_iso.c_str(), doc.GetAllocator());
+    if (doc.HasMember("timestamp")) {
+        doc["timestamp"] = ts_value;
+    } else {
+        doc.AddMember("timestamp", ts_value, doc.GetAllocator());
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
+/// Inter-frame gap for pacing: fixed rate wins, then capture timestamps
+/// scaled by the speed multiplier, then a 100 ms default
+steady_clock::duration frameGap(const LoadgenOptions& options,
+                                const std::vector<CaptureFrame>& frames, std::size_t index) {
+    using namespace std::chrono;
+    if (options.rate > 0.0) {
+        return duration_cast<steady_clock::duration>(duration<double>(1.0 / options.rate));
+    }
+    const auto& current = frames[index % frames.size()];
+    const auto& next = frames[(index + 1) % frames.size()];
+    if (options.speed > 0.0 && current.has_timestamp && next.has_timestamp &&
+        next.timestamp > current.timestamp) {
+        return duration_cast<steady_clock::duration>((next.timestamp - current.timestamp) /
+                                                     options.speed);
+    }
+    return milliseconds(100);
+}
+
+void senderLoop(const LoadgenOptions& options, const std::vector<CaptureFrame>& frames,
+                const std::string& camera_id, tracker::MqttClient& client,
+                CorrelationClock& correlation_clock, LatencyRecorder& recorder,
+                std::atomic<bool>& stop, std::atomic<std::size_t>& sent_count) {
+    const std::string topic = options.topic_prefix + camera_id;
+    tracker::iso8601::Formatter formatter;
+    const auto run_deadline =
+        options.duration > 0.0
+            ? steady_clock::now() + std::chrono::duration_cast<steady_clock::duration>(
+                                        std::chrono::duration<double>(options.duration))
+            : steady_clock::time_point::max();
+
+    auto next_send = steady_clock::now();
+    std::size_t index = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+        if (steady_clock::now() >= run_deadline) {
+            break;
+        }
+        if (options.duration <= 0.0 && index >= frames.size()) {
+            break; // single pass through the capture
+        }
+
+        const auto correlation_ts = correlation_clock.next();
+        const std::string timestamp_iso = formatter.format(correlation_ts);
+        std::string payload =
+            rewritePayload(frames[index % frames.size()].payload, camera_id, timestamp_iso);
+
+        recorder.recordSent(timestamp_iso, steady_clock::now());
+        client.publish(topic, payload);
+        sent_count.fetch_add(1, std::memory_order_relaxed);
+
+        next_send += frameGap(options, frames, index);
+        ++index;
+        std::this_thread::sleep_until(next_send);
+    }
+}
+
+/// Nearest-rank percentile over a sorted sample vector
+double percentileMs(const std::vector<steady_clock::duration>& sorted, double percentile) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const auto rank = static_cast<std::size_t>(percentile / 100.0 * sorted.size());
+    const auto& value = sorted[std::min(rank, sorted.size() - 1)];
+    return std::chrono::duration<double, std::milli>(value).count();
+}
+
+void printReport(const LoadgenOptions& options, std::size_t sent, double elapsed_s,
+                 LatencyRecorder& recorder) {
+    auto samples = recorder.takeSamples();
+    std::sort(samples.begin(), samples.end());
+
+    std::cout << std::format("\n--- tracker loadgen report ---\n");
+    std::cout << std::format("cameras:            {}\n", options.cameras);
+    std::cout << std::format("messages sent:      {}\n", sent);
+    std::cout << std::format("scene updates seen: {}\n", recorder.getSceneMessageCount());
+    std::cout << std::format("matched samples:    {}\n", samples.size());
+    std::cout << std::format("unmatched updates:  {}\n", recorder.getUnmatchedCount());
+    std::cout << std::format("elapsed:            {:.1f} s\n", elapsed_s);
+    if (elapsed_s > 0.0) {
+        std::cout << std::format("send throughput:    {:.1f} msg/s\n", sent / elapsed_s);
+    }
+    if (!samples.empty()) {
+        double sum_ms = 0.0;
+        for (const auto& sample : samples) {
+            sum_ms += std::chrono::duration<double, std::milli>(sample).count();
+        }
+        std::cout << std::format("latency mean:       {:.2f} ms\n", sum_ms / samples.size());
+        std::cout << std::format("latency p50:        {:.2f} ms\n", percentileMs(samples, 50.0));
+        std::cout << std::format("latency p90:        {:.2f} ms\n", percentileMs(samples, 90.0));
+        std::cout << std::format("latency p99:        {:.2f} ms\n", percentileMs(samples, 99.0));
+        std::cout << std::format("latency max:        {:.2f} ms\n",
+                                 percentileMs(samples, 100.0));
+    } else {
+        std::cout << "no latency samples matched; is the tracker running and publishing?\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    LoadgenOptions options;
+
+    CLI::App app{"Tracker load generator: replays camera captures over MQTT and reports "
+                 "receive-to-publish latency"};
+    app.add_option("--host", options.host, "MQTT broker host")->default_val("localhost");
+    app.add_option("--port", options.port, "MQTT broker port")
+        ->check(CLI::Range(1, 65535))
+        ->default_val(1883);
+    app.add_option("--capture", options.capture_path,
+                   "Capture file: one camera JSON payload per line")
+        ->required()
+        ->check(CLI::ExistingFile);
+    app.add_option("--cameras", options.cameras, "Simulated camera fan-out")
+        ->check(CLI::Range(1, 1024))
+        ->default_val(1);
+    app.add_option("--speed", options.speed,
+                   "Speed multiplier on capture timestamps (ignored with --rate)")
+        ->default_val(1.0);
+    app.add_option("--rate", options.rate, "Fixed messages/s per camera (0 = pace from capture)")
+        ->default_val(0.0);
+    app.add_option("--duration", options.duration,
+                   "Seconds to run, looping the capture (0 = one pass)")
+        ->default_val(0.0);
+    app.add_option("--drain-ms", options.drain_ms,
+                   "Wait after sending for trailing scene updates")
+        ->default_val(2000);
+    app.add_option("--qos", options.publish_qos, "Publish QoS")
+        ->check(CLI::Range(0, 2))
+        ->default_val(1);
+    app.add_option("--topic-prefix", options.topic_prefix, "Camera topic prefix")
+        ->default_val("scenescape/data/camera/");
+    CLI11_PARSE(app, argc, argv);
+
+    tracker::Logger::init("warning");
+
+    int exit_code = 0;
+    try {
+        const auto frames = loadCapture(options.capture_path);
+
+        tracker::MqttConfig mqtt_config;
+        mqtt_config.host = options.host;
+        mqtt_config.port = options.port;
+        mqtt_config.insecure = true;
+        mqtt_config.publish_qos = options.publish_qos;
+        // Size the queue so the harness, not the tool's own queue, is the
+        // bottleneck under test
+        mqtt_config.publish_queue_capacity = 65536;
+
+        tracker::MqttClient client(mqtt_config, 5, "-loadgen");
+        LatencyRecorder recorder;
+        client.setMessageCallback([&recorder](const std::string&, std::string payload) {
+            recorder.onSceneMessage(payload);
+        });
+        client.connect();
+
+        const auto connect_deadline = steady_clock::now() + std::chrono::seconds(10);
+        while (!client.isConnected()) {
+            if (steady_clock::now() > connect_deadline) {
+                throw std::runtime_error("Timed out connecting to " + options.host + ":" +
+                                         std::to_string(options.port));
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        client.subscribe(SCENE_TOPIC_FILTER);
+
+        CorrelationClock correlation_clock;
+        std::atomic<bool> stop{false};
+        std::atomic<std::size_t> sent_count{0};
+
+        std::cout << std::format("Replaying {} frame(s) over {} camera(s) to {}:{}...\n",
+                                 frames.size(), options.cameras, options.host, options.port);
+        const auto started = steady_clock::now();
+
+        std::vector<std::thread> senders;
+        senders.reserve(static_cast<std::size_t>(options.cameras));
+        for (int i = 0; i < options.cameras; ++i) {
+            senders.emplace_back(senderLoop, std::cref(options), std::cref(frames),
+                                 options.camera_prefix + std::to_string(i), std::ref(client),
+                                 std::ref(correlation_clock), std::ref(recorder), std::ref(stop),
+                                 std::ref(sent_count));
+        }
+        for (auto& sender : senders) {
+            sender.join();
+        }
+
+        // Let in-flight messages and their scene updates land
+        std::this_thread::sleep_for(std::chrono::milliseconds(options.drain_ms));
+        const double elapsed_s =
+            std::chrono::duration<double>(steady_clock::now() - started).count() -
+            options.drain_ms / 1000.0;
+
+        client.unsubscribe(SCENE_TOPIC_FILTER);
+        client.disconnect();
+
+        printReport(options, sent_count.load(), elapsed_s, recorder);
+    } catch (const std::exception& e) {
+        std::cerr << "loadgen failed: " << e.what() << "\n";
+        exit_code = 1;
+    }
+
+    tracker::Logger::shutdown();
+    return exit_code;
+}